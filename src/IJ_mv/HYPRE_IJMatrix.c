@@ -463,6 +463,9 @@ HYPRE_IJMatrixSetValues2( HYPRE_IJMatrix       matrix,
       }
    }
 
+   /* Values of an assembled matrix may have changed: drop stale SELL copies */
+   hypre_ParCSRMatrixRefreshMatvecFormat((hypre_ParCSRMatrix *) hypre_IJMatrixObject(ijmatrix));
+
    return hypre_error_flag;
 }
 
@@ -481,7 +484,8 @@ HYPRE_IJMatrixSetConstantValues( HYPRE_IJMatrix matrix, HYPRE_Complex value)
 
    if ( hypre_IJMatrixObjectType(ijmatrix) == HYPRE_PARCSR )
    {
-      return ( hypre_IJMatrixSetConstantValuesParCSR( ijmatrix, value));
+      hypre_IJMatrixSetConstantValuesParCSR( ijmatrix, value);
+      hypre_ParCSRMatrixRefreshMatvecFormat((hypre_ParCSRMatrix *) hypre_IJMatrixObject(ijmatrix));
    }
    else
    {
@@ -671,6 +675,9 @@ HYPRE_IJMatrixAddToValues2( HYPRE_IJMatrix       matrix,
       }
    }
 
+   /* Values of an assembled matrix may have changed: drop stale SELL copies */
+   hypre_ParCSRMatrixRefreshMatvecFormat((hypre_ParCSRMatrix *) hypre_IJMatrixObject(ijmatrix));
+
    return hypre_error_flag;
 }
 
@@ -695,13 +702,16 @@ HYPRE_IJMatrixAssemble( HYPRE_IJMatrix matrix )
 
       if (exec == HYPRE_EXEC_DEVICE)
       {
-         return ( hypre_IJMatrixAssembleParCSRDevice( ijmatrix ) );
+         hypre_IJMatrixAssembleParCSRDevice( ijmatrix );
       }
       else
 #endif
       {
-         return ( hypre_IJMatrixAssembleParCSR( ijmatrix ) );
+         hypre_IJMatrixAssembleParCSR( ijmatrix );
       }
+
+      /* Drop SELL copies built from the values before this assembly */
+      hypre_ParCSRMatrixRefreshMatvecFormat((hypre_ParCSRMatrix *) hypre_IJMatrixObject(ijmatrix));
    }
    else
    {
@@ -1048,7 +1058,8 @@ HYPRE_IJMatrixReadBinary( const char     *filename,
  * HYPRE_IJMatrixReadMM
  *
  * Reads matrix-market data from file in ASCII format and creates an
- * IJMatrix on host memory.
+ * IJMatrix on host memory. The file is read by all ranks in parallel,
+ * see hypre_IJMatrixReadMM.
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int
@@ -1057,7 +1068,7 @@ HYPRE_IJMatrixReadMM( const char     *filename,
                       HYPRE_Int       type,
                       HYPRE_IJMatrix *matrix_ptr )
 {
-   hypre_IJMatrixRead(filename, comm, type, matrix_ptr, 1);
+   hypre_IJMatrixReadMM(filename, comm, type, matrix_ptr);
 
    return hypre_error_flag;
 }
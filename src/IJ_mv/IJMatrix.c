@@ -242,6 +242,498 @@ hypre_IJMatrixRead( const char     *filename,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixMMOwner
+ *
+ * Rank owning global index i in the uniform partitioning of n indices
+ * among num_procs ranks (see hypre_GenerateLocalPartitioning).
+ *--------------------------------------------------------------------------*/
+
+static inline HYPRE_Int
+hypre_IJMatrixMMOwner( HYPRE_BigInt i,
+                       HYPRE_BigInt n,
+                       HYPRE_Int    num_procs )
+{
+   HYPRE_BigInt size = n / (HYPRE_BigInt) num_procs;
+   HYPRE_BigInt rest = n - size * (HYPRE_BigInt) num_procs;
+
+   if (i < rest * (size + 1))
+   {
+      return (HYPRE_Int) (i / (size + 1));
+   }
+
+   return (HYPRE_Int) (rest + (i - rest * (size + 1)) / size);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixMMLineStart
+ *
+ * First position at or after pos that begins a line of the entries section
+ * [first, size) of a mapped file.
+ *--------------------------------------------------------------------------*/
+
+static inline size_t
+hypre_IJMatrixMMLineStart( const char *data,
+                           size_t      first,
+                           size_t      size,
+                           size_t      pos )
+{
+   while (pos > first && pos < size && data[pos - 1] != '\n')
+   {
+      pos++;
+   }
+
+   return pos;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixReadMM
+ *
+ * Reads a matrix from a Matrix Market file in parallel. Rank 0 reads the
+ * banner and the size line; the file is then mapped into memory on every
+ * rank and each one parses an equal share of the entries section, cut at
+ * line boundaries. Rows and columns are distributed uniformly, entries are
+ * sent to the rank owning their row, and each rank assembles its rows with
+ * their sizes known in advance. The resulting IJMatrix is stored on host
+ * memory. Entries repeated in the file are not summed.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixReadMM( const char     *filename,
+                      MPI_Comm        comm,
+                      HYPRE_Int       type,
+                      HYPRE_IJMatrix *matrix_ptr )
+{
+   HYPRE_IJMatrix               matrix;
+   hypre_DataExchangeResponse   response_obj;
+   hypre_ProcListElements       send_proc_obj;
+
+   /* Header info: error, symmetric, rows, columns, entries, data offset */
+   HYPRE_BigInt                 info[6];
+
+   /* File range */
+   char                        *data = NULL;
+   size_t                       size = 0, first, begin, end, pos;
+   const char                  *p, *q, *pend;
+
+   /* Entries parsed by this rank */
+   HYPRE_Int                    num_entries, max_entries;
+   HYPRE_BigInt                *ent_i, *ent_j;
+   HYPRE_Complex               *ent_data;
+   HYPRE_Int                   *ent_proc;
+
+   /* Exchange buffers */
+   HYPRE_Int                    obj_size_bytes;
+   HYPRE_Int                   *proc_counts, *proc_starts;
+   HYPRE_Int                    num_contacts, *contact_procs, *contact_starts;
+   char                        *send_buf;
+   void                        *response_buf = NULL;
+   HYPRE_Int                   *response_buf_starts = NULL;
+   HYPRE_Int                   *recv_order;
+   HYPRE_Int                    num_sent, num_srcs, *src_counts;
+   char                       **src_bufs;
+
+   /* Local rows */
+   HYPRE_BigInt                 nrow, ncol, row_part[2], col_part[2];
+   HYPRE_Int                    num_rows, nnz_local;
+   HYPRE_Int                   *row_sizes, *row_starts, *diag_sizes, *offd_sizes;
+   HYPRE_BigInt                *rows, *cols;
+   HYPRE_Complex               *vals;
+
+   HYPRE_Int                    myid, num_procs, is_sym, ierr;
+   HYPRE_Int                    i, k, m, proc, cnt, src;
+   HYPRE_BigInt                 I, J;
+   HYPRE_Real                   value;
+   char                        *obj;
+
+   hypre_MPI_Comm_rank(comm, &myid);
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   /*-----------------------------------------------------------------------
+    * Banner and size line
+    *-----------------------------------------------------------------------*/
+
+   if (myid == 0)
+   {
+      MM_typecode  matcode;
+      char         line[MM_MAX_LINE_LENGTH];
+      FILE        *file;
+
+      hypre_Memset(info, 0, 6 * sizeof(HYPRE_BigInt), HYPRE_MEMORY_HOST);
+      if ((file = fopen(filename, "r")) == NULL)
+      {
+         info[0] = 1;
+      }
+      else
+      {
+         if (hypre_mm_read_banner(file, &matcode) != 0)
+         {
+            info[0] = 2;
+         }
+         else if ( !hypre_mm_is_valid(matcode) ||
+                   !( (hypre_mm_is_real(matcode) || hypre_mm_is_integer(matcode)) &&
+                      hypre_mm_is_coordinate(matcode) && hypre_mm_is_sparse(matcode) ) )
+         {
+            info[0] = 3;
+         }
+         else
+         {
+            info[1] = hypre_mm_is_symmetric(matcode) ? 1 : 0;
+
+            /* skip comments and blank lines */
+            do
+            {
+               if (fgets(line, MM_MAX_LINE_LENGTH, file) == NULL)
+               {
+                  info[0] = 4;
+                  break;
+               }
+               for (p = line; *p == ' ' || *p == '\t' || *p == '\r'; p++);
+            }
+            while (*p == '%' || *p == '\n' || *p == '\0');
+
+            if (!info[0])
+            {
+               pend = line + strlen(line);
+               if (!(p = hypre_mm_parse_index(line, pend, &info[2])) ||
+                   !(p = hypre_mm_parse_index(p, pend, &info[3])) ||
+                   !(p = hypre_mm_parse_index(p, pend, &info[4])))
+               {
+                  info[0] = 4;
+               }
+               info[5] = (HYPRE_BigInt) ftell(file);
+            }
+         }
+         fclose(file);
+      }
+   }
+   hypre_MPI_Bcast(info, 6, HYPRE_MPI_BIG_INT, 0, comm);
+
+   switch (info[0])
+   {
+      case 1:
+         hypre_error_in_arg(1);
+         return hypre_error_flag;
+
+      case 2:
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Could not process Matrix Market banner.");
+         return hypre_error_flag;
+
+      case 3:
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                           "Only sparse real-valued/integer coordinate matrices are supported");
+         return hypre_error_flag;
+
+      case 4:
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "MM read size error !");
+         return hypre_error_flag;
+   }
+
+   is_sym = (HYPRE_Int) info[1];
+   nrow   = info[2];
+   ncol   = info[3];
+
+   /*-----------------------------------------------------------------------
+    * Parse the entries of this rank's byte range
+    *-----------------------------------------------------------------------*/
+
+   ierr = (hypre_mm_map_file(filename, &data, &size) != 0);
+   hypre_MPI_Allreduce(MPI_IN_PLACE, &ierr, 1, HYPRE_MPI_INT, hypre_MPI_MAX, comm);
+   if (ierr)
+   {
+      hypre_mm_unmap_file(data, size);
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Could not map Matrix Market file.");
+      return hypre_error_flag;
+   }
+
+   first = hypre_min((size_t) info[5], size);
+   pos   = (size - first) / (size_t) num_procs;
+   begin = hypre_IJMatrixMMLineStart(data, first, size, first + pos * (size_t) myid);
+   end   = (myid == num_procs - 1) ? size :
+           hypre_IJMatrixMMLineStart(data, first, size, first + pos * (size_t) (myid + 1));
+
+   /* upper bound for the number of entries */
+   max_entries = 1;
+   for (p = data + begin, pend = data + end;
+        p < pend && (q = (const char *) memchr(p, '\n', (size_t) (pend - p))) != NULL;
+        p = q + 1)
+   {
+      max_entries++;
+   }
+   max_entries *= (is_sym ? 2 : 1);
+
+   ent_i    = hypre_TAlloc(HYPRE_BigInt,  max_entries, HYPRE_MEMORY_HOST);
+   ent_j    = hypre_TAlloc(HYPRE_BigInt,  max_entries, HYPRE_MEMORY_HOST);
+   ent_data = hypre_TAlloc(HYPRE_Complex, max_entries, HYPRE_MEMORY_HOST);
+   ent_proc = hypre_TAlloc(HYPRE_Int,     max_entries, HYPRE_MEMORY_HOST);
+
+   num_entries = 0;
+   for (p = data + begin, pend = data + end; p < pend; p = q)
+   {
+      /* skip blank and comment lines */
+      while (p < pend && (*p == ' ' || *p == '\t' || *p == '\r'))
+      {
+         p++;
+      }
+      if (p == pend)
+      {
+         break;
+      }
+      if (*p == '\n' || *p == '%')
+      {
+         q = (const char *) memchr(p, '\n', (size_t) (pend - p));
+         q = q ? q + 1 : pend;
+         continue;
+      }
+
+      if (!(q = hypre_mm_parse_index(p, pend, &I)) ||
+          !(q = hypre_mm_parse_index(q, pend, &J)) ||
+          !(q = hypre_mm_parse_real(q, pend, &value)) ||
+          I < 1 || I > nrow || J < 1 || J > ncol)
+      {
+         ierr = 1;
+         break;
+      }
+
+      /* move to the next line */
+      q = (const char *) memchr(q, '\n', (size_t) (pend - q));
+      q = q ? q + 1 : pend;
+
+      I--;
+      J--;
+      ent_i[num_entries]    = I;
+      ent_j[num_entries]    = J;
+      ent_data[num_entries] = (HYPRE_Complex) value;
+      ent_proc[num_entries] = hypre_IJMatrixMMOwner(I, nrow, num_procs);
+      num_entries++;
+
+      if (is_sym && I != J)
+      {
+         ent_i[num_entries]    = J;
+         ent_j[num_entries]    = I;
+         ent_data[num_entries] = (HYPRE_Complex) value;
+         ent_proc[num_entries] = hypre_IJMatrixMMOwner(J, nrow, num_procs);
+         num_entries++;
+      }
+   }
+   hypre_mm_unmap_file(data, size);
+
+   hypre_MPI_Allreduce(MPI_IN_PLACE, &ierr, 1, HYPRE_MPI_INT, hypre_MPI_MAX, comm);
+   if (ierr)
+   {
+      hypre_TFree(ent_i, HYPRE_MEMORY_HOST);
+      hypre_TFree(ent_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(ent_data, HYPRE_MEMORY_HOST);
+      hypre_TFree(ent_proc, HYPRE_MEMORY_HOST);
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error in MM matrix input file.");
+      return hypre_error_flag;
+   }
+
+   /*-----------------------------------------------------------------------
+    * Send the entries to the owners of their rows. Each entry is packed as
+    * three objects (row, column, value), with the entries kept by this rank
+    * placed after those sent to the other ranks.
+    *-----------------------------------------------------------------------*/
+
+   obj_size_bytes = hypre_max(sizeof(HYPRE_BigInt), sizeof(HYPRE_Complex));
+
+   proc_counts = hypre_CTAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+   proc_starts = hypre_TAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+   for (k = 0; k < num_entries; k++)
+   {
+      proc_counts[ent_proc[k]]++;
+   }
+
+   num_contacts   = 0;
+   contact_procs  = hypre_TAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+   contact_starts = hypre_TAlloc(HYPRE_Int, num_procs + 1, HYPRE_MEMORY_HOST);
+   contact_starts[0] = 0;
+   for (proc = 0, cnt = 0; proc < num_procs; proc++)
+   {
+      if (proc != myid && proc_counts[proc])
+      {
+         proc_starts[proc] = cnt;
+         cnt += proc_counts[proc];
+         contact_procs[num_contacts++]  = proc;
+         contact_starts[num_contacts] = 3 * cnt;
+      }
+   }
+   proc_starts[myid] = num_sent = cnt;
+
+   send_buf = hypre_TAlloc(char, (size_t) 3 * num_entries * obj_size_bytes, HYPRE_MEMORY_HOST);
+   for (k = 0; k < num_entries; k++)
+   {
+      obj = send_buf + (size_t) 3 * proc_starts[ent_proc[k]]++ * obj_size_bytes;
+      hypre_TMemcpy(obj, &ent_i[k], HYPRE_BigInt, 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(obj + obj_size_bytes, &ent_j[k], HYPRE_BigInt, 1,
+                    HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(obj + 2 * obj_size_bytes, &ent_data[k], HYPRE_Complex, 1,
+                    HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   }
+   hypre_TFree(ent_i, HYPRE_MEMORY_HOST);
+   hypre_TFree(ent_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(ent_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(ent_proc, HYPRE_MEMORY_HOST);
+
+   /* received entries are appended to send_proc_obj, no response is sent */
+   send_proc_obj.length                 = 0;
+   send_proc_obj.storage_length         = 10;
+   send_proc_obj.id                     = hypre_CTAlloc(HYPRE_Int, send_proc_obj.storage_length + 1,
+                                                        HYPRE_MEMORY_HOST);
+   send_proc_obj.vec_starts             = hypre_CTAlloc(HYPRE_Int, send_proc_obj.storage_length + 1,
+                                                        HYPRE_MEMORY_HOST);
+   send_proc_obj.element_storage_length = 3 * proc_counts[myid] + 100;
+   send_proc_obj.v_elements             = hypre_TAlloc(char, (size_t) obj_size_bytes *
+                                                       send_proc_obj.element_storage_length,
+                                                       HYPRE_MEMORY_HOST);
+
+   response_obj.fill_response = hypre_FillResponseIJOffProcVals;
+   response_obj.data1         = NULL;
+   response_obj.data2         = &send_proc_obj;
+
+   hypre_DataExchangeList(num_contacts, contact_procs,
+                          send_buf, contact_starts, obj_size_bytes,
+                          0, &response_obj, 0, 1,
+                          comm, &response_buf, &response_buf_starts);
+
+   hypre_TFree(response_buf, HYPRE_MEMORY_HOST);
+   hypre_TFree(response_buf_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(contact_procs, HYPRE_MEMORY_HOST);
+   hypre_TFree(contact_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(proc_starts, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Sort the local entries by row, taking the sources in rank order so
+    * that the result does not depend on the order of the messages
+    *-----------------------------------------------------------------------*/
+
+   row_part[0] = 0;
+   col_part[0] = 0;
+   for (proc = 0; proc < myid; proc++)
+   {
+      row_part[0] += nrow / num_procs + (proc < nrow % num_procs ? 1 : 0);
+      col_part[0] += ncol / num_procs + (proc < ncol % num_procs ? 1 : 0);
+   }
+   row_part[1] = row_part[0] + nrow / num_procs + (myid < nrow % num_procs ? 1 : 0);
+   col_part[1] = col_part[0] + ncol / num_procs + (myid < ncol % num_procs ? 1 : 0);
+   num_rows    = (HYPRE_Int) (row_part[1] - row_part[0]);
+
+   recv_order = hypre_TAlloc(HYPRE_Int, send_proc_obj.length + 1, HYPRE_MEMORY_HOST);
+   for (i = 0; i < send_proc_obj.length; i++)
+   {
+      recv_order[i] = i;
+   }
+   hypre_qsort2i(send_proc_obj.id, recv_order, 0, send_proc_obj.length - 1);
+
+   nnz_local = (num_entries - num_sent) + send_proc_obj.vec_starts[send_proc_obj.length] / 3;
+   hypre_TFree(proc_counts, HYPRE_MEMORY_HOST);
+
+   row_sizes  = hypre_CTAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   row_starts = hypre_TAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   diag_sizes = hypre_CTAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   offd_sizes = hypre_CTAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   rows       = hypre_TAlloc(HYPRE_BigInt, num_rows, HYPRE_MEMORY_HOST);
+   cols       = hypre_TAlloc(HYPRE_BigInt, nnz_local, HYPRE_MEMORY_HOST);
+   vals       = hypre_TAlloc(HYPRE_Complex, nnz_local, HYPRE_MEMORY_HOST);
+
+   /* sources in rank order, this rank's own entries included */
+   src_bufs   = hypre_TAlloc(char *, send_proc_obj.length + 1, HYPRE_MEMORY_HOST);
+   src_counts = hypre_TAlloc(HYPRE_Int, send_proc_obj.length + 1, HYPRE_MEMORY_HOST);
+   num_srcs   = 0;
+   for (k = 0; k <= send_proc_obj.length; k++)
+   {
+      if (num_srcs == k && (k == send_proc_obj.length || send_proc_obj.id[k] > myid))
+      {
+         src_bufs[num_srcs]     = send_buf + (size_t) 3 * num_sent * obj_size_bytes;
+         src_counts[num_srcs++] = num_entries - num_sent;
+      }
+      if (k < send_proc_obj.length)
+      {
+         i = recv_order[k];
+         src_bufs[num_srcs]     = (char *) send_proc_obj.v_elements +
+                                  (size_t) send_proc_obj.vec_starts[i] * obj_size_bytes;
+         src_counts[num_srcs++] = (send_proc_obj.vec_starts[i + 1] -
+                                   send_proc_obj.vec_starts[i]) / 3;
+      }
+   }
+
+   /* two passes over the sources: count, then place */
+   for (m = 0; m < 2; m++)
+   {
+      if (m == 1)
+      {
+         row_starts[0] = 0;
+         for (i = 0; i < num_rows; i++)
+         {
+            row_starts[i + 1] = row_starts[i] + row_sizes[i];
+            rows[i] = row_part[0] + (HYPRE_BigInt) i;
+         }
+      }
+
+      for (src = 0; src < num_srcs; src++)
+      {
+         obj = src_bufs[src];
+         for (cnt = src_counts[src]; cnt > 0; cnt--, obj += 3 * obj_size_bytes)
+         {
+            hypre_TMemcpy(&I, obj, HYPRE_BigInt, 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+            hypre_TMemcpy(&J, obj + obj_size_bytes, HYPRE_BigInt, 1,
+                          HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+            i = (HYPRE_Int) (I - row_part[0]);
+            if (m == 0)
+            {
+               row_sizes[i]++;
+               if (J >= col_part[0] && J < col_part[1])
+               {
+                  diag_sizes[i]++;
+               }
+               else
+               {
+                  offd_sizes[i]++;
+               }
+            }
+            else
+            {
+               cols[row_starts[i]] = J;
+               hypre_TMemcpy(&vals[row_starts[i]], obj + 2 * obj_size_bytes, HYPRE_Complex, 1,
+                             HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+               row_starts[i]++;
+            }
+         }
+      }
+   }
+
+   hypre_TFree(send_buf, HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_order, HYPRE_MEMORY_HOST);
+   hypre_TFree(src_bufs, HYPRE_MEMORY_HOST);
+   hypre_TFree(src_counts, HYPRE_MEMORY_HOST);
+   hypre_TFree(row_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_proc_obj.id, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_proc_obj.vec_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_proc_obj.v_elements, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Assemble
+    *-----------------------------------------------------------------------*/
+
+   HYPRE_IJMatrixCreate(comm, row_part[0], row_part[1] - 1, col_part[0], col_part[1] - 1, &matrix);
+   HYPRE_IJMatrixSetObjectType(matrix, type);
+   HYPRE_IJMatrixSetDiagOffdSizes(matrix, diag_sizes, offd_sizes);
+   HYPRE_IJMatrixInitialize_v2(matrix, HYPRE_MEMORY_HOST);
+   HYPRE_IJMatrixSetValues(matrix, num_rows, row_sizes, rows, cols, vals);
+   HYPRE_IJMatrixAssemble(matrix);
+
+   hypre_TFree(row_sizes, HYPRE_MEMORY_HOST);
+   hypre_TFree(diag_sizes, HYPRE_MEMORY_HOST);
+   hypre_TFree(offd_sizes, HYPRE_MEMORY_HOST);
+   hypre_TFree(rows, HYPRE_MEMORY_HOST);
+   hypre_TFree(cols, HYPRE_MEMORY_HOST);
+   hypre_TFree(vals, HYPRE_MEMORY_HOST);
+
+   *matrix_ptr = matrix;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_IJMatrixReadBinary
  *
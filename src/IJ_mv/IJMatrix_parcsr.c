@@ -2622,6 +2622,9 @@ hypre_IJMatrixAssembleParCSR(hypre_IJMatrix *matrix)
                           hypre_MPI_SUM, comm);
       if (offd_proc_elmts)
       {
+         /* sum duplicate stashed entries so that each is sent only once */
+         hypre_AuxParCSRMatrixCompressOffProcElmts(aux_matrix);
+         off_proc_i_indx = hypre_AuxParCSRMatrixOffProcIIndx(aux_matrix);
          max_off_proc_elmts = hypre_AuxParCSRMatrixMaxOffProcElmts(aux_matrix);
          current_num_elmts = hypre_AuxParCSRMatrixCurrentOffProcElmts(aux_matrix);
          off_proc_i = hypre_AuxParCSRMatrixOffProcI(aux_matrix);
@@ -3586,6 +3589,149 @@ hypre_IJMatrixSetValuesOMPParCSR( hypre_IJMatrix       *matrix,
    return hypre_error_flag;
 }
 
+/******************************************************************************
+ *
+ * hypre_IJMatrixStashOffProcValsOMPParCSR
+ *
+ * appends the off-processor rows collected per thread by
+ * hypre_IJMatrixAddToValuesOMPParCSR to the stash of aux_matrix, and frees
+ * the per-thread lists. The stash is grown once for all threads; each
+ * thread then copies its rows into its own slice of the stash, so no
+ * locking is needed and the threads' rows keep their order.
+ *
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_IJMatrixStashOffProcValsOMPParCSR( hypre_AuxParCSRMatrix  *aux_matrix,
+                                         HYPRE_Int               num_threads,
+                                         HYPRE_Int             **offproc_cnt,
+                                         HYPRE_Int              *ncols,
+                                         const HYPRE_BigInt     *rows,
+                                         const HYPRE_BigInt     *cols,
+                                         const HYPRE_Complex    *values )
+{
+   HYPRE_Int      current_num_elmts = hypre_AuxParCSRMatrixCurrentOffProcElmts(aux_matrix);
+   HYPRE_Int      max_off_proc_elmts = hypre_AuxParCSRMatrixMaxOffProcElmts(aux_matrix);
+   HYPRE_Int      off_proc_i_indx = hypre_AuxParCSRMatrixOffProcIIndx(aux_matrix);
+   HYPRE_BigInt  *off_proc_i;
+   HYPRE_BigInt  *off_proc_j;
+   HYPRE_Complex *off_proc_data;
+   HYPRE_Int     *thread_rows;
+   HYPRE_Int     *thread_elmts;
+   HYPRE_Int      t, i2, n;
+
+   thread_rows  = hypre_CTAlloc(HYPRE_Int, num_threads + 1, HYPRE_MEMORY_HOST);
+   thread_elmts = hypre_CTAlloc(HYPRE_Int, num_threads + 1, HYPRE_MEMORY_HOST);
+
+   /* Count the rows and entries collected by each thread */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(t, i2, n) HYPRE_SMP_SCHEDULE
+#endif
+   for (t = 0; t < num_threads; t++)
+   {
+      if (offproc_cnt[t])
+      {
+         for (i2 = 2; i2 < offproc_cnt[t][1]; i2 += 2)
+         {
+            n = ncols ? ncols[offproc_cnt[t][i2]] : 1;
+            if (n > 0)
+            {
+               thread_rows[t + 1]++;
+               thread_elmts[t + 1] += n;
+            }
+         }
+      }
+   }
+
+   /* Offsets of each thread's slice in the stash */
+   thread_rows[0]  = off_proc_i_indx / 2;
+   thread_elmts[0] = current_num_elmts;
+   for (t = 0; t < num_threads; t++)
+   {
+      thread_rows[t + 1]  += thread_rows[t];
+      thread_elmts[t + 1] += thread_elmts[t];
+   }
+
+   if (thread_elmts[num_threads] > current_num_elmts)
+   {
+      n = thread_elmts[num_threads];
+      if (!max_off_proc_elmts)
+      {
+         max_off_proc_elmts = hypre_max(n, 1000);
+         hypre_AuxParCSRMatrixOffProcI(aux_matrix)
+            = hypre_CTAlloc(HYPRE_BigInt, 2 * max_off_proc_elmts, HYPRE_MEMORY_HOST);
+         hypre_AuxParCSRMatrixOffProcJ(aux_matrix)
+            = hypre_CTAlloc(HYPRE_BigInt, max_off_proc_elmts, HYPRE_MEMORY_HOST);
+         hypre_AuxParCSRMatrixOffProcData(aux_matrix)
+            = hypre_CTAlloc(HYPRE_Complex, max_off_proc_elmts, HYPRE_MEMORY_HOST);
+      }
+      else if (n > max_off_proc_elmts)
+      {
+         max_off_proc_elmts = hypre_max(n, 2 * max_off_proc_elmts);
+         hypre_AuxParCSRMatrixOffProcI(aux_matrix)
+            = hypre_TReAlloc(hypre_AuxParCSRMatrixOffProcI(aux_matrix), HYPRE_BigInt,
+                             2 * max_off_proc_elmts, HYPRE_MEMORY_HOST);
+         hypre_AuxParCSRMatrixOffProcJ(aux_matrix)
+            = hypre_TReAlloc(hypre_AuxParCSRMatrixOffProcJ(aux_matrix), HYPRE_BigInt,
+                             max_off_proc_elmts, HYPRE_MEMORY_HOST);
+         hypre_AuxParCSRMatrixOffProcData(aux_matrix)
+            = hypre_TReAlloc(hypre_AuxParCSRMatrixOffProcData(aux_matrix), HYPRE_Complex,
+                             max_off_proc_elmts, HYPRE_MEMORY_HOST);
+      }
+      hypre_AuxParCSRMatrixMaxOffProcElmts(aux_matrix) = max_off_proc_elmts;
+
+      off_proc_i    = hypre_AuxParCSRMatrixOffProcI(aux_matrix);
+      off_proc_j    = hypre_AuxParCSRMatrixOffProcJ(aux_matrix);
+      off_proc_data = hypre_AuxParCSRMatrixOffProcData(aux_matrix);
+
+      /* Copy each thread's rows into its slice */
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(t, i2, n) HYPRE_SMP_SCHEDULE
+#endif
+      for (t = 0; t < num_threads; t++)
+      {
+         HYPRE_Int i, ii, indx;
+         HYPRE_Int i_indx = 2 * thread_rows[t];
+         HYPRE_Int j_indx = thread_elmts[t];
+
+         if (!offproc_cnt[t])
+         {
+            continue;
+         }
+
+         for (i2 = 2; i2 < offproc_cnt[t][1]; i2 += 2)
+         {
+            ii   = offproc_cnt[t][i2];
+            indx = offproc_cnt[t][i2 + 1];
+            n    = ncols ? ncols[ii] : 1;
+            if (n == 0) /* empty row */
+            {
+               continue;
+            }
+            off_proc_i[i_indx++] = rows[ii];
+            off_proc_i[i_indx++] = n;
+            for (i = 0; i < n; i++)
+            {
+               off_proc_j[j_indx]      = cols[indx];
+               off_proc_data[j_indx++] = values[indx++];
+            }
+         }
+      }
+
+      hypre_AuxParCSRMatrixOffProcIIndx(aux_matrix)        = 2 * thread_rows[num_threads];
+      hypre_AuxParCSRMatrixCurrentOffProcElmts(aux_matrix) = thread_elmts[num_threads];
+   }
+
+   for (t = 0; t < num_threads; t++)
+   {
+      hypre_TFree(offproc_cnt[t], HYPRE_MEMORY_HOST);
+   }
+   hypre_TFree(thread_rows, HYPRE_MEMORY_HOST);
+   hypre_TFree(thread_elmts, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /******************************************************************************
  *
  * hypre_IJMatrixAddToValuesOMPParCSR
@@ -3622,12 +3768,6 @@ hypre_IJMatrixAddToValuesOMPParCSR( hypre_IJMatrix       *matrix,
    HYPRE_Int *offd_j;
    HYPRE_BigInt *big_offd_j;
    HYPRE_Complex *offd_data;
-   HYPRE_Int current_num_elmts;
-   HYPRE_Int max_off_proc_elmts;
-   HYPRE_Int off_proc_i_indx;
-   HYPRE_BigInt *off_proc_i;
-   HYPRE_BigInt *off_proc_j;
-   HYPRE_Complex *off_proc_data;
    HYPRE_Int **offproc_cnt;
 
    HYPRE_Int print_level = hypre_IJMatrixPrintLevel(matrix);
@@ -3671,14 +3811,6 @@ hypre_IJMatrixAddToValuesOMPParCSR( hypre_IJMatrix       *matrix,
          offd_data = hypre_CSRMatrixData(offd);
       }
       aux_matrix = (hypre_AuxParCSRMatrix*) hypre_IJMatrixTranslator(matrix);
-      if (aux_matrix)
-      {
-         current_num_elmts
-            = hypre_AuxParCSRMatrixCurrentOffProcElmts(aux_matrix);
-         off_proc_i_indx = hypre_AuxParCSRMatrixOffProcIIndx(aux_matrix);
-         off_proc_i = hypre_AuxParCSRMatrixOffProcI(aux_matrix);
-         off_proc_j = hypre_AuxParCSRMatrixOffProcJ(aux_matrix);
-      }
 #ifdef HYPRE_USING_OPENMP
       #pragma omp parallel
 #endif
@@ -3868,8 +4000,10 @@ hypre_IJMatrixAddToValuesOMPParCSR( hypre_IJMatrix       *matrix,
                else
                {
                   size = my_offproc_cnt[0];
-                  my_offproc_cnt = hypre_TReAlloc(my_offproc_cnt, HYPRE_Int, size + 200, HYPRE_MEMORY_HOST);
-                  my_offproc_cnt[0] += 200;
+                  my_offproc_cnt = hypre_TReAlloc(my_offproc_cnt, HYPRE_Int,
+                                                  2 * size, HYPRE_MEMORY_HOST);
+                  offproc_cnt[my_thread_num] = my_offproc_cnt;
+                  my_offproc_cnt[0] = 2 * size;
                   my_offproc_cnt[i] = ii;
                   my_offproc_cnt[i + 1] = indx;
                   my_offproc_cnt[1] += 2;
@@ -3883,14 +4017,6 @@ hypre_IJMatrixAddToValuesOMPParCSR( hypre_IJMatrix       *matrix,
    else
    {
       aux_matrix = (hypre_AuxParCSRMatrix*) hypre_IJMatrixTranslator(matrix);
-      if (aux_matrix)
-      {
-         current_num_elmts
-            = hypre_AuxParCSRMatrixCurrentOffProcElmts(aux_matrix);
-         off_proc_i_indx = hypre_AuxParCSRMatrixOffProcIIndx(aux_matrix);
-         off_proc_i = hypre_AuxParCSRMatrixOffProcI(aux_matrix);
-         off_proc_j = hypre_AuxParCSRMatrixOffProcJ(aux_matrix);
-      }
       row_space = hypre_AuxParCSRMatrixRowSpace(aux_matrix);
       row_length = hypre_AuxParCSRMatrixRowLength(aux_matrix);
       need_aux = hypre_AuxParCSRMatrixNeedAux(aux_matrix);
@@ -4154,9 +4280,9 @@ hypre_IJMatrixAddToValuesOMPParCSR( hypre_IJMatrix       *matrix,
                {
                   size = my_offproc_cnt[0];
                   my_offproc_cnt = hypre_TReAlloc(my_offproc_cnt, HYPRE_Int,
-                                                  size + 200, HYPRE_MEMORY_HOST);
+                                                  2 * size, HYPRE_MEMORY_HOST);
                   offproc_cnt[my_thread_num] = my_offproc_cnt;
-                  my_offproc_cnt[0] += 200;
+                  my_offproc_cnt[0] = 2 * size;
                   my_offproc_cnt[i] = ii;
                   my_offproc_cnt[i + 1] = indx;
                   my_offproc_cnt[1] += 2;
@@ -4176,73 +4302,8 @@ hypre_IJMatrixAddToValuesOMPParCSR( hypre_IJMatrix       *matrix,
       hypre_AuxParCSRMatrixNeedAux(aux_matrix) = 0;
       hypre_IJMatrixTranslator(matrix) = aux_matrix;
    }
-   for (i1 = 0; i1 < max_num_threads; i1++)
-   {
-      if (offproc_cnt[i1])
-      {
-         HYPRE_Int *my_offproc_cnt = offproc_cnt[i1];
-         HYPRE_Int i, i2, ii, n, indx;
-         HYPRE_BigInt row;
-         for (i2 = 2; i2 < my_offproc_cnt[1]; i2 += 2)
-         {
-            ii = my_offproc_cnt[i2];
-            row = rows[ii];
-            n = ncols ? ncols[ii] : 1;
-            if (n == 0) /* empty row */
-            {
-               continue;
-            }
-            indx = my_offproc_cnt[i2 + 1];
-            current_num_elmts
-               = hypre_AuxParCSRMatrixCurrentOffProcElmts(aux_matrix);
-            max_off_proc_elmts
-               = hypre_AuxParCSRMatrixMaxOffProcElmts(aux_matrix);
-            off_proc_i_indx = hypre_AuxParCSRMatrixOffProcIIndx(aux_matrix);
-            off_proc_i = hypre_AuxParCSRMatrixOffProcI(aux_matrix);
-            off_proc_j = hypre_AuxParCSRMatrixOffProcJ(aux_matrix);
-            off_proc_data = hypre_AuxParCSRMatrixOffProcData(aux_matrix);
-
-            if (!max_off_proc_elmts)
-            {
-               max_off_proc_elmts = hypre_max(n, 1000);
-               hypre_AuxParCSRMatrixMaxOffProcElmts(aux_matrix) =
-                  max_off_proc_elmts;
-               hypre_AuxParCSRMatrixOffProcI(aux_matrix)
-                  = hypre_CTAlloc(HYPRE_BigInt, 2 * max_off_proc_elmts, HYPRE_MEMORY_HOST);
-               hypre_AuxParCSRMatrixOffProcJ(aux_matrix)
-                  = hypre_CTAlloc(HYPRE_BigInt, max_off_proc_elmts, HYPRE_MEMORY_HOST);
-               hypre_AuxParCSRMatrixOffProcData(aux_matrix)
-                  = hypre_CTAlloc(HYPRE_Complex, max_off_proc_elmts, HYPRE_MEMORY_HOST);
-               off_proc_i = hypre_AuxParCSRMatrixOffProcI(aux_matrix);
-               off_proc_j = hypre_AuxParCSRMatrixOffProcJ(aux_matrix);
-               off_proc_data = hypre_AuxParCSRMatrixOffProcData(aux_matrix);
-            }
-            else if (current_num_elmts + n > max_off_proc_elmts)
-            {
-               max_off_proc_elmts += 3 * n;
-               off_proc_i = hypre_TReAlloc(off_proc_i, HYPRE_BigInt, 2 * max_off_proc_elmts, HYPRE_MEMORY_HOST);
-               off_proc_j = hypre_TReAlloc(off_proc_j, HYPRE_BigInt, max_off_proc_elmts, HYPRE_MEMORY_HOST);
-               off_proc_data = hypre_TReAlloc(off_proc_data, HYPRE_Complex,
-                                              max_off_proc_elmts, HYPRE_MEMORY_HOST);
-               hypre_AuxParCSRMatrixMaxOffProcElmts(aux_matrix)
-                  = max_off_proc_elmts;
-               hypre_AuxParCSRMatrixOffProcI(aux_matrix) = off_proc_i;
-               hypre_AuxParCSRMatrixOffProcJ(aux_matrix) = off_proc_j;
-               hypre_AuxParCSRMatrixOffProcData(aux_matrix) = off_proc_data;
-            }
-            off_proc_i[off_proc_i_indx++] = row;
-            off_proc_i[off_proc_i_indx++] = n;
-            for (i = 0; i < n; i++)
-            {
-               off_proc_j[current_num_elmts] = cols[indx];
-               off_proc_data[current_num_elmts++] = values[indx++];
-            }
-            hypre_AuxParCSRMatrixOffProcIIndx(aux_matrix) = off_proc_i_indx;
-            hypre_AuxParCSRMatrixCurrentOffProcElmts(aux_matrix) = current_num_elmts;
-         }
-         hypre_TFree(offproc_cnt[i1], HYPRE_MEMORY_HOST);
-      }
-   }
+   hypre_IJMatrixStashOffProcValsOMPParCSR(aux_matrix, max_num_threads, offproc_cnt,
+                                           ncols, rows, cols, values);
    hypre_TFree(offproc_cnt, HYPRE_MEMORY_HOST);
 
    return hypre_error_flag;
@@ -386,3 +386,179 @@ hypre_AuxParCSRMatrixInitialize(hypre_AuxParCSRMatrix *matrix)
 
    return -2;
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_AuxParCSRMatrixCompressOffProcElmts
+ *
+ * Sorts the off-processor stash by row and column and sums entries with the
+ * same (row, column) pair, so that every stashed row is sent only once and
+ * with each of its columns only once. All stashed entries are added to the
+ * receiving matrix, so combining them here does not change the assembled
+ * matrix (up to the order of the floating point sums).
+ *
+ * The rows of the stash are sorted serially; gathering, sorting and merging
+ * the entries of the (distinct) rows is done in parallel.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_AuxParCSRMatrixCompressOffProcElmts( hypre_AuxParCSRMatrix *matrix )
+{
+   HYPRE_Int       num_chunks     = hypre_AuxParCSRMatrixOffProcIIndx(matrix) / 2;
+   HYPRE_Int       num_elmts      = hypre_AuxParCSRMatrixCurrentOffProcElmts(matrix);
+   HYPRE_BigInt   *off_proc_i     = hypre_AuxParCSRMatrixOffProcI(matrix);
+   HYPRE_BigInt   *off_proc_j     = hypre_AuxParCSRMatrixOffProcJ(matrix);
+   HYPRE_Complex  *off_proc_data  = hypre_AuxParCSRMatrixOffProcData(matrix);
+
+   HYPRE_Int      *chunk_start;
+   HYPRE_BigInt   *chunk_row;
+   HYPRE_Int      *chunk_perm;
+   HYPRE_Int      *row_chunk_ptr;
+   HYPRE_Int      *row_ptr;
+   HYPRE_Int      *row_nnz;
+   HYPRE_BigInt   *sort_j;
+   HYPRE_Int      *sort_pos;
+   HYPRE_Complex  *sort_data;
+   HYPRE_Int      *new_ptr;
+   HYPRE_BigInt    prev_row = 0;
+   HYPRE_Int       num_rows;
+   HYPRE_Int       i, k;
+
+   if (num_chunks < 1 || num_elmts < 2)
+   {
+      return hypre_error_flag;
+   }
+
+   /* Sort the stashed row chunks by row; chunks of the same row are kept in
+      the order they were stashed so that the result is deterministic */
+   chunk_start = hypre_TAlloc(HYPRE_Int, num_chunks + 1, HYPRE_MEMORY_HOST);
+   chunk_row   = hypre_TAlloc(HYPRE_BigInt, num_chunks, HYPRE_MEMORY_HOST);
+   chunk_perm  = hypre_TAlloc(HYPRE_Int, num_chunks, HYPRE_MEMORY_HOST);
+
+   chunk_start[0] = 0;
+   for (i = 0; i < num_chunks; i++)
+   {
+      chunk_row[i]       = off_proc_i[2 * i];
+      chunk_perm[i]      = i;
+      chunk_start[i + 1] = chunk_start[i] + (HYPRE_Int) off_proc_i[2 * i + 1];
+   }
+   hypre_BigQsort2i(chunk_row, chunk_perm, 0, num_chunks - 1);
+
+   row_chunk_ptr = hypre_TAlloc(HYPRE_Int, num_chunks + 1, HYPRE_MEMORY_HOST);
+   num_rows = 0;
+   for (i = 0; i < num_chunks; i++)
+   {
+      if (i == 0 || chunk_row[i] != prev_row)
+      {
+         if (num_rows > 0)
+         {
+            hypre_qsort0(chunk_perm, row_chunk_ptr[num_rows - 1], i - 1);
+         }
+         prev_row                  = chunk_row[i];
+         chunk_row[num_rows]       = prev_row;
+         row_chunk_ptr[num_rows++] = i;
+      }
+   }
+   hypre_qsort0(chunk_perm, row_chunk_ptr[num_rows - 1], num_chunks - 1);
+   row_chunk_ptr[num_rows] = num_chunks;
+
+   row_ptr = hypre_TAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   row_nnz = hypre_TAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   row_ptr[0] = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      row_ptr[i + 1] = row_ptr[i];
+      for (k = row_chunk_ptr[i]; k < row_chunk_ptr[i + 1]; k++)
+      {
+         row_ptr[i + 1] += chunk_start[chunk_perm[k] + 1] - chunk_start[chunk_perm[k]];
+      }
+   }
+
+   /* Gather the entries of each row, sort them by column and sum duplicates;
+      the merged entries are compacted at the front of the row's segment */
+   sort_j      = hypre_TAlloc(HYPRE_BigInt, num_elmts, HYPRE_MEMORY_HOST);
+   sort_pos    = hypre_TAlloc(HYPRE_Int, num_elmts, HYPRE_MEMORY_HOST);
+   sort_data   = hypre_TAlloc(HYPRE_Complex, num_elmts, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i, k) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      HYPRE_Int jj, cnt, start, end;
+
+      cnt = row_ptr[i];
+      for (k = row_chunk_ptr[i]; k < row_chunk_ptr[i + 1]; k++)
+      {
+         start = chunk_start[chunk_perm[k]];
+         end   = chunk_start[chunk_perm[k] + 1];
+         for (jj = start; jj < end; jj++)
+         {
+            sort_j[cnt]     = off_proc_j[jj];
+            sort_pos[cnt++] = jj;
+         }
+      }
+
+      if (row_ptr[i + 1] == row_ptr[i])
+      {
+         row_nnz[i] = 0;
+         continue;
+      }
+
+      hypre_BigQsortbi(sort_j, sort_pos, row_ptr[i], row_ptr[i + 1] - 1);
+
+      cnt = row_ptr[i];
+      sort_data[cnt] = off_proc_data[sort_pos[cnt]];
+      for (jj = row_ptr[i] + 1; jj < row_ptr[i + 1]; jj++)
+      {
+         if (sort_j[jj] != sort_j[cnt])
+         {
+            cnt++;
+            sort_j[cnt]    = sort_j[jj];
+            sort_data[cnt] = off_proc_data[sort_pos[jj]];
+         }
+         else
+         {
+            sort_data[cnt] += off_proc_data[sort_pos[jj]];
+         }
+      }
+      row_nnz[i] = cnt - row_ptr[i] + 1;
+   }
+
+   /* Write the compressed stash back in place */
+   new_ptr = hypre_TAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   new_ptr[0] = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      new_ptr[i + 1] = new_ptr[i] + row_nnz[i];
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i, k) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      for (k = 0; k < row_nnz[i]; k++)
+      {
+         off_proc_j[new_ptr[i] + k]    = sort_j[row_ptr[i] + k];
+         off_proc_data[new_ptr[i] + k] = sort_data[row_ptr[i] + k];
+      }
+      off_proc_i[2 * i]     = chunk_row[i];
+      off_proc_i[2 * i + 1] = (HYPRE_BigInt) row_nnz[i];
+   }
+
+   hypre_AuxParCSRMatrixOffProcIIndx(matrix)         = 2 * num_rows;
+   hypre_AuxParCSRMatrixCurrentOffProcElmts(matrix)  = new_ptr[num_rows];
+
+   hypre_TFree(chunk_start, HYPRE_MEMORY_HOST);
+   hypre_TFree(chunk_row, HYPRE_MEMORY_HOST);
+   hypre_TFree(chunk_perm, HYPRE_MEMORY_HOST);
+   hypre_TFree(row_chunk_ptr, HYPRE_MEMORY_HOST);
+   hypre_TFree(row_ptr, HYPRE_MEMORY_HOST);
+   hypre_TFree(row_nnz, HYPRE_MEMORY_HOST);
+   hypre_TFree(sort_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(sort_pos, HYPRE_MEMORY_HOST);
+   hypre_TFree(sort_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(new_ptr, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
@@ -152,6 +152,16 @@ HYPRE_Int HYPRE_PCGSetRecomputeResidualP(HYPRE_Solver solver,
 HYPRE_Int HYPRE_PCGSetFlex(HYPRE_Solver solver,
                            HYPRE_Int    flex);
 
+/**
+ * (Optional) Use the pipelined variant of CG, which needs a single global
+ * reduction per iteration and overlaps it with the preconditioner and the
+ * matvec. It is more sensitive to rounding errors; combine it with
+ * HYPRE_PCGSetRecomputeResidualP for long solves. Not compatible with the
+ * Flex and ResidualTol options.
+ **/
+HYPRE_Int HYPRE_PCGSetPipelined(HYPRE_Solver solver,
+                                HYPRE_Int    pipelined);
+
 /**
  * (Optional) Skips subnormal alpha, gamma and iprod values in CG.
  *  If set to 0 (default): will break if values are below HYPRE_REAL_MIN
@@ -263,6 +273,11 @@ HYPRE_Int HYPRE_PCGGetSkipBreak(HYPRE_Solver solver,
 HYPRE_Int HYPRE_PCGGetFlex(HYPRE_Solver solver,
                            HYPRE_Int   *flex);
 
+/**
+ **/
+HYPRE_Int HYPRE_PCGGetPipelined(HYPRE_Solver solver,
+                                HYPRE_Int   *pipelined);
+
 /**
  **/
 HYPRE_Int HYPRE_PCGGetPrecond(HYPRE_Solver  solver,
@@ -900,6 +915,26 @@ HYPRE_Int HYPRE_COGMRESSetUnroll(HYPRE_Solver solver,
 HYPRE_Int HYPRE_COGMRESSetCGS(HYPRE_Solver solver,
                               HYPRE_Int    cgs);
 
+/**
+ * (Optional) Use the s-step variant of COGMRES if s_step > 1. Each block of
+ * s_step basis vectors is generated by a chain of preconditioner applications
+ * and matvecs, and orthogonalized with two global reductions instead of two
+ * or three per vector. The block size is limited by the Krylov space size.
+ * The relative change stopping criterion is ignored by this variant.
+ * Default: 0 (standard COGMRES).
+ **/
+HYPRE_Int HYPRE_COGMRESSetSStep(HYPRE_Solver solver,
+                                HYPRE_Int    s_step);
+
+/**
+ * (Optional) Set the polynomial basis used by the s-step variant:
+ * 0: monomial basis
+ * 1: (default) Newton basis, with shifts given by the Ritz values of the
+ * first s_step Arnoldi steps
+ **/
+HYPRE_Int HYPRE_COGMRESSetSStepBasis(HYPRE_Solver solver,
+                                     HYPRE_Int    s_step_basis);
+
 /**
  * (Optional) Set the preconditioner to use.
  **/
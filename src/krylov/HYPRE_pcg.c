@@ -282,6 +282,24 @@ HYPRE_PCGGetFlex( HYPRE_Solver  solver,
    return ( hypre_PCGGetFlex( (void *) solver, flex ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_PCGSetPipelined, HYPRE_PCGGetPipelined
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_PCGSetPipelined( HYPRE_Solver solver,
+                       HYPRE_Int    pipelined )
+{
+   return ( hypre_PCGSetPipelined( (void *) solver, pipelined ) );
+}
+
+HYPRE_Int
+HYPRE_PCGGetPipelined( HYPRE_Solver  solver,
+                       HYPRE_Int    *pipelined )
+{
+   return ( hypre_PCGGetPipelined( (void *) solver, pipelined ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_PCGSetPrecond
  *--------------------------------------------------------------------------*/
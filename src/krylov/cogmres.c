@@ -73,6 +73,27 @@ hypre_COGMRESFunctionsCreate(
    return cogmres_functions;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_COGMRESFunctionsSetBlockInnerProd
+ *
+ * Sets the optional block inner product, which computes all the products
+ * result[j*nx+i] = <x[i],y[j]> with a single global reduction. The s-step
+ * solver uses it to orthogonalize a block of basis vectors at once; without
+ * it, the products are computed with one MassInnerProd per vector of y.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_COGMRESFunctionsSetBlockInnerProd(
+   hypre_COGMRESFunctions *cogmres_functions,
+   HYPRE_Int    (*BlockInnerProd)( void **x, HYPRE_Int nx, void **y, HYPRE_Int ny,
+                                   HYPRE_Real *result )
+)
+{
+   cogmres_functions->BlockInnerProd = BlockInnerProd;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_COGMRESCreate
  *--------------------------------------------------------------------------*/
@@ -109,6 +130,8 @@ hypre_COGMRESCreate( hypre_COGMRESFunctions *cogmres_functions )
    (cogmres_data -> norms)          = NULL;
    (cogmres_data -> log_file_name)  = NULL;
    (cogmres_data -> unroll)         = 0;
+   (cogmres_data -> s_step)         = 0; /* s-step variant if > 1 */
+   (cogmres_data -> s_step_basis)   = 1; /* Newton basis */
 
    HYPRE_ANNOTATE_FUNC_END;
 
@@ -337,6 +360,11 @@ hypre_COGMRESSolve(void  *cogmres_vdata,
 
    HYPRE_Real real_r_norm_old, real_r_norm_new;
 
+   if ((cogmres_data -> s_step) > 1)
+   {
+      return hypre_COGMRESSolveSStep(cogmres_vdata, A, b, x);
+   }
+
    HYPRE_ANNOTATE_FUNC_BEGIN;
 
    (cogmres_data -> converged) = 0;
@@ -915,68 +943,1150 @@ hypre_COGMRESSolve(void  *cogmres_vdata,
 }
 
 /*--------------------------------------------------------------------------
- * hypre_COGMRESSetKDim, hypre_COGMRESGetKDim
+ * hypre_COGMRESBlockInnerProd
+ *
+ * result[j*nx+i] = <x[i],y[j]> for i < nx, j < ny.
  *--------------------------------------------------------------------------*/
 
-HYPRE_Int
-hypre_COGMRESSetKDim( void   *cogmres_vdata,
-                      HYPRE_Int   k_dim )
+static HYPRE_Int
+hypre_COGMRESBlockInnerProd( hypre_COGMRESFunctions *cogmres_functions,
+                             void                  **x,
+                             HYPRE_Int               nx,
+                             void                  **y,
+                             HYPRE_Int               ny,
+                             HYPRE_Int               unroll,
+                             HYPRE_Real             *result )
 {
-   hypre_COGMRESData *cogmres_data = (hypre_COGMRESData *) cogmres_vdata;
-   (cogmres_data -> k_dim) = k_dim;
-   return hypre_error_flag;
-}
+   HYPRE_Int j;
+
+   if (cogmres_functions->BlockInnerProd)
+   {
+      return (*(cogmres_functions->BlockInnerProd))(x, nx, y, ny, result);
+   }
+
+   for (j = 0; j < ny; j++)
+   {
+      (*(cogmres_functions->MassInnerProd))(y[j], x, nx, unroll, &result[j * nx]);
+   }
 
-HYPRE_Int
-hypre_COGMRESGetKDim( void   *cogmres_vdata,
-                      HYPRE_Int * k_dim )
-{
-   hypre_COGMRESData *cogmres_data = (hypre_COGMRESData *)cogmres_vdata;
-   *k_dim = (cogmres_data -> k_dim);
    return hypre_error_flag;
 }
 
 /*--------------------------------------------------------------------------
- * hypre_COGMRESSetUnroll, hypre_COGMRESGetUnroll
+ * hypre_COGMRESHessenbergEigenvalues
+ *
+ * Computes the eigenvalues wr + i*wi of the leading n x n block of the upper
+ * Hessenberg matrix h (stored by columns with leading dimension ldh).
+ * Complex conjugate pairs are returned next to each other, the one with
+ * positive imaginary part first. Returns nonzero if the iteration does not
+ * converge.
+ *
+ * This is a translation of the EISPACK routine HQR (public domain), called
+ * with LOW = 1 and IGH = N on a copy of h.
  *--------------------------------------------------------------------------*/
 
-HYPRE_Int
-hypre_COGMRESSetUnroll( void   *cogmres_vdata,
-                        HYPRE_Int   unroll )
+static HYPRE_Int
+hypre_COGMRESHessenbergEigenvalues( HYPRE_Int   n,
+                                    HYPRE_Real *h,
+                                    HYPRE_Int   ldh,
+                                    HYPRE_Real *wr,
+                                    HYPRE_Real *wi )
 {
-   hypre_COGMRESData *cogmres_data = (hypre_COGMRESData *) cogmres_vdata;
-   (cogmres_data -> unroll) = unroll;
-   return hypre_error_flag;
-}
+   /* a(i,j) is the Fortran H(I,J), indexed from 1 */
+#define a(i, j) hh[(i) + (j) * (n + 1)]
 
-HYPRE_Int
-hypre_COGMRESGetUnroll( void   *cogmres_vdata,
-                        HYPRE_Int * unroll )
-{
-   hypre_COGMRESData *cogmres_data = (hypre_COGMRESData *)cogmres_vdata;
-   *unroll = (cogmres_data -> unroll);
-   return hypre_error_flag;
+   HYPRE_Real *hh;
+   HYPRE_Real  norm, p = 0.0, q = 0.0, r = 0.0, s, t, w, x, y, zz;
+   HYPRE_Real  tst1, tst2;
+   HYPRE_Int   i, j, k, l = 1, m, en, na, ll, mm, mp2, enm2, its, itn;
+   HYPRE_Int   notlas;
+   HYPRE_Int   ierr = 0;
+
+   /*     THIS SUBROUTINE IS A TRANSLATION OF THE ALGOL PROCEDURE HQR, */
+   /*     NUM. MATH. 14, 219-231(1970) BY MARTIN, PETERS, AND WILKINSON. */
+   /*     HANDBOOK FOR AUTO. COMP., VOL.II-LINEAR ALGEBRA, 359-371(1971). */
+
+   /*     THIS SUBROUTINE FINDS THE EIGENVALUES OF A REAL */
+   /*     UPPER HESSENBERG MATRIX BY THE QR METHOD. */
+
+   /*     ON OUTPUT, IERR IS SET TO */
+   /*          ZERO       FOR NORMAL RETURN, */
+   /*          J          IF THE LIMIT OF 30*N ITERATIONS IS EXHAUSTED */
+   /*                     WHILE THE J-TH EIGENVALUE IS BEING SOUGHT. */
+
+   /*     QUESTIONS AND COMMENTS SHOULD BE DIRECTED TO BURTON S. GARBOW, */
+   /*     MATHEMATICS AND COMPUTER SCIENCE DIV, ARGONNE NATIONAL LABORATORY */
+
+   /*     THIS VERSION DATED AUGUST 1983. */
+
+   hh = hypre_CTAlloc(HYPRE_Real, (n + 1) * (n + 1), HYPRE_MEMORY_HOST);
+
+   /*     .......... COMPUTE MATRIX NORM .......... */
+   norm = 0.0;
+   k = 1;
+   for (i = 1; i <= n; i++)
+   {
+      for (j = k; j <= n; j++)
+      {
+         a(i, j) = h[(j - 1) * ldh + (i - 1)];
+         norm += hypre_abs(a(i, j));
+      }
+      k = i;
+   }
+
+   en = n;
+   t = 0.0;
+   itn = n * 30;
+
+   /*     .......... SEARCH FOR NEXT EIGENVALUES .......... */
+L60:
+   if (en < 1)
+   {
+      goto L1001;
+   }
+   its = 0;
+   na = en - 1;
+   enm2 = na - 1;
+
+   /*     .......... LOOK FOR SINGLE SMALL SUB-DIAGONAL ELEMENT */
+   /*                FOR L=EN STEP -1 UNTIL LOW DO -- .......... */
+L70:
+   for (ll = 1; ll <= en; ll++)
+   {
+      l = en + 1 - ll;
+      if (l == 1)
+      {
+         break;
+      }
+      s = hypre_abs(a(l - 1, l - 1)) + hypre_abs(a(l, l));
+      if (s == 0.0)
+      {
+         s = norm;
+      }
+      tst1 = s;
+      tst2 = tst1 + hypre_abs(a(l, l - 1));
+      if (tst2 == tst1)
+      {
+         break;
+      }
+   }
+
+   /*     .......... FORM SHIFT .......... */
+   x = a(en, en);
+   if (l == en)
+   {
+      goto L270;
+   }
+   y = a(na, na);
+   w = a(en, na) * a(na, en);
+   if (l == na)
+   {
+      goto L280;
+   }
+   if (itn == 0)
+   {
+      goto L1000;
+   }
+   if (its == 10 || its == 20)
+   {
+      /*     .......... FORM EXCEPTIONAL SHIFT .......... */
+      t += x;
+
+      for (i = 1; i <= en; i++)
+      {
+         a(i, i) -= x;
+      }
+
+      s = hypre_abs(a(en, na)) + hypre_abs(a(na, enm2));
+      x = s * 0.75;
+      y = x;
+      w = s * -0.4375 * s;
+   }
+   ++its;
+   --itn;
+
+   /*     .......... LOOK FOR TWO CONSECUTIVE SMALL */
+   /*                SUB-DIAGONAL ELEMENTS. */
+   /*                FOR M=EN-2 STEP -1 UNTIL L DO -- .......... */
+   for (mm = l; mm <= enm2; mm++)
+   {
+      m = enm2 + l - mm;
+      zz = a(m, m);
+      r = x - zz;
+      s = y - zz;
+      p = (r * s - w) / a(m + 1, m) + a(m, m + 1);
+      q = a(m + 1, m + 1) - zz - r - s;
+      r = a(m + 2, m + 1);
+      s = hypre_abs(p) + hypre_abs(q) + hypre_abs(r);
+      p /= s;
+      q /= s;
+      r /= s;
+      if (m == l)
+      {
+         break;
+      }
+      tst1 = hypre_abs(p) * (hypre_abs(a(m - 1, m - 1)) + hypre_abs(zz) +
+                             hypre_abs(a(m + 1, m + 1)));
+      tst2 = tst1 + hypre_abs(a(m, m - 1)) * (hypre_abs(q) + hypre_abs(r));
+      if (tst2 == tst1)
+      {
+         break;
+      }
+   }
+
+   mp2 = m + 2;
+
+   for (i = mp2; i <= en; i++)
+   {
+      a(i, i - 2) = 0.0;
+      if (i != mp2)
+      {
+         a(i, i - 3) = 0.0;
+      }
+   }
+
+   /*     .......... DOUBLE QR STEP INVOLVING ROWS L TO EN AND */
+   /*                COLUMNS M TO EN .......... */
+   for (k = m; k <= na; k++)
+   {
+      notlas = (k != na);
+      if (k != m)
+      {
+         p = a(k, k - 1);
+         q = a(k + 1, k - 1);
+         r = 0.0;
+         if (notlas)
+         {
+            r = a(k + 2, k - 1);
+         }
+         x = hypre_abs(p) + hypre_abs(q) + hypre_abs(r);
+         if (x == 0.0)
+         {
+            continue;
+         }
+         p /= x;
+         q /= x;
+         r /= x;
+      }
+      s = hypre_sqrt(p * p + q * q + r * r);
+      if (p < 0.0)
+      {
+         s = -s;
+      }
+      if (k != m)
+      {
+         a(k, k - 1) = -s * x;
+      }
+      else if (l != m)
+      {
+         a(k, k - 1) = -a(k, k - 1);
+      }
+      p += s;
+      x = p / s;
+      y = q / s;
+      zz = r / s;
+      q /= p;
+      r /= p;
+      j = hypre_min(en, k + 3);
+      if (!notlas)
+      {
+         /*     .......... ROW MODIFICATION .......... */
+         for (i = k; i <= en; i++)
+         {
+            p = a(k, i) + q * a(k + 1, i);
+            a(k, i) -= p * x;
+            a(k + 1, i) -= p * y;
+         }
+
+         /*     .......... COLUMN MODIFICATION .......... */
+         for (i = l; i <= j; i++)
+         {
+            p = x * a(i, k) + y * a(i, k + 1);
+            a(i, k) -= p;
+            a(i, k + 1) -= p * q;
+         }
+      }
+      else
+      {
+         /*     .......... ROW MODIFICATION .......... */
+         for (i = k; i <= en; i++)
+         {
+            p = a(k, i) + q * a(k + 1, i) + r * a(k + 2, i);
+            a(k, i) -= p * x;
+            a(k + 1, i) -= p * y;
+            a(k + 2, i) -= p * zz;
+         }
+
+         /*     .......... COLUMN MODIFICATION .......... */
+         for (i = l; i <= j; i++)
+         {
+            p = x * a(i, k) + y * a(i, k + 1) + zz * a(i, k + 2);
+            a(i, k) -= p;
+            a(i, k + 1) -= p * q;
+            a(i, k + 2) -= p * r;
+         }
+      }
+   }
+
+   goto L70;
+
+   /*     .......... ONE ROOT FOUND .......... */
+L270:
+   wr[en - 1] = x + t;
+   wi[en - 1] = 0.0;
+   en = na;
+   goto L60;
+
+   /*     .......... TWO ROOTS FOUND .......... */
+L280:
+   p = (y - x) / 2.0;
+   q = p * p + w;
+   zz = hypre_sqrt(hypre_abs(q));
+   x += t;
+   if (q >= 0.0)
+   {
+      /*     .......... REAL PAIR .......... */
+      zz = (p < 0.0) ? p - zz : p + zz;
+      wr[na - 1] = x + zz;
+      wr[en - 1] = wr[na - 1];
+      if (zz != 0.0)
+      {
+         wr[en - 1] = x - w / zz;
+      }
+      wi[na - 1] = 0.0;
+      wi[en - 1] = 0.0;
+   }
+   else
+   {
+      /*     .......... COMPLEX PAIR .......... */
+      wr[na - 1] = x + p;
+      wr[en - 1] = x + p;
+      wi[na - 1] = zz;
+      wi[en - 1] = -zz;
+   }
+   en = enm2;
+   goto L60;
+
+   /*     .......... SET ERROR -- ALL EIGENVALUES HAVE NOT */
+   /*                CONVERGED AFTER 30*N ITERATIONS .......... */
+L1000:
+   ierr = en;
+L1001:
+   hypre_TFree(hh, HYPRE_MEMORY_HOST);
+
+#undef a
+
+   return ierr;
 }
 
 /*--------------------------------------------------------------------------
- * hypre_COGMRESSetCGS, hypre_COGMRESGetCGS
+ * hypre_COGMRESLejaOrder
+ *
+ * Orders the n values wr + i*wi in modified Leja order: each value maximizes
+ * the product of its distances to the values already chosen, and the second
+ * member of a complex conjugate pair always follows the first one (which has
+ * positive imaginary part). A pair that does not fit in the n slots is
+ * replaced by its real part.
  *--------------------------------------------------------------------------*/
 
-HYPRE_Int
-hypre_COGMRESSetCGS( void   *cogmres_vdata,
-                     HYPRE_Int   cgs )
+static void
+hypre_COGMRESLejaOrder( HYPRE_Int   n,
+                        HYPRE_Real *wr,
+                        HYPRE_Real *wi,
+                        HYPRE_Real *shift_re,
+                        HYPRE_Real *shift_im )
 {
-   hypre_COGMRESData *cogmres_data = (hypre_COGMRESData *) cogmres_vdata;
-   (cogmres_data -> cgs) = cgs;
-   return hypre_error_flag;
+   HYPRE_Int  *used = hypre_CTAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   HYPRE_Real  tiny = HYPRE_REAL_EPSILON;
+   HYPRE_Real  val, best_val, dr, di;
+   HYPRE_Int   cnt, best, i, m;
+
+   cnt = 0;
+   while (cnt < n)
+   {
+      best     = -1;
+      best_val = 0.0;
+      for (i = 0; i < n; i++)
+      {
+         if (used[i] || wi[i] < 0.0)
+         {
+            continue;
+         }
+         if (cnt == 0)
+         {
+            val = hypre_sqrt(wr[i] * wr[i] + wi[i] * wi[i]);
+         }
+         else
+         {
+            val = 0.0;
+            for (m = 0; m < cnt; m++)
+            {
+               dr   = wr[i] - shift_re[m];
+               di   = wi[i] - shift_im[m];
+               val += hypre_log(hypre_max(hypre_sqrt(dr * dr + di * di), tiny));
+            }
+         }
+         if (best < 0 || val > best_val)
+         {
+            best     = i;
+            best_val = val;
+         }
+      }
+      if (best < 0)
+      {
+         break;
+      }
+
+      used[best] = 1;
+      shift_re[cnt] = wr[best];
+      shift_im[cnt] = wi[best];
+      cnt++;
+      if (wi[best] > 0.0)
+      {
+         /* the conjugate is stored right after the value (see above) */
+         if (best + 1 < n)
+         {
+            used[best + 1] = 1;
+         }
+         if (cnt < n)
+         {
+            shift_re[cnt] = wr[best];
+            shift_im[cnt] = -wi[best];
+            cnt++;
+         }
+         else
+         {
+            shift_im[cnt - 1] = 0.0;
+         }
+      }
+   }
+
+   for (i = cnt; i < n; i++)
+   {
+      shift_re[i] = 0.0;
+      shift_im[i] = 0.0;
+   }
+
+   hypre_TFree(used, HYPRE_MEMORY_HOST);
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_COGMRESSolveSStep
+ *
+ * s-step (communication-avoiding) variant of hypre_COGMRESSolve. Each block
+ * of s basis vectors is generated by a chain of s preconditioner applications
+ * and matvecs, v_{l+1} = (A*M - theta_l*I) v_l, without any global reduction.
+ * The block is then orthogonalized against the previous basis vectors by a
+ * block classical Gram-Schmidt with reorthogonalization (BCGS2), and within
+ * itself by a Cholesky QR of its Gram matrix. Both passes take one global
+ * reduction each, so a block of s vectors costs two reductions instead of
+ * two or three per vector. The Hessenberg matrix is recovered from the
+ * change-of-basis relation and then handled as in the standard solver.
+ *
+ * The shifts theta_l are either zero (monomial basis) or, for the Newton
+ * basis, the Leja-ordered Ritz values from the first s Arnoldi steps, which
+ * are taken one vector at a time. Complex conjugate pairs a +/- ib are
+ * applied in real arithmetic as two steps (A*M - aI) v_l and
+ * (A*M - aI) v_{l+1} + b^2 v_l. If the Gram matrix of a block is not
+ * numerically positive definite, the block is recomputed with s = 1.
+ *
+ * The true residual is recomputed at each restart. The relative change
+ * stopping criterion is not supported by this variant.
+ *--------------------------------------------------------------------------*/
+
 HYPRE_Int
-hypre_COGMRESGetCGS( void   *cogmres_vdata,
-                     HYPRE_Int * cgs )
+hypre_COGMRESSolveSStep(void  *cogmres_vdata,
+                        void  *A,
+                        void  *b,
+                        void  *x)
 {
-   hypre_COGMRESData *cogmres_data = (hypre_COGMRESData *)cogmres_vdata;
-   *cgs = (cogmres_data -> cgs);
+   hypre_COGMRESData      *cogmres_data      = (hypre_COGMRESData *)cogmres_vdata;
+   hypre_COGMRESFunctions *cogmres_functions = cogmres_data->functions;
+   HYPRE_Int     k_dim             = (cogmres_data -> k_dim);
+   HYPRE_Int     unroll            = (cogmres_data -> unroll);
+   HYPRE_Int     s_step            = (cogmres_data -> s_step);
+   HYPRE_Int     s_step_basis      = (cogmres_data -> s_step_basis);
+   HYPRE_Int     min_iter          = (cogmres_data -> min_iter);
+   HYPRE_Int     max_iter          = (cogmres_data -> max_iter);
+   HYPRE_Int     skip_real_r_check = (cogmres_data -> skip_real_r_check);
+   HYPRE_Real    r_tol             = (cogmres_data -> tol);
+   HYPRE_Real    cf_tol            = (cogmres_data -> cf_tol);
+   HYPRE_Real    a_tol             = (cogmres_data -> a_tol);
+   void         *matvec_data       = (cogmres_data -> matvec_data);
+
+   void         *r                 = (cogmres_data -> r);
+   void         *w                 = (cogmres_data -> w);
+   void        **p                 = (cogmres_data -> p);
+
+   HYPRE_Int (*precond)(void*, void*, void*, void*) = (cogmres_functions -> precond);
+   HYPRE_Int  *precond_data       = (HYPRE_Int*)(cogmres_data -> precond_data);
+
+   HYPRE_Int print_level = (cogmres_data -> print_level);
+   HYPRE_Int logging     = (cogmres_data -> logging);
+
+   HYPRE_Real     *norms          = (cogmres_data -> norms);
+
+   /* relative tolerance for the pivots of the Cholesky QR of a block */
+   HYPRE_Real  chol_tol = 1.0e-10;
+   HYPRE_Real  epsmac = 1.e-16;
+   HYPRE_Real  ieee_check = 0.;
+
+   HYPRE_Int   break_value = 0, cycle_converged, have_shifts, chol_ok;
+   HYPRE_Int   i, j, k, l, m, s, sb, ldh, ldr, ldw, itmp = 0;
+   HYPRE_Int   iter, my_id, num_procs;
+   HYPRE_Real *rs, *hh, *hu, *c, *sn;
+   HYPRE_Real *shift_re, *shift_im, *theta, *beta2, *alpha;
+   HYPRE_Real *C, *W, *G, *R, *Rb, *Bm, *M1;
+   HYPRE_Real  epsilon, gamma, t, d, r_norm, b_norm, den_norm, r_norm_0;
+   HYPRE_Real  cf_ave_0 = 0.0, cf_ave_1 = 0.0, weight;
+   HYPRE_Real  real_r_norm_old;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   (cogmres_data -> converged) = 0;
+
+   (*(cogmres_functions->CommInfo))(A, &my_id, &num_procs);
+   if ( logging > 0 || print_level > 0 )
+   {
+      norms = (cogmres_data -> norms);
+   }
+
+   s   = hypre_min(s_step, k_dim);
+   ldh = k_dim + 1;
+
+   /* initialize work arrays */
+   rs = hypre_CTAllocF(HYPRE_Real, k_dim + 1, cogmres_functions, HYPRE_MEMORY_HOST);
+   c  = hypre_CTAllocF(HYPRE_Real, k_dim, cogmres_functions, HYPRE_MEMORY_HOST);
+   sn = hypre_CTAllocF(HYPRE_Real, k_dim, cogmres_functions, HYPRE_MEMORY_HOST);
+
+   /* hu holds the Hessenberg matrix, hh its Givens-rotated copy */
+   hh = hypre_CTAllocF(HYPRE_Real, (k_dim + 1) * k_dim, cogmres_functions, HYPRE_MEMORY_HOST);
+   hu = hypre_CTAllocF(HYPRE_Real, (k_dim + 1) * k_dim, cogmres_functions, HYPRE_MEMORY_HOST);
+
+   shift_re = hypre_CTAllocF(HYPRE_Real, s, cogmres_functions, HYPRE_MEMORY_HOST);
+   shift_im = hypre_CTAllocF(HYPRE_Real, s, cogmres_functions, HYPRE_MEMORY_HOST);
+   theta    = hypre_CTAllocF(HYPRE_Real, s, cogmres_functions, HYPRE_MEMORY_HOST);
+   beta2    = hypre_CTAllocF(HYPRE_Real, s, cogmres_functions, HYPRE_MEMORY_HOST);
+   alpha    = hypre_CTAllocF(HYPRE_Real, s, cogmres_functions, HYPRE_MEMORY_HOST);
+
+   /* block orthogonalization and change-of-basis work space */
+   C  = hypre_CTAllocF(HYPRE_Real, (k_dim + 1) * s, cogmres_functions, HYPRE_MEMORY_HOST);
+   W  = hypre_CTAllocF(HYPRE_Real, (k_dim + 1) * s, cogmres_functions, HYPRE_MEMORY_HOST);
+   G  = hypre_CTAllocF(HYPRE_Real, s * s, cogmres_functions, HYPRE_MEMORY_HOST);
+   R  = hypre_CTAllocF(HYPRE_Real, s * s, cogmres_functions, HYPRE_MEMORY_HOST);
+   Rb = hypre_CTAllocF(HYPRE_Real, (k_dim + 1) * (s + 1), cogmres_functions, HYPRE_MEMORY_HOST);
+   Bm = hypre_CTAllocF(HYPRE_Real, (s + 1) * s, cogmres_functions, HYPRE_MEMORY_HOST);
+   M1 = hypre_CTAllocF(HYPRE_Real, (k_dim + 1) * s, cogmres_functions, HYPRE_MEMORY_HOST);
+
+   /* a monomial basis needs no Ritz values */
+   have_shifts = (s_step_basis == 1) ? 0 : 1;
+
+   /* compute initial residual */
+   (*(cogmres_functions->CopyVector))(b, p[0]);
+   (*(cogmres_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, p[0]);
+
+   b_norm = hypre_sqrt((*(cogmres_functions->InnerProd))(b, b));
+   r_norm = hypre_sqrt((*(cogmres_functions->InnerProd))(p[0], p[0]));
+   r_norm_0 = r_norm;
+   real_r_norm_old = r_norm;
+
+   /* Since it does not diminish performance, attempt to return an error flag
+      and notify users when they supply bad input. */
+   if (b_norm != 0.) { ieee_check = b_norm / b_norm; } /* INF -> NaN conversion */
+   if (r_norm != 0.) { ieee_check += r_norm / r_norm; }
+   if (ieee_check != ieee_check)
+   {
+      if (logging > 0 || print_level > 0)
+      {
+         hypre_printf("\n\nERROR detected by Hypre ... BEGIN\n");
+         hypre_printf("ERROR -- hypre_COGMRESSolveSStep: INFs and/or NaNs detected in input.\n");
+         hypre_printf("User probably placed non-numerics in supplied A, b or x_0.\n");
+         hypre_printf("Returning error flag += 101.  Program not terminated.\n");
+         hypre_printf("ERROR detected by Hypre ... END\n\n\n");
+      }
+      hypre_error(HYPRE_ERROR_GENERIC);
+      break_value = 1;
+   }
+
+   if ( (logging > 0 || print_level > 0) && !break_value )
+   {
+      norms[0] = r_norm;
+      if ( print_level > 1 && my_id == 0 )
+      {
+         hypre_printf("L2 norm of b: %e\n", b_norm);
+         if (b_norm == 0.0)
+         {
+            hypre_printf("Rel_resid_norm actually contains the residual norm\n");
+         }
+         hypre_printf("Initial L2 norm of residual: %e\n", r_norm);
+      }
+   }
+   iter = 0;
+
+   /* convergence criteria: |r_i| <= max( a_tol, r_tol * den_norm),
+      den_norm = |b| if |b| > 0 and |r_0| otherwise */
+   den_norm = (b_norm > 0.0) ? b_norm : r_norm;
+   epsilon  = hypre_max(a_tol, r_tol * den_norm);
+
+   if ( print_level > 1 && my_id == 0 && !break_value )
+   {
+      hypre_printf("=============================================\n\n");
+      if (b_norm > 0.0)
+      {
+         hypre_printf("Iters     resid.norm     conv.rate  rel.res.norm\n");
+         hypre_printf("-----    ------------    ---------- ------------\n");
+      }
+      else
+      {
+         hypre_printf("Iters     resid.norm     conv.rate\n");
+         hypre_printf("-----    ------------    ----------\n");
+      }
+   }
+
+   while (!break_value)
+   {
+      /* here p[0] holds the true residual and r_norm its norm */
+      if (r_norm == 0.0 || (r_norm <= epsilon && iter >= min_iter))
+      {
+         if ( print_level > 1 && my_id == 0 )
+         {
+            hypre_printf("\n\n");
+            hypre_printf("Final L2 norm of residual: %e\n\n", r_norm);
+         }
+         (cogmres_data -> converged) = 1;
+         break;
+      }
+      if (iter >= max_iter)
+      {
+         break;
+      }
+
+      (*(cogmres_functions->ScaleVector))(1.0 / r_norm, p[0]);
+      rs[0] = r_norm;
+      for (k = 1; k <= k_dim; k++)
+      {
+         rs[k] = 0.0;
+      }
+      cycle_converged = 0;
+      i = 0;
+
+      /*** RESTART CYCLE (right-preconditioning), s columns at a time ***/
+      while (i < k_dim && iter < max_iter && !cycle_converged && !break_value)
+      {
+         sb = hypre_min(s, k_dim - i);
+         sb = hypre_min(sb, max_iter - iter);
+         if (!have_shifts)
+         {
+            /* Arnoldi steps whose Hessenberg matrix gives the Ritz values */
+            sb = 1;
+         }
+
+         chol_ok = 0;
+         while (!chol_ok)
+         {
+            for (l = 0; l < sb; l++)
+            {
+               theta[l] = 0.0;
+               beta2[l] = 0.0;
+               if (have_shifts && s_step_basis == 1)
+               {
+                  theta[l] = shift_re[l];
+                  if (l > 0 && shift_im[l - 1] > 0.0 && shift_im[l] < 0.0)
+                  {
+                     beta2[l] = shift_im[l - 1] * shift_im[l - 1];
+                  }
+               }
+            }
+
+            /* basis vectors v_l = p[i+l], l = 0..sb, with v_0 = q_i */
+            for (l = 0; l < sb; l++)
+            {
+               (*(cogmres_functions->ClearVector))(r);
+               precond(precond_data, A, p[i + l], r);
+               (*(cogmres_functions->Matvec))(matvec_data, 1.0, A, r, 0.0, p[i + l + 1]);
+               if (theta[l] != 0.0)
+               {
+                  (*(cogmres_functions->Axpy))(-theta[l], p[i + l], p[i + l + 1]);
+               }
+               if (beta2[l] != 0.0)
+               {
+                  (*(cogmres_functions->Axpy))(beta2[l], p[i + l - 1], p[i + l + 1]);
+               }
+            }
+
+            /* first pass: C = Q^T V, V = V - Q C */
+            hypre_COGMRESBlockInnerProd(cogmres_functions, p, i + 1, &p[i + 1], sb,
+                                        unroll, C);
+            for (l = 0; l < sb; l++)
+            {
+               for (m = 0; m <= i; m++)
+               {
+                  W[m] = -C[l * (i + 1) + m];
+               }
+               (*(cogmres_functions->MassAxpy))(W, p, p[i + l + 1], i + 1, unroll);
+            }
+
+            /* second pass: [Q V]^T V gives the correction of C and the Gram
+               matrix of V, corrected for the second projection below */
+            ldw = i + 1 + sb;
+            hypre_COGMRESBlockInnerProd(cogmres_functions, p, ldw, &p[i + 1], sb,
+                                        unroll, W);
+            for (l = 0; l < sb; l++)
+            {
+               for (m = 0; m <= i; m++)
+               {
+                  C[l * (i + 1) + m] += W[l * ldw + m];
+                  M1[m] = -W[l * ldw + m];
+               }
+               (*(cogmres_functions->MassAxpy))(M1, p, p[i + l + 1], i + 1, unroll);
+               for (m = 0; m < sb; m++)
+               {
+                  t = W[l * ldw + i + 1 + m];
+                  for (k = 0; k <= i; k++)
+                  {
+                     t -= W[m * ldw + k] * W[l * ldw + k];
+                  }
+                  G[l * sb + m] = t;
+               }
+            }
+
+            /* Cholesky factorization G = R^T R */
+            chol_ok = 1;
+            for (l = 0; l < sb && chol_ok; l++)
+            {
+               for (m = 0; m < l; m++)
+               {
+                  t = G[l * sb + m];
+                  for (k = 0; k < m; k++)
+                  {
+                     t -= R[m * sb + k] * R[l * sb + k];
+                  }
+                  R[l * sb + m] = t / R[m * sb + m];
+               }
+               d = G[l * sb + l];
+               for (k = 0; k < l; k++)
+               {
+                  d -= R[l * sb + k] * R[l * sb + k];
+               }
+               if (d <= chol_tol * W[l * ldw + i + 1 + l])
+               {
+                  if (sb > 1)
+                  {
+                     chol_ok = 0;
+                  }
+                  /* for a single vector this is a (near) breakdown */
+                  d = hypre_max(d, 0.0);
+               }
+               R[l * sb + l] = hypre_sqrt(d);
+            }
+
+            if (!chol_ok)
+            {
+               if (print_level > 1 && my_id == 0)
+               {
+                  hypre_printf("s-step block of size %d is ill-conditioned, using size 1\n", sb);
+               }
+               sb = 1;
+            }
+         }
+
+         /* Q_new = V R^{-1} */
+         for (l = 0; l < sb; l++)
+         {
+            if (l > 0)
+            {
+               for (m = 0; m < l; m++)
+               {
+                  alpha[m] = -R[l * sb + m];
+               }
+               (*(cogmres_functions->MassAxpy))(alpha, &p[i + 1], p[i + l + 1], l, unroll);
+            }
+            if (R[l * sb + l] != 0.0)
+            {
+               (*(cogmres_functions->ScaleVector))(1.0 / R[l * sb + l], p[i + l + 1]);
+            }
+         }
+
+         /* [v_0 .. v_sb] = Q Rb with Rb of size (i+sb+1) x (sb+1) and
+            A M [v_0 .. v_{sb-1}] = [v_0 .. v_sb] Bm with Bm of size (sb+1) x sb */
+         ldr = i + sb + 1;
+         for (k = 0; k < ldr * (sb + 1); k++)
+         {
+            Rb[k] = 0.0;
+         }
+         Rb[i] = 1.0;
+         for (l = 1; l <= sb; l++)
+         {
+            for (m = 0; m <= i; m++)
+            {
+               Rb[l * ldr + m] = C[(l - 1) * (i + 1) + m];
+            }
+            for (m = 0; m < l; m++)
+            {
+               Rb[l * ldr + i + 1 + m] = R[(l - 1) * sb + m];
+            }
+         }
+         for (k = 0; k < (sb + 1) * sb; k++)
+         {
+            Bm[k] = 0.0;
+         }
+         for (l = 0; l < sb; l++)
+         {
+            Bm[l * (sb + 1) + l]     = theta[l];
+            Bm[l * (sb + 1) + l + 1] = 1.0;
+            if (l > 0)
+            {
+               Bm[l * (sb + 1) + l - 1] = -beta2[l];
+            }
+         }
+
+         /* The new Hessenberg columns H_new satisfy
+            H_new T = Rb Bm - H_old X, where T = Rb(i:i+sb-1, 0:sb-1) is upper
+            triangular and X = Rb(0:i-1, 0:sb-1) */
+         for (l = 0; l < sb; l++)
+         {
+            for (m = 0; m < ldr; m++)
+            {
+               t = 0.0;
+               for (k = hypre_max(l - 1, 0); k <= l + 1; k++)
+               {
+                  t += Rb[k * ldr + m] * Bm[l * (sb + 1) + k];
+               }
+               M1[l * ldr + m] = t;
+            }
+            for (k = 0; k < i; k++)
+            {
+               t = Rb[l * ldr + k];
+               if (t != 0.0)
+               {
+                  for (m = 0; m <= k + 1; m++)
+                  {
+                     M1[l * ldr + m] -= hu[k * ldh + m] * t;
+                  }
+               }
+            }
+         }
+         for (l = 0; l < sb; l++)
+         {
+            for (m = 0; m < ldr; m++)
+            {
+               t = M1[l * ldr + m];
+               for (k = 0; k < l; k++)
+               {
+                  t -= hu[(i + k) * ldh + m] * Rb[l * ldr + i + k];
+               }
+               hu[(i + l) * ldh + m] = t / Rb[l * ldr + i + l];
+            }
+            for (m = ldr; m <= k_dim; m++)
+            {
+               hu[(i + l) * ldh + m] = 0.0;
+            }
+         }
+
+         /* apply the Givens rotations to the new columns one at a time */
+         for (l = 0; l < sb; l++)
+         {
+            i++;
+            iter++;
+            itmp = (i - 1) * ldh;
+
+            for (j = 0; j <= i; j++)
+            {
+               hh[itmp + j] = hu[itmp + j];
+            }
+            for (j = 1; j < i; j++)
+            {
+               t = hh[itmp + j - 1];
+               hh[itmp + j - 1] = sn[j - 1] * hh[itmp + j] + c[j - 1] * t;
+               hh[itmp + j] = -sn[j - 1] * t + c[j - 1] * hh[itmp + j];
+            }
+            t = hh[itmp + i] * hh[itmp + i];
+            t += hh[itmp + i - 1] * hh[itmp + i - 1];
+            gamma = hypre_sqrt(t);
+            if (gamma == 0.0) { gamma = epsmac; }
+            c[i - 1] = hh[itmp + i - 1] / gamma;
+            sn[i - 1] = hh[itmp + i] / gamma;
+            rs[i] = -hh[itmp + i] * rs[i - 1];
+            rs[i] /=  gamma;
+            rs[i - 1] = c[i - 1] * rs[i - 1];
+            hh[itmp + i - 1] = sn[i - 1] * hh[itmp + i] + c[i - 1] * hh[itmp + i - 1];
+            r_norm = hypre_abs(rs[i]);
+            if ( print_level > 0 )
+            {
+               norms[iter] = r_norm;
+               if ( print_level > 1 && my_id == 0 )
+               {
+                  if (b_norm > 0.0)
+                     hypre_printf("% 5d    %e    %f   %e\n", iter,
+                                  norms[iter], norms[iter] / norms[iter - 1],
+                                  norms[iter] / b_norm);
+                  else
+                     hypre_printf("% 5d    %e    %f\n", iter, norms[iter],
+                                  norms[iter] / norms[iter - 1]);
+               }
+            }
+            /* convergence factor tolerance */
+            if (cf_tol > 0.0)
+            {
+               cf_ave_0 = cf_ave_1;
+               cf_ave_1 = hypre_pow( r_norm / r_norm_0, 1.0 / (2.0 * iter));
+
+               weight = hypre_abs(cf_ave_1 - cf_ave_0);
+               weight = weight / hypre_max(cf_ave_1, cf_ave_0);
+               weight = 1.0 - weight;
+               if (weight * cf_ave_1 > cf_tol)
+               {
+                  break_value = 1;
+                  break;
+               }
+            }
+            if (r_norm <= epsilon && iter >= min_iter)
+            {
+               cycle_converged = 1;
+               break;
+            }
+         }
+
+         /* Newton shifts from the Ritz values of the first s Arnoldi steps */
+         if (!have_shifts && i >= s)
+         {
+            for (k = 0; k < s; k++)
+            {
+               theta[k] = 0.0;
+               beta2[k] = 0.0;
+            }
+            if (hypre_COGMRESHessenbergEigenvalues(s, hu, ldh, theta, beta2))
+            {
+               /* no convergence: fall back to the monomial basis */
+               for (k = 0; k < s; k++)
+               {
+                  theta[k] = 0.0;
+                  beta2[k] = 0.0;
+               }
+            }
+            hypre_COGMRESLejaOrder(s, theta, beta2, shift_re, shift_im);
+            have_shifts = 1;
+            if (print_level > 2 && my_id == 0)
+            {
+               for (k = 0; k < s; k++)
+               {
+                  hypre_printf("s-step Newton shift %d: %e %+e i\n", k, shift_re[k], shift_im[k]);
+               }
+            }
+         }
+      } /*** end of restart cycle ***/
+
+      if (break_value && i == 0)
+      {
+         break;
+      }
+
+      /* now compute solution, first solve upper triangular system */
+      rs[i - 1] = rs[i - 1] / hh[itmp + i - 1];
+      for (k = i - 2; k >= 0; k--)
+      {
+         t = 0.0;
+         for (j = k + 1; j < i; j++)
+         {
+            t -= hh[j * ldh + k] * rs[j];
+         }
+         t += rs[k];
+         rs[k] = t / hh[k * ldh + k];
+      }
+
+      (*(cogmres_functions->CopyVector))(p[i - 1], w);
+      (*(cogmres_functions->ScaleVector))(rs[i - 1], w);
+      for (j = i - 2; j >= 0; j--)
+      {
+         (*(cogmres_functions->Axpy))(rs[j], p[j], w);
+      }
+
+      (*(cogmres_functions->ClearVector))(r);
+      /* find correction (in r) */
+      precond(precond_data, A, w, r);
+
+      /* update current solution x (in x) */
+      (*(cogmres_functions->Axpy))(1.0, r, x);
+
+      if (break_value)
+      {
+         break;
+      }
+
+      if (cycle_converged && skip_real_r_check)
+      {
+         (cogmres_data -> converged) = 1;
+         break;
+      }
+
+      /* restart from the true residual */
+      (*(cogmres_functions->CopyVector))(b, p[0]);
+      (*(cogmres_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, p[0]);
+      r_norm = hypre_sqrt((*(cogmres_functions->InnerProd))(p[0], p[0]));
+
+      if (cycle_converged && r_norm > epsilon)
+      {
+         /* exit if the real residual norm has not decreased */
+         if (r_norm >= real_r_norm_old)
+         {
+            if (print_level > 1 && my_id == 0)
+            {
+               hypre_printf("\n\n");
+               hypre_printf("Final L2 norm of residual: %e\n\n", r_norm);
+            }
+            (cogmres_data -> converged) = 1;
+            break;
+         }
+         if ( print_level > 0 && my_id == 0)
+         {
+            hypre_printf("false convergence 2, L2 norm of residual: %e\n", r_norm);
+         }
+      }
+      real_r_norm_old = r_norm;
+   } /* END of iteration while loop */
+
+   (cogmres_data -> num_iterations) = iter;
+   if (b_norm > 0.0)
+   {
+      (cogmres_data -> rel_residual_norm) = r_norm / b_norm;
+   }
+   if (b_norm == 0.0)
+   {
+      (cogmres_data -> rel_residual_norm) = r_norm;
+   }
+
+   if (iter >= max_iter && r_norm > epsilon && epsilon > 0) { hypre_error(HYPRE_ERROR_CONV); }
+
+   hypre_TFreeF(c, cogmres_functions);
+   hypre_TFreeF(sn, cogmres_functions);
+   hypre_TFreeF(rs, cogmres_functions);
+   hypre_TFreeF(hh, cogmres_functions);
+   hypre_TFreeF(hu, cogmres_functions);
+   hypre_TFreeF(shift_re, cogmres_functions);
+   hypre_TFreeF(shift_im, cogmres_functions);
+   hypre_TFreeF(theta, cogmres_functions);
+   hypre_TFreeF(beta2, cogmres_functions);
+   hypre_TFreeF(alpha, cogmres_functions);
+   hypre_TFreeF(C, cogmres_functions);
+   hypre_TFreeF(W, cogmres_functions);
+   hypre_TFreeF(G, cogmres_functions);
+   hypre_TFreeF(R, cogmres_functions);
+   hypre_TFreeF(Rb, cogmres_functions);
+   hypre_TFreeF(Bm, cogmres_functions);
+   hypre_TFreeF(M1, cogmres_functions);
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_COGMRESSetKDim, hypre_COGMRESGetKDim
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_COGMRESSetKDim( void   *cogmres_vdata,
+                      HYPRE_Int   k_dim )
+{
+   hypre_COGMRESData *cogmres_data = (hypre_COGMRESData *) cogmres_vdata;
+   (cogmres_data -> k_dim) = k_dim;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_COGMRESGetKDim( void   *cogmres_vdata,
+                      HYPRE_Int * k_dim )
+{
+   hypre_COGMRESData *cogmres_data = (hypre_COGMRESData *)cogmres_vdata;
+   *k_dim = (cogmres_data -> k_dim);
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_COGMRESSetUnroll, hypre_COGMRESGetUnroll
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_COGMRESSetUnroll( void   *cogmres_vdata,
+                        HYPRE_Int   unroll )
+{
+   hypre_COGMRESData *cogmres_data = (hypre_COGMRESData *) cogmres_vdata;
+   (cogmres_data -> unroll) = unroll;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_COGMRESGetUnroll( void   *cogmres_vdata,
+                        HYPRE_Int * unroll )
+{
+   hypre_COGMRESData *cogmres_data = (hypre_COGMRESData *)cogmres_vdata;
+   *unroll = (cogmres_data -> unroll);
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_COGMRESSetCGS, hypre_COGMRESGetCGS
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_COGMRESSetCGS( void   *cogmres_vdata,
+                     HYPRE_Int   cgs )
+{
+   hypre_COGMRESData *cogmres_data = (hypre_COGMRESData *) cogmres_vdata;
+   (cogmres_data -> cgs) = cgs;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_COGMRESGetCGS( void   *cogmres_vdata,
+                     HYPRE_Int * cgs )
+{
+   hypre_COGMRESData *cogmres_data = (hypre_COGMRESData *)cogmres_vdata;
+   *cgs = (cogmres_data -> cgs);
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_COGMRESSetSStep, hypre_COGMRESGetSStep
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_COGMRESSetSStep( void   *cogmres_vdata,
+                       HYPRE_Int   s_step )
+{
+   hypre_COGMRESData *cogmres_data = (hypre_COGMRESData *) cogmres_vdata;
+   (cogmres_data -> s_step) = s_step;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_COGMRESGetSStep( void   *cogmres_vdata,
+                       HYPRE_Int * s_step )
+{
+   hypre_COGMRESData *cogmres_data = (hypre_COGMRESData *)cogmres_vdata;
+   *s_step = (cogmres_data -> s_step);
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_COGMRESSetSStepBasis, hypre_COGMRESGetSStepBasis
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_COGMRESSetSStepBasis( void   *cogmres_vdata,
+                            HYPRE_Int   s_step_basis )
+{
+   hypre_COGMRESData *cogmres_data = (hypre_COGMRESData *) cogmres_vdata;
+   (cogmres_data -> s_step_basis) = s_step_basis;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_COGMRESGetSStepBasis( void   *cogmres_vdata,
+                            HYPRE_Int * s_step_basis )
+{
+   hypre_COGMRESData *cogmres_data = (hypre_COGMRESData *)cogmres_vdata;
+   *s_step_basis = (cogmres_data -> s_step_basis);
    return hypre_error_flag;
 }
 
@@ -67,6 +67,11 @@ typedef struct
    HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
    HYPRE_Int    (*MassAxpy)      ( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k,
                                    HYPRE_Int unroll);
+
+   /* optional block inner products, used by s-step COGMRES */
+   HYPRE_Int    (*BlockInnerProd)( void **x, HYPRE_Int nx, void **y, HYPRE_Int ny,
+                                   HYPRE_Real *result );
+
    HYPRE_Int    (*precond)       ();
    HYPRE_Int    (*precond_setup) ();
 
@@ -83,6 +88,8 @@ typedef struct
    HYPRE_Int      k_dim;
    HYPRE_Int      unroll;
    HYPRE_Int      cgs;
+   HYPRE_Int      s_step;
+   HYPRE_Int      s_step_basis;
    HYPRE_Int      min_iter;
    HYPRE_Int      max_iter;
    HYPRE_Int      rel_change;
@@ -158,6 +165,19 @@ hypre_COGMRESFunctionsCreate(
    HYPRE_Int    (*Precond)       ( void *vdata, void *A, void *b, void *x )
 );
 
+/**
+ * Description...
+ *
+ * @param param [IN] ...
+ **/
+
+HYPRE_Int
+hypre_COGMRESFunctionsSetBlockInnerProd(
+   hypre_COGMRESFunctions *cogmres_functions,
+   HYPRE_Int    (*BlockInnerProd)( void **x, HYPRE_Int nx, void **y, HYPRE_Int ny,
+                                   HYPRE_Real *result )
+);
+
 /**
  * Description...
  *
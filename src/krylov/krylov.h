@@ -577,6 +577,11 @@ typedef struct
    HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
    HYPRE_Int    (*MassAxpy)      ( HYPRE_Complex * alpha, void **x, void *y, HYPRE_Int k,
                                    HYPRE_Int unroll);
+
+   /* optional block inner products, used by s-step COGMRES */
+   HYPRE_Int    (*BlockInnerProd)( void **x, HYPRE_Int nx, void **y, HYPRE_Int ny,
+                                   HYPRE_Real *result );
+
    HYPRE_Int    (*precond)       (void *vdata, void *A, void *b, void *x);
    HYPRE_Int    (*precond_setup) (void *vdata, void *A, void *b, void *x);
 
@@ -594,6 +599,8 @@ typedef struct
    HYPRE_Int      k_dim;
    HYPRE_Int      unroll;
    HYPRE_Int      cgs;
+   HYPRE_Int      s_step;
+   HYPRE_Int      s_step_basis;
    HYPRE_Int      min_iter;
    HYPRE_Int      max_iter;
    HYPRE_Int      rel_change;
@@ -670,6 +677,19 @@ extern "C" {
       HYPRE_Int    (*Precond)       ( void *vdata, void *A, void *b, void *x )
    );
 
+   /**
+    * Description...
+    *
+    * @param param [IN] ...
+    **/
+
+   HYPRE_Int
+   hypre_COGMRESFunctionsSetBlockInnerProd(
+      hypre_COGMRESFunctions *cogmres_functions,
+      HYPRE_Int    (*BlockInnerProd)( void **x, HYPRE_Int nx, void **y, HYPRE_Int ny,
+                                      HYPRE_Real *result )
+   );
+
    /**
     * Description...
     *
@@ -1067,6 +1087,11 @@ typedef struct
    HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
    HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
 
+   /* optional non-blocking inner products, used by pipelined CG */
+   HYPRE_Int    (*IInnerProd)    ( HYPRE_Int nprod, void **x, void **y,
+                                   HYPRE_Real *result, void **request );
+   HYPRE_Int    (*InnerProdWait) ( void *request );
+
    HYPRE_Int    (*precond)(void *vdata, void *A, void *b, void *x);
    HYPRE_Int    (*precond_setup)(void *vdata, void *A, void *b, void *x);
 
@@ -1124,6 +1149,7 @@ typedef struct
    HYPRE_Int      hybrid;
    HYPRE_Int      skip_break;
    HYPRE_Int      flex;
+   HYPRE_Int      pipelined;
 
    void    *A;
    void    *p;
@@ -1133,6 +1159,15 @@ typedef struct
    void    *r_old; /* only needed for flexible CG */
    void    *v; /* work vector; only needed if recompute_residual_p is set */
 
+   /* work vectors only needed for pipelined CG: u = C*r, w = A*u, m = C*w,
+      n = A*m, and the recurrences q = C*s and z = A*q */
+   void    *u;
+   void    *w;
+   void    *m;
+   void    *n;
+   void    *q;
+   void    *z;
+
    HYPRE_Int      owns_matvec_data;  /* normally 1; if 0, don't delete it */
    void    *matvec_data;
    void    *precond_data;
@@ -1191,6 +1226,20 @@ extern "C" {
       HYPRE_Int    (*Precond)       ( void *vdata, void *A, void *b, void *x )
    );
 
+   /**
+    * Description...
+    *
+    * @param param [IN] ...
+    **/
+
+   HYPRE_Int
+   hypre_PCGFunctionsSetIInnerProd(
+      hypre_PCGFunctions *pcg_functions,
+      HYPRE_Int    (*IInnerProd)    ( HYPRE_Int nprod, void **x, void **y,
+                                      HYPRE_Real *result, void **request ),
+      HYPRE_Int    (*InnerProdWait) ( void *request )
+   );
+
    /**
     * Description...
     *
@@ -1293,12 +1342,17 @@ HYPRE_Int hypre_COGMRESDestroy ( void *gmres_vdata );
 HYPRE_Int hypre_COGMRESGetResidual ( void *gmres_vdata, void **residual );
 HYPRE_Int hypre_COGMRESSetup ( void *gmres_vdata, void *A, void *b, void *x );
 HYPRE_Int hypre_COGMRESSolve ( void *gmres_vdata, void *A, void *b, void *x );
+HYPRE_Int hypre_COGMRESSolveSStep ( void *gmres_vdata, void *A, void *b, void *x );
 HYPRE_Int hypre_COGMRESSetKDim ( void *gmres_vdata, HYPRE_Int k_dim );
 HYPRE_Int hypre_COGMRESGetKDim ( void *gmres_vdata, HYPRE_Int *k_dim );
 HYPRE_Int hypre_COGMRESSetUnroll ( void *gmres_vdata, HYPRE_Int unroll );
 HYPRE_Int hypre_COGMRESGetUnroll ( void *gmres_vdata, HYPRE_Int *unroll );
 HYPRE_Int hypre_COGMRESSetCGS ( void *gmres_vdata, HYPRE_Int cgs );
 HYPRE_Int hypre_COGMRESGetCGS ( void *gmres_vdata, HYPRE_Int *cgs );
+HYPRE_Int hypre_COGMRESSetSStep ( void *gmres_vdata, HYPRE_Int s_step );
+HYPRE_Int hypre_COGMRESGetSStep ( void *gmres_vdata, HYPRE_Int *s_step );
+HYPRE_Int hypre_COGMRESSetSStepBasis ( void *gmres_vdata, HYPRE_Int s_step_basis );
+HYPRE_Int hypre_COGMRESGetSStepBasis ( void *gmres_vdata, HYPRE_Int *s_step_basis );
 HYPRE_Int hypre_COGMRESSetTol ( void *gmres_vdata, HYPRE_Real tol );
 HYPRE_Int hypre_COGMRESGetTol ( void *gmres_vdata, HYPRE_Real *tol );
 HYPRE_Int hypre_COGMRESSetAbsoluteTol ( void *gmres_vdata, HYPRE_Real a_tol );
@@ -1479,6 +1533,10 @@ HYPRE_Int HYPRE_COGMRESSetUnroll ( HYPRE_Solver solver, HYPRE_Int unroll );
 HYPRE_Int HYPRE_COGMRESGetUnroll ( HYPRE_Solver solver, HYPRE_Int *unroll );
 HYPRE_Int HYPRE_COGMRESSetCGS ( HYPRE_Solver solver, HYPRE_Int cgs );
 HYPRE_Int HYPRE_COGMRESGetCGS ( HYPRE_Solver solver, HYPRE_Int *cgs );
+HYPRE_Int HYPRE_COGMRESSetSStep ( HYPRE_Solver solver, HYPRE_Int s_step );
+HYPRE_Int HYPRE_COGMRESGetSStep ( HYPRE_Solver solver, HYPRE_Int *s_step );
+HYPRE_Int HYPRE_COGMRESSetSStepBasis ( HYPRE_Solver solver, HYPRE_Int s_step_basis );
+HYPRE_Int HYPRE_COGMRESGetSStepBasis ( HYPRE_Solver solver, HYPRE_Int *s_step_basis );
 HYPRE_Int HYPRE_COGMRESSetTol ( HYPRE_Solver solver, HYPRE_Real tol );
 HYPRE_Int HYPRE_COGMRESGetTol ( HYPRE_Solver solver, HYPRE_Real *tol );
 HYPRE_Int HYPRE_COGMRESSetAbsoluteTol ( HYPRE_Solver solver, HYPRE_Real a_tol );
@@ -1596,6 +1654,8 @@ HYPRE_Int HYPRE_PCGSetSkipBreak ( HYPRE_Solver solver, HYPRE_Int skip_break );
 HYPRE_Int HYPRE_PCGGetSkipBreak ( HYPRE_Solver solver, HYPRE_Int *skip_break );
 HYPRE_Int HYPRE_PCGSetFlex ( HYPRE_Solver solver, HYPRE_Int flex );
 HYPRE_Int HYPRE_PCGGetFlex ( HYPRE_Solver solver, HYPRE_Int *flex );
+HYPRE_Int HYPRE_PCGSetPipelined ( HYPRE_Solver solver, HYPRE_Int pipelined );
+HYPRE_Int HYPRE_PCGGetPipelined ( HYPRE_Solver solver, HYPRE_Int *pipelined );
 HYPRE_Int HYPRE_PCGSetPrecond ( HYPRE_Solver solver, HYPRE_PtrToSolverFcn precond,
                                 HYPRE_PtrToSolverFcn precond_setup, HYPRE_Solver precond_solver );
 HYPRE_Int HYPRE_PCGSetPreconditioner ( HYPRE_Solver solver, HYPRE_Solver precond_solver );
@@ -1615,6 +1675,7 @@ HYPRE_Int hypre_PCGDestroy ( void *pcg_vdata );
 HYPRE_Int hypre_PCGGetResidual ( void *pcg_vdata, void **residual );
 HYPRE_Int hypre_PCGSetup ( void *pcg_vdata, void *A, void *b, void *x );
 HYPRE_Int hypre_PCGSolve ( void *pcg_vdata, void *A, void *b, void *x );
+HYPRE_Int hypre_PCGSolvePipelined ( void *pcg_vdata, void *A, void *b, void *x );
 HYPRE_Int hypre_PCGSetTol ( void *pcg_vdata, HYPRE_Real tol );
 HYPRE_Int hypre_PCGGetTol ( void *pcg_vdata, HYPRE_Real *tol );
 HYPRE_Int hypre_PCGSetAbsoluteTol ( void *pcg_vdata, HYPRE_Real a_tol );
@@ -1641,6 +1702,8 @@ HYPRE_Int hypre_PCGSetSkipBreak ( void *pcg_vdata, HYPRE_Int skip_break );
 HYPRE_Int hypre_PCGGetSkipBreak ( void *pcg_vdata, HYPRE_Int *skip_break );
 HYPRE_Int hypre_PCGSetFlex ( void *pcg_vdata, HYPRE_Int flex );
 HYPRE_Int hypre_PCGGetFlex ( void *pcg_vdata, HYPRE_Int *flex );
+HYPRE_Int hypre_PCGSetPipelined ( void *pcg_vdata, HYPRE_Int pipelined );
+HYPRE_Int hypre_PCGGetPipelined ( void *pcg_vdata, HYPRE_Int *pipelined );
 HYPRE_Int hypre_PCGGetPrecond ( void *pcg_vdata, HYPRE_Solver *precond_data_ptr );
 HYPRE_Int hypre_PCGSetPrecond ( void *pcg_vdata,
                                 HYPRE_Int (*precond )(void*, void*, void*, void*),
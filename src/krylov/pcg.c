@@ -65,6 +65,8 @@ hypre_PCGFunctionsCreate(
    pcg_functions->ClearVector = ClearVector;
    pcg_functions->ScaleVector = ScaleVector;
    pcg_functions->Axpy = Axpy;
+   pcg_functions->IInnerProd = NULL;
+   pcg_functions->InnerProdWait = NULL;
    /* default preconditioner must be set here but can be changed later... */
    pcg_functions->precond_setup = PrecondSetup;
    pcg_functions->precond       = Precond;
@@ -72,6 +74,80 @@ hypre_PCGFunctionsCreate(
    return pcg_functions;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGFunctionsSetIInnerProd
+ *
+ * Sets the optional non-blocking inner products. IInnerProd starts the
+ * computation of the nprod inner products <x[k],y[k]> into result and returns
+ * a request, which InnerProdWait completes and frees. Pipelined CG uses them
+ * to overlap its global reduction with the preconditioner and the matvec.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGFunctionsSetIInnerProd(
+   hypre_PCGFunctions *pcg_functions,
+   HYPRE_Int    (*IInnerProd)    ( HYPRE_Int nprod, void **x, void **y,
+                                   HYPRE_Real *result, void **request ),
+   HYPRE_Int    (*InnerProdWait) ( void *request )
+)
+{
+   pcg_functions->IInnerProd    = IInnerProd;
+   pcg_functions->InnerProdWait = InnerProdWait;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGDestroyPipelinedVectors
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_PCGDestroyPipelinedVectors( hypre_PCGData *pcg_data )
+{
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
+   void              **vectors[6];
+   HYPRE_Int           k;
+
+   vectors[0] = &(pcg_data -> u);
+   vectors[1] = &(pcg_data -> w);
+   vectors[2] = &(pcg_data -> m);
+   vectors[3] = &(pcg_data -> n);
+   vectors[4] = &(pcg_data -> q);
+   vectors[5] = &(pcg_data -> z);
+
+   for (k = 0; k < 6; k++)
+   {
+      if (*vectors[k] != NULL)
+      {
+         (*(pcg_functions->DestroyVector))(*vectors[k]);
+         *vectors[k] = NULL;
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGCreatePipelinedVectors
+ *
+ * u, m and q live in the space of x; w, n and z in the space of b.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_PCGCreatePipelinedVectors( hypre_PCGData *pcg_data,
+                                 void          *b,
+                                 void          *x )
+{
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
+
+   hypre_PCGDestroyPipelinedVectors(pcg_data);
+
+   (pcg_data -> u) = (*(pcg_functions->CreateVector))(x);
+   (pcg_data -> w) = (*(pcg_functions->CreateVector))(b);
+   (pcg_data -> m) = (*(pcg_functions->CreateVector))(x);
+   (pcg_data -> n) = (*(pcg_functions->CreateVector))(b);
+   (pcg_data -> q) = (*(pcg_functions->CreateVector))(x);
+   (pcg_data -> z) = (*(pcg_functions->CreateVector))(b);
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGCreate
  *--------------------------------------------------------------------------*/
@@ -114,6 +190,13 @@ hypre_PCGCreate( hypre_PCGFunctions *pcg_functions )
    (pcg_data -> r)            = NULL;
    (pcg_data -> r_old)        = NULL;
    (pcg_data -> v)            = NULL;
+   (pcg_data -> pipelined)    = 0;
+   (pcg_data -> u)            = NULL;
+   (pcg_data -> w)            = NULL;
+   (pcg_data -> m)            = NULL;
+   (pcg_data -> n)            = NULL;
+   (pcg_data -> q)            = NULL;
+   (pcg_data -> z)            = NULL;
 
    HYPRE_ANNOTATE_FUNC_END;
 
@@ -174,6 +257,7 @@ hypre_PCGDestroy( void *pcg_vdata )
          (*(pcg_functions->DestroyVector))(pcg_data -> v);
          pcg_data -> v = NULL;
       }
+      hypre_PCGDestroyPipelinedVectors(pcg_data);
       hypre_TFreeF( pcg_data, pcg_functions );
       hypre_TFreeF( pcg_functions, pcg_functions );
    }
@@ -268,6 +352,11 @@ hypre_PCGSetup( void *pcg_vdata,
       (pcg_data -> v) = (*(pcg_functions->CreateVector))(b);
    }
 
+   if (pcg_data -> pipelined)
+   {
+      hypre_PCGCreatePipelinedVectors(pcg_data, b, x);
+   }
+
    precond_setup(precond_data, A, b, x);
 
    /*-----------------------------------------------------
@@ -379,6 +468,11 @@ hypre_PCGSolve( void *pcg_vdata,
    HYPRE_Int       i = 0;
    HYPRE_Int       my_id, num_procs;
 
+   if (pcg_data -> pipelined)
+   {
+      return hypre_PCGSolvePipelined(pcg_vdata, A, b, x);
+   }
+
    HYPRE_ANNOTATE_FUNC_BEGIN;
 
    (pcg_data -> converged) = 0;
@@ -1007,6 +1101,419 @@ hypre_PCGSolve( void *pcg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGStartInnerProds, hypre_PCGWaitInnerProds
+ *
+ * Start and complete the nprod inner products <x[k],y[k]>. Without
+ * non-blocking inner products in the vector interface, they are computed
+ * one after another by hypre_PCGStartInnerProds.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_PCGStartInnerProds( hypre_PCGFunctions *pcg_functions,
+                          HYPRE_Int           nprod,
+                          void              **x,
+                          void              **y,
+                          HYPRE_Real         *result,
+                          void              **request )
+{
+   HYPRE_Int k;
+
+   if (pcg_functions -> IInnerProd)
+   {
+      (*(pcg_functions->IInnerProd))(nprod, x, y, result, request);
+   }
+   else
+   {
+      for (k = 0; k < nprod; k++)
+      {
+         result[k] = (*(pcg_functions->InnerProd))(x[k], y[k]);
+      }
+      *request = NULL;
+   }
+}
+
+static void
+hypre_PCGWaitInnerProds( hypre_PCGFunctions *pcg_functions,
+                         void               *request )
+{
+   if (pcg_functions -> IInnerProd)
+   {
+      (*(pcg_functions->InnerProdWait))(request);
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGSolvePipelined
+ *
+ * Pipelined preconditioned CG (Ghysels and Vanroose, Parallel Computing 40,
+ * 2014). The inner products <r,u> and <w,u>, with u = C*r and w = A*u, are
+ * reduced together once per iteration, and the reduction is overlapped with
+ * the preconditioner application m = C*w and the matvec n = A*m. The
+ * residual and the directions are then updated through recurrences, which
+ * costs a few more vector updates than hypre_PCGSolve.
+ *
+ * The convergence test is the one of hypre_PCGSolve, evaluated one
+ * iteration later since gamma = <r,u> is only available after the next
+ * reduction. The recurrences can drift from the true residual over long
+ * solves: recompute_residual_p replaces r, u and w by b - A*x, C*r and A*u
+ * every recompute_residual_p iterations (restarting the directions), and
+ * recompute_residual confirms convergence with the true residual.
+ * The flex and rtol options are not supported by this variant.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGSolvePipelined( void *pcg_vdata,
+                         void *A,
+                         void *b,
+                         void *x         )
+{
+   hypre_PCGData  *pcg_data     =  (hypre_PCGData *)pcg_vdata;
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
+
+   HYPRE_Real      r_tol        = (pcg_data -> tol);
+   HYPRE_Real      a_tol        = (pcg_data -> a_tol);
+   HYPRE_Real      atolf        = (pcg_data -> atolf);
+   HYPRE_Real      cf_tol       = (pcg_data -> cf_tol);
+   HYPRE_Int       max_iter     = (pcg_data -> max_iter);
+   HYPRE_Int       two_norm     = (pcg_data -> two_norm);
+   HYPRE_Int       rel_change   = (pcg_data -> rel_change);
+   HYPRE_Int       recompute_residual   = (pcg_data -> recompute_residual);
+   HYPRE_Int       recompute_residual_p = (pcg_data -> recompute_residual_p);
+   HYPRE_Int       stop_crit    = (pcg_data -> stop_crit);
+   HYPRE_Int       hybrid       = (pcg_data -> hybrid);
+   HYPRE_Int       skip_break   = (pcg_data -> skip_break);
+   void           *p            = (pcg_data -> p);
+   void           *s            = (pcg_data -> s);
+   void           *r            = (pcg_data -> r);
+   void           *u, *w, *m, *n, *q, *z;
+   void           *matvec_data  = (pcg_data -> matvec_data);
+   HYPRE_Int     (*precond)(void*, void*, void*, void*)   = (pcg_functions -> precond);
+   void           *precond_data = (pcg_data -> precond_data);
+   HYPRE_Int       print_level  = (pcg_data -> print_level);
+   HYPRE_Int       logging      = (pcg_data -> logging);
+   HYPRE_Real     *norms        = (pcg_data -> norms);
+   HYPRE_Real     *rel_norms    = (pcg_data -> rel_norms);
+
+   void           *prod_x[3], *prod_y[3];
+   HYPRE_Real      prods[3];
+   HYPRE_Int       nprod;
+   void           *request;
+
+   HYPRE_Real      alpha = 0.0, alpha_old = 0.0, beta;
+   HYPRE_Real      gamma, gamma_old = 0.0, delta;
+   HYPRE_Real      bi_prod, eps;
+   HYPRE_Real      pi_prod, xi_prod, ratio;
+   HYPRE_Real      i_prod = 0.0, i_prod_0 = 0.0;
+   HYPRE_Real      cf_ave_0 = 0.0, cf_ave_1 = 0.0, weight;
+   HYPRE_Real      ieee_check = 0.;
+
+   HYPRE_Int       restart = 1;
+   HYPRE_Int       tentatively_converged;
+   HYPRE_Int       i = 0;
+   HYPRE_Int       my_id, num_procs;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   (pcg_data -> converged) = 0;
+
+   (*(pcg_functions->CommInfo))(A, &my_id, &num_procs);
+
+   /* pipelined may have been switched on after the setup */
+   if ((pcg_data -> u) == NULL)
+   {
+      hypre_PCGCreatePipelinedVectors(pcg_data, b, x);
+   }
+   u = (pcg_data -> u);
+   w = (pcg_data -> w);
+   m = (pcg_data -> m);
+   n = (pcg_data -> n);
+   q = (pcg_data -> q);
+   z = (pcg_data -> z);
+
+   /* compute eps */
+   if (two_norm)
+   {
+      /* bi_prod = <b,b> */
+      bi_prod = (*(pcg_functions->InnerProd))(b, b);
+   }
+   else
+   {
+      /* bi_prod = <C*b,b> */
+      (*(pcg_functions->ClearVector))(p);
+      precond(precond_data, A, b, p);
+      bi_prod = (*(pcg_functions->InnerProd))(p, b);
+   }
+
+   if (bi_prod != 0.) { ieee_check = bi_prod / bi_prod; } /* INF -> NaN conversion */
+   if (ieee_check != ieee_check)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "INFs and/or NaNs detected in input b in PCG");
+      HYPRE_ANNOTATE_FUNC_END;
+
+      return hypre_error_flag;
+   }
+
+   eps = r_tol * r_tol;
+   if ( bi_prod > 0.0 )
+   {
+      if ( stop_crit && !rel_change && atolf <= 0 ) /* pure absolute tolerance */
+      {
+         eps = eps / bi_prod;
+      }
+      else if ( atolf > 0 ) /* mixed relative and absolute tolerance */
+      {
+         bi_prod += atolf;
+      }
+      else
+      {
+         eps = hypre_max(r_tol * r_tol, a_tol * a_tol / bi_prod);
+      }
+   }
+   else    /* bi_prod==0.0: the rhs vector b is zero */
+   {
+      /* Set x equal to zero and return */
+      (*(pcg_functions->CopyVector))(b, x);
+      if (logging > 0 || print_level > 0)
+      {
+         norms[0]     = 0.0;
+         rel_norms[0] = 0.0;
+      }
+      HYPRE_ANNOTATE_FUNC_END;
+
+      return hypre_error_flag;
+   }
+
+   /* r = b - Ax, u = C*r, w = A*u */
+   (*(pcg_functions->CopyVector))(b, r);
+   (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+   (*(pcg_functions->ClearVector))(u);
+   precond(precond_data, A, r, u);
+   (*(pcg_functions->Matvec))(matvec_data, 1.0, A, u, 0.0, w);
+
+   if ( print_level > 1 && my_id == 0 )
+   {
+      hypre_printf("\n\n");
+      if (two_norm)
+      {
+         hypre_printf("Iters       ||r||_2     conv.rate  ||r||_2/||b||_2\n");
+         hypre_printf("-----    ------------   ---------  ------------ \n");
+      }
+      else
+      {
+         hypre_printf("Iters       ||r||_C     conv.rate  ||r||_C/||b||_C\n");
+         hypre_printf("-----    ------------    ---------  ------------ \n");
+      }
+   }
+
+   while (1)
+   {
+      /*--------------------------------------------------------------------
+       * Start the reduction of gamma = <r,u>, delta = <w,u> (and <r,r>),
+       * and hide it behind m = C*w and n = A*m
+       *--------------------------------------------------------------------*/
+
+      prod_x[0] = r;  prod_y[0] = u;
+      prod_x[1] = w;  prod_y[1] = u;
+      prod_x[2] = r;  prod_y[2] = r;
+      nprod = two_norm ? 3 : 2;
+      hypre_PCGStartInnerProds(pcg_functions, nprod, prod_x, prod_y, prods, &request);
+
+      (*(pcg_functions->ClearVector))(m);
+      precond(precond_data, A, w, m);
+      (*(pcg_functions->Matvec))(matvec_data, 1.0, A, m, 0.0, n);
+
+      hypre_PCGWaitInnerProds(pcg_functions, request);
+
+      gamma  = prods[0];
+      delta  = prods[1];
+      i_prod = two_norm ? prods[2] : gamma;
+
+      if (i == 0)
+      {
+         if (gamma != 0.) { ieee_check = gamma / gamma; } /* INF -> NaN conversion */
+         if (ieee_check != ieee_check)
+         {
+            hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                              "INFs and/or NaNs detected in input A or x_0 in PCG");
+            HYPRE_ANNOTATE_FUNC_END;
+
+            return hypre_error_flag;
+         }
+         i_prod_0 = i_prod;
+      }
+
+      /* print norm info */
+      if ( logging > 0 || print_level > 0 )
+      {
+         norms[i]     = hypre_sqrt(i_prod);
+         rel_norms[i] = hypre_sqrt(i_prod / bi_prod);
+      }
+      if ( print_level > 1 && my_id == 0 && i > 0 )
+      {
+         hypre_printf("% 5d    %e    %f    %e\n", i, norms[i],
+                      norms[i] / norms[i - 1], rel_norms[i] );
+      }
+
+      /*--------------------------------------------------------------------
+       * check for convergence
+       *--------------------------------------------------------------------*/
+
+      tentatively_converged = (i_prod / bi_prod < eps);
+      if ( tentatively_converged && recompute_residual )
+      {
+         /* r = b - Ax, u = C*r, w = A*u */
+         (*(pcg_functions->CopyVector))(b, r);
+         (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+         (*(pcg_functions->ClearVector))(u);
+         precond(precond_data, A, r, u);
+
+         i_prod = two_norm ? (*(pcg_functions->InnerProd))(r, r) :
+                  (*(pcg_functions->InnerProd))(r, u);
+         if (i_prod / bi_prod >= eps)
+         {
+            /* restart from the true residual */
+            (*(pcg_functions->Matvec))(matvec_data, 1.0, A, u, 0.0, w);
+            restart = 1;
+            continue;
+         }
+      }
+      if ( tentatively_converged && rel_change && i > 0 )
+      {
+         pi_prod = (*(pcg_functions->InnerProd))(p, p);
+         xi_prod = (*(pcg_functions->InnerProd))(x, x);
+         ratio = alpha_old * alpha_old * pi_prod / xi_prod;
+         if (ratio >= eps) { tentatively_converged = 0; }
+      }
+      if ( tentatively_converged )
+      {
+         (pcg_data -> converged) = 1;
+         break;
+      }
+
+      if (i >= max_iter)
+      {
+         break;
+      }
+
+      /* gamma should generally be greater than 0 for spd prec and nonzero r */
+      if (gamma <= 0.0 && skip_break < 3)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_CONV, "Negative or zero gamma value in PCG");
+         break;
+      }
+
+      /* optional test to see if adequate progress is being made */
+      if (cf_tol > 0.0 && i > 0 && i_prod_0 > 0.0)
+      {
+         cf_ave_0 = cf_ave_1;
+         cf_ave_1 = hypre_pow( i_prod / i_prod_0, 1.0 / (2.0 * i) );
+
+         weight   = hypre_abs(cf_ave_1 - cf_ave_0);
+         weight   = weight / hypre_max(cf_ave_1, cf_ave_0);
+         weight   = 1.0 - weight;
+         if (weight * cf_ave_1 > cf_tol) { break; }
+      }
+
+      /*--------------------------------------------------------------------
+       * the core pipelined CG calculations
+       *--------------------------------------------------------------------*/
+
+      i++;
+
+      if (restart)
+      {
+         beta  = 0.0;
+         alpha = gamma / delta;
+      }
+      else
+      {
+         beta  = gamma / gamma_old;
+         alpha = gamma / (delta - beta * gamma / alpha_old);
+      }
+
+      /* alpha should always be greater zero for spd A, spd precond. and nonzero p, r */
+      if (!(alpha > 0.0) && skip_break < 3)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_CONV, "Negative or zero alpha value in PCG");
+         break;
+      }
+
+      /* z = n + beta*z, q = m + beta*q, s = w + beta*s, p = u + beta*p */
+      if (restart)
+      {
+         (*(pcg_functions->CopyVector))(n, z);
+         (*(pcg_functions->CopyVector))(m, q);
+         (*(pcg_functions->CopyVector))(w, s);
+         (*(pcg_functions->CopyVector))(u, p);
+      }
+      else
+      {
+         (*(pcg_functions->ScaleVector))(beta, z);
+         (*(pcg_functions->Axpy))(1.0, n, z);
+         (*(pcg_functions->ScaleVector))(beta, q);
+         (*(pcg_functions->Axpy))(1.0, m, q);
+         (*(pcg_functions->ScaleVector))(beta, s);
+         (*(pcg_functions->Axpy))(1.0, w, s);
+         (*(pcg_functions->ScaleVector))(beta, p);
+         (*(pcg_functions->Axpy))(1.0, u, p);
+      }
+
+      /* x = x + alpha*p */
+      (*(pcg_functions->Axpy))(alpha, p, x);
+
+      if ( recompute_residual_p && !(i % recompute_residual_p) )
+      {
+         if (print_level > 1 && my_id == 0)
+         {
+            hypre_printf("Recomputing the residual...\n");
+         }
+
+         /* r = b - Ax, u = C*r, w = A*u */
+         (*(pcg_functions->CopyVector))(b, r);
+         (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+         (*(pcg_functions->ClearVector))(u);
+         precond(precond_data, A, r, u);
+         (*(pcg_functions->Matvec))(matvec_data, 1.0, A, u, 0.0, w);
+         restart = 1;
+      }
+      else
+      {
+         /* r = r - alpha*s, u = u - alpha*q, w = w - alpha*z */
+         (*(pcg_functions->Axpy))(-alpha, s, r);
+         (*(pcg_functions->Axpy))(-alpha, q, u);
+         (*(pcg_functions->Axpy))(-alpha, z, w);
+         restart = 0;
+      }
+
+      gamma_old = gamma;
+      alpha_old = alpha;
+   }
+
+   /*--------------------------------------------------------------------
+    * Finish up with some outputs.
+    *--------------------------------------------------------------------*/
+
+   if ( print_level > 1 && my_id == 0 )
+   {
+      hypre_printf("\n\n");
+   }
+
+   if (i >= max_iter && (i_prod / bi_prod) >= eps && eps > 0 && hybrid != -1)
+   {
+      char msg[1024];
+      hypre_sprintf(msg, "Reached max iterations %d in PCG before convergence", max_iter);
+      hypre_error_w_msg(HYPRE_ERROR_CONV, msg);
+   }
+
+   (pcg_data -> num_iterations)    = i;
+   (pcg_data -> rel_residual_norm) = hypre_sqrt(i_prod / bi_prod);
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGSetTol, hypre_PCGGetTol
  *--------------------------------------------------------------------------*/
@@ -1357,6 +1864,32 @@ hypre_PCGGetFlex( void *pcg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGSetPipelined, hypre_PCGGetPipelined
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGSetPipelined( void *pcg_vdata,
+                       HYPRE_Int   pipelined  )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   (pcg_data -> pipelined) = pipelined;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PCGGetPipelined( void *pcg_vdata,
+                       HYPRE_Int * pipelined  )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   *pipelined = (pcg_data -> pipelined);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGGetPrecond
  *--------------------------------------------------------------------------*/
@@ -64,6 +64,11 @@ typedef struct
    HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
    HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
 
+   /* optional non-blocking inner products, used by pipelined CG */
+   HYPRE_Int    (*IInnerProd)    ( HYPRE_Int nprod, void **x, void **y,
+                                   HYPRE_Real *result, void **request );
+   HYPRE_Int    (*InnerProdWait) ( void *request );
+
    HYPRE_Int    (*precond)();
    HYPRE_Int    (*precond_setup)();
 
@@ -122,6 +127,7 @@ typedef struct
    HYPRE_Int    hybrid;
    HYPRE_Int    skip_break;
    HYPRE_Int    flex;
+   HYPRE_Int    pipelined;
 
    void    *A;
    void    *p;
@@ -131,6 +137,15 @@ typedef struct
    void    *r_old; /* old residual needed for flexible CG, PR method */
    void    *v; /* work vector only needed if recompute_residual_p uis used */
 
+   /* work vectors only needed for pipelined CG: u = C*r, w = A*u, m = C*w,
+      n = A*m, and the recurrences q = C*s and z = A*q */
+   void    *u;
+   void    *w;
+   void    *m;
+   void    *n;
+   void    *q;
+   void    *z;
+
    HYPRE_Int  owns_matvec_data;  /* normally 1; if 0, don't delete it */
    void      *matvec_data;
    void      *precond_data;
@@ -188,6 +203,20 @@ hypre_PCGFunctionsCreate(
    HYPRE_Int    (*Precond)       ( void *vdata, void *A, void *b, void *x )
 );
 
+/**
+ * Description...
+ *
+ * @param param [IN] ...
+ **/
+
+HYPRE_Int
+hypre_PCGFunctionsSetIInnerProd(
+   hypre_PCGFunctions *pcg_functions,
+   HYPRE_Int    (*IInnerProd)    ( HYPRE_Int nprod, void **x, void **y,
+                                   HYPRE_Real *result, void **request ),
+   HYPRE_Int    (*InnerProdWait) ( void *request )
+);
+
 /**
  * Description...
  *
@@ -587,6 +587,42 @@ HYPRE_BoomerAMGGetFCycle( HYPRE_Solver solver,
    return ( hypre_BoomerAMGGetFCycle( (void *) solver, fcycle ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetAdaptiveCycle, HYPRE_BoomerAMGGetAdaptiveCycle
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetAdaptiveCycle( HYPRE_Solver solver,
+                                 HYPRE_Int    adaptive_cycle  )
+{
+   return ( hypre_BoomerAMGSetAdaptiveCycle( (void *) solver, adaptive_cycle ) );
+}
+
+HYPRE_Int
+HYPRE_BoomerAMGGetAdaptiveCycle( HYPRE_Solver solver,
+                                 HYPRE_Int   *adaptive_cycle  )
+{
+   return ( hypre_BoomerAMGGetAdaptiveCycle( (void *) solver, adaptive_cycle ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetAdaptiveCycleTol, HYPRE_BoomerAMGGetAdaptiveCycleTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetAdaptiveCycleTol( HYPRE_Solver solver,
+                                    HYPRE_Real   adaptive_cycle_tol  )
+{
+   return ( hypre_BoomerAMGSetAdaptiveCycleTol( (void *) solver, adaptive_cycle_tol ) );
+}
+
+HYPRE_Int
+HYPRE_BoomerAMGGetAdaptiveCycleTol( HYPRE_Solver solver,
+                                    HYPRE_Real  *adaptive_cycle_tol  )
+{
+   return ( hypre_BoomerAMGGetAdaptiveCycleTol( (void *) solver, adaptive_cycle_tol ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetConvergeType, HYPRE_BoomerAMGGetConvergeType
  *--------------------------------------------------------------------------*/
@@ -1883,6 +1919,28 @@ HYPRE_BoomerAMGSetChebyVariant( HYPRE_Solver  solver,
    return ( hypre_BoomerAMGSetChebyVariant( (void *) solver, variant ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetChebyLanczos
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetChebyLanczos( HYPRE_Solver  solver,
+                                HYPRE_Int     lanczos )
+{
+   return ( hypre_BoomerAMGSetChebyLanczos( (void *) solver, lanczos ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetChebyEigRefreshTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetChebyEigRefreshTol( HYPRE_Solver  solver,
+                                      HYPRE_Real    refresh_tol )
+{
+   return ( hypre_BoomerAMGSetChebyEigRefreshTol( (void *) solver, refresh_tol ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetChebyEigEst
  *--------------------------------------------------------------------------*/
@@ -2100,6 +2158,61 @@ HYPRE_BoomerAMGSetKeepTranspose (HYPRE_Solver solver,
    return (hypre_BoomerAMGSetKeepTranspose ( (void *) solver, keepTranspose ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetMatvecFormat
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetMatvecFormat (HYPRE_Solver solver,
+                                HYPRE_Int    matvec_format)
+{
+   return (hypre_BoomerAMGSetMatvecFormat ( (void *) solver, matvec_format ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetMatvecFormatNumLevels
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetMatvecFormatNumLevels (HYPRE_Solver solver,
+                                         HYPRE_Int    num_levels)
+{
+   return (hypre_BoomerAMGSetMatvecFormatNumLevels ( (void *) solver, num_levels ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetMatvecOverlap
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetMatvecOverlap (HYPRE_Solver solver,
+                                 HYPRE_Int    matvec_overlap)
+{
+   return (hypre_BoomerAMGSetMatvecOverlap ( (void *) solver, matvec_overlap ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetSinglePrecisionLevel
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetSinglePrecisionLevel (HYPRE_Solver solver,
+                                        HYPRE_Int    level)
+{
+   return (hypre_BoomerAMGSetSinglePrecisionLevel ( (void *) solver, level ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetSetupReuse
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetSetupReuse (HYPRE_Solver solver,
+                              HYPRE_Int    setup_reuse)
+{
+   return (hypre_BoomerAMGSetSetupReuse ( (void *) solver, setup_reuse ) );
+}
+
 #ifdef HYPRE_USING_DSUPERLU
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetDSLUThreshold
@@ -2190,3 +2303,16 @@ HYPRE_BoomerAMGGetCumNnzAP( HYPRE_Solver  solver,
 {
    return ( hypre_BoomerAMGGetCumNnzAP( (void *) solver, cum_nnz_AP ) );
 }
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGGetMemoryUsage
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGGetMemoryUsage( HYPRE_Solver  solver,
+                               HYPRE_Int     level,
+                               HYPRE_Int     object_class,
+                               HYPRE_Real   *bytes )
+{
+   return ( hypre_BoomerAMGGetMemoryUsage( (void *) solver, level, object_class, bytes ) );
+}
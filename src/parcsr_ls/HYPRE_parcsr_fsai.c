@@ -264,6 +264,28 @@ HYPRE_FSAIGetKapTolerance( HYPRE_Solver  solver,
    return ( hypre_FSAIGetKapTolerance( (void *) solver, kap_tolerance ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_FSAISetReuse
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_FSAISetReuse( HYPRE_Solver solver,
+                    HYPRE_Int    reuse )
+{
+   return ( hypre_FSAISetReuse( (void *) solver, reuse ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_FSAIGetReuse
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_FSAIGetReuse( HYPRE_Solver  solver,
+                    HYPRE_Int    *reuse )
+{
+   return ( hypre_FSAIGetReuse( (void *) solver, reuse ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_FSAISetTolerance
  *--------------------------------------------------------------------------*/
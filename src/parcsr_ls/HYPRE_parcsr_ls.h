@@ -159,6 +159,28 @@ HYPRE_Int HYPRE_BoomerAMGGetCumNnzAP(HYPRE_Solver  solver,
 HYPRE_Int HYPRE_BoomerAMGSetCumNnzAP(HYPRE_Solver  solver,
                                      HYPRE_Real    cum_nnz_AP);
 
+/**
+ * Returns the number of bytes held on this process by the AMG hierarchy
+ * built in the last setup. \e level selects one level of the hierarchy,
+ * or all levels if set to -1. \e object\_class selects one of the
+ * following object classes, or all of them if set to -1:
+ *
+ *    - 0 : operators A
+ *    - 1 : interpolation operators P
+ *    - 2 : restriction operators R (if different from P^T)
+ *    - 3 : communication packages of A, P and R
+ *    - 4 : smoother data (l1 norms, Chebyshev, multicolor and FSAI data)
+ *    - 5 : vectors (level 0 holds the work vectors of the solve phase)
+ *    - 6 : other setup data (CF markers, dof functions, reused setup data)
+ *
+ * The sizes are computed from the hierarchy on each call. The right-hand
+ * side and solution vectors passed by the user are not included.
+ **/
+HYPRE_Int HYPRE_BoomerAMGGetMemoryUsage(HYPRE_Solver  solver,
+                                        HYPRE_Int     level,
+                                        HYPRE_Int     object_class,
+                                        HYPRE_Real   *bytes);
+
 /**
  * Returns the norm of the final relative residual.
  **/
@@ -584,6 +606,36 @@ HYPRE_Int
 HYPRE_BoomerAMGSetFCycle( HYPRE_Solver solver,
                           HYPRE_Int    fcycle  );
 
+/**
+ * (Optional) Enables adaptive cycling. Every \e adaptive_cycle cycles
+ * (starting with the first cycle after setup), a full probing cycle
+ * measures on each level the residual reduction of the post-smoothing and
+ * of the coarse-grid correction. Until the next probing cycle, the
+ * post-smoothing is skipped on levels where it reduces the residual by a
+ * factor worse than the tolerance set by
+ * HYPRE_BoomerAMGSetAdaptiveCycleTol, and the cycle is truncated at the
+ * finest level (other than 0) below which the coarse-grid correction and
+ * post-smoothing together do so. The choices are printed after each
+ * cycle for print levels larger than 1.
+ *
+ * Since the cycle is not symmetric and changes between probing cycles, use
+ * it as a solver or as a preconditioner for a flexible Krylov method such as
+ * FlexGMRES.
+ * The default is 0 (no adaptive cycling).
+ **/
+HYPRE_Int
+HYPRE_BoomerAMGSetAdaptiveCycle( HYPRE_Solver solver,
+                                 HYPRE_Int    adaptive_cycle  );
+
+/**
+ * (Optional) Residual reduction factor above which the adaptive cycle
+ * skips post-smoothing or truncates the cycle (see
+ * HYPRE_BoomerAMGSetAdaptiveCycle). The default is 0.9.
+ **/
+HYPRE_Int
+HYPRE_BoomerAMGSetAdaptiveCycleTol( HYPRE_Solver solver,
+                                    HYPRE_Real   adaptive_cycle_tol  );
+
 /**
  * (Optional) Defines use of an additive V(1,1)-cycle using the
  * classical additive method starting at level 'addlvl'.
@@ -755,8 +807,14 @@ HYPRE_Int HYPRE_BoomerAMGSetGridRelaxType(HYPRE_Solver  solver,
  *    - 29 : Direct solve: use Gaussian elimination & BLAS
  *                        (with pivoting) (old version)
  *    - 30 : Kaczmarz
+ *    - 31 : multicolor hybrid Gauss-Seidel or SOR (host only). The local rows
+ *           are colored at setup and each color is relaxed by all threads,
+ *           so the result does not depend on the number of threads
+ *    - 32 : the same as 31 with the colors visited in reverse order
+ *    - 33 : multicolor hybrid symmetric Gauss-Seidel or SSOR (31 followed by 32)
  *    - 88:  The same methods as 8 with a convergent l1-term
  *    - 89:  Symmetric l1-hybrid Gauss-Seidel (i.e., 13 followed by 14)
+ *    - 97 : banded LU on the agglomerated matrix (only on coarsest level)
  *    - 98 : LU with pivoting
  *    - 99 : LU with pivoting
  *    -199 : Matvec with the inverse
@@ -781,6 +839,11 @@ HYPRE_Int HYPRE_BoomerAMGSetRelaxType(HYPRE_Solver  solver,
  *      - 98  : LU factorization with pivoting.
  *      - 198 : explicit (dense) inverse.
  *
+ *   For coarsest level systems agglomerated in sparse form on one active rank:
+ *      - 97  : banded LU factorization with pivoting after RCM reordering.
+ *              Only the agglomerating rank stores the factors; the right-hand
+ *              side and solution are gathered/scattered at every solve.
+ *
  * Options for \e k are
  *
  *    - 1 : the down cycle
@@ -888,7 +951,8 @@ HYPRE_Int HYPRE_BoomerAMGSetLevelOuterWt(HYPRE_Solver  solver,
 
 /**
  * (Optional) Defines the Order for Chebyshev smoother.
- *  The default is 2 (valid options are 1-4).
+ *  The default is 2 (valid options are 1-4, any positive order for the
+ *  fourth-kind variant).
  **/
 HYPRE_Int HYPRE_BoomerAMGSetChebyOrder(HYPRE_Solver solver,
                                        HYPRE_Int    order);
@@ -910,6 +974,14 @@ HYPRE_Int HYPRE_BoomerAMGSetChebyScale (HYPRE_Solver solver,
 /**
  * (Optional) Defines which polynomial variant should be used.
  *  The default is 0 (i.e., scaled).
+ *
+ *  - 0 : standard Chebyshev polynomial
+ *  - 1 : modified Chebyshev polynomial
+ *  - 2 : fourth-kind Chebyshev polynomial (host only). It only uses the upper
+ *        eigenvalue bound, ignores the fraction, and supports any order. For
+ *        the same number of matrix-vector products it damps the upper part
+ *        of the spectrum better than variant 0, so a lower order is usually
+ *        enough.
  **/
 HYPRE_Int HYPRE_BoomerAMGSetChebyVariant (HYPRE_Solver solver,
                                           HYPRE_Int   variant);
@@ -925,6 +997,26 @@ HYPRE_Int HYPRE_BoomerAMGSetChebyVariant (HYPRE_Solver solver,
 HYPRE_Int HYPRE_BoomerAMGSetChebyEigEst (HYPRE_Solver solver,
                                          HYPRE_Int   eig_est);
 
+/**
+ * (Optional) If lanczos is 1, the eig_est iterations of
+ * HYPRE_BoomerAMGSetChebyEigEst run a Lanczos process on the (scaled)
+ * operator instead of CG. Each step needs a single global reduction.
+ * The default is 0.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetChebyLanczos (HYPRE_Solver solver,
+                                          HYPRE_Int    lanczos);
+
+/**
+ * (Optional) If refresh_tol is positive, the Chebyshev eigenvalue estimates
+ * are kept per level across calls to HYPRE_BoomerAMGSetup. A level is
+ * estimated again only if its global size changes or the Frobenius norm of
+ * its matrix changes by more than refresh_tol (relative). This avoids the
+ * estimation cost when the setup is repeated for matrices with slowly
+ * changing values. The default is 0 (estimate on every setup).
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetChebyEigRefreshTol (HYPRE_Solver solver,
+                                                HYPRE_Real   refresh_tol);
+
 /**
  * (Optional) Enables the use of more complex smoothers.
  * The following options exist for \e smooth_type:
@@ -1334,6 +1426,69 @@ HYPRE_Int HYPRE_BoomerAMGSetModuleRAP2(HYPRE_Solver solver,
 HYPRE_Int HYPRE_BoomerAMGSetKeepTranspose(HYPRE_Solver solver,
                                           HYPRE_Int    keepTranspose);
 
+/**
+ * (Optional) Selects the host kernel used by the matrix-vector products
+ * with A, P and R during the solve phase:
+ *
+ *    - 0 : CSR (default)
+ *    - 1 : SELL-C-sigma (sliced ELLPACK); a sorted and padded copy of each
+ *          operator is built on its first matvec, roughly doubling the
+ *          memory used by the operators
+ *
+ * The setup phase always works on CSR. The SELL copy of the fine-level
+ * matrix is rebuilt after its values are changed through the IJ interface
+ * (HYPRE_IJMatrixSetValues, AddToValues, SetConstantValues or Assemble);
+ * code that writes into the ParCSR arrays directly must call
+ * HYPRE_ParCSRMatrixSetMatvecFormat again. See also
+ * HYPRE_BoomerAMGSetMatvecFormatNumLevels.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetMatvecFormat(HYPRE_Solver solver,
+                                         HYPRE_Int    matvec_format);
+
+/**
+ * (Optional) Restricts the matvec format chosen with
+ * HYPRE_BoomerAMGSetMatvecFormat to the operators of levels 0 through
+ * num_levels-1. The default is to use it on all levels.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetMatvecFormatNumLevels(HYPRE_Solver solver,
+                                                  HYPRE_Int    num_levels);
+
+/**
+ * (Optional) If set to 1, the host matrix-vector products with A and P
+ * on all levels compute the rows that have no off-processor coupling while
+ * the halo exchange is in flight, using persistent MPI requests. Rows that
+ * need halo values are computed after the exchange. The default is 0.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetMatvecOverlap(HYPRE_Solver solver,
+                                          HYPRE_Int    matvec_overlap);
+
+/**
+ * (Optional) Keeps a single-precision copy of the values of A, P and R on
+ * levels level and coarser, which the host matvecs and the Jacobi and
+ * non-weighted hybrid Gauss-Seidel smoothers read instead of the
+ * double-precision values. Vectors and sums stay in double precision, and
+ * the finest level is never converted, so an outer Krylov solver is not
+ * affected. The default is 0, which disables this option.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetSinglePrecisionLevel(HYPRE_Solver solver,
+                                                 HYPRE_Int    level);
+
+/**
+ * (Optional) If set to 1, the strength matrix and the C/F splitting of each
+ * level are kept, and later calls to HYPRE_BoomerAMGSetup with a matrix of
+ * the same size, row partition and sparsity pattern skip the strength and
+ * coarsening steps. Interpolation and coarse-grid operators are recomputed
+ * from the new values. Each coarse level is checked in the same way, so a
+ * coarse matrix whose pattern changed (e.g. through interpolation truncation)
+ * is coarsened again, as are all coarser levels. Any other matrix gets a full
+ * setup.
+ * Setting it to 0 discards the kept data at the next setup. Not available
+ * with block or nodal systems AMG, aggressive coarsening, GSMG, non-Galerkin
+ * restriction (AIR), or device execution. The default is 0.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetSetupReuse(HYPRE_Solver solver,
+                                       HYPRE_Int    setup_reuse);
+
 /**
  * HYPRE_BoomerAMGSetPlotGrids
  **/
@@ -1638,7 +1793,11 @@ HYPRE_Int HYPRE_FSAISolve( HYPRE_Solver       solver,
  *
  *      - 1: Adaptive (can use OpenMP with static scheduling)
  *      - 2: Adaptive OpenMP with dynamic scheduling
- *      - 3: Static - power pattern
+ *      - 3: Static - power pattern. The candidate pattern of row i of G is
+ *           given by the lower triangular part of the (filtered) local
+ *           matrix power A^{num_levels}, truncated to the max_nnz_row
+ *           largest entries. The dense local systems are solved in
+ *           batches of equal size.
  **/
 HYPRE_Int HYPRE_FSAISetAlgoType( HYPRE_Solver solver,
                                  HYPRE_Int    algo_type );
@@ -1701,6 +1860,16 @@ HYPRE_Int HYPRE_FSAISetThreshold( HYPRE_Solver solver,
 HYPRE_Int HYPRE_FSAISetKapTolerance( HYPRE_Solver solver,
                                      HYPRE_Real   kap_tolerance );
 
+/**
+ * (Optional) Reuse the sparsity pattern of G computed in the first setup
+ * phase for subsequent setups, which then only recompute the values of G.
+ * This is useful when the values of the matrix change but its sparsity
+ * pattern does not. The default is 0 (recompute the pattern). This input
+ * parameter makes sense to all algorithm types on the host.
+ **/
+HYPRE_Int HYPRE_FSAISetReuse( HYPRE_Solver solver,
+                              HYPRE_Int    reuse );
+
 /**
  * (Optional) Sets the relaxation factor for FSAI. This input parameter makes
  * sense to all algorithm types for setting up FSAI.
@@ -28,6 +28,9 @@ typedef struct { HYPRE_Int prev; HYPRE_Int next; } Link;
 
 #define CUMNUMIT
 
+/* number of object classes reported by hypre_BoomerAMGGetMemoryUsage */
+#define HYPRE_AMG_NUM_MEMORY_CLASSES 7
+
 #include "par_csr_block_matrix.h"
 
 /*--------------------------------------------------------------------------
@@ -104,6 +107,11 @@ typedef struct
    HYPRE_Real     tol;
    HYPRE_Int      partial_cycle_coarsest_level;
    HYPRE_Int      partial_cycle_control;
+   HYPRE_Int      adaptive_cycle;        /* probing interval of the adaptive cycle, 0 = off */
+   HYPRE_Real     adaptive_cycle_tol;    /* skip/truncate when reduction factor >= tol */
+   HYPRE_Int      adaptive_cycle_count;  /* cycles since the last setup */
+   HYPRE_Int      adaptive_num_levels;   /* number of levels visited by the adaptive cycle */
+   HYPRE_Int     *adaptive_post_sweeps;  /* per level: number of post-smoothing sweeps */
 
 
    /* problem data */
@@ -186,9 +194,20 @@ typedef struct
    HYPRE_Int            cheby_variant;
    HYPRE_Int            cheby_scale;
    HYPRE_Real           cheby_fraction;
+   HYPRE_Int            cheby_lanczos;         /* estimate bounds with Lanczos instead of CG */
+   HYPRE_Real           cheby_eig_refresh_tol; /* reuse estimates across setups, 0 = off */
+   HYPRE_Int            cheby_eig_cache_levels;
+   HYPRE_Real          *cheby_eig_cache;       /* per level: max, min and ||A||_F */
+   HYPRE_BigInt        *cheby_eig_cache_rows;  /* per level: global number of rows */
+   HYPRE_Int            cheby_eig_reused;      /* levels reused in the last setup */
    hypre_Vector       **cheby_ds;
    HYPRE_Real         **cheby_coefs;
 
+   /* data for multicolor relaxation (types 31-33), per level */
+   hypre_CSRMatrix    **mc_diag;
+   hypre_IntArray     **mc_perm;
+   hypre_IntArray     **mc_color_starts;
+
    HYPRE_Real           cum_nnz_AP;
 
    /* data needed for non-Galerkin option */
@@ -261,6 +280,9 @@ typedef struct
    HYPRE_Real *A_work;
    HYPRE_Real *b_vec;
    HYPRE_Real *u_vec;
+   HYPRE_Int  *ge_perm;        /* RCM ordering of the banded LU (solver type 97) */
+   HYPRE_Int   ge_band_lower;  /* lower bandwidth of the banded LU */
+   HYPRE_Int   ge_band_upper;  /* upper bandwidth of the banded LU */
 
    /* information for multiplication with Lambda - additive AMG */
    HYPRE_Int      additive;
@@ -282,6 +304,26 @@ typedef struct
    HYPRE_Int keepTranspose;
    HYPRE_Int modularized_matmat;
 
+   /* host matvec kernel used for A, P and R in the solve phase */
+   HYPRE_Int matvec_format;
+   HYPRE_Int matvec_format_num_levels;
+   HYPRE_Int matvec_overlap;
+   HYPRE_Int single_precision_level;
+
+   /* values-only re-setup: strength pattern, C/F splitting and symbolic
+      Galerkin products per level, kept from a previous setup together with
+      the size, row partition and sparsity pattern of each level's matrix */
+   HYPRE_Int                 setup_reuse;
+   HYPRE_Int                 reuse_num_levels;
+   HYPRE_BigInt             *reuse_global_size;
+   HYPRE_BigInt             *reuse_first_row;
+   HYPRE_Int                *reuse_local_nnz;
+   hypre_ulonglongint       *reuse_pattern_key;
+   hypre_ParCSRMatrix      **reuse_S_array;
+   hypre_IntArray          **reuse_CF_marker_array;
+   hypre_ParCSRMatMatData  **reuse_AP_array;
+   hypre_ParCSRMatMatData  **reuse_RAP_array;
+
    /* information for preserving indices as coarse grid points */
    HYPRE_Int      num_C_points;
    HYPRE_Int      C_points_coarse_level;
@@ -360,6 +402,11 @@ typedef struct
 #define hypre_ParAMGDataTol(amg_data) ((amg_data)->tol)
 #define hypre_ParAMGDataPartialCycleCoarsestLevel(amg_data) ((amg_data)->partial_cycle_coarsest_level)
 #define hypre_ParAMGDataPartialCycleControl(amg_data) ((amg_data)->partial_cycle_control)
+#define hypre_ParAMGDataAdaptiveCycle(amg_data) ((amg_data)->adaptive_cycle)
+#define hypre_ParAMGDataAdaptiveCycleTol(amg_data) ((amg_data)->adaptive_cycle_tol)
+#define hypre_ParAMGDataAdaptiveCycleCount(amg_data) ((amg_data)->adaptive_cycle_count)
+#define hypre_ParAMGDataAdaptiveNumLevels(amg_data) ((amg_data)->adaptive_num_levels)
+#define hypre_ParAMGDataAdaptivePostSweeps(amg_data) ((amg_data)->adaptive_post_sweeps)
 #define hypre_ParAMGDataNumGridSweeps(amg_data) ((amg_data)->num_grid_sweeps)
 #define hypre_ParAMGDataUserCoarseRelaxType(amg_data) ((amg_data)->user_coarse_relax_type)
 #define hypre_ParAMGDataUserRelaxType(amg_data) ((amg_data)->user_relax_type)
@@ -445,9 +492,19 @@ typedef struct
 #define hypre_ParAMGDataChebyEigEst(amg_data) ((amg_data)->cheby_eig_est)
 #define hypre_ParAMGDataChebyVariant(amg_data) ((amg_data)->cheby_variant)
 #define hypre_ParAMGDataChebyScale(amg_data) ((amg_data)->cheby_scale)
+#define hypre_ParAMGDataChebyLanczos(amg_data) ((amg_data)->cheby_lanczos)
+#define hypre_ParAMGDataChebyEigRefreshTol(amg_data) ((amg_data)->cheby_eig_refresh_tol)
+#define hypre_ParAMGDataChebyEigCacheLevels(amg_data) ((amg_data)->cheby_eig_cache_levels)
+#define hypre_ParAMGDataChebyEigCache(amg_data) ((amg_data)->cheby_eig_cache)
+#define hypre_ParAMGDataChebyEigCacheRows(amg_data) ((amg_data)->cheby_eig_cache_rows)
+#define hypre_ParAMGDataChebyEigReused(amg_data) ((amg_data)->cheby_eig_reused)
 #define hypre_ParAMGDataChebyDS(amg_data) ((amg_data)->cheby_ds)
 #define hypre_ParAMGDataChebyCoefs(amg_data) ((amg_data)->cheby_coefs)
 
+#define hypre_ParAMGDataMCDiag(amg_data) ((amg_data)->mc_diag)
+#define hypre_ParAMGDataMCPerm(amg_data) ((amg_data)->mc_perm)
+#define hypre_ParAMGDataMCColorStarts(amg_data) ((amg_data)->mc_color_starts)
+
 #define hypre_ParAMGDataCumNnzAP(amg_data)   ((amg_data)->cum_nnz_AP)
 
 /* block */
@@ -522,6 +579,9 @@ typedef struct
 #define hypre_ParAMGDataBVec(amg_data) ((amg_data)->b_vec)
 #define hypre_ParAMGDataUVec(amg_data) ((amg_data)->u_vec)
 #define hypre_ParAMGDataCommInfo(amg_data) ((amg_data)->comm_info)
+#define hypre_ParAMGDataGEPerm(amg_data) ((amg_data)->ge_perm)
+#define hypre_ParAMGDataGEBandLower(amg_data) ((amg_data)->ge_band_lower)
+#define hypre_ParAMGDataGEBandUpper(amg_data) ((amg_data)->ge_band_upper)
 
 /* additive AMG parameters */
 #define hypre_ParAMGDataAdditive(amg_data) ((amg_data)->additive)
@@ -547,6 +607,20 @@ typedef struct
 #define hypre_ParAMGDataRAP2(amg_data) ((amg_data)->rap2)
 #define hypre_ParAMGDataKeepTranspose(amg_data) ((amg_data)->keepTranspose)
 #define hypre_ParAMGDataModularizedMatMat(amg_data) ((amg_data)->modularized_matmat)
+#define hypre_ParAMGDataMatvecFormat(amg_data) ((amg_data)->matvec_format)
+#define hypre_ParAMGDataMatvecFormatNumLevels(amg_data) ((amg_data)->matvec_format_num_levels)
+#define hypre_ParAMGDataMatvecOverlap(amg_data) ((amg_data)->matvec_overlap)
+#define hypre_ParAMGDataSinglePrecisionLevel(amg_data) ((amg_data)->single_precision_level)
+#define hypre_ParAMGDataSetupReuse(amg_data) ((amg_data)->setup_reuse)
+#define hypre_ParAMGDataReuseNumLevels(amg_data) ((amg_data)->reuse_num_levels)
+#define hypre_ParAMGDataReuseGlobalSize(amg_data) ((amg_data)->reuse_global_size)
+#define hypre_ParAMGDataReuseFirstRow(amg_data) ((amg_data)->reuse_first_row)
+#define hypre_ParAMGDataReuseLocalNnz(amg_data) ((amg_data)->reuse_local_nnz)
+#define hypre_ParAMGDataReusePatternKey(amg_data) ((amg_data)->reuse_pattern_key)
+#define hypre_ParAMGDataReuseSArray(amg_data) ((amg_data)->reuse_S_array)
+#define hypre_ParAMGDataReuseCFMarkerArray(amg_data) ((amg_data)->reuse_CF_marker_array)
+#define hypre_ParAMGDataReuseAPArray(amg_data) ((amg_data)->reuse_AP_array)
+#define hypre_ParAMGDataReuseRAPArray(amg_data) ((amg_data)->reuse_RAP_array)
 
 /*indices for the dof which will keep coarsening to the coarse level */
 #define hypre_ParAMGDataNumCPoints(amg_data)  ((amg_data)->num_C_points)
@@ -844,6 +918,7 @@ typedef struct hypre_ParFSAIData_struct
    HYPRE_Int             num_levels;       /* Number of levels for computing the candidate pattern */
    HYPRE_Real            threshold;        /* Filtering threshold for the candidate pattern */
    HYPRE_Real            kap_tolerance;    /* Min. amount of change between two steps */
+   HYPRE_Int             reuse;            /* Reuse the pattern of G in subsequent setups */
 
    /* FSAI Setup data */
    HYPRE_Real            density;          /* Density of matrix G wrt. A */
@@ -881,6 +956,7 @@ typedef struct hypre_ParFSAIData_struct
 #define hypre_ParFSAIDataNumLevels(fsai_data)               ((fsai_data) -> num_levels)
 #define hypre_ParFSAIDataThreshold(fsai_data)               ((fsai_data) -> threshold)
 #define hypre_ParFSAIDataKapTolerance(fsai_data)            ((fsai_data) -> kap_tolerance)
+#define hypre_ParFSAIDataReuse(fsai_data)                   ((fsai_data) -> reuse)
 
 /* FSAI Setup data */
 #define hypre_ParFSAIDataGmat(fsai_data)                    ((fsai_data) -> Gmat)
@@ -1166,6 +1242,14 @@ typedef struct hypre_ParILUData_struct
    HYPRE_Int             nI;
    HYPRE_Int            *u_end; /* used when schur block is formed */
 
+   /* level schedules of L and U for threaded host triangular solves */
+   HYPRE_Int             num_lower_levels;
+   HYPRE_Int            *lower_level_i;  /* level k holds rows lower_level_j[i[k]:i[k+1]] */
+   HYPRE_Int            *lower_level_j;
+   HYPRE_Int             num_upper_levels;
+   HYPRE_Int            *upper_level_i;
+   HYPRE_Int            *upper_level_j;
+
    /* temp vectors for solve phase */
    hypre_ParVector      *Utemp;
    hypre_ParVector      *Ftemp;
@@ -1294,6 +1378,12 @@ typedef struct hypre_ParILUData_struct
 #define hypre_ParILUDataNLU(ilu_data)                          ((ilu_data) -> nLU)
 #define hypre_ParILUDataNI(ilu_data)                           ((ilu_data) -> nI)
 #define hypre_ParILUDataUEnd(ilu_data)                         ((ilu_data) -> u_end)
+#define hypre_ParILUDataNumLowerLevels(ilu_data)               ((ilu_data) -> num_lower_levels)
+#define hypre_ParILUDataLowerLevelI(ilu_data)                  ((ilu_data) -> lower_level_i)
+#define hypre_ParILUDataLowerLevelJ(ilu_data)                  ((ilu_data) -> lower_level_j)
+#define hypre_ParILUDataNumUpperLevels(ilu_data)               ((ilu_data) -> num_upper_levels)
+#define hypre_ParILUDataUpperLevelI(ilu_data)                  ((ilu_data) -> upper_level_i)
+#define hypre_ParILUDataUpperLevelJ(ilu_data)                  ((ilu_data) -> upper_level_j)
 #define hypre_ParILUDataUTemp(ilu_data)                        ((ilu_data) -> Utemp)
 #define hypre_ParILUDataFTemp(ilu_data)                        ((ilu_data) -> Ftemp)
 #define hypre_ParILUDataXTemp(ilu_data)                        ((ilu_data) -> Xtemp)
@@ -1856,6 +1946,11 @@ HYPRE_Int HYPRE_BoomerAMGSetSetupType ( HYPRE_Solver solver, HYPRE_Int setup_typ
 HYPRE_Int HYPRE_BoomerAMGSetOldDefault ( HYPRE_Solver solver );
 HYPRE_Int HYPRE_BoomerAMGSetFCycle ( HYPRE_Solver solver, HYPRE_Int fcycle );
 HYPRE_Int HYPRE_BoomerAMGGetFCycle ( HYPRE_Solver solver, HYPRE_Int *fcycle );
+HYPRE_Int HYPRE_BoomerAMGSetAdaptiveCycle ( HYPRE_Solver solver, HYPRE_Int adaptive_cycle );
+HYPRE_Int HYPRE_BoomerAMGGetAdaptiveCycle ( HYPRE_Solver solver, HYPRE_Int *adaptive_cycle );
+HYPRE_Int HYPRE_BoomerAMGSetAdaptiveCycleTol ( HYPRE_Solver solver, HYPRE_Real adaptive_cycle_tol );
+HYPRE_Int HYPRE_BoomerAMGGetAdaptiveCycleTol ( HYPRE_Solver solver,
+                                               HYPRE_Real *adaptive_cycle_tol );
 HYPRE_Int HYPRE_BoomerAMGSetCycleType ( HYPRE_Solver solver, HYPRE_Int cycle_type );
 HYPRE_Int HYPRE_BoomerAMGGetCycleType ( HYPRE_Solver solver, HYPRE_Int *cycle_type );
 HYPRE_Int HYPRE_BoomerAMGSetConvergeType ( HYPRE_Solver solver, HYPRE_Int type );
@@ -1986,6 +2081,8 @@ HYPRE_Int HYPRE_BoomerAMGSetChebyFraction ( HYPRE_Solver solver, HYPRE_Real rati
 HYPRE_Int HYPRE_BoomerAMGSetChebyEigEst ( HYPRE_Solver solver, HYPRE_Int eig_est );
 HYPRE_Int HYPRE_BoomerAMGSetChebyVariant ( HYPRE_Solver solver, HYPRE_Int variant );
 HYPRE_Int HYPRE_BoomerAMGSetChebyScale ( HYPRE_Solver solver, HYPRE_Int scale );
+HYPRE_Int HYPRE_BoomerAMGSetChebyLanczos ( HYPRE_Solver solver, HYPRE_Int lanczos );
+HYPRE_Int HYPRE_BoomerAMGSetChebyEigRefreshTol ( HYPRE_Solver solver, HYPRE_Real refresh_tol );
 HYPRE_Int HYPRE_BoomerAMGSetInterpVectors ( HYPRE_Solver solver, HYPRE_Int num_vectors,
                                             HYPRE_ParVector *vectors );
 HYPRE_Int HYPRE_BoomerAMGSetInterpVecVariant ( HYPRE_Solver solver, HYPRE_Int num );
@@ -2010,6 +2107,11 @@ HYPRE_Int HYPRE_BoomerAMGSetNonGalerkTol ( HYPRE_Solver solver, HYPRE_Int nongal
 HYPRE_Int HYPRE_BoomerAMGSetRAP2 ( HYPRE_Solver solver, HYPRE_Int rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetModuleRAP2 ( HYPRE_Solver solver, HYPRE_Int mod_rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetKeepTranspose ( HYPRE_Solver solver, HYPRE_Int keepTranspose );
+HYPRE_Int HYPRE_BoomerAMGSetMatvecFormat ( HYPRE_Solver solver, HYPRE_Int matvec_format );
+HYPRE_Int HYPRE_BoomerAMGSetMatvecFormatNumLevels ( HYPRE_Solver solver, HYPRE_Int num_levels );
+HYPRE_Int HYPRE_BoomerAMGSetMatvecOverlap ( HYPRE_Solver solver, HYPRE_Int matvec_overlap );
+HYPRE_Int HYPRE_BoomerAMGSetSinglePrecisionLevel ( HYPRE_Solver solver, HYPRE_Int level );
+HYPRE_Int HYPRE_BoomerAMGSetSetupReuse ( HYPRE_Solver solver, HYPRE_Int setup_reuse );
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int HYPRE_BoomerAMGSetDSLUThreshold ( HYPRE_Solver solver, HYPRE_Int slu_threshold );
 #endif
@@ -2023,6 +2125,8 @@ HYPRE_Int HYPRE_BoomerAMGSetFPoints( HYPRE_Solver solver, HYPRE_Int num_fpt,
                                      HYPRE_BigInt *fpt_index );
 HYPRE_Int HYPRE_BoomerAMGSetCumNnzAP ( HYPRE_Solver solver, HYPRE_Real cum_nnz_AP );
 HYPRE_Int HYPRE_BoomerAMGGetCumNnzAP ( HYPRE_Solver solver, HYPRE_Real *cum_nnz_AP );
+HYPRE_Int HYPRE_BoomerAMGGetMemoryUsage ( HYPRE_Solver solver, HYPRE_Int level,
+                                         HYPRE_Int object_class, HYPRE_Real *bytes );
 
 /* HYPRE_parcsr_amgdd.c */
 HYPRE_Int HYPRE_BoomerAMGDDSetup ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A, HYPRE_ParVector b,
@@ -2355,6 +2459,8 @@ HYPRE_Int HYPRE_FSAISetThreshold ( HYPRE_Solver solver, HYPRE_Real threshold );
 HYPRE_Int HYPRE_FSAIGetThreshold ( HYPRE_Solver solver, HYPRE_Real *threshold );
 HYPRE_Int HYPRE_FSAISetKapTolerance ( HYPRE_Solver solver, HYPRE_Real kap_tolerance );
 HYPRE_Int HYPRE_FSAIGetKapTolerance ( HYPRE_Solver solver, HYPRE_Real *kap_tolerance );
+HYPRE_Int HYPRE_FSAISetReuse ( HYPRE_Solver solver, HYPRE_Int reuse );
+HYPRE_Int HYPRE_FSAIGetReuse ( HYPRE_Solver solver, HYPRE_Int *reuse );
 HYPRE_Int HYPRE_FSAISetTolerance ( HYPRE_Solver solver, HYPRE_Real tolerance );
 HYPRE_Int HYPRE_FSAIGetTolerance ( HYPRE_Solver solver, HYPRE_Real *tolerance );
 HYPRE_Int HYPRE_FSAISetOmega ( HYPRE_Solver solver, HYPRE_Real omega );
@@ -2480,6 +2586,10 @@ HYPRE_Int hypre_BoomerAMGSetSetupType ( void *data, HYPRE_Int setup_type );
 HYPRE_Int hypre_BoomerAMGGetSetupType ( void *data, HYPRE_Int *setup_type );
 HYPRE_Int hypre_BoomerAMGSetFCycle ( void *data, HYPRE_Int fcycle );
 HYPRE_Int hypre_BoomerAMGGetFCycle ( void *data, HYPRE_Int *fcycle );
+HYPRE_Int hypre_BoomerAMGSetAdaptiveCycle ( void *data, HYPRE_Int adaptive_cycle );
+HYPRE_Int hypre_BoomerAMGGetAdaptiveCycle ( void *data, HYPRE_Int *adaptive_cycle );
+HYPRE_Int hypre_BoomerAMGSetAdaptiveCycleTol ( void *data, HYPRE_Real adaptive_cycle_tol );
+HYPRE_Int hypre_BoomerAMGGetAdaptiveCycleTol ( void *data, HYPRE_Real *adaptive_cycle_tol );
 HYPRE_Int hypre_BoomerAMGSetCycleType ( void *data, HYPRE_Int cycle_type );
 HYPRE_Int hypre_BoomerAMGGetCycleType ( void *data, HYPRE_Int *cycle_type );
 HYPRE_Int hypre_BoomerAMGSetConvergeType ( void *data, HYPRE_Int type );
@@ -2607,6 +2717,8 @@ HYPRE_Int hypre_BoomerAMGSetChebyFraction ( void *data, HYPRE_Real ratio );
 HYPRE_Int hypre_BoomerAMGSetChebyEigEst ( void *data, HYPRE_Int eig_est );
 HYPRE_Int hypre_BoomerAMGSetChebyVariant ( void *data, HYPRE_Int variant );
 HYPRE_Int hypre_BoomerAMGSetChebyScale ( void *data, HYPRE_Int scale );
+HYPRE_Int hypre_BoomerAMGSetChebyLanczos ( void *data, HYPRE_Int cheby_lanczos );
+HYPRE_Int hypre_BoomerAMGSetChebyEigRefreshTol ( void *data, HYPRE_Real refresh_tol );
 HYPRE_Int hypre_BoomerAMGSetInterpVectors ( void *solver, HYPRE_Int num_vectors,
                                             hypre_ParVector **interp_vectors );
 HYPRE_Int hypre_BoomerAMGSetInterpVecVariant ( void *solver, HYPRE_Int var );
@@ -2630,6 +2742,16 @@ HYPRE_Int hypre_BoomerAMGSetNonGalerkTol ( void *data, HYPRE_Int nongalerk_num_t
 HYPRE_Int hypre_BoomerAMGSetRAP2 ( void *data, HYPRE_Int rap2 );
 HYPRE_Int hypre_BoomerAMGSetModuleRAP2 ( void *data, HYPRE_Int mod_rap2 );
 HYPRE_Int hypre_BoomerAMGSetKeepTranspose ( void *data, HYPRE_Int keepTranspose );
+HYPRE_Int hypre_BoomerAMGSetMatvecFormat ( void *data, HYPRE_Int matvec_format );
+HYPRE_Int hypre_BoomerAMGSetMatvecFormatNumLevels ( void *data, HYPRE_Int num_levels );
+HYPRE_Int hypre_BoomerAMGSetMatvecOverlap ( void *data, HYPRE_Int matvec_overlap );
+HYPRE_Int hypre_BoomerAMGSetSinglePrecisionLevel ( void *data, HYPRE_Int level );
+HYPRE_Int hypre_BoomerAMGSetSetupReuse ( void *data, HYPRE_Int setup_reuse );
+HYPRE_Int hypre_BoomerAMGSetupReuseCreate ( void *data, HYPRE_Int num_levels );
+HYPRE_Int hypre_BoomerAMGSetupReuseDestroy ( void *data );
+HYPRE_Int hypre_BoomerAMGSetupReuseClearLevels ( void *data, HYPRE_Int level );
+HYPRE_Int hypre_BoomerAMGSetupReuseStoreKey ( void *data, hypre_ParCSRMatrix *A, HYPRE_Int level );
+HYPRE_Int hypre_BoomerAMGSetupReuseMatches ( void *data, hypre_ParCSRMatrix *A, HYPRE_Int level );
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int hypre_BoomerAMGSetDSLUThreshold ( void *data, HYPRE_Int slu_threshold );
 #endif
@@ -2688,6 +2810,9 @@ HYPRE_Int hypre_ParCSRRelax_Cheby_Solve ( hypre_ParCSRMatrix *A, hypre_ParVector
                                           hypre_ParVector *u, hypre_ParVector *v, hypre_ParVector *r, hypre_ParVector *orig_u_vec,
                                           hypre_ParVector *tmp_vec);
 
+HYPRE_Int hypre_ParCSRRelax_Cheby_SolveFourthKindHost ( hypre_ParCSRMatrix *A, hypre_ParVector *f,
+                                                        HYPRE_Real *ds_data, HYPRE_Real *coefs, HYPRE_Int order, HYPRE_Int scale, hypre_ParVector *u,
+                                                        hypre_ParVector *v, hypre_ParVector *r );
 HYPRE_Int hypre_ParCSRRelax_Cheby_SolveHost ( hypre_ParCSRMatrix *A, hypre_ParVector *f,
                                               HYPRE_Real *ds_data, HYPRE_Real *coefs, HYPRE_Int order, HYPRE_Int scale, HYPRE_Int variant,
                                               hypre_ParVector *u, hypre_ParVector *v, hypre_ParVector *r, hypre_ParVector *orig_u_vec,
@@ -3092,6 +3217,9 @@ HYPRE_Int hypre_BoomerAMGBuildCoarseOperator ( hypre_ParCSRMatrix *RT, hypre_Par
                                                hypre_ParCSRMatrix *P, hypre_ParCSRMatrix **RAP_ptr );
 HYPRE_Int hypre_BoomerAMGBuildCoarseOperatorKT ( hypre_ParCSRMatrix *RT, hypre_ParCSRMatrix *A,
                                                  hypre_ParCSRMatrix *P, HYPRE_Int keepTranspose, hypre_ParCSRMatrix **RAP_ptr );
+HYPRE_Int hypre_BoomerAMGBuildCoarseOperatorReuse ( hypre_ParCSRMatrix *P, hypre_ParCSRMatrix *A,
+                                                    HYPRE_Int keepTranspose, hypre_ParCSRMatMatData **AP_data_ptr,
+                                                    hypre_ParCSRMatMatData **RAP_data_ptr, hypre_ParCSRMatrix **RAP_ptr );
 
 /* par_rap_communication.c */
 HYPRE_Int hypre_GetCommPkgRTFromCommPkgA ( hypre_ParCSRMatrix *RT, hypre_ParCSRMatrix *A,
@@ -3110,6 +3238,12 @@ HYPRE_Int hypre_GaussElimSetup ( hypre_ParAMGData *amg_data, HYPRE_Int level,
                                  HYPRE_Int solver_type );
 HYPRE_Int hypre_GaussElimSolve ( hypre_ParAMGData *amg_data, HYPRE_Int level,
                                  HYPRE_Int solver_type );
+HYPRE_Int hypre_GaussElimBandFactor ( HYPRE_Int n, HYPRE_Int kl, HYPRE_Int ku, HYPRE_Real *ab,
+                                      HYPRE_Int *piv );
+HYPRE_Int hypre_GaussElimBandSolve ( HYPRE_Int n, HYPRE_Int kl, HYPRE_Int ku, HYPRE_Real *ab,
+                                     HYPRE_Int *piv, HYPRE_Real *b );
+HYPRE_Int hypre_GaussElimBandedSetup ( hypre_ParAMGData *amg_data, HYPRE_Int level );
+HYPRE_Int hypre_GaussElimBandedSolve ( hypre_ParAMGData *amg_data, HYPRE_Int level );
 
 /* par_relax.c */
 HYPRE_Int hypre_BoomerAMGRelax ( hypre_ParCSRMatrix *A, hypre_ParVector *f, HYPRE_Int *cf_marker,
@@ -3120,6 +3254,10 @@ HYPRE_Int hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A, hyp
                                                       HYPRE_Real *l1_norms, hypre_ParVector *u, hypre_ParVector *Vtemp, hypre_ParVector *Ztemp,
                                                       HYPRE_Int GS_order, HYPRE_Int Symm, HYPRE_Int Skip_diag, HYPRE_Int forced_seq,
                                                       HYPRE_Int Topo_order );
+HYPRE_Int hypre_BoomerAMGRelaxHybridGaussSeidelMultiVec( hypre_ParCSRMatrix *A, hypre_ParVector *f,
+                                                         HYPRE_Int *cf_marker, HYPRE_Int relax_points, HYPRE_Real relax_weight, HYPRE_Real omega,
+                                                         HYPRE_Real *l1_norms, hypre_ParVector *u, hypre_ParVector *Vtemp, HYPRE_Int GS_order,
+                                                         HYPRE_Int Symm, HYPRE_Int Skip_diag, HYPRE_Int forced_seq );
 HYPRE_Int hypre_BoomerAMGRelax0WeightedJacobi( hypre_ParCSRMatrix *A, hypre_ParVector *f,
                                                HYPRE_Int *cf_marker, HYPRE_Int relax_points, HYPRE_Real relax_weight, hypre_ParVector *u,
                                                hypre_ParVector *Vtemp );
@@ -3222,6 +3360,16 @@ HYPRE_Int hypre_BoomerAMGRelaxIF ( hypre_ParCSRMatrix *A, hypre_ParVector *f, HY
                                    HYPRE_Real omega, HYPRE_Real *l1_norms, hypre_ParVector *u, hypre_ParVector *Vtemp,
                                    hypre_ParVector *Ztemp );
 
+/* par_relax_multicolor.c */
+HYPRE_Int hypre_BoomerAMGRelaxMulticolorSetup ( hypre_ParCSRMatrix *A, hypre_CSRMatrix **mc_diag_ptr,
+                                                hypre_IntArray **perm_ptr, hypre_IntArray **color_starts_ptr );
+HYPRE_Int hypre_BoomerAMGRelaxMulticolor ( hypre_ParCSRMatrix *A, hypre_ParVector *f,
+                                           hypre_CSRMatrix *mc_diag, hypre_IntArray *perm, hypre_IntArray *color_starts,
+                                           HYPRE_Int relax_type, HYPRE_Real relax_weight, hypre_ParVector *u, hypre_ParVector *Vtemp );
+HYPRE_Int hypre_BoomerAMGRelaxMulticolorOnce ( hypre_ParCSRMatrix *A, hypre_ParVector *f,
+                                               HYPRE_Int relax_type, HYPRE_Real relax_weight, hypre_ParVector *u,
+                                               hypre_ParVector *Vtemp );
+
 /* par_relax_more.c */
 HYPRE_Int hypre_ParCSRMaxEigEstimate ( hypre_ParCSRMatrix *A, HYPRE_Int scale, HYPRE_Real *max_eig,
                                        HYPRE_Real *min_eig );
@@ -3231,6 +3379,10 @@ HYPRE_Int hypre_ParCSRMaxEigEstimateCG ( hypre_ParCSRMatrix *A, HYPRE_Int scale,
                                          HYPRE_Real *max_eig, HYPRE_Real *min_eig );
 HYPRE_Int hypre_ParCSRMaxEigEstimateCGHost ( hypre_ParCSRMatrix *A, HYPRE_Int scale,
                                              HYPRE_Int max_iter, HYPRE_Real *max_eig, HYPRE_Real *min_eig );
+HYPRE_Int hypre_ParCSRMaxEigEstimateLanczos ( hypre_ParCSRMatrix *A, HYPRE_Int scale,
+                                              HYPRE_Int max_iter, HYPRE_Real *max_eig, HYPRE_Real *min_eig );
+HYPRE_Int hypre_ParCSRMaxEigEstimateLanczosHost ( hypre_ParCSRMatrix *A, HYPRE_Int scale,
+                                                  HYPRE_Int max_iter, HYPRE_Real *max_eig, HYPRE_Real *min_eig );
 HYPRE_Int hypre_ParCSRRelax_Cheby ( hypre_ParCSRMatrix *A, hypre_ParVector *f, HYPRE_Real max_eig,
                                     HYPRE_Real min_eig, HYPRE_Real fraction, HYPRE_Int order, HYPRE_Int scale, HYPRE_Int variant,
                                     hypre_ParVector *u, hypre_ParVector *v, hypre_ParVector *r );
@@ -3283,6 +3435,9 @@ HYPRE_Int hypre_SchwarzSetDofFunc ( void *data, HYPRE_Int *dof_func );
 /* par_stats.c */
 HYPRE_Int hypre_BoomerAMGSetupStats ( void *amg_vdata, hypre_ParCSRMatrix *A );
 HYPRE_Int hypre_BoomerAMGWriteSolverParams ( void *data );
+HYPRE_Int hypre_BoomerAMGLevelMemoryUsage ( void *data, HYPRE_Int level, HYPRE_Real *bytes );
+HYPRE_Int hypre_BoomerAMGGetMemoryUsage ( void *data, HYPRE_Int level, HYPRE_Int object_class,
+                                         HYPRE_Real *bytes );
 const char* hypre_BoomerAMGGetProlongationName( hypre_ParAMGData *amg_data );
 const char* hypre_BoomerAMGGetAggProlongationName( hypre_ParAMGData *amg_data );
 const char* hypre_BoomerAMGGetCoarseningName( hypre_ParAMGData *amg_data );
@@ -3407,6 +3562,11 @@ HYPRE_Int hypre_ParKrylovMatvecDestroy ( void *matvec_data );
 HYPRE_Real hypre_ParKrylovInnerProd ( void *x, void *y );
 HYPRE_Int hypre_ParKrylovMassInnerProd ( void *x, void **y, HYPRE_Int k, HYPRE_Int unroll,
                                          void *result );
+HYPRE_Int hypre_ParKrylovIInnerProd ( HYPRE_Int nprod, void **x, void **y, HYPRE_Real *result,
+                                      void **request );
+HYPRE_Int hypre_ParKrylovInnerProdWait ( void *request );
+HYPRE_Int hypre_ParKrylovBlockInnerProd ( void **x, HYPRE_Int nx, void **y, HYPRE_Int ny,
+                                         HYPRE_Real *result );
 HYPRE_Int hypre_ParKrylovMassDotpTwo ( void *x, void *y, void **z, HYPRE_Int k, HYPRE_Int unroll,
                                        void *result_x, void *result_y );
 HYPRE_Int hypre_ParKrylovMassAxpy( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k,
@@ -3801,6 +3961,10 @@ HYPRE_Int hypre_ILUGetInteriorExteriorPerm( hypre_ParCSRMatrix *A,
                                             HYPRE_MemoryLocation memory_location,
                                             HYPRE_Int **perm, HYPRE_Int *nLU,
                                             HYPRE_Int reordering_type );
+HYPRE_Int hypre_ILUGetDomainPartitionPerm( hypre_ParCSRMatrix *A, HYPRE_MemoryLocation memory_location,
+                                           HYPRE_Int **perm_ptr, HYPRE_Int nLU,
+                                           HYPRE_Int num_domains, HYPRE_Int *num_domains_ptr,
+                                           HYPRE_Int **domain_starts_ptr );
 HYPRE_Int hypre_ILUGetLocalPerm( hypre_ParCSRMatrix *A, HYPRE_Int **perm_ptr,
                                  HYPRE_Int *nLU, HYPRE_Int reordering_type );
 HYPRE_Int hypre_ILUBuildRASExternalMatrix( hypre_ParCSRMatrix *A, HYPRE_Int *rperm,
@@ -3902,6 +4066,9 @@ HYPRE_Int hypre_ILUSetupRAPILU0( hypre_ParCSRMatrix *A, HYPRE_Int *perm, HYPRE_I
                                  hypre_ParCSRMatrix **Uptr, hypre_ParCSRMatrix **mLptr,
                                  HYPRE_Real **mDptr, hypre_ParCSRMatrix **mUptr,
                                  HYPRE_Int **u_end );
+HYPRE_Int hypre_ILUSetupLevelSchedule( hypre_CSRMatrix *T, HYPRE_Int upper,
+                                       HYPRE_Int *num_levels_ptr, HYPRE_Int **level_i_ptr,
+                                       HYPRE_Int **level_j_ptr );
 HYPRE_Int hypre_ILUSetupILU0( hypre_ParCSRMatrix  *A, HYPRE_Int *perm, HYPRE_Int *qperm,
                               HYPRE_Int nLU, HYPRE_Int nI, hypre_ParCSRMatrix **Lptr,
                               HYPRE_Real **Dptr, hypre_ParCSRMatrix **Uptr,
@@ -3917,14 +4084,32 @@ HYPRE_Int hypre_ILUSetupILUKSymbolic( HYPRE_Int n, HYPRE_Int *A_diag_i, HYPRE_In
                                       HYPRE_Int *U_diag_i, HYPRE_Int *S_diag_i,
                                       HYPRE_Int **L_diag_j, HYPRE_Int **U_diag_j,
                                       HYPRE_Int **S_diag_j, HYPRE_Int **u_end );
+HYPRE_Int hypre_ILUSetupILUKRows( HYPRE_Int row_start, HYPRE_Int row_end,
+                                  hypre_CSRMatrix *A_diag, HYPRE_Int *perm, HYPRE_Int *rperm,
+                                  HYPRE_Int *iw, HYPRE_Real *D_data, HYPRE_Int *L_diag_i,
+                                  HYPRE_Int *L_diag_j, HYPRE_Real *L_diag_data,
+                                  HYPRE_Int *U_diag_i, HYPRE_Int *U_diag_j,
+                                  HYPRE_Real *U_diag_data );
 HYPRE_Int hypre_ILUSetupILUK( hypre_ParCSRMatrix *A, HYPRE_Int lfil, HYPRE_Int *permp,
                               HYPRE_Int *qpermp, HYPRE_Int nLU, HYPRE_Int nI,
+                              HYPRE_Int num_domains, HYPRE_Int *domain_starts,
                               hypre_ParCSRMatrix **Lptr, HYPRE_Real **Dptr,
                               hypre_ParCSRMatrix **Uptr, hypre_ParCSRMatrix **Sptr,
                               HYPRE_Int **u_end );
+HYPRE_Int hypre_ILUSetupILUTRows( HYPRE_Int row_start, HYPRE_Int row_end, HYPRE_Int row_offset,
+                                  HYPRE_Int lfil, HYPRE_Real *tol, HYPRE_Int nLU, HYPRE_Int m,
+                                  hypre_CSRMatrix *A_diag, HYPRE_Int *perm, HYPRE_Int *rperm,
+                                  HYPRE_Int *iw, HYPRE_Int *iL, HYPRE_Real *w,
+                                  HYPRE_Real *D_data, HYPRE_Int *L_diag_i,
+                                  HYPRE_Int **L_diag_j_ptr, HYPRE_Real **L_diag_data_ptr,
+                                  HYPRE_Int *capacity_L_ptr, HYPRE_Int *U_diag_i,
+                                  HYPRE_Int **U_diag_j_ptr, HYPRE_Real **U_diag_data_ptr,
+                                  HYPRE_Int *capacity_U_ptr, HYPRE_Int *u_end_array,
+                                  HYPRE_MemoryLocation memory_location );
 HYPRE_Int hypre_ILUSetupILUT( hypre_ParCSRMatrix *A, HYPRE_Int lfil, HYPRE_Real *tol,
                               HYPRE_Int *permp, HYPRE_Int *qpermp, HYPRE_Int nLU,
-                              HYPRE_Int nI, hypre_ParCSRMatrix **Lptr, HYPRE_Real **Dptr,
+                              HYPRE_Int nI, HYPRE_Int num_domains, HYPRE_Int *domain_starts,
+                              hypre_ParCSRMatrix **Lptr, HYPRE_Real **Dptr,
                               hypre_ParCSRMatrix **Uptr, hypre_ParCSRMatrix **Sptr,
                               HYPRE_Int **u_end );
 HYPRE_Int hypre_NSHSetup( void *nsh_vdata, hypre_ParCSRMatrix *A,
@@ -3977,6 +4162,13 @@ HYPRE_Int hypre_ILUSolveLU( hypre_ParCSRMatrix *A, hypre_ParVector *f,
                             hypre_ParVector *u, HYPRE_Int *perm, HYPRE_Int nLU,
                             hypre_ParCSRMatrix *L, HYPRE_Real *D, hypre_ParCSRMatrix *U,
                             hypre_ParVector *ftemp, hypre_ParVector *utemp );
+HYPRE_Int hypre_ILUSolveLULevels( hypre_ParCSRMatrix *A, hypre_ParVector *f,
+                                  hypre_ParVector *u, HYPRE_Int *perm, HYPRE_Int nLU,
+                                  hypre_ParCSRMatrix *L, HYPRE_Real *D, hypre_ParCSRMatrix *U,
+                                  hypre_ParVector *ftemp, hypre_ParVector *utemp,
+                                  HYPRE_Int num_lower_levels, HYPRE_Int *lower_level_i,
+                                  HYPRE_Int *lower_level_j, HYPRE_Int num_upper_levels,
+                                  HYPRE_Int *upper_level_i, HYPRE_Int *upper_level_j );
 HYPRE_Int hypre_ILUSolveLUIter( hypre_ParCSRMatrix *A, hypre_ParVector *f,
                                 hypre_ParVector *u, HYPRE_Int *perm, HYPRE_Int nLU,
                                 hypre_ParCSRMatrix *L, HYPRE_Real *D, hypre_ParCSRMatrix *U,
@@ -4217,6 +4409,7 @@ HYPRE_Int hypre_FSAISetMaxNnzRow ( void *data, HYPRE_Int max_nnz_row );
 HYPRE_Int hypre_FSAISetNumLevels ( void *data, HYPRE_Int num_levels );
 HYPRE_Int hypre_FSAISetThreshold ( void *data, HYPRE_Real threshold );
 HYPRE_Int hypre_FSAISetKapTolerance ( void *data, HYPRE_Real kap_tolerance );
+HYPRE_Int hypre_FSAISetReuse ( void *data, HYPRE_Int reuse );
 HYPRE_Int hypre_FSAISetMaxIterations ( void *data, HYPRE_Int max_iterations );
 HYPRE_Int hypre_FSAISetEigMaxIters ( void *data, HYPRE_Int eig_max_iters );
 HYPRE_Int hypre_FSAISetZeroGuess ( void *data, HYPRE_Int zero_guess );
@@ -4233,6 +4426,7 @@ HYPRE_Int hypre_FSAIGetMaxNnzRow ( void *data, HYPRE_Int *max_nnz_row );
 HYPRE_Int hypre_FSAIGetNumLevels ( void *data, HYPRE_Int *num_levels );
 HYPRE_Int hypre_FSAIGetThreshold ( void *data, HYPRE_Real *threshold );
 HYPRE_Int hypre_FSAIGetKapTolerance ( void *data, HYPRE_Real *kap_tolerance );
+HYPRE_Int hypre_FSAIGetReuse ( void *data, HYPRE_Int *reuse );
 HYPRE_Int hypre_FSAIGetMaxIterations ( void *data, HYPRE_Int *max_iterations );
 HYPRE_Int hypre_FSAIGetEigMaxIters ( void *data, HYPRE_Int *eig_max_iters );
 HYPRE_Int hypre_FSAIGetZeroGuess ( void *data, HYPRE_Int *zero_guess );
@@ -4261,6 +4455,9 @@ HYPRE_Int hypre_FSAISetupNative ( void *fsai_vdata, hypre_ParCSRMatrix *A,
                                   hypre_ParVector *f, hypre_ParVector *u );
 HYPRE_Int hypre_FSAISetupOMPDyn ( void *fsai_vdata, hypre_ParCSRMatrix *A,
                                   hypre_ParVector *f, hypre_ParVector *u );
+HYPRE_Int hypre_FSAISetupStaticPowerHost ( void *fsai_vdata, hypre_ParCSRMatrix *A,
+                                           hypre_ParVector *f, hypre_ParVector *u );
+HYPRE_Int hypre_FSAISetupValuesHost ( void *fsai_vdata, hypre_ParCSRMatrix *A );
 HYPRE_Int hypre_FSAIPrintStats ( void *fsai_vdata, hypre_ParCSRMatrix *A );
 HYPRE_Int hypre_FSAIComputeOmega ( void *fsai_vdata, hypre_ParCSRMatrix *A );
 void hypre_swap2_ci ( HYPRE_Complex *v, HYPRE_Int *w, HYPRE_Int i, HYPRE_Int j );
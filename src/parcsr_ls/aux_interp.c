@@ -51,7 +51,7 @@ HYPRE_Int hypre_alt_insert_new_nodes(hypre_ParCSRCommPkg *comm_pkg,
    index = hypre_max(hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
                      hypre_ParCSRCommPkgSendMapStart(extend_comm_pkg, e_num_sends));
 
-   int_buf_data = hypre_CTAlloc(HYPRE_Int,  index, HYPRE_MEMORY_HOST);
+   int_buf_data = hypre_CTAllocScratch(HYPRE_Int,  index);
 
    /* orig commpkg data*/
    index = 0;
@@ -98,7 +98,7 @@ HYPRE_Int hypre_alt_insert_new_nodes(hypre_ParCSRCommPkg *comm_pkg,
    hypre_ParCSRCommHandleDestroy(comm_handle);
    comm_handle = NULL;
 
-   hypre_TFree(int_buf_data, HYPRE_MEMORY_HOST);
+   hypre_TFreeScratch(int_buf_data);
 
    return hypre_error_flag;
 }
@@ -134,7 +134,7 @@ HYPRE_Int hypre_big_insert_new_nodes(hypre_ParCSRCommPkg *comm_pkg,
    index = hypre_max(hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
                      hypre_ParCSRCommPkgSendMapStart(extend_comm_pkg, e_num_sends));
 
-   int_buf_data = hypre_CTAlloc(HYPRE_BigInt,  index, HYPRE_MEMORY_HOST);
+   int_buf_data = hypre_CTAllocScratch(HYPRE_BigInt,  index);
 
    /* orig commpkg data*/
    index = 0;
@@ -181,7 +181,7 @@ HYPRE_Int hypre_big_insert_new_nodes(hypre_ParCSRCommPkg *comm_pkg,
    hypre_ParCSRCommHandleDestroy(comm_handle);
    comm_handle = NULL;
 
-   hypre_TFree(int_buf_data, HYPRE_MEMORY_HOST);
+   hypre_TFreeScratch(int_buf_data);
 
    return hypre_error_flag;
 }
@@ -546,7 +546,7 @@ HYPRE_Int hypre_exchange_marker(hypre_ParCSRCommPkg *comm_pkg,
    HYPRE_Int num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
    HYPRE_Int begin = hypre_ParCSRCommPkgSendMapStart(comm_pkg, 0);
    HYPRE_Int end = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
-   HYPRE_Int *int_buf_data = hypre_CTAlloc(HYPRE_Int, end, HYPRE_MEMORY_HOST);
+   HYPRE_Int *int_buf_data = hypre_CTAllocScratch(HYPRE_Int, end);
 
    HYPRE_Int i;
 #ifdef HYPRE_USING_OPENMP
@@ -562,7 +562,7 @@ HYPRE_Int hypre_exchange_marker(hypre_ParCSRCommPkg *comm_pkg,
                                                                        OUT_marker);
 
    hypre_ParCSRCommHandleDestroy(comm_handle);
-   hypre_TFree(int_buf_data, HYPRE_MEMORY_HOST);
+   hypre_TFreeScratch(int_buf_data);
 
    return hypre_error_flag;
 }
@@ -705,9 +705,9 @@ void hypre_build_interp_colmap(hypre_ParCSRMatrix *P, HYPRE_Int full_off_procNod
 
    if (full_off_procNodes)
    {
-      P_marker = hypre_TAlloc(HYPRE_Int, full_off_procNodes, HYPRE_MEMORY_HOST);
+      P_marker = hypre_TAllocScratch(HYPRE_Int, full_off_procNodes);
    }
-   prefix_sum_workspace = hypre_TAlloc(HYPRE_Int, hypre_NumThreads() + 1, HYPRE_MEMORY_HOST);
+   prefix_sum_workspace = hypre_TAllocScratch(HYPRE_Int, hypre_NumThreads() + 1);
 
 #ifdef HYPRE_USING_OPENMP
    #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
@@ -795,8 +795,8 @@ void hypre_build_interp_colmap(hypre_ParCSRMatrix *P, HYPRE_Int full_off_procNod
       P_offd_j[i] = P_marker[P_offd_j[i]];
    }
 
-   hypre_TFree(P_marker, HYPRE_MEMORY_HOST);
-   hypre_TFree(prefix_sum_workspace, HYPRE_MEMORY_HOST);
+   hypre_TFreeScratch(prefix_sum_workspace);
+   hypre_TFreeScratch(P_marker);
 
    if (num_cols_P_offd)
    {
@@ -324,6 +324,17 @@ hypre_BoomerAMGCreate( void )
 
    hypre_ParAMGDataPartialCycleCoarsestLevel(amg_data) = -1;
    hypre_ParAMGDataPartialCycleControl(amg_data) = -1;
+   hypre_ParAMGDataAdaptiveCycle(amg_data) = 0;
+   hypre_ParAMGDataAdaptiveCycleTol(amg_data) = 0.9;
+   hypre_ParAMGDataAdaptiveCycleCount(amg_data) = 0;
+   hypre_ParAMGDataAdaptiveNumLevels(amg_data) = 0;
+   hypre_ParAMGDataAdaptivePostSweeps(amg_data) = NULL;
+   hypre_ParAMGDataChebyLanczos(amg_data) = 0;
+   hypre_ParAMGDataChebyEigRefreshTol(amg_data) = 0.0;
+   hypre_ParAMGDataChebyEigCacheLevels(amg_data) = 0;
+   hypre_ParAMGDataChebyEigCache(amg_data) = NULL;
+   hypre_ParAMGDataChebyEigCacheRows(amg_data) = NULL;
+   hypre_ParAMGDataChebyEigReused(amg_data) = 0;
    hypre_ParAMGDataMaxLevels(amg_data) =  max_levels;
    hypre_ParAMGDataUserCoarseRelaxType(amg_data) = 9;
    hypre_ParAMGDataUserRelaxType(amg_data) = -1;
@@ -484,6 +495,11 @@ hypre_BoomerAMGCreate( void )
    hypre_ParAMGDataChebyDS(amg_data) = NULL;
    hypre_ParAMGDataChebyCoefs(amg_data) = NULL;
 
+   /* Stuff for multicolor relaxation */
+   hypre_ParAMGDataMCDiag(amg_data) = NULL;
+   hypre_ParAMGDataMCPerm(amg_data) = NULL;
+   hypre_ParAMGDataMCColorStarts(amg_data) = NULL;
+
    /* BM Oct 22, 2006 */
    hypre_ParAMGDataPlotGrids(amg_data) = 0;
    hypre_BoomerAMGSetPlotFileName (amg_data, plot_file_name);
@@ -523,6 +539,9 @@ hypre_BoomerAMGCreate( void )
    hypre_ParAMGDataAPiv(amg_data)             = NULL;
    hypre_ParAMGDataBVec(amg_data)             = NULL;
    hypre_ParAMGDataUVec(amg_data)             = NULL;
+   hypre_ParAMGDataGEPerm(amg_data)           = NULL;
+   hypre_ParAMGDataGEBandLower(amg_data)      = 0;
+   hypre_ParAMGDataGEBandUpper(amg_data)      = 0;
 
    hypre_ParAMGDataNonGalerkinTol(amg_data) = nongalerkin_tol;
    hypre_ParAMGDataNonGalTolArray(amg_data) = NULL;
@@ -531,6 +550,22 @@ hypre_BoomerAMGCreate( void )
    hypre_ParAMGDataKeepTranspose(amg_data)     = keepT;
    hypre_ParAMGDataModularizedMatMat(amg_data) = modu_rap;
 
+   hypre_ParAMGDataMatvecFormat(amg_data)          = HYPRE_CSR_MATVEC_FORMAT_CSR;
+   hypre_ParAMGDataMatvecFormatNumLevels(amg_data) = HYPRE_INT_MAX;
+   hypre_ParAMGDataMatvecOverlap(amg_data)         = 0;
+   hypre_ParAMGDataSinglePrecisionLevel(amg_data)  = 0;
+
+   hypre_ParAMGDataSetupReuse(amg_data)            = 0;
+   hypre_ParAMGDataReuseNumLevels(amg_data)        = 0;
+   hypre_ParAMGDataReuseGlobalSize(amg_data)       = NULL;
+   hypre_ParAMGDataReuseFirstRow(amg_data)         = NULL;
+   hypre_ParAMGDataReuseLocalNnz(amg_data)         = NULL;
+   hypre_ParAMGDataReusePatternKey(amg_data)       = NULL;
+   hypre_ParAMGDataReuseSArray(amg_data)           = NULL;
+   hypre_ParAMGDataReuseCFMarkerArray(amg_data)    = NULL;
+   hypre_ParAMGDataReuseAPArray(amg_data)          = NULL;
+   hypre_ParAMGDataReuseRAPArray(amg_data)         = NULL;
+
    /* information for preserving indices as coarse grid points */
    hypre_ParAMGDataCPointsMarker(amg_data)      = NULL;
    hypre_ParAMGDataCPointsLocalMarker(amg_data) = NULL;
@@ -574,6 +609,8 @@ hypre_BoomerAMGDestroy( void *data )
       HYPRE_Int     i;
       HYPRE_MemoryLocation memory_location = hypre_ParAMGDataMemoryLocation(amg_data);
 
+      hypre_BoomerAMGSetupReuseDestroy(amg_data);
+
 #ifdef HYPRE_USING_DSUPERLU
       // if (hypre_ParAMGDataDSLUThreshold(amg_data) > 0)
       if (hypre_ParAMGDataDSLUSolver(amg_data) != NULL)
@@ -738,6 +775,19 @@ hypre_BoomerAMGDestroy( void *data )
          hypre_TFree(hypre_ParAMGDataChebyDS(amg_data), HYPRE_MEMORY_HOST);
       }
 
+      if (hypre_ParAMGDataMCDiag(amg_data))
+      {
+         for (i = 0; i < num_levels; i++)
+         {
+            hypre_CSRMatrixDestroy(hypre_ParAMGDataMCDiag(amg_data)[i]);
+            hypre_IntArrayDestroy(hypre_ParAMGDataMCPerm(amg_data)[i]);
+            hypre_IntArrayDestroy(hypre_ParAMGDataMCColorStarts(amg_data)[i]);
+         }
+         hypre_TFree(hypre_ParAMGDataMCDiag(amg_data), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_ParAMGDataMCPerm(amg_data), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_ParAMGDataMCColorStarts(amg_data), HYPRE_MEMORY_HOST);
+      }
+
       hypre_TFree(hypre_ParAMGDataDinv(amg_data), HYPRE_MEMORY_HOST);
 
       /* get rid of a fine level block matrix */
@@ -899,6 +949,10 @@ hypre_BoomerAMGDestroy( void *data )
       hypre_TFree(hypre_ParAMGDataBVec(amg_data),  hypre_ParAMGDataGEMemoryLocation(amg_data));
       hypre_TFree(hypre_ParAMGDataUVec(amg_data),  hypre_ParAMGDataGEMemoryLocation(amg_data));
       hypre_TFree(hypre_ParAMGDataCommInfo(amg_data), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParAMGDataGEPerm(amg_data), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParAMGDataAdaptivePostSweeps(amg_data), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParAMGDataChebyEigCache(amg_data), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParAMGDataChebyEigCacheRows(amg_data), HYPRE_MEMORY_HOST);
 
       if (new_comm != hypre_MPI_COMM_NULL)
       {
@@ -1905,6 +1959,86 @@ hypre_BoomerAMGGetFCycle( void      *data,
    return hypre_error_flag;
 }
 
+HYPRE_Int
+hypre_BoomerAMGSetAdaptiveCycle( void     *data,
+                                 HYPRE_Int adaptive_cycle )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (adaptive_cycle < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataAdaptiveCycle(amg_data) = adaptive_cycle;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGGetAdaptiveCycle( void      *data,
+                                 HYPRE_Int *adaptive_cycle )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   *adaptive_cycle = hypre_ParAMGDataAdaptiveCycle(amg_data);
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetAdaptiveCycleTol( void       *data,
+                                    HYPRE_Real  adaptive_cycle_tol )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (adaptive_cycle_tol <= 0.0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataAdaptiveCycleTol(amg_data) = adaptive_cycle_tol;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGGetAdaptiveCycleTol( void       *data,
+                                    HYPRE_Real *adaptive_cycle_tol )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   *adaptive_cycle_tol = hypre_ParAMGDataAdaptiveCycleTol(amg_data);
+
+   return hypre_error_flag;
+}
+
 HYPRE_Int
 hypre_BoomerAMGSetConvergeType( void     *data,
                                 HYPRE_Int type  )
@@ -4532,6 +4666,41 @@ hypre_BoomerAMGSetChebyScale( void     *data,
 
    return hypre_error_flag;
 }
+HYPRE_Int
+hypre_BoomerAMGSetChebyLanczos( void     *data,
+                                HYPRE_Int     cheby_lanczos)
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   hypre_ParAMGDataChebyLanczos(amg_data) = cheby_lanczos;
+
+   return hypre_error_flag;
+}
+HYPRE_Int
+hypre_BoomerAMGSetChebyEigRefreshTol( void     *data,
+                                      HYPRE_Real    refresh_tol)
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (refresh_tol < 0.0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   hypre_ParAMGDataChebyEigRefreshTol(amg_data) = refresh_tol;
+
+   return hypre_error_flag;
+}
 
 
 /*--------------------------------------------------------------------------
@@ -4927,6 +5096,289 @@ hypre_BoomerAMGSetKeepTranspose( void       *data,
    return hypre_error_flag;
 }
 
+HYPRE_Int
+hypre_BoomerAMGSetMatvecFormat( void       *data,
+                                HYPRE_Int   matvec_format )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (matvec_format != HYPRE_CSR_MATVEC_FORMAT_CSR &&
+       matvec_format != HYPRE_CSR_MATVEC_FORMAT_SELL)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataMatvecFormat(amg_data) = matvec_format;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetMatvecFormatNumLevels( void       *data,
+                                         HYPRE_Int   num_levels )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (num_levels < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataMatvecFormatNumLevels(amg_data) = num_levels;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetMatvecOverlap( void       *data,
+                                 HYPRE_Int   matvec_overlap )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (matvec_overlap != 0 && matvec_overlap != 1)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataMatvecOverlap(amg_data) = matvec_overlap;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetSinglePrecisionLevel( void       *data,
+                                        HYPRE_Int   level )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (level < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataSinglePrecisionLevel(amg_data) = level;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetSetupReuse( void       *data,
+                              HYPRE_Int   setup_reuse )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (setup_reuse != 0 && setup_reuse != 1)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataSetupReuse(amg_data) = setup_reuse;
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGSetupReuseCreate
+ *
+ * Allocates the per-level data kept for values-only re-setups.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGSetupReuseCreate( void      *data,
+                                 HYPRE_Int  num_levels )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+   hypre_BoomerAMGSetupReuseDestroy(amg_data);
+
+   hypre_ParAMGDataReuseSArray(amg_data) =
+      hypre_CTAlloc(hypre_ParCSRMatrix *, num_levels, HYPRE_MEMORY_HOST);
+   hypre_ParAMGDataReuseCFMarkerArray(amg_data) =
+      hypre_CTAlloc(hypre_IntArray *, num_levels, HYPRE_MEMORY_HOST);
+   hypre_ParAMGDataReuseAPArray(amg_data) =
+      hypre_CTAlloc(hypre_ParCSRMatMatData *, num_levels, HYPRE_MEMORY_HOST);
+   hypre_ParAMGDataReuseRAPArray(amg_data) =
+      hypre_CTAlloc(hypre_ParCSRMatMatData *, num_levels, HYPRE_MEMORY_HOST);
+   hypre_ParAMGDataReuseGlobalSize(amg_data) =
+      hypre_CTAlloc(HYPRE_BigInt, num_levels, HYPRE_MEMORY_HOST);
+   hypre_ParAMGDataReuseFirstRow(amg_data) =
+      hypre_CTAlloc(HYPRE_BigInt, num_levels, HYPRE_MEMORY_HOST);
+   hypre_ParAMGDataReuseLocalNnz(amg_data) =
+      hypre_CTAlloc(HYPRE_Int, num_levels, HYPRE_MEMORY_HOST);
+   hypre_ParAMGDataReusePatternKey(amg_data) =
+      hypre_CTAlloc(hypre_ulonglongint, num_levels, HYPRE_MEMORY_HOST);
+   hypre_ParAMGDataReuseNumLevels(amg_data) = num_levels;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGSetupReuseDestroy
+ *
+ * Frees the strength matrices, C/F splittings and symbolic Galerkin
+ * products kept for values-only re-setups.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGSetupReuseDestroy( void *data )
+{
+   hypre_ParAMGData        *amg_data   = (hypre_ParAMGData*) data;
+   hypre_ParCSRMatMatData **AP_array   = hypre_ParAMGDataReuseAPArray(amg_data);
+   hypre_ParCSRMatMatData **RAP_array  = hypre_ParAMGDataReuseRAPArray(amg_data);
+   HYPRE_Int                num_levels = hypre_ParAMGDataReuseNumLevels(amg_data);
+   HYPRE_Int                i;
+
+   if (hypre_ParAMGDataReuseSArray(amg_data))
+   {
+      hypre_BoomerAMGSetupReuseClearLevels(amg_data, 0);
+   }
+   for (i = 0; i < num_levels; i++)
+   {
+      hypre_ParCSRMatMatDataDestroy(AP_array[i]);
+      hypre_ParCSRMatMatDataDestroy(RAP_array[i]);
+   }
+   hypre_TFree(hypre_ParAMGDataReuseSArray(amg_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParAMGDataReuseCFMarkerArray(amg_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(AP_array, HYPRE_MEMORY_HOST);
+   hypre_TFree(RAP_array, HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParAMGDataReuseGlobalSize(amg_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParAMGDataReuseFirstRow(amg_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParAMGDataReuseLocalNnz(amg_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParAMGDataReusePatternKey(amg_data), HYPRE_MEMORY_HOST);
+
+   hypre_ParAMGDataReuseSArray(amg_data)        = NULL;
+   hypre_ParAMGDataReuseCFMarkerArray(amg_data) = NULL;
+   hypre_ParAMGDataReuseAPArray(amg_data)       = NULL;
+   hypre_ParAMGDataReuseRAPArray(amg_data)      = NULL;
+   hypre_ParAMGDataReuseGlobalSize(amg_data)    = NULL;
+   hypre_ParAMGDataReuseFirstRow(amg_data)      = NULL;
+   hypre_ParAMGDataReuseLocalNnz(amg_data)      = NULL;
+   hypre_ParAMGDataReusePatternKey(amg_data)    = NULL;
+   hypre_ParAMGDataReuseNumLevels(amg_data)     = 0;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGSetupReuseClearLevels
+ *
+ * Drops the strength matrices and C/F splittings kept for the levels from
+ * level on, so that these levels are coarsened again. The symbolic Galerkin
+ * products check the patterns of their operands themselves.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGSetupReuseClearLevels( void      *data,
+                                      HYPRE_Int  level )
+{
+   hypre_ParAMGData    *amg_data   = (hypre_ParAMGData*) data;
+   hypre_ParCSRMatrix **S_array    = hypre_ParAMGDataReuseSArray(amg_data);
+   hypre_IntArray     **CF_array   = hypre_ParAMGDataReuseCFMarkerArray(amg_data);
+   HYPRE_Int            num_levels = hypre_ParAMGDataReuseNumLevels(amg_data);
+   HYPRE_Int            i;
+
+   for (i = level; i < num_levels; i++)
+   {
+      if (S_array[i])
+      {
+         hypre_ParCSRMatrixDestroy(S_array[i]);
+      }
+      hypre_IntArrayDestroy(CF_array[i]);
+      S_array[i]  = NULL;
+      CF_array[i] = NULL;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGSetupReuseStoreKey
+ *
+ * Records the global size, row partition and sparsity pattern of the matrix
+ * A of the given level, so that a later setup can check that the coarsening
+ * kept for that level still applies.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGSetupReuseStoreKey( void               *data,
+                                   hypre_ParCSRMatrix *A,
+                                   HYPRE_Int           level )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+   hypre_ParAMGDataReuseGlobalSize(amg_data)[level] = hypre_ParCSRMatrixGlobalNumRows(A);
+   hypre_ParAMGDataReuseFirstRow(amg_data)[level]   = hypre_ParCSRMatrixFirstRowIndex(A);
+   hypre_ParAMGDataReuseLocalNnz(amg_data)[level]   =
+      hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(A)) +
+      hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(A));
+   hypre_ParAMGDataReusePatternKey(amg_data)[level] = hypre_ParCSRMatrixPatternKey(A);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGSetupReuseMatches
+ *
+ * Returns 1 on all ranks if A has the global size, row partition and
+ * sparsity pattern recorded for the given level by
+ * hypre_BoomerAMGSetupReuseStoreKey on every rank, and 0 otherwise.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGSetupReuseMatches( void               *data,
+                                  hypre_ParCSRMatrix *A,
+                                  HYPRE_Int           level )
+{
+   hypre_ParAMGData *amg_data    = (hypre_ParAMGData*) data;
+   HYPRE_Int         local_match = 0;
+   HYPRE_Int         match;
+
+   if (hypre_ParAMGDataReuseGlobalSize(amg_data)[level] == hypre_ParCSRMatrixGlobalNumRows(A) &&
+       hypre_ParAMGDataReuseFirstRow(amg_data)[level]   == hypre_ParCSRMatrixFirstRowIndex(A) &&
+       hypre_ParAMGDataReuseLocalNnz(amg_data)[level]   ==
+       hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(A)) +
+       hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(A)) &&
+       hypre_ParAMGDataReusePatternKey(amg_data)[level] == hypre_ParCSRMatrixPatternKey(A))
+   {
+      local_match = 1;
+   }
+
+   hypre_MPI_Allreduce(&local_match, &match, 1, HYPRE_MPI_INT, hypre_MPI_MIN,
+                       hypre_ParCSRMatrixComm(A));
+
+   return match;
+}
+
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int
 hypre_BoomerAMGSetDSLUThreshold( void   *data,
@@ -10,6 +10,9 @@
 
 #define CUMNUMIT
 
+/* number of object classes reported by hypre_BoomerAMGGetMemoryUsage */
+#define HYPRE_AMG_NUM_MEMORY_CLASSES 7
+
 #include "par_csr_block_matrix.h"
 
 /*--------------------------------------------------------------------------
@@ -86,6 +89,11 @@ typedef struct
    HYPRE_Real     tol;
    HYPRE_Int      partial_cycle_coarsest_level;
    HYPRE_Int      partial_cycle_control;
+   HYPRE_Int      adaptive_cycle;        /* probing interval of the adaptive cycle, 0 = off */
+   HYPRE_Real     adaptive_cycle_tol;    /* skip/truncate when reduction factor >= tol */
+   HYPRE_Int      adaptive_cycle_count;  /* cycles since the last setup */
+   HYPRE_Int      adaptive_num_levels;   /* number of levels visited by the adaptive cycle */
+   HYPRE_Int     *adaptive_post_sweeps;  /* per level: number of post-smoothing sweeps */
 
 
    /* problem data */
@@ -168,9 +176,20 @@ typedef struct
    HYPRE_Int            cheby_variant;
    HYPRE_Int            cheby_scale;
    HYPRE_Real           cheby_fraction;
+   HYPRE_Int            cheby_lanczos;         /* estimate bounds with Lanczos instead of CG */
+   HYPRE_Real           cheby_eig_refresh_tol; /* reuse estimates across setups, 0 = off */
+   HYPRE_Int            cheby_eig_cache_levels;
+   HYPRE_Real          *cheby_eig_cache;       /* per level: max, min and ||A||_F */
+   HYPRE_BigInt        *cheby_eig_cache_rows;  /* per level: global number of rows */
+   HYPRE_Int            cheby_eig_reused;      /* levels reused in the last setup */
    hypre_Vector       **cheby_ds;
    HYPRE_Real         **cheby_coefs;
 
+   /* data for multicolor relaxation (types 31-33), per level */
+   hypre_CSRMatrix    **mc_diag;
+   hypre_IntArray     **mc_perm;
+   hypre_IntArray     **mc_color_starts;
+
    HYPRE_Real           cum_nnz_AP;
 
    /* data needed for non-Galerkin option */
@@ -243,6 +262,9 @@ typedef struct
    HYPRE_Real *A_work;
    HYPRE_Real *b_vec;
    HYPRE_Real *u_vec;
+   HYPRE_Int  *ge_perm;        /* RCM ordering of the banded LU (solver type 97) */
+   HYPRE_Int   ge_band_lower;  /* lower bandwidth of the banded LU */
+   HYPRE_Int   ge_band_upper;  /* upper bandwidth of the banded LU */
 
    /* information for multiplication with Lambda - additive AMG */
    HYPRE_Int      additive;
@@ -264,6 +286,26 @@ typedef struct
    HYPRE_Int keepTranspose;
    HYPRE_Int modularized_matmat;
 
+   /* host matvec kernel used for A, P and R in the solve phase */
+   HYPRE_Int matvec_format;
+   HYPRE_Int matvec_format_num_levels;
+   HYPRE_Int matvec_overlap;
+   HYPRE_Int single_precision_level;
+
+   /* values-only re-setup: strength pattern, C/F splitting and symbolic
+      Galerkin products per level, kept from a previous setup together with
+      the size, row partition and sparsity pattern of each level's matrix */
+   HYPRE_Int                 setup_reuse;
+   HYPRE_Int                 reuse_num_levels;
+   HYPRE_BigInt             *reuse_global_size;
+   HYPRE_BigInt             *reuse_first_row;
+   HYPRE_Int                *reuse_local_nnz;
+   hypre_ulonglongint       *reuse_pattern_key;
+   hypre_ParCSRMatrix      **reuse_S_array;
+   hypre_IntArray          **reuse_CF_marker_array;
+   hypre_ParCSRMatMatData  **reuse_AP_array;
+   hypre_ParCSRMatMatData  **reuse_RAP_array;
+
    /* information for preserving indices as coarse grid points */
    HYPRE_Int      num_C_points;
    HYPRE_Int      C_points_coarse_level;
@@ -342,6 +384,11 @@ typedef struct
 #define hypre_ParAMGDataTol(amg_data) ((amg_data)->tol)
 #define hypre_ParAMGDataPartialCycleCoarsestLevel(amg_data) ((amg_data)->partial_cycle_coarsest_level)
 #define hypre_ParAMGDataPartialCycleControl(amg_data) ((amg_data)->partial_cycle_control)
+#define hypre_ParAMGDataAdaptiveCycle(amg_data) ((amg_data)->adaptive_cycle)
+#define hypre_ParAMGDataAdaptiveCycleTol(amg_data) ((amg_data)->adaptive_cycle_tol)
+#define hypre_ParAMGDataAdaptiveCycleCount(amg_data) ((amg_data)->adaptive_cycle_count)
+#define hypre_ParAMGDataAdaptiveNumLevels(amg_data) ((amg_data)->adaptive_num_levels)
+#define hypre_ParAMGDataAdaptivePostSweeps(amg_data) ((amg_data)->adaptive_post_sweeps)
 #define hypre_ParAMGDataNumGridSweeps(amg_data) ((amg_data)->num_grid_sweeps)
 #define hypre_ParAMGDataUserCoarseRelaxType(amg_data) ((amg_data)->user_coarse_relax_type)
 #define hypre_ParAMGDataUserRelaxType(amg_data) ((amg_data)->user_relax_type)
@@ -427,9 +474,19 @@ typedef struct
 #define hypre_ParAMGDataChebyEigEst(amg_data) ((amg_data)->cheby_eig_est)
 #define hypre_ParAMGDataChebyVariant(amg_data) ((amg_data)->cheby_variant)
 #define hypre_ParAMGDataChebyScale(amg_data) ((amg_data)->cheby_scale)
+#define hypre_ParAMGDataChebyLanczos(amg_data) ((amg_data)->cheby_lanczos)
+#define hypre_ParAMGDataChebyEigRefreshTol(amg_data) ((amg_data)->cheby_eig_refresh_tol)
+#define hypre_ParAMGDataChebyEigCacheLevels(amg_data) ((amg_data)->cheby_eig_cache_levels)
+#define hypre_ParAMGDataChebyEigCache(amg_data) ((amg_data)->cheby_eig_cache)
+#define hypre_ParAMGDataChebyEigCacheRows(amg_data) ((amg_data)->cheby_eig_cache_rows)
+#define hypre_ParAMGDataChebyEigReused(amg_data) ((amg_data)->cheby_eig_reused)
 #define hypre_ParAMGDataChebyDS(amg_data) ((amg_data)->cheby_ds)
 #define hypre_ParAMGDataChebyCoefs(amg_data) ((amg_data)->cheby_coefs)
 
+#define hypre_ParAMGDataMCDiag(amg_data) ((amg_data)->mc_diag)
+#define hypre_ParAMGDataMCPerm(amg_data) ((amg_data)->mc_perm)
+#define hypre_ParAMGDataMCColorStarts(amg_data) ((amg_data)->mc_color_starts)
+
 #define hypre_ParAMGDataCumNnzAP(amg_data)   ((amg_data)->cum_nnz_AP)
 
 /* block */
@@ -504,6 +561,9 @@ typedef struct
 #define hypre_ParAMGDataBVec(amg_data) ((amg_data)->b_vec)
 #define hypre_ParAMGDataUVec(amg_data) ((amg_data)->u_vec)
 #define hypre_ParAMGDataCommInfo(amg_data) ((amg_data)->comm_info)
+#define hypre_ParAMGDataGEPerm(amg_data) ((amg_data)->ge_perm)
+#define hypre_ParAMGDataGEBandLower(amg_data) ((amg_data)->ge_band_lower)
+#define hypre_ParAMGDataGEBandUpper(amg_data) ((amg_data)->ge_band_upper)
 
 /* additive AMG parameters */
 #define hypre_ParAMGDataAdditive(amg_data) ((amg_data)->additive)
@@ -529,6 +589,20 @@ typedef struct
 #define hypre_ParAMGDataRAP2(amg_data) ((amg_data)->rap2)
 #define hypre_ParAMGDataKeepTranspose(amg_data) ((amg_data)->keepTranspose)
 #define hypre_ParAMGDataModularizedMatMat(amg_data) ((amg_data)->modularized_matmat)
+#define hypre_ParAMGDataMatvecFormat(amg_data) ((amg_data)->matvec_format)
+#define hypre_ParAMGDataMatvecFormatNumLevels(amg_data) ((amg_data)->matvec_format_num_levels)
+#define hypre_ParAMGDataMatvecOverlap(amg_data) ((amg_data)->matvec_overlap)
+#define hypre_ParAMGDataSinglePrecisionLevel(amg_data) ((amg_data)->single_precision_level)
+#define hypre_ParAMGDataSetupReuse(amg_data) ((amg_data)->setup_reuse)
+#define hypre_ParAMGDataReuseNumLevels(amg_data) ((amg_data)->reuse_num_levels)
+#define hypre_ParAMGDataReuseGlobalSize(amg_data) ((amg_data)->reuse_global_size)
+#define hypre_ParAMGDataReuseFirstRow(amg_data) ((amg_data)->reuse_first_row)
+#define hypre_ParAMGDataReuseLocalNnz(amg_data) ((amg_data)->reuse_local_nnz)
+#define hypre_ParAMGDataReusePatternKey(amg_data) ((amg_data)->reuse_pattern_key)
+#define hypre_ParAMGDataReuseSArray(amg_data) ((amg_data)->reuse_S_array)
+#define hypre_ParAMGDataReuseCFMarkerArray(amg_data) ((amg_data)->reuse_CF_marker_array)
+#define hypre_ParAMGDataReuseAPArray(amg_data) ((amg_data)->reuse_AP_array)
+#define hypre_ParAMGDataReuseRAPArray(amg_data) ((amg_data)->reuse_RAP_array)
 
 /*indices for the dof which will keep coarsening to the coarse level */
 #define hypre_ParAMGDataNumCPoints(amg_data)  ((amg_data)->num_C_points)
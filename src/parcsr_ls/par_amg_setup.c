@@ -147,6 +147,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
    HYPRE_Real *max_eig_est = NULL;
    HYPRE_Real *min_eig_est = NULL;
+   hypre_CSRMatrix **mc_diag = NULL;
 
    HYPRE_Solver *smoother = hypre_ParAMGDataSmoother(amg_data);
    HYPRE_Int     smooth_type = hypre_ParAMGDataSmoothType(amg_data);
@@ -227,6 +228,15 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    HYPRE_Real      wall_time;   /* for debugging instrumentation */
    HYPRE_Int       add_end;
 
+   /* values-only re-setup */
+   HYPRE_Int            reuse_structure = 0;
+   HYPRE_Int            reuse_level = 0;
+   HYPRE_Int            store_structure = 0;
+   hypre_ParCSRMatrix **reuse_S_array;
+   hypre_IntArray     **reuse_CF_marker_array;
+   hypre_ParCSRMatMatData **reuse_AP_array = NULL;
+   hypre_ParCSRMatMatData **reuse_RAP_array = NULL;
+
 #ifdef HYPRE_USING_DSUPERLU
    HYPRE_Int       dslu_threshold = hypre_ParAMGDataDSLUThreshold(amg_data);
 #endif
@@ -374,6 +384,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
 
    if (grid_relax_type[0] >= 20 && grid_relax_type[0] != 30 &&
+       (grid_relax_type[0] < 31 || grid_relax_type[0] > 33) &&
        grid_relax_type[0] != 88 && grid_relax_type[0] != 89)
    {
       /* block relaxation chosen */
@@ -534,6 +545,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       hypre_TFree(hypre_ParAMGDataBVec(amg_data),  hypre_ParAMGDataGEMemoryLocation(amg_data));
       hypre_TFree(hypre_ParAMGDataUVec(amg_data),  hypre_ParAMGDataGEMemoryLocation(amg_data));
       hypre_TFree(hypre_ParAMGDataCommInfo(amg_data), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParAMGDataGEPerm(amg_data), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParAMGDataAdaptivePostSweeps(amg_data), HYPRE_MEMORY_HOST);
 
       if (new_comm != hypre_MPI_COMM_NULL)
       {
@@ -568,6 +581,19 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          hypre_TFree(hypre_ParAMGDataChebyCoefs(amg_data), HYPRE_MEMORY_HOST);
       }
 
+      if (hypre_ParAMGDataMCDiag(amg_data))
+      {
+         for (i = 0; i < old_num_levels; i++)
+         {
+            hypre_CSRMatrixDestroy(hypre_ParAMGDataMCDiag(amg_data)[i]);
+            hypre_IntArrayDestroy(hypre_ParAMGDataMCPerm(amg_data)[i]);
+            hypre_IntArrayDestroy(hypre_ParAMGDataMCColorStarts(amg_data)[i]);
+         }
+         hypre_TFree(hypre_ParAMGDataMCDiag(amg_data), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_ParAMGDataMCPerm(amg_data), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_ParAMGDataMCColorStarts(amg_data), HYPRE_MEMORY_HOST);
+      }
+
       if (hypre_ParAMGDataL1Norms(amg_data))
       {
          for (i = 0; i < old_num_levels; i++)
@@ -974,6 +1000,44 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       hypre_ParAMGDataSmoother(amg_data) = smoother;
    }
 
+   /*-----------------------------------------------------
+    * Values-only re-setup: decide whether the strength matrices and
+    * C/F splittings of a previous setup are reused, or kept from this one
+    *-----------------------------------------------------*/
+
+   if (hypre_ParAMGDataSetupReuse(amg_data) && !block_mode && !nodal &&
+       !agg_num_levels && !hypre_ParAMGDataGSMG(amg_data) && interp_type != 1 &&
+       !restri_type && max_levels > 1 &&
+       hypre_GetExecPolicy1(memory_location) == HYPRE_EXEC_HOST)
+   {
+      /* the kept data only applies to a matrix with the same row partition
+         and sparsity pattern; anything else gets a full setup. The coarse
+         levels are checked in the same way as they are reached. */
+      if (hypre_ParAMGDataReuseSArray(amg_data) &&
+          hypre_ParAMGDataReuseNumLevels(amg_data) == max_levels &&
+          hypre_BoomerAMGSetupReuseMatches(amg_data, A, 0))
+      {
+         reuse_structure = 1;
+      }
+      else
+      {
+         hypre_BoomerAMGSetupReuseCreate(amg_data, max_levels);
+         store_structure = 1;
+      }
+   }
+   else
+   {
+      hypre_BoomerAMGSetupReuseDestroy(amg_data);
+   }
+   reuse_S_array         = hypre_ParAMGDataReuseSArray(amg_data);
+   reuse_CF_marker_array = hypre_ParAMGDataReuseCFMarkerArray(amg_data);
+   if (hypre_GetExecPolicy1(memory_location) == HYPRE_EXEC_HOST)
+   {
+      /* the split symbolic/numeric Galerkin product is host only */
+      reuse_AP_array  = hypre_ParAMGDataReuseAPArray(amg_data);
+      reuse_RAP_array = hypre_ParAMGDataReuseRAPArray(amg_data);
+   }
+
    /*-----------------------------------------------------
     *  Enter Coarsening Loop
     *-----------------------------------------------------*/
@@ -1072,6 +1136,21 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
             local_num_vars =
                hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A_array[level]));
          }
+
+         /* New values can change the pattern of the coarse matrices, e.g.
+            through truncation of P, and the hierarchy can get deeper. Coarsen
+            this and all coarser levels again and keep the result for the next
+            setup. */
+         if (reuse_structure &&
+             (!reuse_S_array[level] ||
+              (level > 0 && !hypre_BoomerAMGSetupReuseMatches(amg_data, A_array[level], level))))
+         {
+            hypre_BoomerAMGSetupReuseClearLevels(amg_data, level);
+            reuse_structure = 0;
+            store_structure = 1;
+         }
+         reuse_level = reuse_structure;
+
          if (hypre_ParAMGDataGSMG(amg_data) ||
              hypre_ParAMGDataInterpType(amg_data) == 1)
          {
@@ -1081,7 +1160,13 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          }
 
          /**** Get the Strength Matrix ****/
-         if (hypre_ParAMGDataGSMG(amg_data) == 0)
+         if (reuse_level)
+         {
+            /* Values-only re-setup: take the strength pattern of the
+               previous setup */
+            S = hypre_ParCSRMatrixClone(reuse_S_array[level], 0);
+         }
+         else if (hypre_ParAMGDataGSMG(amg_data) == 0)
          {
             if (nodal) /* if we are solving systems and
                           not using the unknown approach then we need to
@@ -1150,12 +1235,19 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          }
 
          /* Allocate CF_marker for the current level */
-         CF_marker_array[level] = hypre_IntArrayCreate(local_num_vars);
-         hypre_IntArrayInitialize(CF_marker_array[level]);
+         if (reuse_level)
+         {
+            CF_marker_array[level] = hypre_IntArrayCloneDeep(reuse_CF_marker_array[level]);
+         }
+         else
+         {
+            CF_marker_array[level] = hypre_IntArrayCreate(local_num_vars);
+            hypre_IntArrayInitialize(CF_marker_array[level]);
+         }
          CF_marker = hypre_IntArrayData(CF_marker_array[level]);
 
          /* Set isolated fine points (SF_PT) given by the user */
-         if ((num_isolated_F_points > 0) && (level == 0))
+         if ((num_isolated_F_points > 0) && (level == 0) && !reuse_level)
          {
             if (block_mode)
             {
@@ -1210,7 +1302,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          /**** Do the appropriate coarsening ****/
          HYPRE_ANNOTATE_REGION_BEGIN("%s", "Coarsening");
 
-         if (nodal == 0) /* no nodal coarsening */
+         /* a values-only re-setup keeps the previous C/F splitting */
+         if (nodal == 0 && !reuse_level) /* no nodal coarsening */
          {
             if (coarsen_type == 6)
                hypre_BoomerAMGCoarsenFalgout(S, A_array[level], measure_type,
@@ -1617,6 +1710,14 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
             }
          }
 
+         /* Keep the strength pattern and C/F splitting for values-only re-setups */
+         if (store_structure && S)
+         {
+            reuse_S_array[level]         = hypre_ParCSRMatrixClone(S, 0);
+            reuse_CF_marker_array[level] = hypre_IntArrayCloneDeep(CF_marker_array[level]);
+            hypre_BoomerAMGSetupReuseStoreKey(amg_data, A_array[level], level);
+         }
+
          /*****xxxxxxxxxxxxx changes for min_coarse_size */
          /* here we will determine the coarse grid size to be able to
             determine if it is not smaller than requested minimal size */
@@ -1650,7 +1751,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                HYPRE_Int *num_grid_sweeps = hypre_ParAMGDataNumGridSweeps(amg_data);
                HYPRE_Int **grid_relax_points = hypre_ParAMGDataGridRelaxPoints(amg_data);
                if (grid_relax_type[3] ==  9 || grid_relax_type[3] == 99 ||
-                   grid_relax_type[3] == 19 || grid_relax_type[3] == 98)
+                   grid_relax_type[3] == 19 || grid_relax_type[3] == 98 ||
+                   grid_relax_type[3] == 97)
                {
                   grid_relax_type[3] = grid_relax_type[0];
                   num_grid_sweeps[3] = 1;
@@ -2502,7 +2604,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          HYPRE_Int    **grid_relax_points =
             hypre_ParAMGDataGridRelaxPoints(amg_data);
          if (grid_relax_type[3] == 9 || grid_relax_type[3] == 99
-             || grid_relax_type[3] == 19 || grid_relax_type[3] == 98)
+             || grid_relax_type[3] == 19 || grid_relax_type[3] == 98
+             || grid_relax_type[3] == 97)
          {
             grid_relax_type[3] = grid_relax_type[0];
             num_grid_sweeps[3] = 1;
@@ -3060,7 +3163,14 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          else
          {
             /* Compute standard Galerkin coarse-grid product */
-            if (hypre_ParAMGDataModularizedMatMat(amg_data))
+            if (reuse_AP_array && !Pnew)
+            {
+               hypre_BoomerAMGBuildCoarseOperatorReuse(P_array[level], A_array[level],
+                                                       keepTranspose,
+                                                       &reuse_AP_array[level],
+                                                       &reuse_RAP_array[level], &A_H);
+            }
+            else if (hypre_ParAMGDataModularizedMatMat(amg_data))
             {
                A_H = hypre_ParCSRMatrixRAPKT(P_array[level], A_array[level],
                                              P_array[level], keepTranspose);
@@ -3101,6 +3211,9 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          fflush(NULL);
       }
 
+      /* all scratch arrays of this level have been freed: recycle the arena */
+      hypre_HostArenaReset(hypre_HandleHostArena(hypre_handle()));
+
       HYPRE_ANNOTATE_MGLEVEL_END(level);
       hypre_GpuProfilingPopRange();
       ++level;
@@ -3145,6 +3258,9 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       }
    }  /* end of coarsening loop: while (not_finished_coarsening) */
 
+   /* give the chunks of the host arena back to the system */
+   hypre_HostArenaRelease(hypre_HandleHostArena(hypre_handle()));
+
    HYPRE_ANNOTATE_REGION_BEGIN("%s", "Coarse solve");
 
    /* redundant coarse grid solve */
@@ -3166,6 +3282,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 #endif
    else if (grid_relax_type[3] == 9   ||
             grid_relax_type[3] == 19  ||
+            grid_relax_type[3] == 97  ||
             grid_relax_type[3] == 98  ||
             grid_relax_type[3] == 99  ||
             grid_relax_type[3] == 198 ||
@@ -3267,6 +3384,41 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       cheby_coefs = hypre_CTAlloc(HYPRE_Real *, num_levels, HYPRE_MEMORY_HOST);
       hypre_ParAMGDataChebyDS(amg_data) = cheby_ds;
       hypre_ParAMGDataChebyCoefs(amg_data) = cheby_coefs;
+
+      /* per level estimates kept across setups; new levels start empty */
+      if (hypre_ParAMGDataChebyEigRefreshTol(amg_data) > 0.0 &&
+          hypre_ParAMGDataChebyEigCacheLevels(amg_data) < num_levels)
+      {
+         HYPRE_Int old_levels = hypre_ParAMGDataChebyEigCacheLevels(amg_data);
+
+         hypre_ParAMGDataChebyEigCache(amg_data) =
+            hypre_TReAlloc_v2(hypre_ParAMGDataChebyEigCache(amg_data), HYPRE_Real, 3 * old_levels,
+                              HYPRE_Real, 3 * num_levels, HYPRE_MEMORY_HOST);
+         hypre_ParAMGDataChebyEigCacheRows(amg_data) =
+            hypre_TReAlloc_v2(hypre_ParAMGDataChebyEigCacheRows(amg_data), HYPRE_BigInt, old_levels,
+                              HYPRE_BigInt, num_levels, HYPRE_MEMORY_HOST);
+         for (j = old_levels; j < num_levels; j++)
+         {
+            hypre_ParAMGDataChebyEigCacheRows(amg_data)[j] = -1;
+         }
+         hypre_ParAMGDataChebyEigCacheLevels(amg_data) = num_levels;
+      }
+      hypre_ParAMGDataChebyEigReused(amg_data) = 0;
+   }
+
+   /* Multicolor Gauss-Seidel */
+   for (j = 0; j < 4; j++)
+   {
+      if (grid_relax_type[j] >= 31 && grid_relax_type[j] <= 33)
+      {
+         mc_diag = hypre_CTAlloc(hypre_CSRMatrix *, num_levels, HYPRE_MEMORY_HOST);
+         hypre_ParAMGDataMCDiag(amg_data) = mc_diag;
+         hypre_ParAMGDataMCPerm(amg_data) =
+            hypre_CTAlloc(hypre_IntArray *, num_levels, HYPRE_MEMORY_HOST);
+         hypre_ParAMGDataMCColorStarts(amg_data) =
+            hypre_CTAlloc(hypre_IntArray *, num_levels, HYPRE_MEMORY_HOST);
+         break;
+      }
    }
 
    /* CG */
@@ -3505,7 +3657,33 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          HYPRE_Int cheby_order = hypre_ParAMGDataChebyOrder(amg_data);
          HYPRE_Int cheby_eig_est = hypre_ParAMGDataChebyEigEst(amg_data);
          HYPRE_Real cheby_fraction = hypre_ParAMGDataChebyFraction(amg_data);
-         if (cheby_eig_est)
+         HYPRE_Real refresh_tol = hypre_ParAMGDataChebyEigRefreshTol(amg_data);
+         HYPRE_Real *eig_cache = hypre_ParAMGDataChebyEigCache(amg_data);
+         HYPRE_BigInt *eig_cache_rows = hypre_ParAMGDataChebyEigCacheRows(amg_data);
+         HYPRE_Real fnorm = 0.0;
+         HYPRE_Int reuse = 0;
+
+         /* reuse the estimate of the previous setup unless this level
+            changed size or its values changed noticeably */
+         if (refresh_tol > 0.0 && j < hypre_ParAMGDataChebyEigCacheLevels(amg_data))
+         {
+            fnorm = hypre_ParCSRMatrixFnorm(A_array[j]);
+            reuse = (eig_cache_rows[j] == hypre_ParCSRMatrixGlobalNumRows(A_array[j]) &&
+                     hypre_abs(fnorm - eig_cache[3 * j + 2]) <= refresh_tol * eig_cache[3 * j + 2]);
+         }
+
+         if (reuse)
+         {
+            max_eig = eig_cache[3 * j];
+            min_eig = eig_cache[3 * j + 1];
+            hypre_ParAMGDataChebyEigReused(amg_data)++;
+         }
+         else if (cheby_eig_est && hypre_ParAMGDataChebyLanczos(amg_data))
+         {
+            hypre_ParCSRMaxEigEstimateLanczos(A_array[j], scale, cheby_eig_est,
+                                              &max_eig, &min_eig);
+         }
+         else if (cheby_eig_est)
          {
             hypre_ParCSRMaxEigEstimateCG(A_array[j], scale, cheby_eig_est,
                                          &max_eig, &min_eig);
@@ -3517,6 +3695,14 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          max_eig_est[j] = max_eig;
          min_eig_est[j] = min_eig;
 
+         if (refresh_tol > 0.0 && !reuse && j < hypre_ParAMGDataChebyEigCacheLevels(amg_data))
+         {
+            eig_cache[3 * j]     = max_eig;
+            eig_cache[3 * j + 1] = min_eig;
+            eig_cache[3 * j + 2] = fnorm;
+            eig_cache_rows[j]    = hypre_ParCSRMatrixGlobalNumRows(A_array[j]);
+         }
+
          cheby_ds[j] = hypre_SeqVectorCreate(hypre_ParCSRMatrixNumRows(A_array[j]));
          hypre_VectorVectorStride(cheby_ds[j])   = hypre_ParCSRMatrixNumRows(A_array[j]);
          hypre_VectorIndexStride(cheby_ds[j])    = 1;
@@ -3553,6 +3739,17 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
       }
 
+      if (mc_diag &&
+          ((grid_relax_type[1] >= 31 && grid_relax_type[1] <= 33) ||
+           (grid_relax_type[2] >= 31 && grid_relax_type[2] <= 33) ||
+           (grid_relax_type[3] >= 31 && grid_relax_type[3] <= 33 && j == num_levels - 1)))
+      {
+         /* color the local rows and store them permuted by color */
+         hypre_BoomerAMGRelaxMulticolorSetup(A_array[j], &mc_diag[j],
+                                             &hypre_ParAMGDataMCPerm(amg_data)[j],
+                                             &hypre_ParAMGDataMCColorStarts(amg_data)[j]);
+      }
+
       if (relax_weight[j] == 0.0)
       {
          hypre_ParCSRMatrixScaledNorm(A_array[j], &relax_weight[j]);
@@ -3819,6 +4016,71 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       hypre_ParAMGDataCumNnzAP(amg_data) = cum_nnz_AP;
    }
 
+   /* Switch the solve-phase operators to the requested host matvec kernel.
+      This also drops copies built for the values of a previous setup. The
+      SELL copy of the fine-level matrix is dropped again by the IJ interface
+      whenever the caller changes its values. */
+   if (!block_mode && hypre_ParAMGDataMatvecFormat(amg_data) != HYPRE_CSR_MATVEC_FORMAT_CSR)
+   {
+      HYPRE_Int matvec_format   = hypre_ParAMGDataMatvecFormat(amg_data);
+      HYPRE_Int num_format_lvls = hypre_min(num_levels,
+                                            hypre_ParAMGDataMatvecFormatNumLevels(amg_data));
+
+      for (j = 0; j < num_format_lvls; j++)
+      {
+         hypre_ParCSRMatrixSetMatvecFormat(A_array[j], matvec_format);
+         if (j < num_levels - 1)
+         {
+            hypre_ParCSRMatrixSetMatvecFormat(P_array[j], matvec_format);
+            if (hypre_ParAMGDataRArray(amg_data) != P_array)
+            {
+               hypre_ParCSRMatrixSetMatvecFormat(hypre_ParAMGDataRArray(amg_data)[j],
+                                                 matvec_format);
+            }
+         }
+      }
+   }
+
+   /* Overlap the halo exchange of the solve-phase matvecs with computation.
+      This also drops row splittings built for a previous setup. */
+   if (!block_mode && hypre_ParAMGDataMatvecOverlap(amg_data))
+   {
+      HYPRE_Int matvec_overlap = hypre_ParAMGDataMatvecOverlap(amg_data);
+
+      for (j = 0; j < num_levels; j++)
+      {
+         hypre_ParCSRMatrixSetMatvecOverlap(A_array[j], matvec_overlap);
+         if (j < num_levels - 1)
+         {
+            hypre_ParCSRMatrixSetMatvecOverlap(P_array[j], matvec_overlap);
+            if (hypre_ParAMGDataRArray(amg_data) != P_array)
+            {
+               hypre_ParCSRMatrixSetMatvecOverlap(hypre_ParAMGDataRArray(amg_data)[j],
+                                                  matvec_overlap);
+            }
+         }
+      }
+   }
+
+   /* Keep single-precision copies of the values of the coarse-level
+      operators for the solve phase. The fine-level matrix belongs to the
+      caller and is left alone. */
+   if (!block_mode && hypre_ParAMGDataSinglePrecisionLevel(amg_data) > 0)
+   {
+      for (j = hypre_ParAMGDataSinglePrecisionLevel(amg_data); j < num_levels; j++)
+      {
+         hypre_ParCSRMatrixSetSinglePrecision(A_array[j], 1);
+         if (j < num_levels - 1)
+         {
+            hypre_ParCSRMatrixSetSinglePrecision(P_array[j], 1);
+            if (hypre_ParAMGDataRArray(amg_data) != P_array)
+            {
+               hypre_ParCSRMatrixSetSinglePrecision(hypre_ParAMGDataRArray(amg_data)[j], 1);
+            }
+         }
+      }
+   }
+
    /*-----------------------------------------------------------------------
     * Print some stuff
     *-----------------------------------------------------------------------*/
@@ -49,6 +49,8 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
 
    /*  Local variables  */
    HYPRE_Int           j;
+   HYPRE_Int           adaptive_cycle;
+   HYPRE_Int          *post_sweeps;
    HYPRE_Int           Solve_err_flag;
    HYPRE_Int           num_procs, my_id;
    HYPRE_Int           num_vectors;
@@ -330,6 +332,28 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
       {
          hypre_printf("    Cycle %2d   %e    %f     %e \n", cycle_count,
                       resid_nrm, conv_factor, relative_resid);
+
+         /* Report the shape chosen by the adaptive cycle */
+         if (hypre_ParAMGDataAdaptiveCycle(amg_data) && hypre_ParAMGDataAdaptivePostSweeps(amg_data))
+         {
+            adaptive_cycle = hypre_ParAMGDataAdaptiveCycle(amg_data);
+            post_sweeps    = hypre_ParAMGDataAdaptivePostSweeps(amg_data);
+            if ((hypre_ParAMGDataAdaptiveCycleCount(amg_data) - 1) % adaptive_cycle == 0)
+            {
+               hypre_printf("               adaptive: probing cycle, levels 0-%d\n",
+                            num_levels - 1);
+            }
+            else
+            {
+               hypre_printf("               adaptive: levels 0-%d, post-smoothing sweeps",
+                            hypre_ParAMGDataAdaptiveNumLevels(amg_data) - 1);
+               for (j = 0; j < hypre_ParAMGDataAdaptiveNumLevels(amg_data) - 1; j++)
+               {
+                  hypre_printf(" %d", post_sweeps[j]);
+               }
+               hypre_printf("\n");
+            }
+         }
       }
    }
 
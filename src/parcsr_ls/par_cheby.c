@@ -32,6 +32,10 @@ this is rlx 11 if scale = 0, and 16 if scale == 1
 variant 1: modified cheby: T(t)* f(t) where f(t) = (1-b/t)
 this is rlx 15 if scale = 0, and 17 if scale == 1
 
+variant 2: fourth-kind cheby (Lottes 2022), only uses the upper bound and
+supports any order. It is applied through its three-term recurrence, so
+coefs holds two weights per step instead of the polynomial coefficients
+
 ratio indicates the percentage of the whole spectrum to use (so .5
 means half, and .1 means 10percent)
 
@@ -48,9 +52,10 @@ means half, and .1 means 10percent)
  * @param[in] max_eig Maximum eigenvalue
  * @param[in] min_eig Maximum eigenvalue
  * @param[in] fraction Fraction used to calculate lower bound
- * @param[in] order Polynomial order to use [1,4]
+ * @param[in] order Polynomial order to use [1,4] ([1,inf) for the fourth kind)
  * @param[in] scale Whether or not to scale by the diagonal
- * @param[in] variant Whether or not to use a variant of Chebyshev (0 standard, 1 variant)
+ * @param[in] variant Whether or not to use a variant of Chebyshev (0 standard, 1 variant,
+ *                    2 fourth kind)
  * @param[out] coefs_ptr *coefs_ptr will be allocated to contain coefficients of the polynomial
  * @param[out] ds_ptr *ds_ptr will be allocated to allow scaling by the diagonal
  */
@@ -73,9 +78,10 @@ hypre_ParCSRRelax_Cheby_Setup(hypre_ParCSRMatrix *A,         /* matrix to relax
    HYPRE_Real      *coefs        = NULL;
    HYPRE_Int        cheby_order;
    HYPRE_Real      *ds_data = NULL;
+   HYPRE_Int        i;
 
    /* u = u + p(A)r */
-   if (order > 4)
+   if (order > 4 && variant != 2)
    {
       order = 4;
    }
@@ -85,7 +91,7 @@ hypre_ParCSRRelax_Cheby_Setup(hypre_ParCSRMatrix *A,         /* matrix to relax
       order = 1;
    }
 
-   coefs = hypre_CTAlloc(HYPRE_Real, order + 1, HYPRE_MEMORY_HOST);
+   coefs = hypre_CTAlloc(HYPRE_Real, hypre_max(order + 1, 2 * order), HYPRE_MEMORY_HOST);
    /* we are using the order of p(A) */
    cheby_order = order - 1;
 
@@ -106,7 +112,18 @@ hypre_ParCSRRelax_Cheby_Setup(hypre_ParCSRMatrix *A,         /* matrix to relax
    theta = (upper_bound + lower_bound) / 2;
    delta = (upper_bound - lower_bound) / 2;
 
-   if (variant == 1)
+   if (variant == 2)
+   {
+      /* fourth-kind: d_i = coefs[2i] * d_{i-1} + coefs[2i+1] * D^{-1} r_i,
+         u_{i+1} = u_i + d_i and r_{i+1} = r_i - A d_i */
+      for (i = 0; i < order; i++)
+      {
+         coefs[2 * i]     = (HYPRE_Real) (2 * i - 1) / (HYPRE_Real) (2 * i + 3);
+         coefs[2 * i + 1] = (HYPRE_Real) (8 * i + 4) / ((HYPRE_Real) (2 * i + 3) * upper_bound);
+      }
+      coefs[0] = 0.0;
+   }
+   else if (variant == 1)
    {
       switch (cheby_order) /* these are the corresponding cheby polynomials: u = u_o + s(A)r_0  - so order is
                                one less that  resid poly: r(t) = 1 - t*s(t) */
@@ -382,6 +399,89 @@ hypre_ParCSRRelax_Cheby_SolveHost(hypre_ParCSRMatrix *A, /* matrix to relax with
    return hypre_error_flag;
 }
 
+/**
+ * @brief Solve using a fourth-kind chebyshev polynomial on the host
+ *
+ * Uses one matvec per order and only the r and v temp vectors.
+ *
+ * @param[in] A Matrix to relax with
+ * @param[in] f right-hand side
+ * @param[in] ds_data Diagonal information
+ * @param[in] coefs Recurrence weights from hypre_ParCSRRelax_Cheby_Setup
+ * @param[in] order Order of the polynomial
+ * @param[in] scale Whether or not to scale by diagonal
+ * @param[in,out] u Initial/updated approximation
+ * @param[in] v Temp vector (holds the update direction)
+ * @param[in] r Temp Vector (holds the residual)
+ */
+HYPRE_Int
+hypre_ParCSRRelax_Cheby_SolveFourthKindHost(hypre_ParCSRMatrix *A, /* matrix to relax with */
+                                            hypre_ParVector    *f, /* right-hand side */
+                                            HYPRE_Real         *ds_data,
+                                            HYPRE_Real         *coefs,
+                                            HYPRE_Int           order, /* polynomial order */
+                                            HYPRE_Int           scale, /* scale by diagonal?*/
+                                            hypre_ParVector    *u, /* initial/updated approximation */
+                                            hypre_ParVector    *v, /* temporary vector */
+                                            hypre_ParVector    *r) /* another vector */
+{
+   HYPRE_Int   num_rows = hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A));
+   HYPRE_Real *u_data   = hypre_VectorData(hypre_ParVectorLocalVector(u));
+   HYPRE_Real *d_data   = hypre_VectorData(hypre_ParVectorLocalVector(v));
+   HYPRE_Real *r_data   = hypre_VectorData(hypre_ParVectorLocalVector(r));
+
+   HYPRE_Real  d_mult, r_mult;
+   HYPRE_Int   i, j;
+
+   if (order < 1)
+   {
+      order = 1;
+   }
+
+   /* get residual: r = f - A*u */
+   hypre_ParVectorCopy(f, r);
+   hypre_ParCSRMatrixMatvec(-1.0, A, u, 1.0, r);
+
+   for (i = 0; i < order; i++)
+   {
+      if (i > 0)
+      {
+         /* r = r - A*d */
+         hypre_ParCSRMatrixMatvec(-1.0, A, v, 1.0, r);
+      }
+
+      d_mult = coefs[2 * i];
+      r_mult = coefs[2 * i + 1];
+
+      /* d = d_mult * d + r_mult * D^{-1} r; u = u + d */
+      if (scale)
+      {
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
+#endif
+         for (j = 0; j < num_rows; j++)
+         {
+            d_data[j] = (i ? d_mult * d_data[j] : 0.0) +
+                        r_mult * ds_data[j] * ds_data[j] * r_data[j];
+            u_data[j] += d_data[j];
+         }
+      }
+      else
+      {
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
+#endif
+         for (j = 0; j < num_rows; j++)
+         {
+            d_data[j] = (i ? d_mult * d_data[j] : 0.0) + r_mult * r_data[j];
+            u_data[j] += d_data[j];
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
 /**
  * @brief Solve using a chebyshev polynomial
  *
@@ -427,13 +527,25 @@ hypre_ParCSRRelax_Cheby_Solve(hypre_ParCSRMatrix *A, /* matrix to relax with */
 
 #if defined(HYPRE_USING_GPU)
    HYPRE_ExecutionPolicy exec = hypre_GetExecPolicy1(hypre_ParCSRMatrixMemoryLocation(A));
-   if (exec == HYPRE_EXEC_DEVICE)
+   if (exec == HYPRE_EXEC_DEVICE && variant == 2)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Fourth-kind Chebyshev is not supported on the device");
+      ierr = hypre_error_flag;
+   }
+   else if (exec == HYPRE_EXEC_DEVICE)
    {
       ierr = hypre_ParCSRRelax_Cheby_SolveDevice(A, f, ds_data, coefs, order, scale, variant, u, v, r,
                                                  orig_u_vec, tmp_vec);
    }
    else
 #endif
+   if (variant == 2)
+   {
+      ierr = hypre_ParCSRRelax_Cheby_SolveFourthKindHost(A, f, ds_data, coefs, order, scale,
+                                                         u, v, r);
+   }
+   else
    {
       ierr = hypre_ParCSRRelax_Cheby_SolveHost(A, f, ds_data, coefs, order, scale, variant, u, v, r,
                                                orig_u_vec, tmp_vec);
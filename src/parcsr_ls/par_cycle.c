@@ -99,6 +99,19 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
    HYPRE_Int       seq_cg = 0;
    HYPRE_Int       partial_cycle_coarsest_level;
    HYPRE_Int       partial_cycle_control;
+   HYPRE_Int       adaptive_cycle;
+   HYPRE_Int       adapt_probe = 0;
+   HYPRE_Int       cycle_num_levels;
+   HYPRE_Int       adapt_stride = 0;
+   HYPRE_Int      *post_sweeps = NULL;
+   HYPRE_Real     *adapt_norms = NULL;
+   HYPRE_Real     *adapt_norms_global;
+   HYPRE_Real      adapt_tol2, adapt_prev;
+   HYPRE_Int       fuse_restrict, restrict_work_size;
+   hypre_CSRMatrix *R_diag, *R_offd;
+   HYPRE_Complex  *Vtemp_data;
+   HYPRE_Int       num_threads = hypre_NumThreads();
+   HYPRE_Real      rnorm2;
    MPI_Comm        comm;
 
    char            nvtx_name[1024];
@@ -117,6 +130,7 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
    R_array           = hypre_ParAMGDataRArray(amg_data);
    CF_marker_array   = hypre_ParAMGDataCFMarkerArray(amg_data);
    Vtemp             = hypre_ParAMGDataVtemp(amg_data);
+   Vtemp_data        = hypre_VectorData(hypre_ParVectorLocalVector(Vtemp));
    Rtemp             = hypre_ParAMGDataRtemp(amg_data);
    Ptemp             = hypre_ParAMGDataPtemp(amg_data);
    Ztemp             = hypre_ParAMGDataZtemp(amg_data);
@@ -153,6 +167,48 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
 
    cycle_op_count = hypre_ParAMGDataCycleOpCount(amg_data);
 
+   /*---------------------------------------------------------------------
+    * Adaptive cycling: every adaptive_cycle cycles, a full probing cycle
+    * accumulates local squared residual norms on each level: after
+    * pre-smoothing, after the coarse-grid correction and after each
+    * post-smoothing sweep. They are summed up with a single reduction at
+    * the end of the probing cycle and decide how many post-smoothing
+    * sweeps are done on each level and at which level the following
+    * cycles are truncated.
+    *---------------------------------------------------------------------*/
+
+   adaptive_cycle   = hypre_ParAMGDataAdaptiveCycle(amg_data);
+   cycle_num_levels = num_levels;
+   if (block_mode || partial_cycle_coarsest_level >= 0 || num_levels < 2 ||
+       (smooth_num_levels > 0 && smooth_type > 9) || grid_relax_type[2] == 15)
+   {
+      adaptive_cycle = 0;
+   }
+
+   if (adaptive_cycle)
+   {
+      if (!hypre_ParAMGDataAdaptivePostSweeps(amg_data))
+      {
+         hypre_ParAMGDataAdaptivePostSweeps(amg_data) = hypre_CTAlloc(HYPRE_Int, num_levels,
+                                                                     HYPRE_MEMORY_HOST);
+         hypre_ParAMGDataAdaptiveNumLevels(amg_data)  = num_levels;
+         hypre_ParAMGDataAdaptiveCycleCount(amg_data) = 0;
+      }
+      post_sweeps = hypre_ParAMGDataAdaptivePostSweeps(amg_data);
+
+      adapt_probe = (hypre_ParAMGDataAdaptiveCycleCount(amg_data) % adaptive_cycle) == 0;
+      if (adapt_probe)
+      {
+         adapt_stride = 2 + hypre_max(num_grid_sweeps[2], hypre_ParAMGDataSmoothNumSweeps(amg_data));
+         adapt_norms  = hypre_CTAlloc(HYPRE_Real, adapt_stride * num_levels, HYPRE_MEMORY_HOST);
+      }
+      else
+      {
+         cycle_num_levels = hypre_ParAMGDataAdaptiveNumLevels(amg_data);
+      }
+      hypre_ParAMGDataAdaptiveCycleCount(amg_data)++;
+   }
+
    lev_counter = hypre_CTAlloc(HYPRE_Int, num_levels, HYPRE_MEMORY_HOST);
 
    if (hypre_ParAMGDataParticipate(amg_data))
@@ -220,7 +276,7 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
          lev_counter[k] = cycle_type;
       }
    }
-   fcycle_lev = num_levels - 2;
+   fcycle_lev = cycle_num_levels - 2;
 
    level = 0;
    cycle_param = 1;
@@ -326,6 +382,12 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
             Aux_F = F_array[level];
          }
          relax_type = grid_relax_type[cycle_param];
+
+         /* Drop the post-smoothing sweeps found ineffective on this level */
+         if (cycle_param == 2 && post_sweeps && !adapt_probe)
+         {
+            num_sweep = hypre_min(num_sweep, post_sweeps[level]);
+         }
       }
       else /* AB: 4/08: removed the max_levels > 1 check - should do this when max-levels = 1 also */
       {
@@ -360,6 +422,15 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
          l1_norms_level = NULL;
       }
 
+      if (adapt_probe && cycle_param == 2)
+      {
+         hypre_ParCSRMatrixMatvecOutOfPlace(-1.0, A_array[level], U_array[level],
+                                            1.0, F_array[level], Vtemp);
+         adapt_norms[adapt_stride * level + 1] +=
+            hypre_SeqVectorInnerProd(hypre_ParVectorLocalVector(Vtemp),
+                                     hypre_ParVectorLocalVector(Vtemp));
+      }
+
       if (cycle_param == 3 && seq_cg)
       {
          HYPRE_ANNOTATE_REGION_BEGIN("%s", "Coarse solve");
@@ -492,6 +563,7 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
                }
                else if (relax_type == 9   ||
                         relax_type == 19  ||
+                        relax_type == 97  ||
                         relax_type == 98  ||
                         relax_type == 99  ||
                         relax_type == 198 ||
@@ -538,6 +610,16 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
                                                 cheby_order, scale,
                                                 variant, Aux_U, Vtemp, Ztemp, Ptemp, Rtemp );
                }
+               else if (relax_type >= 31 && relax_type <= 33)
+               {
+                  /* multicolor Gauss-Seidel */
+                  hypre_BoomerAMGRelaxMulticolor(A_array[level], Aux_F,
+                                                 hypre_ParAMGDataMCDiag(amg_data)[level],
+                                                 hypre_ParAMGDataMCPerm(amg_data)[level],
+                                                 hypre_ParAMGDataMCColorStarts(amg_data)[level],
+                                                 relax_type, relax_weight[level],
+                                                 Aux_U, Vtemp);
+               }
                else if (relax_type == 17)
                {
                   if (level == num_levels - 1)
@@ -611,6 +693,15 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
                   hypre_GpuProfilingPopRange();
                   return (Solve_err_flag);
                }
+
+               if (adapt_probe && cycle_param == 2)
+               {
+                  hypre_ParCSRMatrixMatvecOutOfPlace(-1.0, A_array[level], U_array[level],
+                                                     1.0, F_array[level], Vtemp);
+                  adapt_norms[adapt_stride * level + 2 + j] +=
+                     hypre_SeqVectorInnerProd(hypre_ParVectorLocalVector(Vtemp),
+                                              hypre_ParVectorLocalVector(Vtemp));
+               }
             } /* for (j = 0; j < num_sweep; j++) */
 
             if  (smooth_num_levels > level && smooth_type > 9)
@@ -648,7 +739,7 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
       --lev_counter[level];
 
       //if ( level != num_levels-1 && lev_counter[level] >= 0 )
-      if (lev_counter[level] >= 0 && level != num_levels - 1)
+      if (lev_counter[level] >= 0 && level != cycle_num_levels - 1)
       {
          /*---------------------------------------------------------------
           * Visit coarser level next.
@@ -665,45 +756,92 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
          alpha = -1.0;
          beta = 1.0;
 
-         HYPRE_ANNOTATE_REGION_BEGIN("%s", "Residual");
-         hypre_GpuProfilingPushRange("Residual");
-         if (block_mode)
+         /* With R = P^T on the host, the residual is restricted in the same
+            sweep that computes it and is never stored (see
+            hypre_ParCSRMatrixResidualRestrictHost). The private coarse vectors
+            of the threads are kept in Vtemp; when they would be larger than the
+            fine residual, the two-pass path is cheaper */
+         fuse_restrict = !block_mode && !restri_type &&
+                         hypre_ParVectorNumVectors(U_array[fine_grid]) == 1 &&
+                         !hypre_CSRMatrixDataSingle(hypre_ParCSRMatrixDiag(A_array[fine_grid])) &&
+                         !hypre_CSRMatrixDataSingle(hypre_ParCSRMatrixDiag(R_array[fine_grid]));
+         if (fuse_restrict)
          {
-            hypre_ParVectorCopy(F_array[fine_grid], Vtemp);
-            hypre_ParCSRBlockMatrixMatvec(alpha, A_block_array[fine_grid], U_array[fine_grid],
-                                          beta, Vtemp);
+            R_diag = hypre_ParCSRMatrixDiag(R_array[fine_grid]);
+            R_offd = hypre_ParCSRMatrixOffd(R_array[fine_grid]);
+            restrict_work_size = hypre_CSRMatrixNumCols(R_diag) + hypre_CSRMatrixNumCols(R_offd);
+            fuse_restrict = ((num_threads - 1) * restrict_work_size <= local_size);
          }
-         else
+#if defined(HYPRE_USING_GPU)
+         if (hypre_GetExecPolicy1(hypre_ParCSRMatrixMemoryLocation(A_array[fine_grid])) ==
+             HYPRE_EXEC_DEVICE)
          {
-            // JSP: avoid unnecessary copy using out-of-place version of SpMV
-            hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A_array[fine_grid], U_array[fine_grid],
-                                               beta, F_array[fine_grid], Vtemp);
+            fuse_restrict = 0;
          }
-         HYPRE_ANNOTATE_REGION_END("%s", "Residual");
-         hypre_GpuProfilingPopRange();
-
-         alpha = 1.0;
-         beta = 0.0;
+#endif
 
-         HYPRE_ANNOTATE_REGION_BEGIN("%s", "Restriction");
-         hypre_GpuProfilingPushRange("Restriction");
-         if (block_mode)
+         if (fuse_restrict)
          {
-            hypre_ParCSRBlockMatrixMatvecT(alpha, R_block_array[fine_grid], Vtemp,
-                                           beta, F_array[coarse_grid]);
+            HYPRE_ANNOTATE_REGION_BEGIN("%s", "Restriction");
+            hypre_GpuProfilingPushRange("Restriction");
+            hypre_ParCSRMatrixResidualRestrictHost(A_array[fine_grid], R_array[fine_grid],
+                                                   U_array[fine_grid], F_array[fine_grid],
+                                                   F_array[coarse_grid], &rnorm2,
+                                                   Vtemp_data);
+            if (adapt_probe)
+            {
+               adapt_norms[adapt_stride * fine_grid] += rnorm2;
+            }
          }
          else
          {
-            if (restri_type)
+            HYPRE_ANNOTATE_REGION_BEGIN("%s", "Residual");
+            hypre_GpuProfilingPushRange("Residual");
+            if (block_mode)
             {
-               /* RL: no transpose for R */
-               hypre_ParCSRMatrixMatvec(alpha, R_array[fine_grid], Vtemp,
-                                        beta, F_array[coarse_grid]);
+               hypre_ParVectorCopy(F_array[fine_grid], Vtemp);
+               hypre_ParCSRBlockMatrixMatvec(alpha, A_block_array[fine_grid], U_array[fine_grid],
+                                             beta, Vtemp);
             }
             else
             {
-               hypre_ParCSRMatrixMatvecT(alpha, R_array[fine_grid], Vtemp,
-                                         beta, F_array[coarse_grid]);
+               // JSP: avoid unnecessary copy using out-of-place version of SpMV
+               hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A_array[fine_grid], U_array[fine_grid],
+                                                  beta, F_array[fine_grid], Vtemp);
+            }
+            HYPRE_ANNOTATE_REGION_END("%s", "Residual");
+            hypre_GpuProfilingPopRange();
+
+            if (adapt_probe)
+            {
+               adapt_norms[adapt_stride * fine_grid] +=
+                  hypre_SeqVectorInnerProd(hypre_ParVectorLocalVector(Vtemp),
+                                           hypre_ParVectorLocalVector(Vtemp));
+            }
+
+            alpha = 1.0;
+            beta = 0.0;
+
+            HYPRE_ANNOTATE_REGION_BEGIN("%s", "Restriction");
+            hypre_GpuProfilingPushRange("Restriction");
+            if (block_mode)
+            {
+               hypre_ParCSRBlockMatrixMatvecT(alpha, R_block_array[fine_grid], Vtemp,
+                                              beta, F_array[coarse_grid]);
+            }
+            else
+            {
+               if (restri_type)
+               {
+                  /* RL: no transpose for R */
+                  hypre_ParCSRMatrixMatvec(alpha, R_array[fine_grid], Vtemp,
+                                           beta, F_array[coarse_grid]);
+               }
+               else
+               {
+                  hypre_ParCSRMatrixMatvecT(alpha, R_array[fine_grid], Vtemp,
+                                            beta, F_array[coarse_grid]);
+               }
             }
          }
          HYPRE_ANNOTATE_REGION_END("%s", "Restriction");
@@ -785,6 +923,47 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
 
    hypre_ParAMGDataCycleOpCount(amg_data) = cycle_op_count;
 
+   /* Adaptive cycling: decide on the shape of the following cycles */
+   if (adapt_probe)
+   {
+      adapt_norms_global = hypre_CTAlloc(HYPRE_Real, adapt_stride * num_levels, HYPRE_MEMORY_HOST);
+      hypre_MPI_Allreduce(adapt_norms, adapt_norms_global, adapt_stride * num_levels,
+                          HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+
+      adapt_tol2 = hypre_ParAMGDataAdaptiveCycleTol(amg_data) *
+                   hypre_ParAMGDataAdaptiveCycleTol(amg_data);
+
+      cycle_num_levels = num_levels;
+      for (k = 0; k < num_levels - 1; k++)
+      {
+         HYPRE_Real *norms = adapt_norms_global + adapt_stride * k;
+
+         /* Keep post-smoothing sweeps while each reduces the residual by tol */
+         post_sweeps[k] = 0;
+         adapt_prev     = norms[1];
+         for (j = 0; j < adapt_stride - 2 && norms[2 + j] > 0.0; j++)
+         {
+            if (post_sweeps[k] == j && norms[2 + j] < adapt_tol2 * adapt_prev)
+            {
+               post_sweeps[k]++;
+            }
+            adapt_prev = norms[2 + j];
+         }
+
+         /* Truncate below the first level where the visit of the coarser
+            levels and the post-smoothing reduce the residual by less than tol */
+         if (k > 0 && cycle_num_levels == num_levels &&
+             norms[0] > 0.0 && adapt_prev >= adapt_tol2 * norms[0])
+         {
+            cycle_num_levels = k + 1;
+         }
+      }
+      hypre_ParAMGDataAdaptiveNumLevels(amg_data) = cycle_num_levels;
+
+      hypre_TFree(adapt_norms, HYPRE_MEMORY_HOST);
+      hypre_TFree(adapt_norms_global, HYPRE_MEMORY_HOST);
+   }
+
    hypre_TFree(lev_counter, HYPRE_MEMORY_HOST);
    hypre_TFree(num_coeffs, HYPRE_MEMORY_HOST);
 
@@ -25,6 +25,7 @@ hypre_FSAICreate( void )
    HYPRE_Int            max_nnz_row;
    HYPRE_Int            num_levels;
    HYPRE_Real           kap_tolerance;
+   HYPRE_Int            reuse;
 
    /* solver params */
    HYPRE_Int            eig_max_iters;
@@ -51,6 +52,7 @@ hypre_FSAICreate( void )
    max_nnz_row = max_steps * max_step_size;
    num_levels = 2;
    kap_tolerance = 1.0e-3;
+   reuse = 0;
 
    /* parameters that depend on the execution policy */
 #if defined (HYPRE_USING_CUDA) || defined (HYPRE_USING_HIP)
@@ -98,6 +100,7 @@ hypre_FSAICreate( void )
    hypre_FSAISetMaxNnzRow(fsai_data, max_nnz_row);
    hypre_FSAISetNumLevels(fsai_data, num_levels);
    hypre_FSAISetKapTolerance(fsai_data, kap_tolerance);
+   hypre_FSAISetReuse(fsai_data, reuse);
 
    hypre_FSAISetMaxIterations(fsai_data, max_iterations);
    hypre_FSAISetEigMaxIters(fsai_data, eig_max_iters);
@@ -336,6 +339,23 @@ hypre_FSAISetKapTolerance( void       *data,
    return hypre_error_flag;
 }
 
+HYPRE_Int
+hypre_FSAISetReuse( void      *data,
+                    HYPRE_Int  reuse )
+{
+   hypre_ParFSAIData  *fsai_data = (hypre_ParFSAIData*) data;
+
+   if (!fsai_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_ParFSAIDataReuse(fsai_data) = (reuse != 0);
+
+   return hypre_error_flag;
+}
+
 HYPRE_Int
 hypre_FSAISetMaxIterations( void      *data,
                             HYPRE_Int  max_iterations )
@@ -661,6 +681,23 @@ hypre_FSAIGetKapTolerance( void       *data,
    return hypre_error_flag;
 }
 
+HYPRE_Int
+hypre_FSAIGetReuse( void      *data,
+                    HYPRE_Int *reuse )
+{
+   hypre_ParFSAIData  *fsai_data = (hypre_ParFSAIData*) data;
+
+   if (!fsai_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   *reuse = hypre_ParFSAIDataReuse(fsai_data);
+
+   return hypre_error_flag;
+}
+
 HYPRE_Int
 hypre_FSAIGetMaxIterations( void      *data,
                             HYPRE_Int *max_iterations )
@@ -25,6 +25,7 @@ typedef struct hypre_ParFSAIData_struct
    HYPRE_Int             num_levels;       /* Number of levels for computing the candidate pattern */
    HYPRE_Real            threshold;        /* Filtering threshold for the candidate pattern */
    HYPRE_Real            kap_tolerance;    /* Min. amount of change between two steps */
+   HYPRE_Int             reuse;            /* Reuse the pattern of G in subsequent setups */
 
    /* FSAI Setup data */
    HYPRE_Real            density;          /* Density of matrix G wrt. A */
@@ -62,6 +63,7 @@ typedef struct hypre_ParFSAIData_struct
 #define hypre_ParFSAIDataNumLevels(fsai_data)               ((fsai_data) -> num_levels)
 #define hypre_ParFSAIDataThreshold(fsai_data)               ((fsai_data) -> threshold)
 #define hypre_ParFSAIDataKapTolerance(fsai_data)            ((fsai_data) -> kap_tolerance)
+#define hypre_ParFSAIDataReuse(fsai_data)                   ((fsai_data) -> reuse)
 
 /* FSAI Setup data */
 #define hypre_ParFSAIDataGmat(fsai_data)                    ((fsai_data) -> Gmat)
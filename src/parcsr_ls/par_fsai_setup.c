@@ -913,6 +913,508 @@ hypre_FSAISetupOMPDyn( void               *fsai_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_FSAISetupStaticPowerHost
+ *
+ * Static FSAI on the host. The pattern of row i of G is taken from the
+ * strictly lower triangular part of row i of K = Atilde^{num_levels}, where
+ * Atilde is A_diag without the off-diagonal entries smaller than threshold
+ * times the 2-norm of their row. Only the max_nnz_row largest entries of K
+ * are kept. The values of G are computed by hypre_FSAISetupValuesHost.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_FSAISetupStaticPowerHost( void               *fsai_vdata,
+                                hypre_ParCSRMatrix *A,
+                                hypre_ParVector    *f,
+                                hypre_ParVector    *u )
+{
+   hypre_ParFSAIData      *fsai_data        = (hypre_ParFSAIData*) fsai_vdata;
+   HYPRE_Int               max_nnz_row      = hypre_ParFSAIDataMaxNnzRow(fsai_data);
+   HYPRE_Int               num_levels       = hypre_ParFSAIDataNumLevels(fsai_data);
+   HYPRE_Real              threshold        = hypre_ParFSAIDataThreshold(fsai_data);
+
+   /* CSRMatrix A_diag variables */
+   hypre_CSRMatrix        *A_diag           = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int              *A_i              = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int              *A_j              = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Complex          *A_a              = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int               num_rows_diag_A  = hypre_CSRMatrixNumRows(A_diag);
+
+   /* Matrix G variables */
+   hypre_ParCSRMatrix     *G                = hypre_ParFSAIDataGmat(fsai_data);
+   hypre_CSRMatrix        *G_diag           = hypre_ParCSRMatrixDiag(G);
+   HYPRE_Int              *G_i              = hypre_CSRMatrixI(G_diag);
+   HYPRE_Int              *G_j              = hypre_CSRMatrixJ(G_diag);
+
+   /* Candidate pattern variables */
+   hypre_CSRMatrix        *Atilde;
+   hypre_CSRMatrix        *K;
+   hypre_CSRMatrix        *B;
+   HYPRE_Int              *At_i;
+   HYPRE_Int              *At_j;
+   HYPRE_Complex          *At_a;
+   HYPRE_Int              *K_i;
+   HYPRE_Int              *K_j;
+   HYPRE_Complex          *K_a;
+   HYPRE_Int              *G_nnzcnt;
+
+   HYPRE_Int               i, j, k, cnt;
+   HYPRE_Real              row_nrm;
+
+   /*-----------------------------------------------------
+    *  Compute filtered version of A_diag
+    *-----------------------------------------------------*/
+
+   HYPRE_ANNOTATE_REGION_BEGIN("%s", "CandPat");
+   Atilde = hypre_CSRMatrixClone_v2(A_diag, 1, HYPRE_MEMORY_HOST);
+   At_i   = hypre_CSRMatrixI(Atilde);
+   At_j   = hypre_CSRMatrixJ(Atilde);
+   At_a   = hypre_CSRMatrixData(Atilde);
+
+   /* Pre-filter to reduce SpGEMM cost */
+   if (num_levels > 1 && threshold > 0.0)
+   {
+      cnt = 0;
+      for (i = 0; i < num_rows_diag_A; i++)
+      {
+         row_nrm = 0.0;
+         for (j = A_i[i]; j < A_i[i + 1]; j++)
+         {
+            row_nrm += hypre_squared(hypre_cabs(A_a[j]));
+         }
+         row_nrm = hypre_sqrt(row_nrm);
+
+         k = A_i[i];
+         At_i[i] = cnt;
+         for (j = k; j < A_i[i + 1]; j++)
+         {
+            if (A_j[j] == i || hypre_cabs(A_a[j]) >= threshold * row_nrm)
+            {
+               At_j[cnt]   = A_j[j];
+               At_a[cnt++] = A_a[j];
+            }
+         }
+      }
+      At_i[num_rows_diag_A] = cnt;
+      hypre_CSRMatrixNumNonzeros(Atilde) = cnt;
+   }
+
+   /*-----------------------------------------------------
+    *  Compute power pattern
+    *-----------------------------------------------------*/
+
+   K = Atilde;
+   for (i = 1; i < num_levels; i++)
+   {
+      B = hypre_CSRMatrixMultiplyHost(Atilde, K);
+      if (K != Atilde)
+      {
+         hypre_CSRMatrixDestroy(K);
+      }
+      K = B;
+   }
+   HYPRE_ANNOTATE_REGION_END("%s", "CandPat");
+
+   /*-----------------------------------------------------
+    *  Truncate candidate pattern and build the pattern of G
+    *-----------------------------------------------------*/
+
+   HYPRE_ANNOTATE_REGION_BEGIN("%s", "FilterPat");
+   K_i = hypre_CSRMatrixI(K);
+   K_j = hypre_CSRMatrixJ(K);
+   K_a = hypre_CSRMatrixData(K);
+   G_nnzcnt = hypre_CTAlloc(HYPRE_Int, num_rows_diag_A + 1, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel
+#endif
+   {
+      HYPRE_Complex  *cand_val;
+      HYPRE_Int      *cand_col;
+      HYPRE_Int       max_cand_size;
+      HYPRE_Int       ns, ne, ii, jj, kk, patt_size, cand_size;
+
+      hypre_partition1D(num_rows_diag_A, hypre_NumActiveThreads(), hypre_GetThreadNum(),
+                        &ns, &ne);
+
+      max_cand_size = 0;
+      for (ii = ns; ii < ne; ii++)
+      {
+         max_cand_size = hypre_max(max_cand_size, K_i[ii + 1] - K_i[ii]);
+      }
+      cand_val = hypre_TAlloc(HYPRE_Complex, max_cand_size, HYPRE_MEMORY_HOST);
+      cand_col = hypre_TAlloc(HYPRE_Int, max_cand_size, HYPRE_MEMORY_HOST);
+
+      for (ii = ns; ii < ne; ii++)
+      {
+         /* Gather candidates from the strictly lower triangular part */
+         cand_size = 0;
+         for (jj = K_i[ii]; jj < K_i[ii + 1]; jj++)
+         {
+            if (K_j[jj] < ii)
+            {
+               cand_val[cand_size]   = hypre_cabs(K_a[jj]);
+               cand_col[cand_size++] = K_j[jj];
+            }
+         }
+
+         /* Keep the max_nnz_row largest ones, in ascending column order */
+         patt_size = hypre_min(cand_size, max_nnz_row);
+         hypre_PartialSelectSortCI(cand_val, cand_col, cand_size, patt_size);
+         hypre_qsort0(cand_col, 0, patt_size - 1);
+
+         /* G is allocated with max_nnz_row + 1 entries per row */
+         jj = ii * (max_nnz_row + 1);
+         G_j[jj] = ii;
+         for (kk = 0; kk < patt_size; kk++)
+         {
+            G_j[jj + kk + 1] = cand_col[kk];
+         }
+         G_nnzcnt[ii + 1] = patt_size + 1;
+      }
+
+      hypre_TFree(cand_val, HYPRE_MEMORY_HOST);
+      hypre_TFree(cand_col, HYPRE_MEMORY_HOST);
+   }
+
+   /* Compress the pattern of G */
+   G_i[0] = 0;
+   for (i = 0; i < num_rows_diag_A; i++)
+   {
+      G_i[i + 1] = G_i[i] + G_nnzcnt[i + 1];
+      for (j = 0; j < G_nnzcnt[i + 1]; j++)
+      {
+         G_j[G_i[i] + j] = G_j[i * (max_nnz_row + 1) + j];
+      }
+   }
+   hypre_CSRMatrixNumNonzeros(G_diag) = G_i[num_rows_diag_A];
+   HYPRE_ANNOTATE_REGION_END("%s", "FilterPat");
+
+   /* Free memory */
+   if (K != Atilde)
+   {
+      hypre_CSRMatrixDestroy(K);
+   }
+   hypre_CSRMatrixDestroy(Atilde);
+   hypre_TFree(G_nnzcnt, HYPRE_MEMORY_HOST);
+
+   /* Compute the values of G */
+   hypre_FSAISetupValuesHost(fsai_vdata, A);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_FSAISetupValuesHost
+ *
+ * Computes the values of G for the sparsity pattern already stored in G,
+ * with the diagonal entry first in each row. For each row i with pattern P,
+ * solves the dense SPD system A[P, P] g = -A[P, i] and sets
+ * G[i, [i P]] = [1 g] / sqrt(a_ii + A[i, P] g).
+ *
+ * Rows are grouped by pattern size and the dense systems of up to
+ * HYPRE_FSAI_BATCH_SIZE rows of the same size are factored and solved
+ * together, with the entries of the batch interleaved so that the innermost
+ * loops of the Cholesky factorization and the triangular solves run over the
+ * batch and can be vectorized.
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_FSAI_BATCH_SIZE 8
+
+HYPRE_Int
+hypre_FSAISetupValuesHost( void               *fsai_vdata,
+                           hypre_ParCSRMatrix *A )
+{
+   hypre_ParFSAIData      *fsai_data        = (hypre_ParFSAIData*) fsai_vdata;
+
+   /* CSRMatrix A_diag variables */
+   hypre_CSRMatrix        *A_diag           = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int              *A_i              = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int              *A_j              = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Complex          *A_a              = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int               num_rows_diag_A  = hypre_CSRMatrixNumRows(A_diag);
+
+   /* Matrix G variables */
+   hypre_ParCSRMatrix     *G                = hypre_ParFSAIDataGmat(fsai_data);
+   hypre_CSRMatrix        *G_diag           = hypre_ParCSRMatrixDiag(G);
+   HYPRE_Int              *G_i              = hypre_CSRMatrixI(G_diag);
+   HYPRE_Int              *G_j              = hypre_CSRMatrixJ(G_diag);
+   HYPRE_Complex          *G_a              = hypre_CSRMatrixData(G_diag);
+
+   /* Batching variables */
+   HYPRE_Int              *size_starts;     /* Rows of G sorted by pattern size */
+   HYPRE_Int              *rows;
+   HYPRE_Int              *batch_starts;    /* First entry of each batch in rows */
+   HYPRE_Int               num_batches;
+   HYPRE_Int               max_size;
+   HYPRE_Int               i, m, b, nb;
+
+   /* Bucket the rows of G by pattern size */
+   max_size = 0;
+   for (i = 0; i < num_rows_diag_A; i++)
+   {
+      max_size = hypre_max(max_size, G_i[i + 1] - G_i[i] - 1);
+   }
+
+   size_starts = hypre_CTAlloc(HYPRE_Int, max_size + 2, HYPRE_MEMORY_HOST);
+   rows        = hypre_TAlloc(HYPRE_Int, num_rows_diag_A, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_rows_diag_A; i++)
+   {
+      size_starts[G_i[i + 1] - G_i[i]]++;
+   }
+   for (m = 0; m <= max_size; m++)
+   {
+      size_starts[m + 1] += size_starts[m];
+   }
+   for (i = 0; i < num_rows_diag_A; i++)
+   {
+      rows[size_starts[G_i[i + 1] - G_i[i] - 1]++] = i;
+   }
+   for (m = max_size; m > 0; m--)
+   {
+      size_starts[m] = size_starts[m - 1];
+   }
+   size_starts[0] = 0;
+
+   /* Split each bucket into batches */
+   num_batches = 0;
+   for (m = 0; m <= max_size; m++)
+   {
+      nb = size_starts[m + 1] - size_starts[m];
+      num_batches += (nb + HYPRE_FSAI_BATCH_SIZE - 1) / HYPRE_FSAI_BATCH_SIZE;
+   }
+   batch_starts = hypre_TAlloc(HYPRE_Int, num_batches + 1, HYPRE_MEMORY_HOST);
+   nb = 0;
+   for (m = 0; m <= max_size; m++)
+   {
+      for (b = size_starts[m]; b < size_starts[m + 1]; b += HYPRE_FSAI_BATCH_SIZE)
+      {
+         batch_starts[nb++] = b;
+      }
+   }
+   batch_starts[num_batches] = num_rows_diag_A;
+
+   HYPRE_ANNOTATE_REGION_BEGIN("%s", "BatchedSolve");
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel private(i, m, b)
+#endif
+   {
+      const HYPRE_Int  bs = HYPRE_FSAI_BATCH_SIZE;
+      HYPRE_Int       *marker;
+      HYPRE_Complex   *mat;         /* Interleaved lower triangles of A[P, P] */
+      HYPRE_Complex   *sol;         /* Interleaved right-hand sides/solutions */
+      HYPRE_Complex   *subrow;      /* Interleaved A[i, P] */
+      HYPRE_Complex    psi[HYPRE_FSAI_BATCH_SIZE];
+      HYPRE_Complex    diag[HYPRE_FSAI_BATCH_SIZE];
+      HYPRE_Int        fail[HYPRE_FSAI_BATCH_SIZE];
+      HYPRE_Complex    row_scale;
+      HYPRE_Int        ib, first, len, ii, jj, k, c, p, cc;
+      char             msg[512];
+
+      marker = hypre_TAlloc(HYPRE_Int, num_rows_diag_A, HYPRE_MEMORY_HOST);
+      mat    = hypre_TAlloc(HYPRE_Complex, max_size * max_size * bs, HYPRE_MEMORY_HOST);
+      sol    = hypre_TAlloc(HYPRE_Complex, max_size * bs, HYPRE_MEMORY_HOST);
+      subrow = hypre_TAlloc(HYPRE_Complex, max_size * bs, HYPRE_MEMORY_HOST);
+      hypre_Memset(marker, -1, num_rows_diag_A * sizeof(HYPRE_Int), HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp for schedule(dynamic)
+#endif
+      for (ib = 0; ib < num_batches; ib++)
+      {
+         first = batch_starts[ib];
+         len   = hypre_min(bs, batch_starts[ib + 1] - first);
+         m     = G_i[rows[first] + 1] - G_i[rows[first]] - 1;
+
+         /* Gather the dense systems of the batch. Unused slots hold the identity */
+         for (k = 0; k < m * m * bs; k++)
+         {
+            mat[k] = 0.0;
+         }
+         for (k = 0; k < m * bs; k++)
+         {
+            sol[k] = subrow[k] = 0.0;
+         }
+         for (b = 0; b < bs; b++)
+         {
+            fail[b] = 0;
+            diag[b] = 1.0;
+         }
+         for (b = len; b < bs; b++)
+         {
+            for (k = 0; k < m; k++)
+            {
+               mat[(k * m + k) * bs + b] = 1.0;
+            }
+         }
+
+         for (b = 0; b < len; b++)
+         {
+            i  = rows[first + b];
+            ii = G_i[i] + 1;
+            for (k = 0; k < m; k++)
+            {
+               marker[G_j[ii + k]] = k;
+            }
+
+            /* Lower triangular part of A[P, P] */
+            for (k = 0; k < m; k++)
+            {
+               p = G_j[ii + k];
+               for (jj = A_i[p]; jj < A_i[p + 1]; jj++)
+               {
+                  if ((cc = marker[A_j[jj]]) >= 0 && cc <= k)
+                  {
+                     mat[(k * m + cc) * bs + b] = A_a[jj];
+                  }
+               }
+            }
+
+            /* A[i, P] and -A[i, P] */
+            diag[b] = A_a[A_i[i]];
+            for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+            {
+               if ((cc = marker[A_j[jj]]) >= 0)
+               {
+                  subrow[cc * bs + b] =  A_a[jj];
+                  sol[cc * bs + b]    = -A_a[jj];
+               }
+            }
+
+            for (k = 0; k < m; k++)
+            {
+               marker[G_j[ii + k]] = -1;
+            }
+         }
+
+         /* Left-looking Cholesky factorization of the batch */
+         for (k = 0; k < m; k++)
+         {
+            for (c = 0; c <= k; c++)
+            {
+               for (p = 0; p < c; p++)
+               {
+                  for (b = 0; b < bs; b++)
+                  {
+                     mat[(k * m + c) * bs + b] -= mat[(k * m + p) * bs + b] *
+                                                  mat[(c * m + p) * bs + b];
+                  }
+               }
+
+               if (c < k)
+               {
+                  for (b = 0; b < bs; b++)
+                  {
+                     mat[(k * m + c) * bs + b] /= mat[(c * m + c) * bs + b];
+                  }
+               }
+               else
+               {
+                  for (b = 0; b < bs; b++)
+                  {
+                     if (hypre_creal(mat[(k * m + k) * bs + b]) > 0.0)
+                     {
+                        mat[(k * m + k) * bs + b] = hypre_csqrt(mat[(k * m + k) * bs + b]);
+                     }
+                     else
+                     {
+                        fail[b] = 1;
+                        mat[(k * m + k) * bs + b] = 1.0;
+                     }
+                  }
+               }
+            }
+         }
+
+         /* Forward solve with L */
+         for (k = 0; k < m; k++)
+         {
+            for (p = 0; p < k; p++)
+            {
+               for (b = 0; b < bs; b++)
+               {
+                  sol[k * bs + b] -= mat[(k * m + p) * bs + b] * sol[p * bs + b];
+               }
+            }
+            for (b = 0; b < bs; b++)
+            {
+               sol[k * bs + b] /= mat[(k * m + k) * bs + b];
+            }
+         }
+
+         /* Backward solve with L^T */
+         for (k = m - 1; k >= 0; k--)
+         {
+            for (p = k + 1; p < m; p++)
+            {
+               for (b = 0; b < bs; b++)
+               {
+                  sol[k * bs + b] -= mat[(p * m + k) * bs + b] * sol[p * bs + b];
+               }
+            }
+            for (b = 0; b < bs; b++)
+            {
+               sol[k * bs + b] /= mat[(k * m + k) * bs + b];
+            }
+         }
+
+         /* psi = a_ii + A[i, P] * g */
+         for (b = 0; b < bs; b++)
+         {
+            psi[b] = diag[b];
+         }
+         for (k = 0; k < m; k++)
+         {
+            for (b = 0; b < bs; b++)
+            {
+               psi[b] += subrow[k * bs + b] * sol[k * bs + b];
+            }
+         }
+
+         /* Scatter the scaled solutions into G */
+         for (b = 0; b < len; b++)
+         {
+            i  = rows[first + b];
+            ii = G_i[i];
+            if (!fail[b] && hypre_creal(psi[b]) > 0 && hypre_cimag(psi[b]) == 0)
+            {
+               row_scale = 1.0 / hypre_csqrt(psi[b]);
+               G_a[ii] = row_scale;
+               for (k = 0; k < m; k++)
+               {
+                  G_a[ii + k + 1] = row_scale * sol[k * bs + b];
+               }
+            }
+            else
+            {
+               hypre_sprintf(msg, "Warning: complex scaling factor found in row %d\n", i);
+               hypre_error_w_msg(HYPRE_ERROR_GENERIC, msg);
+
+               G_a[ii] = 1.0 / hypre_cabs(diag[b]);
+               for (k = 0; k < m; k++)
+               {
+                  G_a[ii + k + 1] = 0.0;
+               }
+            }
+         }
+      }
+
+      hypre_TFree(marker, HYPRE_MEMORY_HOST);
+      hypre_TFree(mat, HYPRE_MEMORY_HOST);
+      hypre_TFree(sol, HYPRE_MEMORY_HOST);
+      hypre_TFree(subrow, HYPRE_MEMORY_HOST);
+   } /* end openmp region */
+   HYPRE_ANNOTATE_REGION_END("%s", "BatchedSolve");
+
+   /* Free memory */
+   hypre_TFree(size_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(rows, HYPRE_MEMORY_HOST);
+   hypre_TFree(batch_starts, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_FSAISetup
  *--------------------------------------------------------------------------*/
@@ -930,6 +1432,7 @@ hypre_FSAISetup( void               *fsai_vdata,
    HYPRE_Int                algo_type     = hypre_ParFSAIDataAlgoType(fsai_data);
    HYPRE_Int                print_level   = hypre_ParFSAIDataPrintLevel(fsai_data);
    HYPRE_Int                eig_max_iters = hypre_ParFSAIDataEigMaxIters(fsai_data);
+   HYPRE_Int                reuse         = hypre_ParFSAIDataReuse(fsai_data);
 
    /* ParCSRMatrix A variables */
    MPI_Comm                 comm          = hypre_ParCSRMatrixComm(A);
@@ -947,9 +1450,10 @@ hypre_FSAISetup( void               *fsai_vdata,
    hypre_ParVector         *z_work;
 
    /* G variables */
-   hypre_ParCSRMatrix      *G;
+   hypre_ParCSRMatrix      *G             = hypre_ParFSAIDataGmat(fsai_data);
    HYPRE_Int                max_nnzrow_diag_G;   /* Max. number of nonzeros per row in G_diag */
    HYPRE_Int                max_nonzeros_diag_G; /* Max. number of nonzeros in G_diag */
+   HYPRE_Int                reuse_pattern;
 
    /* Sanity check */
    if (f && hypre_ParVectorNumVectors(f) > 1)
@@ -960,61 +1464,86 @@ hypre_FSAISetup( void               *fsai_vdata,
 
    HYPRE_ANNOTATE_FUNC_BEGIN;
 
-   /* Create and initialize work vectors used in the solve phase */
-   r_work = hypre_ParVectorCreate(comm, num_rows_A, row_starts_A);
-   z_work = hypre_ParVectorCreate(comm, num_rows_A, row_starts_A);
+   /* Check if the pattern of G from a previous setup can be reused */
+   reuse_pattern = reuse && G &&
+                   hypre_ParCSRMatrixGlobalNumRows(G) == num_rows_A &&
+                   hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(G)) == num_rows_diag_A &&
+                   hypre_GetExecPolicy1(hypre_ParCSRMatrixMemoryLocation(A)) == HYPRE_EXEC_HOST;
 
-   hypre_ParVectorInitialize(r_work);
-   hypre_ParVectorInitialize(z_work);
-
-   hypre_ParFSAIDataRWork(fsai_data) = r_work;
-   hypre_ParFSAIDataZWork(fsai_data) = z_work;
-
-   /* Create the matrix G */
-   if (algo_type == 1 || algo_type == 2)
+   if (reuse_pattern)
    {
-      max_nnzrow_diag_G = max_steps * max_step_size + 1;
+      /* Recompute only the values of G */
+      hypre_ParCSRMatrixDestroy(hypre_ParFSAIDataGTmat(fsai_data));
+      hypre_FSAISetupValuesHost(fsai_vdata, A);
    }
    else
    {
-      max_nnzrow_diag_G = max_nnz_row + 1;
-   }
-   max_nonzeros_diag_G = num_rows_diag_A * max_nnzrow_diag_G;
-   G = hypre_ParCSRMatrixCreate(comm, num_rows_A, num_cols_A,
-                                row_starts_A, col_starts_A,
-                                0, max_nonzeros_diag_G, 0);
-   hypre_ParFSAIDataGmat(fsai_data) = G;
+      /* Free data from a previous setup */
+      hypre_ParCSRMatrixDestroy(G);
+      hypre_ParCSRMatrixDestroy(hypre_ParFSAIDataGTmat(fsai_data));
+      hypre_ParVectorDestroy(hypre_ParFSAIDataRWork(fsai_data));
+      hypre_ParVectorDestroy(hypre_ParFSAIDataZWork(fsai_data));
+
+      /* Create and initialize work vectors used in the solve phase */
+      r_work = hypre_ParVectorCreate(comm, num_rows_A, row_starts_A);
+      z_work = hypre_ParVectorCreate(comm, num_rows_A, row_starts_A);
+
+      hypre_ParVectorInitialize(r_work);
+      hypre_ParVectorInitialize(z_work);
+
+      hypre_ParFSAIDataRWork(fsai_data) = r_work;
+      hypre_ParFSAIDataZWork(fsai_data) = z_work;
+
+      /* Create the matrix G */
+      if (algo_type == 1 || algo_type == 2)
+      {
+         max_nnzrow_diag_G = max_steps * max_step_size + 1;
+      }
+      else
+      {
+         max_nnzrow_diag_G = max_nnz_row + 1;
+      }
+      max_nonzeros_diag_G = num_rows_diag_A * max_nnzrow_diag_G;
+      G = hypre_ParCSRMatrixCreate(comm, num_rows_A, num_cols_A,
+                                   row_starts_A, col_starts_A,
+                                   0, max_nonzeros_diag_G, 0);
+      hypre_ParFSAIDataGmat(fsai_data) = G;
 
-   /* Initialize and compute lower triangular factor G */
+      /* Initialize and compute lower triangular factor G */
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
-   HYPRE_MemoryLocation  memloc_A = hypre_ParCSRMatrixMemoryLocation(A);
-   HYPRE_ExecutionPolicy exec = hypre_GetExecPolicy1(memloc_A);
+      HYPRE_MemoryLocation  memloc_A = hypre_ParCSRMatrixMemoryLocation(A);
+      HYPRE_ExecutionPolicy exec = hypre_GetExecPolicy1(memloc_A);
 
-   if (exec == HYPRE_EXEC_DEVICE)
-   {
-      hypre_FSAISetupDevice(fsai_vdata, A, f, u);
-   }
-   else
+      if (exec == HYPRE_EXEC_DEVICE)
+      {
+         hypre_FSAISetupDevice(fsai_vdata, A, f, u);
+      }
+      else
 #endif
-   {
-      /* Initialize matrix */
-      hypre_ParCSRMatrixInitialize(G);
-
-      switch (algo_type)
       {
-         case 1:
-            // TODO: Change name to hypre_FSAISetupAdaptive
-            hypre_FSAISetupNative(fsai_vdata, A, f, u);
-            break;
-
-         case 2:
-            // TODO: Change name to hypre_FSAISetupAdaptiveOMPDynamic
-            hypre_FSAISetupOMPDyn(fsai_vdata, A, f, u);
-            break;
-
-         default:
-            hypre_FSAISetupNative(fsai_vdata, A, f, u);
-            break;
+         /* Initialize matrix */
+         hypre_ParCSRMatrixInitialize(G);
+
+         switch (algo_type)
+         {
+            case 1:
+               // TODO: Change name to hypre_FSAISetupAdaptive
+               hypre_FSAISetupNative(fsai_vdata, A, f, u);
+               break;
+
+            case 2:
+               // TODO: Change name to hypre_FSAISetupAdaptiveOMPDynamic
+               hypre_FSAISetupOMPDyn(fsai_vdata, A, f, u);
+               break;
+
+            case 3:
+               hypre_FSAISetupStaticPowerHost(fsai_vdata, A, f, u);
+               break;
+
+            default:
+               hypre_FSAISetupNative(fsai_vdata, A, f, u);
+               break;
+         }
       }
    }
 
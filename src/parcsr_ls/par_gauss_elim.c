@@ -27,6 +27,11 @@
  *   - 19: hypre's internal Gaussian elimination on the host.
  *   - 98: LU factorization with pivoting.
  *   - 198: explicit (dense) inverse A_inv = U^{-1}*L^{-1}.
+ *
+ * Solver option for which the matrix is agglomerated on a single rank of the
+ * sub-communicator, see hypre_GaussElimBandedSetup:
+ *
+ *   - 97: banded LU factorization with pivoting after RCM reordering.
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int
@@ -86,6 +91,12 @@ hypre_GaussElimSetup(hypre_ParAMGData *amg_data,
       return hypre_error_flag;
    }
 
+   /* Agglomerated banded LU */
+   if (solver_type == 97)
+   {
+      return hypre_GaussElimBandedSetup(amg_data, level);
+   }
+
    /*-----------------------------------------------------------------
     *  Determine mem. location of the GE lin. system and allocate data
     *-----------------------------------------------------------------*/
@@ -458,6 +469,55 @@ hypre_GaussElimSolve(hypre_ParAMGData *amg_data,
    HYPRE_Int            *displs, *info;
    HYPRE_Int             new_num_procs;
 
+   /*-----------------------------------------------------------------
+    *  Multivectors: solve for each vector using single-vector views
+    *-----------------------------------------------------------------*/
+
+   if (hypre_ParVectorNumVectors(f) > 1)
+   {
+      hypre_Vector    *f_local = hypre_ParVectorLocalVector(f);
+      hypre_Vector    *u_local = hypre_ParVectorLocalVector(u);
+      hypre_Vector     f_k_local, u_k_local;
+      hypre_ParVector  f_k, u_k;
+      HYPRE_Int        k;
+
+      if (hypre_VectorIndexStride(f_local) != 1 || hypre_VectorIndexStride(u_local) != 1)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Unsupported multivector storage!");
+         return hypre_error_flag;
+      }
+
+      f_k = *f;  f_k_local = *f_local;
+      u_k = *u;  u_k_local = *u_local;
+      hypre_VectorNumVectors(&f_k_local) = 1;
+      hypre_VectorNumVectors(&u_k_local) = 1;
+      hypre_VectorOwnsData(&f_k_local)   = 0;
+      hypre_VectorOwnsData(&u_k_local)   = 0;
+      hypre_ParVectorLocalVector(&f_k)   = &f_k_local;
+      hypre_ParVectorLocalVector(&u_k)   = &u_k_local;
+
+      for (k = 0; k < hypre_ParVectorNumVectors(f); k++)
+      {
+         hypre_VectorData(&f_k_local) = f_data + k * hypre_VectorVectorStride(f_local);
+         hypre_VectorData(&u_k_local) = u_data + k * hypre_VectorVectorStride(u_local);
+
+         hypre_ParAMGDataFArray(amg_data)[level] = &f_k;
+         hypre_ParAMGDataUArray(amg_data)[level] = &u_k;
+         hypre_GaussElimSolve(amg_data, level, solver_type);
+      }
+
+      hypre_ParAMGDataFArray(amg_data)[level] = f;
+      hypre_ParAMGDataUArray(amg_data)[level] = u;
+
+      return hypre_error_flag;
+   }
+
+   /* Agglomerated banded LU */
+   if (solver_type == 97)
+   {
+      return hypre_GaussElimBandedSolve(amg_data, level);
+   }
+
 #ifdef HYPRE_PROFILE
    hypre_profile_times[HYPRE_TIMER_ID_GS_ELIM_SOLVE] -= hypre_MPI_Wtime();
 #endif
@@ -649,3 +709,535 @@ hypre_GaussElimSolve(hypre_ParAMGData *amg_data,
 
    return hypre_error_flag;
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_GaussElimBandFactor
+ *
+ * LU factorization with partial pivoting of the n x n band matrix with kl
+ * sub-diagonals and ku super-diagonals stored in ab. The storage follows
+ * LAPACK's dgbtrf: column j of the matrix is stored in column j of ab, which
+ * has leading dimension ldab = 2*kl + ku + 1, and A(i,j) is found at
+ * ab[kl + ku + i - j + j * ldab]. The first kl rows of ab must be zero on
+ * input; they receive the fill-in of U due to row interchanges.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GaussElimBandFactor(HYPRE_Int   n,
+                          HYPRE_Int   kl,
+                          HYPRE_Int   ku,
+                          HYPRE_Real *ab,
+                          HYPRE_Int  *piv)
+{
+   HYPRE_Int    ldab = 2 * kl + ku + 1;
+   HYPRE_Int    kv   = kl + ku;
+   HYPRE_Int    i, j, k, jp, km, ju;
+   HYPRE_Real  *col, *ck;
+   HYPRE_Real   amax, pivot, temp;
+
+   ju = 0;
+   for (j = 0; j < n; j++)
+   {
+      col = &ab[kv + j * ldab];
+      km  = hypre_min(kl, n - 1 - j);
+
+      /* Find pivot among the rows j, ..., j + km */
+      jp   = 0;
+      amax = hypre_abs(col[0]);
+      for (i = 1; i <= km; i++)
+      {
+         if (hypre_abs(col[i]) > amax)
+         {
+            jp   = i;
+            amax = hypre_abs(col[i]);
+         }
+      }
+      piv[j] = j + jp;
+
+      if (amax == 0.0)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Singular matrix in banded LU!");
+         return hypre_error_flag;
+      }
+
+      /* Swap rows j and j + jp in the columns reached by U */
+      ju = hypre_max(ju, hypre_min(j + ku + jp, n - 1));
+      if (jp != 0)
+      {
+         for (k = j; k <= ju; k++)
+         {
+            ck            = &ab[kv + j - k + k * ldab];
+            temp          = ck[0];
+            ck[0]         = ck[jp];
+            ck[jp]        = temp;
+         }
+      }
+
+      /* Compute the multipliers and update the trailing band */
+      if (km > 0)
+      {
+         pivot = 1.0 / col[0];
+         for (i = 1; i <= km; i++)
+         {
+            col[i] *= pivot;
+         }
+
+         for (k = j + 1; k <= ju; k++)
+         {
+            ck   = &ab[kv + j - k + k * ldab];
+            temp = ck[0];
+            if (temp != 0.0)
+            {
+               for (i = 1; i <= km; i++)
+               {
+                  ck[i] -= col[i] * temp;
+               }
+            }
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_GaussElimBandSolve
+ *
+ * Solves A x = b in place with the factors computed by
+ * hypre_GaussElimBandFactor.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GaussElimBandSolve(HYPRE_Int   n,
+                         HYPRE_Int   kl,
+                         HYPRE_Int   ku,
+                         HYPRE_Real *ab,
+                         HYPRE_Int  *piv,
+                         HYPRE_Real *b)
+{
+   HYPRE_Int    ldab = 2 * kl + ku + 1;
+   HYPRE_Int    kv   = kl + ku;
+   HYPRE_Int    i, j, km;
+   HYPRE_Real  *col;
+   HYPRE_Real   temp;
+
+   /* Forward solve with L, applying the row interchanges */
+   for (j = 0; j < n; j++)
+   {
+      col = &ab[kv + j * ldab];
+      km  = hypre_min(kl, n - 1 - j);
+
+      if (piv[j] != j)
+      {
+         temp      = b[j];
+         b[j]      = b[piv[j]];
+         b[piv[j]] = temp;
+      }
+
+      temp = b[j];
+      for (i = 1; i <= km; i++)
+      {
+         b[j + i] -= col[i] * temp;
+      }
+   }
+
+   /* Backward solve with U, which has kl + ku super-diagonals */
+   for (j = n - 1; j >= 0; j--)
+   {
+      col   = &ab[kv + j * ldab];
+      b[j] /= col[0];
+      temp  = b[j];
+      for (i = hypre_max(0, j - kv); i < j; i++)
+      {
+         b[i] -= col[i - j] * temp;
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_GaussElimBandedSetup
+ *
+ * Setup of the agglomerated banded LU coarse solver (solver type 97).
+ *
+ * Instead of replicating the dense coarse matrix on every active rank, the
+ * rows of A are gathered in sparse form on the first rank of the
+ * sub-communicator of active ranks. That rank reorders the matrix with RCM,
+ * factors the resulting band matrix once and keeps the factors, the
+ * ordering and the counts/displacements needed to gather the right-hand side
+ * and scatter the solution. The remaining ranks store nothing but the
+ * sub-communicator, so memory no longer grows as global_num_rows^2 per rank.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GaussElimBandedSetup(hypre_ParAMGData *amg_data,
+                           HYPRE_Int         level)
+{
+   hypre_ParCSRMatrix   *A               = hypre_ParAMGDataAArray(amg_data)[level];
+   MPI_Comm              comm            = hypre_ParCSRMatrixComm(A);
+   HYPRE_Int             num_rows        = hypre_ParCSRMatrixNumRows(A);
+   HYPRE_Int             global_num_rows = (HYPRE_Int) hypre_ParCSRMatrixGlobalNumRows(A);
+   HYPRE_BigInt          first_row_index = hypre_ParCSRMatrixFirstRowIndex(A);
+   HYPRE_BigInt         *col_map_offd    = hypre_ParCSRMatrixColMapOffd(A);
+   hypre_CSRMatrix      *A_diag          = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix      *A_offd          = hypre_ParCSRMatrixOffd(A);
+   HYPRE_MemoryLocation  memory_location = hypre_ParCSRMatrixMemoryLocation(A);
+
+   /* Local matrices */
+   hypre_CSRMatrix      *A_diag_host;
+   hypre_CSRMatrix      *A_offd_host;
+   hypre_CSRMatrix      *A_CSR           = NULL;
+   HYPRE_Int            *A_CSR_i         = NULL;
+   HYPRE_Int            *A_CSR_j         = NULL;
+   HYPRE_Complex        *A_CSR_data      = NULL;
+   HYPRE_Int            *A_diag_i;
+   HYPRE_Int            *A_offd_i;
+   HYPRE_Int            *A_diag_j;
+   HYPRE_Int            *A_offd_j;
+   HYPRE_Complex        *A_diag_data;
+   HYPRE_Complex        *A_offd_data;
+
+   /* Local rows with global column indices */
+   HYPRE_Int             local_nnz;
+   HYPRE_Int            *local_len;
+   HYPRE_Int            *local_j;
+   HYPRE_Complex        *local_data;
+
+   /* Communication info (significant on the root only) */
+   MPI_Comm              new_comm;
+   HYPRE_Int             new_num_procs, my_id;
+   HYPRE_Int            *comm_info       = NULL;
+   HYPRE_Int            *info            = NULL;
+   HYPRE_Int            *displs          = NULL;
+   HYPRE_Int            *nnz_info        = NULL;
+   HYPRE_Int            *nnz_displs      = NULL;
+
+   /* Band factorization */
+   HYPRE_Int            *perm            = NULL;
+   HYPRE_Int            *rperm;
+   HYPRE_Real           *A_band;
+   HYPRE_Int            *A_piv;
+   HYPRE_Int             kl, ku, kv, ldab;
+   HYPRE_Int             i, jj, k, row, col;
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_GS_ELIM_SETUP] -= hypre_MPI_Wtime();
+#endif
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   hypre_ParAMGDataGEMemoryLocation(amg_data) = HYPRE_MEMORY_HOST;
+
+   /* Generate sub communicator - processes that have nonzero num_rows */
+   hypre_GenerateSubComm(comm, num_rows, &new_comm);
+   hypre_ParAMGDataNewComm(amg_data) = new_comm;
+
+   /* Skip setup if this rank has no rows. */
+   if (!num_rows)
+   {
+      hypre_ParAMGDataGSSetup(amg_data) = 1;
+      HYPRE_ANNOTATE_FUNC_END;
+#ifdef HYPRE_PROFILE
+      hypre_profile_times[HYPRE_TIMER_ID_GS_ELIM_SETUP] += hypre_MPI_Wtime();
+#endif
+      return hypre_error_flag;
+   }
+
+   hypre_MPI_Comm_size(new_comm, &new_num_procs);
+   hypre_MPI_Comm_rank(new_comm, &my_id);
+
+   /*-----------------------------------------------------------------
+    *  Pack the local rows with global column indices
+    *-----------------------------------------------------------------*/
+
+   A_diag_host = (hypre_GetActualMemLocation(memory_location) == hypre_MEMORY_DEVICE) ?
+                 hypre_CSRMatrixClone_v2(A_diag, 1, HYPRE_MEMORY_HOST) : A_diag;
+   A_offd_host = (hypre_GetActualMemLocation(memory_location) == hypre_MEMORY_DEVICE) ?
+                 hypre_CSRMatrixClone_v2(A_offd, 1, HYPRE_MEMORY_HOST) : A_offd;
+   A_diag_i    = hypre_CSRMatrixI(A_diag_host);
+   A_offd_i    = hypre_CSRMatrixI(A_offd_host);
+   A_diag_j    = hypre_CSRMatrixJ(A_diag_host);
+   A_offd_j    = hypre_CSRMatrixJ(A_offd_host);
+   A_diag_data = hypre_CSRMatrixData(A_diag_host);
+   A_offd_data = hypre_CSRMatrixData(A_offd_host);
+
+   local_nnz  = A_diag_i[num_rows] + A_offd_i[num_rows];
+   local_len  = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   local_j    = hypre_TAlloc(HYPRE_Int, local_nnz, HYPRE_MEMORY_HOST);
+   local_data = hypre_TAlloc(HYPRE_Complex, local_nnz, HYPRE_MEMORY_HOST);
+
+   for (i = 0, k = 0; i < num_rows; i++)
+   {
+      for (jj = A_diag_i[i]; jj < A_diag_i[i + 1]; jj++, k++)
+      {
+         local_j[k]    = A_diag_j[jj] + (HYPRE_Int) first_row_index;
+         local_data[k] = A_diag_data[jj];
+      }
+      for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++, k++)
+      {
+         local_j[k]    = (HYPRE_Int) col_map_offd[A_offd_j[jj]];
+         local_data[k] = A_offd_data[jj];
+      }
+      local_len[i] = A_diag_i[i + 1] - A_diag_i[i] + A_offd_i[i + 1] - A_offd_i[i];
+   }
+
+   if (A_diag_host != A_diag)
+   {
+      hypre_CSRMatrixDestroy(A_diag_host);
+   }
+   if (A_offd_host != A_offd)
+   {
+      hypre_CSRMatrixDestroy(A_offd_host);
+   }
+
+   /*-----------------------------------------------------------------
+    *  Gather the matrix on the root of the sub communicator
+    *-----------------------------------------------------------------*/
+
+   if (my_id == 0)
+   {
+      comm_info  = hypre_CTAlloc(HYPRE_Int, 2 * new_num_procs + 1, HYPRE_MEMORY_HOST);
+      nnz_info   = hypre_CTAlloc(HYPRE_Int, new_num_procs, HYPRE_MEMORY_HOST);
+      nnz_displs = hypre_CTAlloc(HYPRE_Int, new_num_procs + 1, HYPRE_MEMORY_HOST);
+      info       = &comm_info[0];
+      displs     = &comm_info[new_num_procs];
+   }
+
+   hypre_MPI_Gather(&num_rows, 1, HYPRE_MPI_INT, info, 1, HYPRE_MPI_INT, 0, new_comm);
+   hypre_MPI_Gather(&local_nnz, 1, HYPRE_MPI_INT, nnz_info, 1, HYPRE_MPI_INT, 0, new_comm);
+
+   if (my_id == 0)
+   {
+      for (i = 0; i < new_num_procs; i++)
+      {
+         displs[i + 1]     = displs[i] + info[i];
+         nnz_displs[i + 1] = nnz_displs[i] + nnz_info[i];
+      }
+
+      A_CSR = hypre_CSRMatrixCreate(global_num_rows, global_num_rows,
+                                    nnz_displs[new_num_procs]);
+      hypre_CSRMatrixInitialize_v2(A_CSR, 0, HYPRE_MEMORY_HOST);
+      A_CSR_i    = hypre_CSRMatrixI(A_CSR);
+      A_CSR_j    = hypre_CSRMatrixJ(A_CSR);
+      A_CSR_data = hypre_CSRMatrixData(A_CSR);
+   }
+
+   /* Row lengths land in A_CSR_i[1:] and are turned into offsets below */
+   hypre_MPI_Gatherv(local_len, num_rows, HYPRE_MPI_INT,
+                     (A_CSR_i) ? A_CSR_i + 1 : NULL, info, displs,
+                     HYPRE_MPI_INT, 0, new_comm);
+   hypre_MPI_Gatherv(local_j, local_nnz, HYPRE_MPI_INT, A_CSR_j,
+                     nnz_info, nnz_displs, HYPRE_MPI_INT, 0, new_comm);
+   hypre_MPI_Gatherv(local_data, local_nnz, HYPRE_MPI_COMPLEX, A_CSR_data,
+                     nnz_info, nnz_displs, HYPRE_MPI_COMPLEX, 0, new_comm);
+
+   hypre_TFree(local_len, HYPRE_MEMORY_HOST);
+   hypre_TFree(local_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(local_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(nnz_info, HYPRE_MEMORY_HOST);
+   hypre_TFree(nnz_displs, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------
+    *  Reorder and factor on the root
+    *-----------------------------------------------------------------*/
+
+   if (my_id == 0)
+   {
+      A_CSR_i[0] = 0;
+      for (i = 0; i < global_num_rows; i++)
+      {
+         A_CSR_i[i + 1] += A_CSR_i[i];
+      }
+
+      /* RCM ordering of the symmetrized pattern: B = A(perm, perm) */
+      hypre_ILULocalRCM(A_CSR, 0, global_num_rows, &perm, &perm, 0);
+      rperm = hypre_TAlloc(HYPRE_Int, global_num_rows, HYPRE_MEMORY_HOST);
+      for (i = 0; i < global_num_rows; i++)
+      {
+         rperm[perm[i]] = i;
+      }
+
+      /* Bandwidths of the reordered matrix */
+      kl = ku = 0;
+      for (i = 0; i < global_num_rows; i++)
+      {
+         row = perm[i];
+         for (jj = A_CSR_i[row]; jj < A_CSR_i[row + 1]; jj++)
+         {
+            col = rperm[A_CSR_j[jj]];
+            kl  = hypre_max(kl, i - col);
+            ku  = hypre_max(ku, col - i);
+         }
+      }
+      kv   = kl + ku;
+      ldab = 2 * kl + ku + 1;
+
+      /* Load the reordered matrix into band storage */
+      A_band = hypre_CTAlloc(HYPRE_Real, ldab * global_num_rows, HYPRE_MEMORY_HOST);
+      A_piv  = hypre_CTAlloc(HYPRE_Int, global_num_rows, HYPRE_MEMORY_HOST);
+      for (i = 0; i < global_num_rows; i++)
+      {
+         row = perm[i];
+         for (jj = A_CSR_i[row]; jj < A_CSR_i[row + 1]; jj++)
+         {
+            col = rperm[A_CSR_j[jj]];
+            A_band[kv + i - col + col * ldab] += (HYPRE_Real) A_CSR_data[jj];
+         }
+      }
+
+      hypre_CSRMatrixDestroy(A_CSR);
+      hypre_TFree(rperm, HYPRE_MEMORY_HOST);
+
+      hypre_GaussElimBandFactor(global_num_rows, kl, ku, A_band, A_piv);
+
+      hypre_ParAMGDataAMat(amg_data)        = A_band;
+      hypre_ParAMGDataAPiv(amg_data)        = A_piv;
+      hypre_ParAMGDataGEPerm(amg_data)      = perm;
+      hypre_ParAMGDataGEBandLower(amg_data) = kl;
+      hypre_ParAMGDataGEBandUpper(amg_data) = ku;
+      hypre_ParAMGDataCommInfo(amg_data)    = comm_info;
+      hypre_ParAMGDataBVec(amg_data)        = hypre_CTAlloc(HYPRE_Real, global_num_rows,
+                                                            HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataUVec(amg_data)        = hypre_CTAlloc(HYPRE_Real, global_num_rows,
+                                                            HYPRE_MEMORY_HOST);
+   }
+
+   hypre_ParAMGDataGSSetup(amg_data) = 1;
+
+   HYPRE_ANNOTATE_FUNC_END;
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_GS_ELIM_SETUP] += hypre_MPI_Wtime();
+#endif
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_GaussElimBandedSolve
+ *
+ * Solve phase of the agglomerated banded LU coarse solver: the right-hand
+ * side is gathered on the root of the sub-communicator, solved there with
+ * the stored factors and the solution is scattered back to the owners.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GaussElimBandedSolve(hypre_ParAMGData *amg_data,
+                           HYPRE_Int         level)
+{
+   hypre_ParCSRMatrix   *A               = hypre_ParAMGDataAArray(amg_data)[level];
+   HYPRE_Int             global_num_rows = (HYPRE_Int) hypre_ParCSRMatrixGlobalNumRows(A);
+   HYPRE_Int             num_rows        = hypre_ParCSRMatrixNumRows(A);
+
+   hypre_ParVector      *f               = hypre_ParAMGDataFArray(amg_data)[level];
+   hypre_ParVector      *u               = hypre_ParAMGDataUArray(amg_data)[level];
+   HYPRE_Real           *f_data          = hypre_VectorData(hypre_ParVectorLocalVector(f));
+   HYPRE_Real           *u_data          = hypre_VectorData(hypre_ParVectorLocalVector(u));
+   HYPRE_MemoryLocation  f_location      = hypre_ParVectorMemoryLocation(f);
+   HYPRE_MemoryLocation  u_location      = hypre_ParVectorMemoryLocation(u);
+   HYPRE_Real           *f_data_h;
+   HYPRE_Real           *u_data_h;
+
+   MPI_Comm              new_comm;
+   HYPRE_Int            *comm_info;
+   HYPRE_Int            *perm;
+   HYPRE_Real           *b_vec;
+   HYPRE_Real           *u_vec;
+   HYPRE_Int            *info            = NULL;
+   HYPRE_Int            *displs          = NULL;
+   HYPRE_Int             new_num_procs, my_id, i;
+
+   /* Call setup if not done before */
+   if (hypre_ParAMGDataGSSetup(amg_data) == 0)
+   {
+      hypre_GaussElimBandedSetup(amg_data, level);
+   }
+
+   /* Exit if no rows in this rank */
+   if (!num_rows)
+   {
+      return hypre_error_flag;
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_GS_ELIM_SOLVE] -= hypre_MPI_Wtime();
+#endif
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   new_comm  = hypre_ParAMGDataNewComm(amg_data);
+   comm_info = hypre_ParAMGDataCommInfo(amg_data);
+   perm      = hypre_ParAMGDataGEPerm(amg_data);
+   b_vec     = hypre_ParAMGDataBVec(amg_data);
+   u_vec     = hypre_ParAMGDataUVec(amg_data);
+
+   hypre_MPI_Comm_size(new_comm, &new_num_procs);
+   hypre_MPI_Comm_rank(new_comm, &my_id);
+   if (my_id == 0)
+   {
+      info   = &comm_info[0];
+      displs = &comm_info[new_num_procs];
+   }
+
+   if (hypre_GetActualMemLocation(f_location) != hypre_MEMORY_HOST)
+   {
+      f_data_h = hypre_TAlloc(HYPRE_Real, num_rows, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(f_data_h, f_data, HYPRE_Real, num_rows, HYPRE_MEMORY_HOST, f_location);
+   }
+   else
+   {
+      f_data_h = f_data;
+   }
+
+   if (hypre_GetActualMemLocation(u_location) != hypre_MEMORY_HOST)
+   {
+      u_data_h = hypre_TAlloc(HYPRE_Real, num_rows, HYPRE_MEMORY_HOST);
+   }
+   else
+   {
+      u_data_h = u_data;
+   }
+
+   /* Gather the right-hand side */
+   hypre_MPI_Gatherv(f_data_h, num_rows, HYPRE_MPI_REAL, b_vec,
+                     info, displs, HYPRE_MPI_REAL, 0, new_comm);
+
+   /* Solve with the reordered band factors */
+   if (my_id == 0)
+   {
+      for (i = 0; i < global_num_rows; i++)
+      {
+         u_vec[i] = b_vec[perm[i]];
+      }
+
+      hypre_GaussElimBandSolve(global_num_rows,
+                               hypre_ParAMGDataGEBandLower(amg_data),
+                               hypre_ParAMGDataGEBandUpper(amg_data),
+                               hypre_ParAMGDataAMat(amg_data),
+                               hypre_ParAMGDataAPiv(amg_data),
+                               u_vec);
+
+      for (i = 0; i < global_num_rows; i++)
+      {
+         b_vec[perm[i]] = u_vec[i];
+      }
+   }
+
+   /* Scatter the solution */
+   hypre_MPI_Scatterv(b_vec, info, displs, HYPRE_MPI_REAL, u_data_h,
+                      num_rows, HYPRE_MPI_REAL, 0, new_comm);
+
+   if (u_data_h != u_data)
+   {
+      hypre_TMemcpy(u_data, u_data_h, HYPRE_Real, num_rows, u_location, HYPRE_MEMORY_HOST);
+      hypre_TFree(u_data_h, HYPRE_MEMORY_HOST);
+   }
+   if (f_data_h != f_data)
+   {
+      hypre_TFree(f_data_h, HYPRE_MEMORY_HOST);
+   }
+
+   HYPRE_ANNOTATE_FUNC_END;
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_GS_ELIM_SOLVE] += hypre_MPI_Wtime();
+#endif
+
+   return hypre_error_flag;
+}
@@ -86,6 +86,12 @@ hypre_ILUCreate( void )
    hypre_ParILUDataNLU(ilu_data)                          = 0;
    hypre_ParILUDataNI(ilu_data)                           = 0;
    hypre_ParILUDataUEnd(ilu_data)                         = NULL;
+   hypre_ParILUDataNumLowerLevels(ilu_data)               = 0;
+   hypre_ParILUDataLowerLevelI(ilu_data)                  = NULL;
+   hypre_ParILUDataLowerLevelJ(ilu_data)                  = NULL;
+   hypre_ParILUDataNumUpperLevels(ilu_data)               = 0;
+   hypre_ParILUDataUpperLevelI(ilu_data)                  = NULL;
+   hypre_ParILUDataUpperLevelJ(ilu_data)                  = NULL;
 
    /* reordering_type default to use local RCM */
    hypre_ParILUDataReorderingType(ilu_data)               = 1;
@@ -192,6 +198,12 @@ hypre_ILUDestroy( void *data )
       /* u_end */
       hypre_TFree( hypre_ParILUDataUEnd(ilu_data), HYPRE_MEMORY_HOST );
 
+      /* level schedules */
+      hypre_TFree( hypre_ParILUDataLowerLevelI(ilu_data), HYPRE_MEMORY_HOST );
+      hypre_TFree( hypre_ParILUDataLowerLevelJ(ilu_data), HYPRE_MEMORY_HOST );
+      hypre_TFree( hypre_ParILUDataUpperLevelI(ilu_data), HYPRE_MEMORY_HOST );
+      hypre_TFree( hypre_ParILUDataUpperLevelJ(ilu_data), HYPRE_MEMORY_HOST );
+
       /* Factors */
       hypre_ParCSRMatrixDestroy( hypre_ParILUDataMatS(ilu_data) );
       hypre_ParCSRMatrixDestroy( hypre_ParILUDataMatL(ilu_data) );
@@ -2026,6 +2038,167 @@ hypre_ILUGetLocalPerm(hypre_ParCSRMatrix  *A,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ILUGetDomainPartitionPerm
+ *
+ * Reorders the first nLU entries of the (symmetric) local ordering into num_domains
+ * interior domains followed by a separator, so that the rows of different
+ * domains are not coupled (in either direction) and ILU factorization of
+ * the domains can proceed independently. The domains are contiguous
+ * chunks of the incoming ordering, e.g., from hypre_ILUGetLocalPerm or
+ * hypre_ILUGetInteriorExteriorPerm, which with RCM are bands of level
+ * sets. Of each pair of coupled rows lying in different chunks, the one in
+ * the lower chunk is moved to the separator.
+ *
+ * Parameters:
+ *   A: parcsr matrix
+ *   memory_location: memory location of perm (must be host accessible)
+ *   perm_ptr: permutation array; created as identity if NULL on input
+ *   nLU: number of rows to partition
+ *   num_domains: requested number of domains
+ *   num_domains_ptr: number of domains created. Set to 0 (and perm left
+ *                    unchanged) when the separator would be too large
+ *   domain_starts_ptr: domain d spans [starts[d], starts[d + 1]) and the
+ *                      separator spans [starts[num_domains], nLU)
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ILUGetDomainPartitionPerm(hypre_ParCSRMatrix    *A,
+                                HYPRE_MemoryLocation   memory_location,
+                                HYPRE_Int            **perm_ptr,
+                                HYPRE_Int              nLU,
+                                HYPRE_Int              num_domains,
+                                HYPRE_Int             *num_domains_ptr,
+                                HYPRE_Int            **domain_starts_ptr)
+{
+   HYPRE_Int              n        = hypre_ParCSRMatrixNumRows(A);
+   hypre_CSRMatrix       *A_diag   = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int             *A_diag_i = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int             *A_diag_j = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Int             *perm     = *perm_ptr;
+
+   HYPRE_Int             *rperm, *domain, *order, *domain_starts, *pos, *tmp;
+   HYPRE_Int              i, ii, jj, j, d, num_sep;
+
+   *num_domains_ptr   = 0;
+   *domain_starts_ptr = NULL;
+
+   /* Need enough rows per domain for the separator to be small */
+   if (num_domains < 2 || nLU < 64 * num_domains)
+   {
+      return hypre_error_flag;
+   }
+
+   if (!perm)
+   {
+      perm = hypre_TAlloc(HYPRE_Int, n, memory_location);
+      for (i = 0; i < n; i++)
+      {
+         perm[i] = i;
+      }
+      *perm_ptr = perm;
+   }
+
+   rperm  = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   domain = hypre_TAlloc(HYPRE_Int, nLU, HYPRE_MEMORY_HOST);
+   for (i = 0; i < n; i++)
+   {
+      rperm[perm[i]] = i;
+   }
+
+   /* Initial chunks; -1 marks the separator */
+   for (ii = 0; ii < nLU; ii++)
+   {
+      domain[ii] = (HYPRE_Int) (((HYPRE_BigInt) ii * num_domains) / nLU);
+   }
+   for (ii = 0; ii < nLU; ii++)
+   {
+      d = (HYPRE_Int) (((HYPRE_BigInt) ii * num_domains) / nLU);
+      i = perm[ii];
+      for (j = A_diag_i[i]; j < A_diag_i[i + 1]; j++)
+      {
+         jj = rperm[A_diag_j[j]];
+         if (jj >= nLU)
+         {
+            continue;
+         }
+         if ((HYPRE_Int) (((HYPRE_BigInt) jj * num_domains) / nLU) > d)
+         {
+            domain[ii] = -1;
+         }
+         else if ((HYPRE_Int) (((HYPRE_BigInt) jj * num_domains) / nLU) < d)
+         {
+            domain[jj] = -1;
+         }
+      }
+   }
+
+   num_sep = 0;
+   for (ii = 0; ii < nLU; ii++)
+   {
+      num_sep += (domain[ii] < 0);
+   }
+
+   /* Not worth it if the sequential separator dominates */
+   if (num_sep > nLU / 4)
+   {
+      hypre_TFree(rperm, HYPRE_MEMORY_HOST);
+      hypre_TFree(domain, HYPRE_MEMORY_HOST);
+      return hypre_error_flag;
+   }
+
+   /* Domains keep their relative order, then the separator */
+   domain_starts = hypre_CTAlloc(HYPRE_Int, num_domains + 1, HYPRE_MEMORY_HOST);
+   pos           = hypre_TAlloc(HYPRE_Int, num_domains, HYPRE_MEMORY_HOST);
+   order         = hypre_TAlloc(HYPRE_Int, nLU, HYPRE_MEMORY_HOST);
+   for (ii = 0; ii < nLU; ii++)
+   {
+      if (domain[ii] >= 0)
+      {
+         domain_starts[domain[ii] + 1]++;
+      }
+   }
+   for (d = 0; d < num_domains; d++)
+   {
+      domain_starts[d + 1] += domain_starts[d];
+      pos[d] = domain_starts[d];
+   }
+   num_sep = domain_starts[num_domains];
+   for (ii = 0; ii < nLU; ii++)
+   {
+      if (domain[ii] >= 0)
+      {
+         order[pos[domain[ii]]++] = ii;
+      }
+      else
+      {
+         order[num_sep++] = ii;
+      }
+   }
+
+   /* Apply the new order to perm */
+   tmp = hypre_TAlloc(HYPRE_Int, nLU, HYPRE_MEMORY_HOST);
+   for (ii = 0; ii < nLU; ii++)
+   {
+      tmp[ii] = perm[order[ii]];
+   }
+   for (ii = 0; ii < nLU; ii++)
+   {
+      perm[ii] = tmp[ii];
+   }
+
+   hypre_TFree(tmp, HYPRE_MEMORY_HOST);
+   hypre_TFree(order, HYPRE_MEMORY_HOST);
+   hypre_TFree(pos, HYPRE_MEMORY_HOST);
+   hypre_TFree(rperm, HYPRE_MEMORY_HOST);
+   hypre_TFree(domain, HYPRE_MEMORY_HOST);
+
+   *num_domains_ptr   = num_domains;
+   *domain_starts_ptr = domain_starts;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ILUBuildRASExternalMatrix
  *
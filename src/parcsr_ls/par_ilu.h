@@ -51,6 +51,14 @@ typedef struct hypre_ParILUData_struct
    HYPRE_Int             nI;
    HYPRE_Int            *u_end; /* used when schur block is formed */
 
+   /* level schedules of L and U for threaded host triangular solves */
+   HYPRE_Int             num_lower_levels;
+   HYPRE_Int            *lower_level_i;  /* level k holds rows lower_level_j[i[k]:i[k+1]] */
+   HYPRE_Int            *lower_level_j;
+   HYPRE_Int             num_upper_levels;
+   HYPRE_Int            *upper_level_i;
+   HYPRE_Int            *upper_level_j;
+
    /* temp vectors for solve phase */
    hypre_ParVector      *Utemp;
    hypre_ParVector      *Ftemp;
@@ -179,6 +187,12 @@ typedef struct hypre_ParILUData_struct
 #define hypre_ParILUDataNLU(ilu_data)                          ((ilu_data) -> nLU)
 #define hypre_ParILUDataNI(ilu_data)                           ((ilu_data) -> nI)
 #define hypre_ParILUDataUEnd(ilu_data)                         ((ilu_data) -> u_end)
+#define hypre_ParILUDataNumLowerLevels(ilu_data)               ((ilu_data) -> num_lower_levels)
+#define hypre_ParILUDataLowerLevelI(ilu_data)                  ((ilu_data) -> lower_level_i)
+#define hypre_ParILUDataLowerLevelJ(ilu_data)                  ((ilu_data) -> lower_level_j)
+#define hypre_ParILUDataNumUpperLevels(ilu_data)               ((ilu_data) -> num_upper_levels)
+#define hypre_ParILUDataUpperLevelI(ilu_data)                  ((ilu_data) -> upper_level_i)
+#define hypre_ParILUDataUpperLevelJ(ilu_data)                  ((ilu_data) -> upper_level_j)
 #define hypre_ParILUDataUTemp(ilu_data)                        ((ilu_data) -> Utemp)
 #define hypre_ParILUDataFTemp(ilu_data)                        ((ilu_data) -> Ftemp)
 #define hypre_ParILUDataXTemp(ilu_data)                        ((ilu_data) -> Xtemp)
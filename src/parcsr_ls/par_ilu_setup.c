@@ -36,6 +36,9 @@ hypre_ILUSetup( void               *ilu_vdata,
    HYPRE_Int            *perm                = hypre_ParILUDataPerm(ilu_data);
    HYPRE_Int            *qperm               = hypre_ParILUDataQPerm(ilu_data);
    HYPRE_Real            tol_ddPQ            = hypre_ParILUDataTolDDPQ(ilu_data);
+   HYPRE_Int             partition           = 0;
+   HYPRE_Int             num_domains         = 0;
+   HYPRE_Int            *domain_starts       = NULL;
 
    /* Pointers to device data, note that they are not NULL only when needed */
 #if defined(HYPRE_USING_GPU)
@@ -270,6 +273,33 @@ hypre_ILUSetup( void               *ilu_vdata,
             hypre_ILUGetLocalPerm(matA, &perm, &nLU, reordering_type);
             break;
       }
+
+      /* Split the ordering into independent domains for threaded ILU(k)/ILUT */
+      switch (ilu_type)
+      {
+         case 0: case 10: case 20:
+            partition = (fill_level > 0);
+            break;
+
+         case 1: case 11: case 21:
+            partition = 1;
+            break;
+
+         default:
+            partition = 0;
+            break;
+      }
+#if defined(HYPRE_USING_GPU)
+      if (exec == HYPRE_EXEC_DEVICE)
+      {
+         partition = 0;
+      }
+#endif
+      if (partition && hypre_NumThreads() > 1)
+      {
+         hypre_ILUGetDomainPartitionPerm(matA, memory_location, &perm, nLU,
+                                         hypre_NumThreads(), &num_domains, &domain_starts);
+      }
    }
 
    /* Factorization */
@@ -302,7 +332,7 @@ hypre_ILUSetup( void               *ilu_vdata,
 #endif
          {
             /* BJ + hypre_iluk() */
-            hypre_ILUSetupILUK(matA, fill_level, perm, perm, n, n,
+            hypre_ILUSetupILUK(matA, fill_level, perm, perm, n, n, num_domains, domain_starts,
                                &matL, &matD, &matU, &matS, &u_end);
          }
          break;
@@ -325,7 +355,7 @@ hypre_ILUSetup( void               *ilu_vdata,
          {
             /* BJ + hypre_ilut() */
             hypre_ILUSetupILUT(matA, max_row_elmts, droptol, perm, perm, n, n,
-                               &matL, &matD, &matU, &matS, &u_end);
+                               num_domains, domain_starts, &matL, &matD, &matU, &matS, &u_end);
          }
          break;
 
@@ -357,7 +387,7 @@ hypre_ILUSetup( void               *ilu_vdata,
          {
             /* GMRES + hypre_iluk() */
             hypre_ILUSetupILUK(matA, fill_level, perm, perm, nLU, nLU,
-                               &matL, &matD, &matU, &matS, &u_end);
+                               num_domains, domain_starts, &matL, &matD, &matU, &matS, &u_end);
          }
          break;
 
@@ -380,7 +410,7 @@ hypre_ILUSetup( void               *ilu_vdata,
          {
             /* GMRES + hypre_ilut() */
             hypre_ILUSetupILUT(matA, max_row_elmts, droptol, perm, perm, nLU, nLU,
-                               &matL, &matD, &matU, &matS, &u_end);
+                               num_domains, domain_starts, &matL, &matD, &matU, &matS, &u_end);
          }
          break;
 
@@ -396,7 +426,7 @@ hypre_ILUSetup( void               *ilu_vdata,
 
          /* Newton Schulz Hotelling + hypre_iluk() */
          hypre_ILUSetupILUK(matA, fill_level, perm, perm, nLU, nLU,
-                            &matL, &matD, &matU, &matS, &u_end);
+                            num_domains, domain_starts, &matL, &matD, &matU, &matS, &u_end);
          break;
 
       case 21:
@@ -411,7 +441,7 @@ hypre_ILUSetup( void               *ilu_vdata,
 
          /* Newton Schulz Hotelling + hypre_ilut() */
          hypre_ILUSetupILUT(matA, max_row_elmts, droptol, perm, perm, nLU, nLU,
-                            &matL, &matD, &matU, &matS, &u_end);
+                            num_domains, domain_starts, &matL, &matD, &matU, &matS, &u_end);
          break;
 
       case 30:
@@ -455,7 +485,7 @@ hypre_ILUSetup( void               *ilu_vdata,
 #endif
 
          /* ddPQ + GMRES + hypre_iluk() */
-         hypre_ILUSetupILUK(matA, fill_level, perm, qperm, nLU, nI,
+         hypre_ILUSetupILUK(matA, fill_level, perm, qperm, nLU, nI, 0, NULL,
                             &matL, &matD, &matU, &matS, &u_end);
          break;
 
@@ -471,7 +501,7 @@ hypre_ILUSetup( void               *ilu_vdata,
 
          /* ddPQ + GMRES + hypre_ilut() */
          hypre_ILUSetupILUT(matA, max_row_elmts, droptol, perm, qperm, nLU, nI,
-                            &matL, &matD, &matU, &matS, &u_end);
+                            0, NULL, &matL, &matD, &matU, &matS, &u_end);
          break;
 
       case 50:
@@ -516,6 +546,29 @@ hypre_ILUSetup( void               *ilu_vdata,
          break;
    }
 
+   hypre_TFree(domain_starts, HYPRE_MEMORY_HOST);
+
+   /* Level schedules for the threaded triangular solves with L and U */
+   hypre_TFree(hypre_ParILUDataLowerLevelI(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataLowerLevelJ(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataUpperLevelI(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataUpperLevelJ(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_ParILUDataNumLowerLevels(ilu_data) = 0;
+   hypre_ParILUDataNumUpperLevels(ilu_data) = 0;
+
+   if ((ilu_type == 0 || ilu_type == 1) && tri_solve == 1 &&
+       matL && matU && hypre_NumThreads() > 1)
+   {
+      hypre_ILUSetupLevelSchedule(hypre_ParCSRMatrixDiag(matL), 0,
+                                  &hypre_ParILUDataNumLowerLevels(ilu_data),
+                                  &hypre_ParILUDataLowerLevelI(ilu_data),
+                                  &hypre_ParILUDataLowerLevelJ(ilu_data));
+      hypre_ILUSetupLevelSchedule(hypre_ParCSRMatrixDiag(matU), 1,
+                                  &hypre_ParILUDataNumUpperLevels(ilu_data),
+                                  &hypre_ParILUDataUpperLevelI(ilu_data),
+                                  &hypre_ParILUDataUpperLevelJ(ilu_data));
+   }
+
    /* Create additional temporary vector for iterative triangular solve */
    if (!tri_solve)
    {
@@ -1263,6 +1316,87 @@ hypre_ILUSetup( void               *ilu_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ILUSetupLevelSchedule
+ *
+ * Compute the level sets of the triangular factor T (strictly lower when
+ * upper = 0, strictly upper otherwise) for a threaded substitution. Rows
+ * in level k only depend on rows in levels 0, ..., k-1, so each level can
+ * be processed in parallel.
+ *
+ * T = diagonal block of the L or U factor
+ * num_levels_ptr = number of levels
+ * level_i_ptr = start of each level in level_j (num_levels + 1 entries)
+ * level_j_ptr = rows of T ordered by level
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ILUSetupLevelSchedule(hypre_CSRMatrix  *T,
+                            HYPRE_Int         upper,
+                            HYPRE_Int        *num_levels_ptr,
+                            HYPRE_Int       **level_i_ptr,
+                            HYPRE_Int       **level_j_ptr)
+{
+   HYPRE_Int    n      = hypre_CSRMatrixNumRows(T);
+   HYPRE_Int   *T_i    = hypre_CSRMatrixI(T);
+   HYPRE_Int   *T_j    = hypre_CSRMatrixJ(T);
+
+   HYPRE_Int   *level;
+   HYPRE_Int   *level_i;
+   HYPRE_Int   *level_j;
+   HYPRE_Int    num_levels = 0;
+   HYPRE_Int    i, ii, j, col;
+
+   level = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+
+   /* The level of a row is one more than the largest level of the rows it
+      depends on. Visit the rows in the order of the substitution. */
+   for (ii = 0; ii < n; ii++)
+   {
+      i = upper ? (n - 1 - ii) : ii;
+      level[i] = 0;
+      for (j = T_i[i]; j < T_i[i + 1]; j++)
+      {
+         col = T_j[j];
+         if ((upper && col > i && col < n) || (!upper && col < i))
+         {
+            level[i] = hypre_max(level[i], level[col] + 1);
+         }
+      }
+      num_levels = hypre_max(num_levels, level[i] + 1);
+   }
+
+   /* Bucket the rows by level, keeping them in substitution order */
+   level_i = hypre_CTAlloc(HYPRE_Int, num_levels + 1, HYPRE_MEMORY_HOST);
+   level_j = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   for (i = 0; i < n; i++)
+   {
+      level_i[level[i] + 1]++;
+   }
+   for (i = 0; i < num_levels; i++)
+   {
+      level_i[i + 1] += level_i[i];
+   }
+   for (ii = 0; ii < n; ii++)
+   {
+      i = upper ? (n - 1 - ii) : ii;
+      level_j[level_i[level[i]]++] = i;
+   }
+   for (i = num_levels; i > 0; i--)
+   {
+      level_i[i] = level_i[i - 1];
+   }
+   level_i[0] = 0;
+
+   hypre_TFree(level, HYPRE_MEMORY_HOST);
+
+   *num_levels_ptr = num_levels;
+   *level_i_ptr    = level_i;
+   *level_j_ptr    = level_j;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParILUExtractEBFC
  *
@@ -3265,6 +3399,135 @@ hypre_ILUSetupILUKSymbolic(HYPRE_Int   n,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ILUSetupILUKRows
+ *
+ * ILU(k) numeric factorization of the rows [row_start, row_end) of the
+ * upper (L, D, U) part, given the pattern computed by
+ * hypre_ILUSetupILUKSymbolic. The rows eliminated against must have been
+ * factored already. iw is a work array of length n that must be -1 on
+ * input and is left that way on output.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ILUSetupILUKRows(HYPRE_Int         row_start,
+                       HYPRE_Int         row_end,
+                       hypre_CSRMatrix  *A_diag,
+                       HYPRE_Int        *perm,
+                       HYPRE_Int        *rperm,
+                       HYPRE_Int        *iw,
+                       HYPRE_Real       *D_data,
+                       HYPRE_Int        *L_diag_i,
+                       HYPRE_Int        *L_diag_j,
+                       HYPRE_Real       *L_diag_data,
+                       HYPRE_Int        *U_diag_i,
+                       HYPRE_Int        *U_diag_j,
+                       HYPRE_Real       *U_diag_data)
+{
+   HYPRE_Real              *A_diag_data   = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int               *A_diag_i      = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int               *A_diag_j      = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Int                i, ii, j, k, k1, k2, kl, ku, jpiv, col, icol;
+
+   for (ii = row_start; ii < row_end; ii++)
+   {
+      // get row i
+      i = perm[ii];
+      kl = L_diag_i[ii + 1];
+      ku = U_diag_i[ii + 1];
+      k1 = A_diag_i[i];
+      k2 = A_diag_i[i + 1];
+      /* set up working arrays */
+      for (j = L_diag_i[ii]; j < kl; j++)
+      {
+         col = L_diag_j[j];
+         iw[col] = j;
+      }
+      D_data[ii] = 0.0;
+      iw[ii] = ii;
+      for (j = U_diag_i[ii]; j < ku; j++)
+      {
+         col = U_diag_j[j];
+         iw[col] = j;
+      }
+      /* copy data from A into L, D and U */
+      for (j = k1; j < k2; j++)
+      {
+         /* compute everything in new index */
+         col = rperm[A_diag_j[j]];
+         icol = iw[col];
+         /* A for sure to be inside the pattern */
+         if (col < ii)
+         {
+            L_diag_data[icol] = A_diag_data[j];
+         }
+         else if (col == ii)
+         {
+            D_data[ii] = A_diag_data[j];
+         }
+         else
+         {
+            U_diag_data[icol] = A_diag_data[j];
+         }
+      }
+      /* elimination */
+      for (j = L_diag_i[ii]; j < kl; j++)
+      {
+         jpiv = L_diag_j[j];
+         L_diag_data[j] *= D_data[jpiv];
+         ku = U_diag_i[jpiv + 1];
+
+         for (k = U_diag_i[jpiv]; k < ku; k++)
+         {
+            col = U_diag_j[k];
+            icol = iw[col];
+            if (icol < 0)
+            {
+               /* not in partern */
+               continue;
+            }
+            if (col < ii)
+            {
+               /* L part */
+               L_diag_data[icol] -= L_diag_data[j] * U_diag_data[k];
+            }
+            else if (col == ii)
+            {
+               /* diag part */
+               D_data[icol] -= L_diag_data[j] * U_diag_data[k];
+            }
+            else
+            {
+               /* U part */
+               U_diag_data[icol] -= L_diag_data[j] * U_diag_data[k];
+            }
+         }
+      }
+      /* reset working array */
+      ku = U_diag_i[ii + 1];
+      for (j = L_diag_i[ii]; j < kl; j++)
+      {
+         col = L_diag_j[j];
+         iw[col] = -1;
+      }
+      iw[ii] = -1;
+      for (j = U_diag_i[ii]; j < ku ; j++)
+      {
+         col = U_diag_j[j];
+         iw[col] = -1;
+      }
+
+      /* diagonal part (we store the inverse) */
+      if (hypre_abs(D_data[ii]) < MAT_TOL)
+      {
+         D_data[ii] = 1.0e-06;
+      }
+      D_data[ii] = 1. / D_data[ii];
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ILUSetupILUK
  *
@@ -3277,6 +3540,10 @@ hypre_ILUSetupILUKSymbolic(HYPRE_Int   n,
  * qpermp: column permutation array.
  * nLU: size of computed LDU factorization.
  * nI: number of interial unknowns, nI should obey nI >= nLU
+ * num_domains, domain_starts: optional partition of the first nLU rows into
+ *      independent domains followed by a separator, which lets the numeric
+ *      factorization run on threads (see hypre_ILUGetDomainPartitionPerm).
+ *      Pass 0 and NULL for a sequential factorization.
  * Lptr, Dptr, Uptr: L, D, U factors.
  * Sprt: Schur Complement, if no Schur Complement, it will be set to NULL
  *--------------------------------------------------------------------------*/
@@ -3288,6 +3555,8 @@ hypre_ILUSetupILUK(hypre_ParCSRMatrix  *A,
                    HYPRE_Int           *qpermp,
                    HYPRE_Int            nLU,
                    HYPRE_Int            nI,
+                   HYPRE_Int            num_domains,
+                   HYPRE_Int           *domain_starts,
                    hypre_ParCSRMatrix **Lptr,
                    HYPRE_Real         **Dptr,
                    hypre_ParCSRMatrix **Uptr,
@@ -3312,7 +3581,7 @@ hypre_ILUSetupILUK(hypre_ParCSRMatrix  *A,
    }
 
    HYPRE_Real              local_nnz, total_nnz;
-   HYPRE_Int               i, ii, j, k, k1, k2, k3, kl, ku, jpiv, col, icol;
+   HYPRE_Int               i, ii, j, k, k1, k2, k3, kl, ku, jpiv, col, icol, d;
    HYPRE_Int               *iw;
    MPI_Comm                comm = hypre_ParCSRMatrixComm(A);
    HYPRE_Int               num_procs,  my_id;
@@ -3472,12 +3741,47 @@ hypre_ILUSetupILUK(hypre_ParCSRMatrix  *A,
     * we already have L and U structure ready, so no extra working array needed
     */
    /* first loop for upper part */
-   for (ii = 0; ii < nLU; ii++)
+   if (num_domains > 1)
+   {
+      /* Interior domains only couple to themselves and to the separator,
+         so they are factored concurrently, each with its own work array */
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(d) HYPRE_SMP_SCHEDULE
+#endif
+      for (d = 0; d < num_domains; d++)
+      {
+         HYPRE_Int *iw_d = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+         HYPRE_Int  k_d;
+
+         for (k_d = 0; k_d < n; k_d++)
+         {
+            iw_d[k_d] = -1;
+         }
+         hypre_ILUSetupILUKRows(domain_starts[d], domain_starts[d + 1], A_diag, perm, rperm,
+                                iw_d, D_data, L_diag_i, L_diag_j, L_diag_data,
+                                U_diag_i, U_diag_j, U_diag_data);
+         hypre_TFree(iw_d, HYPRE_MEMORY_HOST);
+      }
+
+      /* Separator rows last */
+      hypre_ILUSetupILUKRows(domain_starts[num_domains], nLU, A_diag, perm, rperm,
+                             iw, D_data, L_diag_i, L_diag_j, L_diag_data,
+                             U_diag_i, U_diag_j, U_diag_data);
+   }
+   else
+   {
+      hypre_ILUSetupILUKRows(0, nLU, A_diag, perm, rperm, iw, D_data,
+                             L_diag_i, L_diag_j, L_diag_data,
+                             U_diag_i, U_diag_j, U_diag_data);
+   }
+
+   /* Now lower part for Schur complement */
+   for (ii = nLU; ii < n; ii++)
    {
       // get row i
       i = perm[ii];
       kl = L_diag_i[ii + 1];
-      ku = U_diag_i[ii + 1];
+      ku = S_diag_i[ii - nLU + 1];
       k1 = A_diag_i[i];
       k2 = A_diag_i[i + 1];
       /* set up working arrays */
@@ -3486,31 +3790,25 @@ hypre_ILUSetupILUK(hypre_ParCSRMatrix  *A,
          col = L_diag_j[j];
          iw[col] = j;
       }
-      D_data[ii] = 0.0;
-      iw[ii] = ii;
-      for (j = U_diag_i[ii]; j < ku; j++)
+      for (j = S_diag_i[ii - nLU]; j < ku; j++)
       {
-         col = U_diag_j[j];
+         col = S_diag_j[j];
          iw[col] = j;
       }
-      /* copy data from A into L, D and U */
+      /* copy data from A into L, and S */
       for (j = k1; j < k2; j++)
       {
          /* compute everything in new index */
          col = rperm[A_diag_j[j]];
          icol = iw[col];
          /* A for sure to be inside the pattern */
-         if (col < ii)
+         if (col < nLU)
          {
             L_diag_data[icol] = A_diag_data[j];
          }
-         else if (col == ii)
-         {
-            D_data[ii] = A_diag_data[j];
-         }
          else
          {
-            U_diag_data[icol] = A_diag_data[j];
+            S_diag_data[icol] = A_diag_data[j];
          }
       }
       /* elimination */
@@ -3519,7 +3817,6 @@ hypre_ILUSetupILUK(hypre_ParCSRMatrix  *A,
          jpiv = L_diag_j[j];
          L_diag_data[j] *= D_data[jpiv];
          ku = U_diag_i[jpiv + 1];
-
          for (k = U_diag_i[jpiv]; k < ku; k++)
          {
             col = U_diag_j[k];
@@ -3529,138 +3826,48 @@ hypre_ILUSetupILUK(hypre_ParCSRMatrix  *A,
                /* not in partern */
                continue;
             }
-            if (col < ii)
+            if (col < nLU)
             {
                /* L part */
                L_diag_data[icol] -= L_diag_data[j] * U_diag_data[k];
             }
-            else if (col == ii)
-            {
-               /* diag part */
-               D_data[icol] -= L_diag_data[j] * U_diag_data[k];
-            }
             else
             {
-               /* U part */
-               U_diag_data[icol] -= L_diag_data[j] * U_diag_data[k];
+               /* S part */
+               S_diag_data[icol] -= L_diag_data[j] * U_diag_data[k];
             }
          }
       }
       /* reset working array */
-      ku = U_diag_i[ii + 1];
-      for (j = L_diag_i[ii]; j < kl; j++)
+      for (j = L_diag_i[ii]; j < kl ; j++)
       {
          col = L_diag_j[j];
          iw[col] = -1;
       }
-      iw[ii] = -1;
-      for (j = U_diag_i[ii]; j < ku ; j++)
+      ku = S_diag_i[ii - nLU + 1];
+      for (j = S_diag_i[ii - nLU]; j < ku; j++)
       {
-         col = U_diag_j[j];
+         col = S_diag_j[j];
          iw[col] = -1;
+         /* remember to update index, S is smaller! */
+         S_diag_j[j] -= nLU;
       }
-
-      /* diagonal part (we store the inverse) */
-      if (hypre_abs(D_data[ii]) < MAT_TOL)
-      {
-         D_data[ii] = 1.0e-06;
-      }
-      D_data[ii] = 1. / D_data[ii];
    }
 
-   /* Now lower part for Schur complement */
-   for (ii = nLU; ii < n; ii++)
+   /*
+    * 4: Finishing up and free
+    */
+
+   /* First create Schur complement if necessary
+    * Check if we need to create Schur complement
+    */
+   HYPRE_BigInt big_m = (HYPRE_BigInt)m;
+   hypre_MPI_Allreduce(&big_m, &total_rows, 1, HYPRE_MPI_BIG_INT, hypre_MPI_SUM, comm);
+   /* only form when total_rows > 0 */
+   if ( total_rows > 0 )
    {
-      // get row i
-      i = perm[ii];
-      kl = L_diag_i[ii + 1];
-      ku = S_diag_i[ii - nLU + 1];
-      k1 = A_diag_i[i];
-      k2 = A_diag_i[i + 1];
-      /* set up working arrays */
-      for (j = L_diag_i[ii]; j < kl; j++)
-      {
-         col = L_diag_j[j];
-         iw[col] = j;
-      }
-      for (j = S_diag_i[ii - nLU]; j < ku; j++)
-      {
-         col = S_diag_j[j];
-         iw[col] = j;
-      }
-      /* copy data from A into L, and S */
-      for (j = k1; j < k2; j++)
-      {
-         /* compute everything in new index */
-         col = rperm[A_diag_j[j]];
-         icol = iw[col];
-         /* A for sure to be inside the pattern */
-         if (col < nLU)
-         {
-            L_diag_data[icol] = A_diag_data[j];
-         }
-         else
-         {
-            S_diag_data[icol] = A_diag_data[j];
-         }
-      }
-      /* elimination */
-      for (j = L_diag_i[ii]; j < kl; j++)
-      {
-         jpiv = L_diag_j[j];
-         L_diag_data[j] *= D_data[jpiv];
-         ku = U_diag_i[jpiv + 1];
-         for (k = U_diag_i[jpiv]; k < ku; k++)
-         {
-            col = U_diag_j[k];
-            icol = iw[col];
-            if (icol < 0)
-            {
-               /* not in partern */
-               continue;
-            }
-            if (col < nLU)
-            {
-               /* L part */
-               L_diag_data[icol] -= L_diag_data[j] * U_diag_data[k];
-            }
-            else
-            {
-               /* S part */
-               S_diag_data[icol] -= L_diag_data[j] * U_diag_data[k];
-            }
-         }
-      }
-      /* reset working array */
-      for (j = L_diag_i[ii]; j < kl ; j++)
-      {
-         col = L_diag_j[j];
-         iw[col] = -1;
-      }
-      ku = S_diag_i[ii - nLU + 1];
-      for (j = S_diag_i[ii - nLU]; j < ku; j++)
-      {
-         col = S_diag_j[j];
-         iw[col] = -1;
-         /* remember to update index, S is smaller! */
-         S_diag_j[j] -= nLU;
-      }
-   }
-
-   /*
-    * 4: Finishing up and free
-    */
-
-   /* First create Schur complement if necessary
-    * Check if we need to create Schur complement
-    */
-   HYPRE_BigInt big_m = (HYPRE_BigInt)m;
-   hypre_MPI_Allreduce(&big_m, &total_rows, 1, HYPRE_MPI_BIG_INT, hypre_MPI_SUM, comm);
-   /* only form when total_rows > 0 */
-   if ( total_rows > 0 )
-   {
-      /* now create S */
-      /* need to get new column start */
+      /* now create S */
+      /* need to get new column start */
       {
          HYPRE_BigInt global_start;
          hypre_MPI_Scan(&big_m, &global_start, 1, HYPRE_MPI_BIG_INT, hypre_MPI_SUM, comm);
@@ -3822,16 +4029,316 @@ hypre_ILUSetupILUK(hypre_ParCSRMatrix  *A,
       hypre_TFree(perm, memory_location);
    }
 
-   if (!qpermp)
-   {
-      hypre_TFree(qperm, memory_location);
-   }
+   if (!qpermp)
+   {
+      hypre_TFree(qperm, memory_location);
+   }
+
+   /* set matrix pointers */
+   *Lptr = matL;
+   *Dptr = D_data;
+   *Uptr = matU;
+   *Sptr = matS;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ILUSetupILUTRows
+ *
+ * ILU(t) numeric factorization of the rows [row_start, row_end) of the
+ * upper (L, D, U) part, see hypre_ILUSetupILUT for the meaning of lfil,
+ * tol, nLU, perm and rperm. m is the size of the local Schur complement.
+ *
+ * The rows are stored in L_diag_i/U_diag_i shifted by row_offset, i.e.,
+ * row ii starts at L_diag_i[ii - row_offset], and appended to the arrays
+ * pointed to by L_diag_j_ptr, L_diag_data_ptr (and likewise for U), which
+ * are grown as needed. Rows eliminated against must also be stored in
+ * these arrays, so row_offset must not exceed the first of them.
+ * u_end_array is indexed by ii and relative to the given U arrays.
+ *
+ * iw, iL and w are work arrays of length n; iw must be -1 on input and is
+ * left that way on output.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ILUSetupILUTRows(HYPRE_Int              row_start,
+                       HYPRE_Int              row_end,
+                       HYPRE_Int              row_offset,
+                       HYPRE_Int              lfil,
+                       HYPRE_Real            *tol,
+                       HYPRE_Int              nLU,
+                       HYPRE_Int              m,
+                       hypre_CSRMatrix       *A_diag,
+                       HYPRE_Int             *perm,
+                       HYPRE_Int             *rperm,
+                       HYPRE_Int             *iw,
+                       HYPRE_Int             *iL,
+                       HYPRE_Real            *w,
+                       HYPRE_Real            *D_data,
+                       HYPRE_Int             *L_diag_i,
+                       HYPRE_Int            **L_diag_j_ptr,
+                       HYPRE_Real           **L_diag_data_ptr,
+                       HYPRE_Int             *capacity_L_ptr,
+                       HYPRE_Int             *U_diag_i,
+                       HYPRE_Int            **U_diag_j_ptr,
+                       HYPRE_Real           **U_diag_data_ptr,
+                       HYPRE_Int             *capacity_U_ptr,
+                       HYPRE_Int             *u_end_array,
+                       HYPRE_MemoryLocation   memory_location)
+{
+   HYPRE_Real               *A_diag_data     = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int                *A_diag_i        = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int                *A_diag_j        = hypre_CSRMatrixJ(A_diag);
+
+   HYPRE_Int                *L_diag_j        = *L_diag_j_ptr;
+   HYPRE_Real               *L_diag_data     = *L_diag_data_ptr;
+   HYPRE_Int                 capacity_L      = *capacity_L_ptr;
+   HYPRE_Int                *U_diag_j        = *U_diag_j_ptr;
+   HYPRE_Real               *U_diag_data     = *U_diag_data_ptr;
+   HYPRE_Int                 capacity_U      = *capacity_U_ptr;
+
+   HYPRE_Int                 i, ii, ir, j, k1, k2, kl, ku, col, icol, lenl, lenu, lenhu,
+                             lenhlr, lenhll, jpos, jrow, ctrL, ctrU;
+   HYPRE_Real                inorm, itolb, itolef, dpiv, lxu;
+
+   ctrL = L_diag_i[row_start - row_offset];
+   ctrU = U_diag_i[row_start - row_offset];
+
+   for (ii = row_start; ii < row_end; ii++)
+   {
+      /* get real row with perm */
+      i = perm[ii];
+      ir = ii - row_offset;
+      k1 = A_diag_i[i];
+      k2 = A_diag_i[i + 1];
+      kl = ii - 1;
+      /* reset row norm of ith row */
+      inorm = .0;
+      for (j = k1; j < k2; j++)
+      {
+         inorm += hypre_abs(A_diag_data[j]);
+      }
+      if (inorm == .0)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_ARG, "WARNING: ILUT with zero row.\n");
+      }
+      inorm /= (HYPRE_Real)(k2 - k1);
+      /* set the scaled tol for that row */
+      itolb = tol[0] * inorm;
+      itolef = tol[1] * inorm;
+
+      /* reset displacement */
+      lenhll = lenhlr = lenu = 0;
+      w[ii] = 0.0;
+      iw[ii] = ii;
+      /* copy in data from A */
+      for (j = k1; j < k2; j++)
+      {
+         /* get now col number */
+         col = rperm[A_diag_j[j]];
+         if (col < ii)
+         {
+            /* L part of it */
+            iL[lenhll] = col;
+            w[lenhll] = A_diag_data[j];
+            iw[col] = lenhll++;
+            /* add to heap, by col number */
+            hypre_ILUMinHeapAddIRIi(iL, w, iw, lenhll);
+         }
+         else if (col == ii)
+         {
+            w[ii] = A_diag_data[j];
+         }
+         else
+         {
+            lenu++;
+            jpos = lenu + ii;
+            iL[jpos] = col;
+            w[jpos] = A_diag_data[j];
+            iw[col] = jpos;
+         }
+      }
+
+      /*
+       * main elimination
+       * need to maintain 2 heaps for L, one heap for col and one heaps for value
+       * maintian an array for U, and do qsplit with quick sort after that
+       * while the heap of col is greater than zero
+       */
+      while (lenhll > 0)
+      {
+
+         /* get the next row from top of the heap */
+         jrow = iL[0];
+         dpiv = w[0] * D_data[jrow];
+         w[0] = dpiv;
+         /* now remove it from the top of the heap */
+         hypre_ILUMinHeapRemoveIRIi(iL, w, iw, lenhll);
+         lenhll--;
+         /*
+          * reset the drop part to -1
+          * we don't need this iw anymore
+          */
+         iw[jrow] = -1;
+         /* need to keep this one, move to the end of the heap */
+         /* no longer need to maintain iw */
+         hypre_swap2(iL, w, lenhll, kl - lenhlr);
+         lenhlr++;
+         hypre_ILUMaxrHeapAddRabsI(w + kl, iL + kl, lenhlr);
+         /* loop for elimination */
+         ku = U_diag_i[jrow - row_offset + 1];
+         for (j = U_diag_i[jrow - row_offset]; j < ku; j++)
+         {
+            col = U_diag_j[j];
+            icol = iw[col];
+            lxu = - dpiv * U_diag_data[j];
+            /* we don't want to fill small number to empty place */
+            if ((icol == -1) &&
+                ((col < nLU && hypre_abs(lxu) < itolb) || (col >= nLU && hypre_abs(lxu) < itolef)))
+            {
+               continue;
+            }
+            if (icol == -1)
+            {
+               if (col < ii)
+               {
+                  /* L part
+                   * not already in L part
+                   * put it to the end of heap
+                   * might overwrite some small entries, no issue
+                   */
+                  iL[lenhll] = col;
+                  w[lenhll] = lxu;
+                  iw[col] = lenhll++;
+                  /* add to heap, by col number */
+                  hypre_ILUMinHeapAddIRIi(iL, w, iw, lenhll);
+               }
+               else if (col == ii)
+               {
+                  w[ii] += lxu;
+               }
+               else
+               {
+                  /*
+                   * not already in U part
+                   * put is to the end of heap
+                   */
+                  lenu++;
+                  jpos = lenu + ii;
+                  iL[jpos] = col;
+                  w[jpos] = lxu;
+                  iw[col] = jpos;
+               }
+            }
+            else
+            {
+               w[icol] += lxu;
+            }
+         }
+      }/* while loop for the elimination of current row */
+
+      if (hypre_abs(w[ii]) < MAT_TOL)
+      {
+         w[ii] = 1.0e-06;
+      }
+      D_data[ii] = 1. / w[ii];
+      iw[ii] = -1;
+
+      /*
+       * now pick up the largest lfil from L
+       * L part is guarantee to be larger than itol
+       */
+
+      lenl = lenhlr < lfil ? lenhlr : lfil;
+      L_diag_i[ir + 1] = L_diag_i[ir] + lenl;
+      if (lenl > 0)
+      {
+         /* test if memory is enough */
+         while (ctrL + lenl > capacity_L)
+         {
+            HYPRE_Int tmp = capacity_L;
+            capacity_L = (HYPRE_Int)(capacity_L * EXPAND_FACT + 1);
+            L_diag_j = hypre_TReAlloc_v2(L_diag_j, HYPRE_Int, tmp, HYPRE_Int,
+                                         capacity_L, memory_location);
+            L_diag_data = hypre_TReAlloc_v2(L_diag_data, HYPRE_Real, tmp, HYPRE_Real,
+                                            capacity_L, memory_location);
+         }
+         ctrL += lenl;
+
+         /* copy large data in */
+         for (j = L_diag_i[ir]; j < ctrL; j++)
+         {
+            L_diag_j[j] = iL[kl];
+            L_diag_data[j] = w[kl];
+            hypre_ILUMaxrHeapRemoveRabsI(w + kl, iL + kl, lenhlr);
+            lenhlr--;
+         }
+      }
+      /*
+       * now reset working array
+       * L part already reset when move out of heap, only U part
+       */
+      ku = lenu + ii;
+      for (j = ii + 1; j <= ku; j++)
+      {
+         iw[iL[j]] = -1;
+      }
+
+      if (lenu < lfil)
+      {
+         /* we simply keep all of the data, no need to sort */
+         lenhu = lenu;
+      }
+      else
+      {
+         /* need to sort the first small(hopefully) part of it */
+         lenhu = lfil;
+         /* quick split, only sort the first small part of the array */
+         hypre_ILUMaxQSplitRabsI(w, iL, ii + 1, ii + lenhu, ii + lenu);
+      }
+
+      U_diag_i[ir + 1] = U_diag_i[ir] + lenhu;
+      if (lenhu > 0)
+      {
+         /* test if memory is enough */
+         while (ctrU + lenhu > capacity_U)
+         {
+            HYPRE_Int tmp = capacity_U;
+            capacity_U = (HYPRE_Int)(capacity_U * EXPAND_FACT + 1);
+            U_diag_j = hypre_TReAlloc_v2(U_diag_j, HYPRE_Int, tmp, HYPRE_Int,
+                                         capacity_U, memory_location);
+            U_diag_data = hypre_TReAlloc_v2(U_diag_data, HYPRE_Real, tmp, HYPRE_Real,
+                                            capacity_U, memory_location);
+         }
+         ctrU += lenhu;
+         /* copy large data in */
+         for (j = U_diag_i[ir]; j < ctrU; j++)
+         {
+            jpos = ii + 1 + j - U_diag_i[ir];
+            U_diag_j[j] = iL[jpos];
+            U_diag_data[j] = w[jpos];
+         }
+      }
+      /* check and build u_end array */
+      if (m > 0)
+      {
+         hypre_qsort1(U_diag_j, U_diag_data, U_diag_i[ir], U_diag_i[ir + 1] - 1);
+         hypre_BinarySearch2(U_diag_j, nLU, U_diag_i[ir], U_diag_i[ir + 1] - 1, u_end_array + ii);
+      }
+      else
+      {
+         /* Everything is in U */
+         u_end_array[ii] = ctrU;
+      }
+   }/* end of ii loop from row_start to row_end-1 */
 
-   /* set matrix pointers */
-   *Lptr = matL;
-   *Dptr = D_data;
-   *Uptr = matU;
-   *Sptr = matS;
+   *L_diag_j_ptr    = L_diag_j;
+   *L_diag_data_ptr = L_diag_data;
+   *capacity_L_ptr  = capacity_L;
+   *U_diag_j_ptr    = U_diag_j;
+   *U_diag_data_ptr = U_diag_data;
+   *capacity_U_ptr  = capacity_U;
 
    return hypre_error_flag;
 }
@@ -3853,6 +4360,8 @@ hypre_ILUSetupILUK(hypre_ParCSRMatrix  *A,
  * nLU: size of computed LDU factorization.
  *      If nLU < n, Schur complement will be formed
  * nI: number of interial unknowns. nLU should obey nLU <= nI.
+ * num_domains, domain_starts: optional partition of the first nLU rows into
+ *      independent domains followed by a separator, see hypre_ILUSetupILUK.
  * Lptr, Dptr, Uptr: L, D, U factors.
  * Sptr: Schur complement
  *
@@ -3868,6 +4377,8 @@ hypre_ILUSetupILUT(hypre_ParCSRMatrix  *A,
                    HYPRE_Int           *qpermp,
                    HYPRE_Int            nLU,
                    HYPRE_Int            nI,
+                   HYPRE_Int            num_domains,
+                   HYPRE_Int           *domain_starts,
                    hypre_ParCSRMatrix **Lptr,
                    HYPRE_Real         **Dptr,
                    hypre_ParCSRMatrix **Uptr,
@@ -3887,10 +4398,15 @@ hypre_ILUSetupILUT(hypre_ParCSRMatrix  *A,
    HYPRE_Real               local_nnz, total_nnz;
    HYPRE_Int                i, ii, j, k, k1, k2, k3, kl, ku, col, icol, lenl, lenu, lenhu, lenhlr,
                             lenhll, jpos, jrow;
-   HYPRE_Real               inorm, itolb, itolef, itols, dpiv, lxu;
+   HYPRE_Real               inorm, itolef, itols, dpiv, lxu;
    HYPRE_Int                *iw, *iL;
    HYPRE_Real               *w;
 
+   /* per-domain factors for the threaded factorization */
+   HYPRE_Int                d;
+   HYPRE_Int                **dom_L_i, **dom_L_j, **dom_U_i, **dom_U_j;
+   HYPRE_Real               **dom_L_data, **dom_U_data;
+
    /* memory management */
    HYPRE_Int                ctrL;
    HYPRE_Int                ctrU;
@@ -4082,156 +4598,63 @@ hypre_ILUSetupILUT(hypre_ParCSRMatrix  *A,
     */
 
    /* main outer loop for upper part */
-   for (ii = 0; ii < nLU; ii++)
-   {
-      /* get real row with perm */
-      i = perm[ii];
-      k1 = A_diag_i[i];
-      k2 = A_diag_i[i + 1];
-      kl = ii - 1;
-      /* reset row norm of ith row */
-      inorm = .0;
-      for (j = k1; j < k2; j++)
-      {
-         inorm += hypre_abs(A_diag_data[j]);
-      }
-      if (inorm == .0)
+   if (num_domains > 1)
+   {
+      /* Interior domains only couple to themselves and to the separator,
+         so they are factored concurrently into private buffers, each with
+         its own heap work space, and appended to L and U afterwards */
+      dom_L_i    = hypre_TAlloc(HYPRE_Int *,  num_domains, HYPRE_MEMORY_HOST);
+      dom_L_j    = hypre_TAlloc(HYPRE_Int *,  num_domains, HYPRE_MEMORY_HOST);
+      dom_L_data = hypre_TAlloc(HYPRE_Real *, num_domains, HYPRE_MEMORY_HOST);
+      dom_U_i    = hypre_TAlloc(HYPRE_Int *,  num_domains, HYPRE_MEMORY_HOST);
+      dom_U_j    = hypre_TAlloc(HYPRE_Int *,  num_domains, HYPRE_MEMORY_HOST);
+      dom_U_data = hypre_TAlloc(HYPRE_Real *, num_domains, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(d) HYPRE_SMP_SCHEDULE
+#endif
+      for (d = 0; d < num_domains; d++)
       {
-         hypre_error_w_msg(HYPRE_ERROR_ARG, "WARNING: ILUT with zero row.\n");
-      }
-      inorm /= (HYPRE_Real)(k2 - k1);
-      /* set the scaled tol for that row */
-      itolb = tol[0] * inorm;
-      itolef = tol[1] * inorm;
+         HYPRE_Int   d_start = domain_starts[d];
+         HYPRE_Int   d_size  = domain_starts[d + 1] - d_start;
+         HYPRE_Int   d_cap_L = (HYPRE_Int) (((size_t) initial_alloc * (size_t) d_size) /
+                                             (size_t) hypre_max(nLU, 1)) + 1;
+         HYPRE_Int   d_cap_U = d_cap_L;
+         HYPRE_Int  *d_iw    = hypre_TAlloc(HYPRE_Int, 2 * n, HYPRE_MEMORY_HOST);
+         HYPRE_Real *d_w     = hypre_TAlloc(HYPRE_Real, n, HYPRE_MEMORY_HOST);
+         HYPRE_Int   d_k;
 
-      /* reset displacement */
-      lenhll = lenhlr = lenu = 0;
-      w[ii] = 0.0;
-      iw[ii] = ii;
-      /* copy in data from A */
-      for (j = k1; j < k2; j++)
-      {
-         /* get now col number */
-         col = rperm[A_diag_j[j]];
-         if (col < ii)
-         {
-            /* L part of it */
-            iL[lenhll] = col;
-            w[lenhll] = A_diag_data[j];
-            iw[col] = lenhll++;
-            /* add to heap, by col number */
-            hypre_ILUMinHeapAddIRIi(iL, w, iw, lenhll);
-         }
-         else if (col == ii)
-         {
-            w[ii] = A_diag_data[j];
-         }
-         else
+         for (d_k = 0; d_k < n; d_k++)
          {
-            lenu++;
-            jpos = lenu + ii;
-            iL[jpos] = col;
-            w[jpos] = A_diag_data[j];
-            iw[col] = jpos;
+            d_iw[d_k] = -1;
          }
-      }
 
-      /*
-       * main elimination
-       * need to maintain 2 heaps for L, one heap for col and one heaps for value
-       * maintian an array for U, and do qsplit with quick sort after that
-       * while the heap of col is greater than zero
-       */
-      while (lenhll > 0)
-      {
+         dom_L_i[d]    = hypre_CTAlloc(HYPRE_Int, d_size + 1, HYPRE_MEMORY_HOST);
+         dom_U_i[d]    = hypre_CTAlloc(HYPRE_Int, d_size + 1, HYPRE_MEMORY_HOST);
+         dom_L_j[d]    = hypre_TAlloc(HYPRE_Int, d_cap_L, HYPRE_MEMORY_HOST);
+         dom_L_data[d] = hypre_TAlloc(HYPRE_Real, d_cap_L, HYPRE_MEMORY_HOST);
+         dom_U_j[d]    = hypre_TAlloc(HYPRE_Int, d_cap_U, HYPRE_MEMORY_HOST);
+         dom_U_data[d] = hypre_TAlloc(HYPRE_Real, d_cap_U, HYPRE_MEMORY_HOST);
 
-         /* get the next row from top of the heap */
-         jrow = iL[0];
-         dpiv = w[0] * D_data[jrow];
-         w[0] = dpiv;
-         /* now remove it from the top of the heap */
-         hypre_ILUMinHeapRemoveIRIi(iL, w, iw, lenhll);
-         lenhll--;
-         /*
-          * reset the drop part to -1
-          * we don't need this iw anymore
-          */
-         iw[jrow] = -1;
-         /* need to keep this one, move to the end of the heap */
-         /* no longer need to maintain iw */
-         hypre_swap2(iL, w, lenhll, kl - lenhlr);
-         lenhlr++;
-         hypre_ILUMaxrHeapAddRabsI(w + kl, iL + kl, lenhlr);
-         /* loop for elimination */
-         ku = U_diag_i[jrow + 1];
-         for (j = U_diag_i[jrow]; j < ku; j++)
-         {
-            col = U_diag_j[j];
-            icol = iw[col];
-            lxu = - dpiv * U_diag_data[j];
-            /* we don't want to fill small number to empty place */
-            if ((icol == -1) &&
-                ((col < nLU && hypre_abs(lxu) < itolb) || (col >= nLU && hypre_abs(lxu) < itolef)))
-            {
-               continue;
-            }
-            if (icol == -1)
-            {
-               if (col < ii)
-               {
-                  /* L part
-                   * not already in L part
-                   * put it to the end of heap
-                   * might overwrite some small entries, no issue
-                   */
-                  iL[lenhll] = col;
-                  w[lenhll] = lxu;
-                  iw[col] = lenhll++;
-                  /* add to heap, by col number */
-                  hypre_ILUMinHeapAddIRIi(iL, w, iw, lenhll);
-               }
-               else if (col == ii)
-               {
-                  w[ii] += lxu;
-               }
-               else
-               {
-                  /*
-                   * not already in U part
-                   * put is to the end of heap
-                   */
-                  lenu++;
-                  jpos = lenu + ii;
-                  iL[jpos] = col;
-                  w[jpos] = lxu;
-                  iw[col] = jpos;
-               }
-            }
-            else
-            {
-               w[icol] += lxu;
-            }
-         }
-      }/* while loop for the elimination of current row */
+         hypre_ILUSetupILUTRows(d_start, d_start + d_size, d_start, lfil, tol, nLU, m,
+                                A_diag, perm, rperm, d_iw, d_iw + n, d_w, D_data,
+                                dom_L_i[d], &dom_L_j[d], &dom_L_data[d], &d_cap_L,
+                                dom_U_i[d], &dom_U_j[d], &dom_U_data[d], &d_cap_U,
+                                u_end_array, HYPRE_MEMORY_HOST);
 
-      if (hypre_abs(w[ii]) < MAT_TOL)
-      {
-         w[ii] = 1.0e-06;
+         hypre_TFree(d_iw, HYPRE_MEMORY_HOST);
+         hypre_TFree(d_w, HYPRE_MEMORY_HOST);
       }
-      D_data[ii] = 1. / w[ii];
-      iw[ii] = -1;
-
-      /*
-       * now pick up the largest lfil from L
-       * L part is guarantee to be larger than itol
-       */
 
-      lenl = lenhlr < lfil ? lenhlr : lfil;
-      L_diag_i[ii + 1] = L_diag_i[ii] + lenl;
-      if (lenl > 0)
+      /* Append the domain factors to L and U */
+      for (d = 0; d < num_domains; d++)
       {
-         /* test if memory is enough */
-         while (ctrL + lenl > capacity_L)
+         k1 = domain_starts[d];
+         k2 = domain_starts[d + 1] - k1;
+         ctrL = L_diag_i[k1];
+         ctrU = U_diag_i[k1];
+
+         while (ctrL + dom_L_i[d][k2] > capacity_L)
          {
             HYPRE_Int tmp = capacity_L;
             capacity_L = (HYPRE_Int)(capacity_L * EXPAND_FACT + 1);
@@ -4240,45 +4663,7 @@ hypre_ILUSetupILUT(hypre_ParCSRMatrix  *A,
             L_diag_data = hypre_TReAlloc_v2(L_diag_data, HYPRE_Real, tmp, HYPRE_Real,
                                             capacity_L, memory_location);
          }
-         ctrL += lenl;
-
-         /* copy large data in */
-         for (j = L_diag_i[ii]; j < ctrL; j++)
-         {
-            L_diag_j[j] = iL[kl];
-            L_diag_data[j] = w[kl];
-            hypre_ILUMaxrHeapRemoveRabsI(w + kl, iL + kl, lenhlr);
-            lenhlr--;
-         }
-      }
-      /*
-       * now reset working array
-       * L part already reset when move out of heap, only U part
-       */
-      ku = lenu + ii;
-      for (j = ii + 1; j <= ku; j++)
-      {
-         iw[iL[j]] = -1;
-      }
-
-      if (lenu < lfil)
-      {
-         /* we simply keep all of the data, no need to sort */
-         lenhu = lenu;
-      }
-      else
-      {
-         /* need to sort the first small(hopefully) part of it */
-         lenhu = lfil;
-         /* quick split, only sort the first small part of the array */
-         hypre_ILUMaxQSplitRabsI(w, iL, ii + 1, ii + lenhu, ii + lenu);
-      }
-
-      U_diag_i[ii + 1] = U_diag_i[ii] + lenhu;
-      if (lenhu > 0)
-      {
-         /* test if memory is enough */
-         while (ctrU + lenhu > capacity_U)
+         while (ctrU + dom_U_i[d][k2] > capacity_U)
          {
             HYPRE_Int tmp = capacity_U;
             capacity_U = (HYPRE_Int)(capacity_U * EXPAND_FACT + 1);
@@ -4287,28 +4672,53 @@ hypre_ILUSetupILUT(hypre_ParCSRMatrix  *A,
             U_diag_data = hypre_TReAlloc_v2(U_diag_data, HYPRE_Real, tmp, HYPRE_Real,
                                             capacity_U, memory_location);
          }
-         ctrU += lenhu;
-         /* copy large data in */
-         for (j = U_diag_i[ii]; j < ctrU; j++)
-         {
-            jpos = ii + 1 + j - U_diag_i[ii];
-            U_diag_j[j] = iL[jpos];
-            U_diag_data[j] = w[jpos];
-         }
-      }
-      /* check and build u_end array */
-      if (m > 0)
-      {
-         hypre_qsort1(U_diag_j, U_diag_data, U_diag_i[ii], U_diag_i[ii + 1] - 1);
-         hypre_BinarySearch2(U_diag_j, nLU, U_diag_i[ii], U_diag_i[ii + 1] - 1, u_end_array + ii);
-      }
-      else
-      {
-         /* Everything is in U */
-         u_end_array[ii] = ctrU;
-      }
-   }/* end of ii loop from 0 to nLU-1 */
 
+         hypre_TMemcpy(L_diag_j + ctrL, dom_L_j[d], HYPRE_Int, dom_L_i[d][k2],
+                       memory_location, HYPRE_MEMORY_HOST);
+         hypre_TMemcpy(L_diag_data + ctrL, dom_L_data[d], HYPRE_Real, dom_L_i[d][k2],
+                       memory_location, HYPRE_MEMORY_HOST);
+         hypre_TMemcpy(U_diag_j + ctrU, dom_U_j[d], HYPRE_Int, dom_U_i[d][k2],
+                       memory_location, HYPRE_MEMORY_HOST);
+         hypre_TMemcpy(U_diag_data + ctrU, dom_U_data[d], HYPRE_Real, dom_U_i[d][k2],
+                       memory_location, HYPRE_MEMORY_HOST);
+         for (k = 0; k < k2; k++)
+         {
+            L_diag_i[k1 + k + 1]  = ctrL + dom_L_i[d][k + 1];
+            U_diag_i[k1 + k + 1]  = ctrU + dom_U_i[d][k + 1];
+            u_end_array[k1 + k]  += ctrU;
+         }
+
+         hypre_TFree(dom_L_i[d], HYPRE_MEMORY_HOST);
+         hypre_TFree(dom_L_j[d], HYPRE_MEMORY_HOST);
+         hypre_TFree(dom_L_data[d], HYPRE_MEMORY_HOST);
+         hypre_TFree(dom_U_i[d], HYPRE_MEMORY_HOST);
+         hypre_TFree(dom_U_j[d], HYPRE_MEMORY_HOST);
+         hypre_TFree(dom_U_data[d], HYPRE_MEMORY_HOST);
+      }
+      hypre_TFree(dom_L_i, HYPRE_MEMORY_HOST);
+      hypre_TFree(dom_L_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(dom_L_data, HYPRE_MEMORY_HOST);
+      hypre_TFree(dom_U_i, HYPRE_MEMORY_HOST);
+      hypre_TFree(dom_U_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(dom_U_data, HYPRE_MEMORY_HOST);
+
+      /* Separator rows last */
+      hypre_ILUSetupILUTRows(domain_starts[num_domains], nLU, 0, lfil, tol, nLU, m,
+                             A_diag, perm, rperm, iw, iL, w, D_data,
+                             L_diag_i, &L_diag_j, &L_diag_data, &capacity_L,
+                             U_diag_i, &U_diag_j, &U_diag_data, &capacity_U,
+                             u_end_array, memory_location);
+   }
+   else
+   {
+      hypre_ILUSetupILUTRows(0, nLU, 0, lfil, tol, nLU, m,
+                             A_diag, perm, rperm, iw, iL, w, D_data,
+                             L_diag_i, &L_diag_j, &L_diag_data, &capacity_L,
+                             U_diag_i, &U_diag_j, &U_diag_data, &capacity_U,
+                             u_end_array, memory_location);
+   }
+   ctrL = L_diag_i[nLU];
+   ctrU = U_diag_i[nLU];
 
    /* now main loop for Schur comlement part */
    for (ii = nLU; ii < n; ii++)
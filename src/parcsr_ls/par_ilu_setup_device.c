@@ -164,11 +164,12 @@ hypre_ILUSetupILUDevice(HYPRE_Int               ilu_type,
 #endif
          if (ilu_type == 1)
          {
-            hypre_ILUSetupILUK(Apq, lfil, NULL, NULL, n, n, &parL, &parD, &parU, &parS, &uend);
+            hypre_ILUSetupILUK(Apq, lfil, NULL, NULL, n, n, 0, NULL,
+                               &parL, &parD, &parU, &parS, &uend);
          }
          else if (ilu_type == 2)
          {
-            hypre_ILUSetupILUT(Apq, lfil, tol, NULL, NULL, n, n,
+            hypre_ILUSetupILUT(Apq, lfil, tol, NULL, NULL, n, n, 0, NULL,
                                &parL, &parD, &parU, &parS, &uend);
          }
 
@@ -269,7 +269,18 @@ hypre_ILUSolve( void               *ilu_vdata,
 #endif
             {
                /* BJ - hypre_ilu */
-               if (tri_solve == 1)
+               if (tri_solve == 1 && hypre_ParILUDataNumLowerLevels(ilu_data) > 0)
+               {
+                  hypre_ILUSolveLULevels(matA, F_array, U_array, perm, n,
+                                         matL, matD, matU, Utemp, Ftemp,
+                                         hypre_ParILUDataNumLowerLevels(ilu_data),
+                                         hypre_ParILUDataLowerLevelI(ilu_data),
+                                         hypre_ParILUDataLowerLevelJ(ilu_data),
+                                         hypre_ParILUDataNumUpperLevels(ilu_data),
+                                         hypre_ParILUDataUpperLevelI(ilu_data),
+                                         hypre_ParILUDataUpperLevelJ(ilu_data));
+               }
+               else if (tri_solve == 1)
                {
                   hypre_ILUSolveLU(matA, F_array, U_array, perm, n,
                                    matL, matD, matU, Utemp, Ftemp);
@@ -939,6 +950,218 @@ hypre_ILUSolveLU(hypre_ParCSRMatrix *A,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------
+ * hypre_ILUSolveLULevels
+ *
+ * Incomplete LU solve with threaded triangular solves
+ *
+ * Same as hypre_ILUSolveLU, but the rows of L and U are visited level by
+ * level, following the level schedules computed by
+ * hypre_ILUSetupLevelSchedule. The rows of a level are independent and are
+ * shared among the threads. Each row is computed exactly as in the
+ * sequential solve, so the result is bitwise identical.
+ *
+ * Levels with few rows are not worth a synchronization each: a run of
+ * consecutive small levels is processed by a single thread, with one
+ * barrier at its end.
+ *--------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ILUSolveLULevels(hypre_ParCSRMatrix *A,
+                       hypre_ParVector    *f,
+                       hypre_ParVector    *u,
+                       HYPRE_Int          *perm,
+                       HYPRE_Int           nLU,
+                       hypre_ParCSRMatrix *L,
+                       HYPRE_Real         *D,
+                       hypre_ParCSRMatrix *U,
+                       hypre_ParVector    *ftemp,
+                       hypre_ParVector    *utemp,
+                       HYPRE_Int           num_lower_levels,
+                       HYPRE_Int          *lower_level_i,
+                       HYPRE_Int          *lower_level_j,
+                       HYPRE_Int           num_upper_levels,
+                       HYPRE_Int          *upper_level_i,
+                       HYPRE_Int          *upper_level_j)
+{
+   /* data objects for L and U */
+   hypre_CSRMatrix *L_diag      = hypre_ParCSRMatrixDiag(L);
+   HYPRE_Real      *L_diag_data = hypre_CSRMatrixData(L_diag);
+   HYPRE_Int       *L_diag_i    = hypre_CSRMatrixI(L_diag);
+   HYPRE_Int       *L_diag_j    = hypre_CSRMatrixJ(L_diag);
+   hypre_CSRMatrix *U_diag      = hypre_ParCSRMatrixDiag(U);
+   HYPRE_Real      *U_diag_data = hypre_CSRMatrixData(U_diag);
+   HYPRE_Int       *U_diag_i    = hypre_CSRMatrixI(U_diag);
+   HYPRE_Int       *U_diag_j    = hypre_CSRMatrixJ(U_diag);
+
+   /* Vectors */
+   hypre_Vector    *utemp_local = hypre_ParVectorLocalVector(utemp);
+   HYPRE_Real      *utemp_data  = hypre_VectorData(utemp_local);
+   hypre_Vector    *ftemp_local = hypre_ParVectorLocalVector(ftemp);
+   HYPRE_Real      *ftemp_data  = hypre_VectorData(ftemp_local);
+   HYPRE_Real       alpha       = -1.0;
+   HYPRE_Real       beta        = 1.0;
+
+   /* Levels with fewer rows than this are run by a single thread */
+   HYPRE_Int        min_rows    = 16 * hypre_NumThreads();
+
+   /* compute residual */
+   hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A, u, beta, f, ftemp);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel
+#endif
+   {
+      HYPRE_Int  i, ii, j, pi, lev, next;
+
+      /* L solve - Forward solve */
+      /* copy rhs to account for diagonal of L (which is identity) */
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < nLU; i++)
+      {
+         pi = perm ? perm[i] : i;
+         utemp_data[pi] = ftemp_data[pi];
+      }
+
+      /* Update with remaining (off-diagonal) entries of L */
+      for (lev = 0; lev < num_lower_levels; lev = next)
+      {
+         next = lev + 1;
+         if (lower_level_i[next] - lower_level_i[lev] >= min_rows)
+         {
+#ifdef HYPRE_USING_OPENMP
+            #pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+            for (ii = lower_level_i[lev]; ii < lower_level_i[next]; ii++)
+            {
+               i = lower_level_j[ii];
+               if (perm)
+               {
+                  for (j = L_diag_i[i]; j < L_diag_i[i + 1]; j++)
+                  {
+                     utemp_data[perm[i]] -= L_diag_data[j] * utemp_data[perm[L_diag_j[j]]];
+                  }
+               }
+               else
+               {
+                  for (j = L_diag_i[i]; j < L_diag_i[i + 1]; j++)
+                  {
+                     utemp_data[i] -= L_diag_data[j] * utemp_data[L_diag_j[j]];
+                  }
+               }
+            }
+         }
+         else
+         {
+            while (next < num_lower_levels &&
+                   lower_level_i[next + 1] - lower_level_i[next] < min_rows)
+            {
+               next++;
+            }
+
+#ifdef HYPRE_USING_OPENMP
+            #pragma omp single
+#endif
+            for (ii = lower_level_i[lev]; ii < lower_level_i[next]; ii++)
+            {
+               i = lower_level_j[ii];
+               if (perm)
+               {
+                  for (j = L_diag_i[i]; j < L_diag_i[i + 1]; j++)
+                  {
+                     utemp_data[perm[i]] -= L_diag_data[j] * utemp_data[perm[L_diag_j[j]]];
+                  }
+               }
+               else
+               {
+                  for (j = L_diag_i[i]; j < L_diag_i[i + 1]; j++)
+                  {
+                     utemp_data[i] -= L_diag_data[j] * utemp_data[L_diag_j[j]];
+                  }
+               }
+            }
+         }
+      }
+
+      /*-------------------- U solve - Backward substitution */
+      for (lev = 0; lev < num_upper_levels; lev = next)
+      {
+         next = lev + 1;
+         if (upper_level_i[next] - upper_level_i[lev] >= min_rows)
+         {
+#ifdef HYPRE_USING_OPENMP
+            #pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+            for (ii = upper_level_i[lev]; ii < upper_level_i[next]; ii++)
+            {
+               i  = upper_level_j[ii];
+               pi = perm ? perm[i] : i;
+
+               /* first update with the remaining (off-diagonal) entries of U */
+               if (perm)
+               {
+                  for (j = U_diag_i[i]; j < U_diag_i[i + 1]; j++)
+                  {
+                     utemp_data[pi] -= U_diag_data[j] * utemp_data[perm[U_diag_j[j]]];
+                  }
+               }
+               else
+               {
+                  for (j = U_diag_i[i]; j < U_diag_i[i + 1]; j++)
+                  {
+                     utemp_data[pi] -= U_diag_data[j] * utemp_data[U_diag_j[j]];
+                  }
+               }
+
+               /* diagonal scaling (contribution from D. Note: D is stored as its inverse) */
+               utemp_data[pi] *= D[i];
+            }
+         }
+         else
+         {
+            while (next < num_upper_levels &&
+                   upper_level_i[next + 1] - upper_level_i[next] < min_rows)
+            {
+               next++;
+            }
+
+#ifdef HYPRE_USING_OPENMP
+            #pragma omp single
+#endif
+            for (ii = upper_level_i[lev]; ii < upper_level_i[next]; ii++)
+            {
+               i  = upper_level_j[ii];
+               pi = perm ? perm[i] : i;
+
+               if (perm)
+               {
+                  for (j = U_diag_i[i]; j < U_diag_i[i + 1]; j++)
+                  {
+                     utemp_data[pi] -= U_diag_data[j] * utemp_data[perm[U_diag_j[j]]];
+                  }
+               }
+               else
+               {
+                  for (j = U_diag_i[i]; j < U_diag_i[i + 1]; j++)
+                  {
+                     utemp_data[pi] -= U_diag_data[j] * utemp_data[U_diag_j[j]];
+                  }
+               }
+
+               utemp_data[pi] *= D[i];
+            }
+         }
+      }
+   }
+
+   /* Update solution */
+   hypre_ParVectorAxpy(beta, utemp, u);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------
  * hypre_ILUSolveLUIter
  *
@@ -190,6 +190,122 @@ hypre_ParKrylovMassInnerProd( void *x,
                                           (HYPRE_Real*)result ) );
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovIInnerProd
+ *
+ * Starts the nprod inner products <x[k],y[k]> with a single non-blocking
+ * allreduce. The local products are kept in the returned request until
+ * hypre_ParKrylovInnerProdWait has completed the reduction into result.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   hypre_MPI_Request  request;
+   HYPRE_Real        *local_result;
+
+} hypre_ParKrylovInnerProdRequest;
+
+HYPRE_Int
+hypre_ParKrylovIInnerProd( HYPRE_Int    nprod,
+                           void       **x,
+                           void       **y,
+                           HYPRE_Real  *result,
+                           void       **request )
+{
+   hypre_ParVector                 **x_par = (hypre_ParVector **) x;
+   hypre_ParVector                 **y_par = (hypre_ParVector **) y;
+   hypre_ParKrylovInnerProdRequest  *ip_request;
+   HYPRE_Int                         k;
+
+   ip_request = hypre_TAlloc(hypre_ParKrylovInnerProdRequest, 1, HYPRE_MEMORY_HOST);
+   ip_request -> local_result = hypre_TAlloc(HYPRE_Real, nprod, HYPRE_MEMORY_HOST);
+
+   for (k = 0; k < nprod; k++)
+   {
+      (ip_request -> local_result)[k] =
+         hypre_SeqVectorInnerProd(hypre_ParVectorLocalVector(x_par[k]),
+                                  hypre_ParVectorLocalVector(y_par[k]));
+   }
+
+   hypre_MPI_Iallreduce(ip_request -> local_result, result, nprod, HYPRE_MPI_REAL,
+                        hypre_MPI_SUM, hypre_ParVectorComm(x_par[0]), &(ip_request -> request));
+
+   *request = (void *) ip_request;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovInnerProdWait
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovInnerProdWait( void *request )
+{
+   hypre_ParKrylovInnerProdRequest *ip_request = (hypre_ParKrylovInnerProdRequest *) request;
+   hypre_MPI_Status                 status;
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+   hypre_MPI_Wait(&(ip_request -> request), &status);
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+
+   hypre_TFree(ip_request -> local_result, HYPRE_MEMORY_HOST);
+   hypre_TFree(ip_request, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovBlockInnerProd
+ *
+ * Computes result[j*nx+i] = <x[i],y[j]> with a single allreduce.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovBlockInnerProd( void       **x,
+                               HYPRE_Int    nx,
+                               void       **y,
+                               HYPRE_Int    ny,
+                               HYPRE_Real  *result )
+{
+   hypre_ParVector  **x_par = (hypre_ParVector **) x;
+   hypre_ParVector  **y_par = (hypre_ParVector **) y;
+   hypre_Vector     **x_local;
+   HYPRE_Real        *local_result;
+   HYPRE_Int          i, j;
+
+   x_local      = hypre_TAlloc(hypre_Vector *, nx, HYPRE_MEMORY_HOST);
+   local_result = hypre_CTAlloc(HYPRE_Real, nx * ny, HYPRE_MEMORY_HOST);
+
+   for (i = 0; i < nx; i++)
+   {
+      x_local[i] = hypre_ParVectorLocalVector(x_par[i]);
+   }
+   for (j = 0; j < ny; j++)
+   {
+      hypre_SeqVectorMassInnerProd(hypre_ParVectorLocalVector(y_par[j]), x_local, nx, 0,
+                                   &local_result[j * nx]);
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+   hypre_MPI_Allreduce(local_result, result, nx * ny, HYPRE_MPI_REAL,
+                       hypre_MPI_SUM, hypre_ParVectorComm(x_par[0]));
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+
+   hypre_TFree(x_local, HYPRE_MEMORY_HOST);
+   hypre_TFree(local_result, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParKrylovMassDotpTwo
  *--------------------------------------------------------------------------*/
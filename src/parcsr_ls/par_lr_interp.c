@@ -1128,7 +1128,7 @@ hypre_BoomerAMGBuildExtPIInterpHost(hypre_ParCSRMatrix   *A,
 
    /* Threading variables */
    HYPRE_Int my_thread_num, num_threads, start, stop;
-   HYPRE_Int * max_num_threads = hypre_CTAlloc(HYPRE_Int, 1, HYPRE_MEMORY_HOST);
+   HYPRE_Int * max_num_threads = hypre_CTAllocScratch(HYPRE_Int, 1);
    HYPRE_Int * diag_offset;
    HYPRE_Int * fine_to_coarse_offset;
    HYPRE_Int * offd_offset;
@@ -1191,13 +1191,13 @@ hypre_BoomerAMGBuildExtPIInterpHost(hypre_ParCSRMatrix   *A,
 
    if (n_fine)
    {
-      fine_to_coarse = hypre_CTAlloc(HYPRE_Int, n_fine, HYPRE_MEMORY_HOST);
+      fine_to_coarse = hypre_CTAllocScratch(HYPRE_Int, n_fine);
    }
 
    if (full_off_procNodes)
    {
-      fine_to_coarse_offd = hypre_CTAlloc(HYPRE_BigInt, full_off_procNodes, HYPRE_MEMORY_HOST);
-      tmp_CF_marker_offd  = hypre_CTAlloc(HYPRE_Int,    full_off_procNodes, HYPRE_MEMORY_HOST);
+      fine_to_coarse_offd = hypre_CTAllocScratch(HYPRE_BigInt, full_off_procNodes);
+      tmp_CF_marker_offd  = hypre_CTAllocScratch(HYPRE_Int,    full_off_procNodes);
    }
 
    /* This function is smart enough to check P_marker and P_marker_offd only,
@@ -1211,9 +1211,9 @@ hypre_BoomerAMGBuildExtPIInterpHost(hypre_ParCSRMatrix   *A,
     *  Initialize threading variables
     *-----------------------------------------------------------------------*/
    max_num_threads[0] = hypre_NumThreads();
-   diag_offset           = hypre_CTAlloc(HYPRE_Int, max_num_threads[0], HYPRE_MEMORY_HOST);
-   fine_to_coarse_offset = hypre_CTAlloc(HYPRE_Int, max_num_threads[0], HYPRE_MEMORY_HOST);
-   offd_offset           = hypre_CTAlloc(HYPRE_Int, max_num_threads[0], HYPRE_MEMORY_HOST);
+   diag_offset           = hypre_CTAllocScratch(HYPRE_Int, max_num_threads[0]);
+   fine_to_coarse_offset = hypre_CTAllocScratch(HYPRE_Int, max_num_threads[0]);
+   offd_offset           = hypre_CTAllocScratch(HYPRE_Int, max_num_threads[0]);
    for (i = 0; i < max_num_threads[0]; i++)
    {
       diag_offset[i] = 0;
@@ -1252,13 +1252,13 @@ hypre_BoomerAMGBuildExtPIInterpHost(hypre_ParCSRMatrix   *A,
       jj_counter_offd = start_indexing;
       if (n_fine)
       {
-         P_marker = hypre_CTAlloc(HYPRE_Int,  n_fine, HYPRE_MEMORY_HOST);
+         P_marker = hypre_CTAllocScratch(HYPRE_Int,  n_fine);
          for (i = 0; i < n_fine; i++)
          {  P_marker[i] = -1; }
       }
       if (full_off_procNodes)
       {
-         P_marker_offd = hypre_CTAlloc(HYPRE_Int,  full_off_procNodes, HYPRE_MEMORY_HOST);
+         P_marker_offd = hypre_CTAllocScratch(HYPRE_Int,  full_off_procNodes);
          for (i = 0; i < full_off_procNodes; i++)
          {  P_marker_offd[i] = -1;}
       }
@@ -1806,12 +1806,12 @@ hypre_BoomerAMGBuildExtPIInterpHost(hypre_ParCSRMatrix   *A,
 
       if (n_fine)
       {
-         hypre_TFree(P_marker, HYPRE_MEMORY_HOST);
+         hypre_TFreeScratch(P_marker);
       }
 
       if (full_off_procNodes)
       {
-         hypre_TFree(P_marker_offd, HYPRE_MEMORY_HOST);
+         hypre_TFreeScratch(P_marker_offd);
       }
    }
    /*-----------------------------------------------------------------------
@@ -1894,19 +1894,19 @@ hypre_BoomerAMGBuildExtPIInterpHost(hypre_ParCSRMatrix   *A,
    *P_ptr = P;
 
    /* Deallocate memory */
-   hypre_TFree(max_num_threads, HYPRE_MEMORY_HOST);
-   hypre_TFree(fine_to_coarse, HYPRE_MEMORY_HOST);
-   hypre_TFree(diag_offset, HYPRE_MEMORY_HOST);
-   hypre_TFree(offd_offset, HYPRE_MEMORY_HOST);
-   hypre_TFree(fine_to_coarse_offset, HYPRE_MEMORY_HOST);
+   hypre_TFreeScratch(max_num_threads);
+   hypre_TFreeScratch(fine_to_coarse);
+   hypre_TFreeScratch(diag_offset);
+   hypre_TFreeScratch(offd_offset);
+   hypre_TFreeScratch(fine_to_coarse_offset);
 
    if (num_procs > 1)
    {
       hypre_CSRMatrixDestroy(Sop);
       hypre_CSRMatrixDestroy(A_ext);
-      hypre_TFree(fine_to_coarse_offd, HYPRE_MEMORY_HOST);
+      hypre_TFreeScratch(fine_to_coarse_offd);
       hypre_TFree(CF_marker_offd, HYPRE_MEMORY_HOST);
-      hypre_TFree(tmp_CF_marker_offd, HYPRE_MEMORY_HOST);
+      hypre_TFreeScratch(tmp_CF_marker_offd);
       if (num_functions > 1)
       {
          hypre_TFree(dof_func_offd, HYPRE_MEMORY_HOST);
@@ -4929,15 +4929,15 @@ hypre_BoomerAMGBuildExtInterpHost(hypre_ParCSRMatrix  *A,
 
    if (n_fine)
    {
-      fine_to_coarse = hypre_CTAlloc(HYPRE_Int,  n_fine, HYPRE_MEMORY_HOST);
-      P_marker       = hypre_CTAlloc(HYPRE_Int,  n_fine, HYPRE_MEMORY_HOST);
+      fine_to_coarse = hypre_CTAllocScratch(HYPRE_Int,  n_fine);
+      P_marker       = hypre_CTAllocScratch(HYPRE_Int,  n_fine);
    }
 
    if (full_off_procNodes)
    {
-      P_marker_offd       = hypre_CTAlloc(HYPRE_Int,    full_off_procNodes, HYPRE_MEMORY_HOST);
-      fine_to_coarse_offd = hypre_CTAlloc(HYPRE_BigInt, full_off_procNodes, HYPRE_MEMORY_HOST);
-      tmp_CF_marker_offd  = hypre_CTAlloc(HYPRE_Int,    full_off_procNodes, HYPRE_MEMORY_HOST);
+      P_marker_offd       = hypre_CTAllocScratch(HYPRE_Int,    full_off_procNodes);
+      fine_to_coarse_offd = hypre_CTAllocScratch(HYPRE_BigInt, full_off_procNodes);
+      tmp_CF_marker_offd  = hypre_CTAllocScratch(HYPRE_Int,    full_off_procNodes);
    }
 
    hypre_initialize_vecs(n_fine, full_off_procNodes, fine_to_coarse,
@@ -5488,17 +5488,17 @@ hypre_BoomerAMGBuildExtInterpHost(hypre_ParCSRMatrix  *A,
    *P_ptr = P;
 
    /* Deallocate memory */
-   hypre_TFree(fine_to_coarse, HYPRE_MEMORY_HOST);
-   hypre_TFree(P_marker,       HYPRE_MEMORY_HOST);
+   hypre_TFreeScratch(fine_to_coarse);
+   hypre_TFreeScratch(P_marker);
 
    if (num_procs > 1)
    {
       hypre_CSRMatrixDestroy(Sop);
       hypre_CSRMatrixDestroy(A_ext);
-      hypre_TFree(fine_to_coarse_offd, HYPRE_MEMORY_HOST);
-      hypre_TFree(P_marker_offd,       HYPRE_MEMORY_HOST);
+      hypre_TFreeScratch(fine_to_coarse_offd);
+      hypre_TFreeScratch(P_marker_offd);
       hypre_TFree(CF_marker_offd,      HYPRE_MEMORY_HOST);
-      hypre_TFree(tmp_CF_marker_offd,  HYPRE_MEMORY_HOST);
+      hypre_TFreeScratch(tmp_CF_marker_offd);
       if (num_functions > 1)
       {
          hypre_TFree(dof_func_offd, HYPRE_MEMORY_HOST);
@@ -576,11 +576,10 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
 
          if (num_cols_offd_Pext || num_cols_diag_P)
          {
-            P_mark_array[ii] = hypre_CTAlloc(HYPRE_Int,  num_cols_diag_P + num_cols_offd_Pext,
-                                             HYPRE_MEMORY_HOST);
+            P_mark_array[ii] = hypre_CTAllocScratch(HYPRE_Int,  num_cols_diag_P + num_cols_offd_Pext);
             P_marker = P_mark_array[ii];
          }
-         A_mark_array[ii] = hypre_CTAlloc(HYPRE_Int,  num_nz_cols_A, HYPRE_MEMORY_HOST);
+         A_mark_array[ii] = hypre_CTAllocScratch(HYPRE_Int,  num_nz_cols_A);
          A_marker = A_mark_array[ii];
          /*-----------------------------------------------------------------------
           *  Initialize some stuff.
@@ -1019,11 +1018,11 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
                }
             }
          }
+         hypre_TFreeScratch(A_mark_array[ii]);
          if (num_cols_offd_Pext || num_cols_diag_P)
          {
-            hypre_TFree(P_mark_array[ii], HYPRE_MEMORY_HOST);
+            hypre_TFreeScratch(P_mark_array[ii]);
          }
-         hypre_TFree(A_mark_array[ii], HYPRE_MEMORY_HOST);
       }
 
       RAP_int = hypre_CSRMatrixCreate(num_cols_offd_RT, num_rows_offd_RT, RAP_size);
@@ -1232,9 +1231,8 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
          ne = (ii + 1) * size + rest;
       }
 
-      P_mark_array[ii] = hypre_CTAlloc(HYPRE_Int,  num_cols_diag_P + num_cols_offd_RAP,
-                                       HYPRE_MEMORY_HOST);
-      A_mark_array[ii] = hypre_CTAlloc(HYPRE_Int,  num_nz_cols_A, HYPRE_MEMORY_HOST);
+      P_mark_array[ii] = hypre_CTAllocScratch(HYPRE_Int,  num_cols_diag_P + num_cols_offd_RAP);
+      A_mark_array[ii] = hypre_CTAllocScratch(HYPRE_Int,  num_nz_cols_A);
       P_marker = P_mark_array[ii];
       A_marker = A_mark_array[ii];
       jj_count_diag = start_indexing;
@@ -1916,8 +1914,8 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
             } // num_cols_offd_P
          } // loop over entries in row ic of RA_diag.
       } // Loop over interior c-points.
-      hypre_TFree(P_mark_array[ii], HYPRE_MEMORY_HOST);
-      hypre_TFree(A_mark_array[ii], HYPRE_MEMORY_HOST);
+      hypre_TFreeScratch(A_mark_array[ii]);
+      hypre_TFreeScratch(P_mark_array[ii]);
    } // omp parallel for
 
    /* check if really all off-diagonal entries occurring in col_map_offd_RAP
@@ -2089,3 +2087,66 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
 
    return (0);
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGBuildCoarseOperatorReuse
+ *
+ * Computes RAP = P^T * (A * P) with two host products whose symbolic data
+ * is kept in *AP_data_ptr and *RAP_data_ptr. Later calls with matrices of
+ * the same patterns (values-only AMG re-setups) only run the numeric phases.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGBuildCoarseOperatorReuse( hypre_ParCSRMatrix      *P,
+                                         hypre_ParCSRMatrix      *A,
+                                         HYPRE_Int                keepTranspose,
+                                         hypre_ParCSRMatMatData **AP_data_ptr,
+                                         hypre_ParCSRMatMatData **RAP_data_ptr,
+                                         hypre_ParCSRMatrix     **RAP_ptr )
+{
+   MPI_Comm             comm = hypre_ParCSRMatrixComm(A);
+   hypre_ParCSRMatrix  *PT   = NULL;
+   hypre_ParCSRMatrix  *AP;
+   hypre_ParCSRMatrix  *RAP  = NULL;
+   hypre_CSRMatrix     *P_diagT;
+   hypre_CSRMatrix     *P_offdT;
+   HYPRE_Int            num_procs;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   hypre_ParCSRMatrixTranspose(P, &PT, 1);
+
+   AP = hypre_ParCSRMatMatReuseHost(A, P, AP_data_ptr);
+   if (AP)
+   {
+      RAP = hypre_ParCSRMatMatReuseHost(PT, AP, RAP_data_ptr);
+      hypre_ParCSRMatrixDestroy(AP);
+   }
+   hypre_ParCSRMatrixDestroy(PT);
+
+   if (!RAP)
+   {
+      *RAP_ptr = NULL;
+      return hypre_error_flag;
+   }
+
+   if (num_procs > 1)
+   {
+      hypre_MatvecCommPkgCreate(RAP);
+   }
+
+   if (keepTranspose)
+   {
+      hypre_CSRMatrixTranspose(hypre_ParCSRMatrixDiag(P), &P_diagT, 1);
+      hypre_ParCSRMatrixDiagT(P) = P_diagT;
+      if (hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(P)))
+      {
+         hypre_CSRMatrixTranspose(hypre_ParCSRMatrixOffd(P), &P_offdT, 1);
+         hypre_ParCSRMatrixOffdT(P) = P_offdT;
+      }
+   }
+
+   *RAP_ptr = RAP;
+
+   return hypre_error_flag;
+}
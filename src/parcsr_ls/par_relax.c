@@ -67,6 +67,9 @@ hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
     *     relax_type = 18 -> L1-Jacobi [GPU-supported through call to relax7Jacobi]
     *     relax_type = 21 -> the same as 8 except forcing serialization on CPU (#OMP-thread = 1)
     *     relax_type = 30 -> Kaczmarz
+    *     relax_type = 31 -> multicolor hybrid Gauss-Seidel (colors computed per call)
+    *     relax_type = 32 -> multicolor hybrid Gauss-Seidel, reverse color order
+    *     relax_type = 33 -> multicolor hybrid symmetric Gauss-Seidel
     *     relax_type = 88 -> convergent version of SSOR (option 8)
     *     relax_type = 89 -> L1 Symm. hybrid Gauss-Seidel
     *-------------------------------------------------------------------------------------*/
@@ -160,6 +163,12 @@ hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
          hypre_BoomerAMGRelaxKaczmarz(A, f, omega, l1_norms, u);
          break;
 
+      case 31: /* multicolor hybrid Gauss-Seidel */
+      case 32:
+      case 33:
+         hypre_BoomerAMGRelaxMulticolorOnce(A, f, relax_type, relax_weight, u, Vtemp);
+         break;
+
       case 89: /* L1 Symm. hybrid Gauss-Seidel */
          hypre_BoomerAMGRelax89HybridL1SSOR(A, f, cf_marker, relax_points,
                                             relax_weight, omega, l1_norms, u,
@@ -201,25 +210,34 @@ hypre_BoomerAMGRelaxWeightedJacobi_core( hypre_ParCSRMatrix *A,
    HYPRE_Int            num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
    hypre_Vector        *u_local       = hypre_ParVectorLocalVector(u);
    HYPRE_Complex       *u_data        = hypre_VectorData(u_local);
+   HYPRE_Int            num_vectors   = hypre_VectorNumVectors(u_local);
+   HYPRE_Int            vecstride     = hypre_VectorVectorStride(u_local);
+   HYPRE_Int            idxstride     = hypre_VectorIndexStride(u_local);
    hypre_Vector        *f_local       = hypre_ParVectorLocalVector(f);
    HYPRE_Complex       *f_data        = hypre_VectorData(f_local);
+   HYPRE_Int            f_vecstride   = hypre_VectorVectorStride(f_local);
+   HYPRE_Int            f_idxstride   = hypre_VectorIndexStride(f_local);
    hypre_Vector        *Vtemp_local   = hypre_ParVectorLocalVector(Vtemp);
    HYPRE_Complex       *Vtemp_data    = hypre_VectorData(Vtemp_local);
    HYPRE_Complex       *v_ext_data    = NULL;
    HYPRE_Complex       *v_buf_data    = NULL;
 
+   hypre_float         *A_diag_data_s = hypre_CSRMatrixDataSingle(A_diag);
+   hypre_float         *A_offd_data_s = hypre_CSRMatrixDataSingle(A_offd);
+   HYPRE_Int            use_single    = A_diag_data_s &&
+                                        (A_offd_data_s || !hypre_CSRMatrixNumNonzeros(A_offd));
+
    HYPRE_Complex        zero             = 0.0;
    HYPRE_Real           one_minus_weight = 1.0 - relax_weight;
    HYPRE_Complex        res;
 
-   HYPRE_Int num_procs, my_id, i, j, ii, jj, index, num_sends, start;
+   HYPRE_Int num_procs, my_id, i, j, k, ii, jj, index, num_sends, start;
    hypre_ParCSRCommHandle *comm_handle;
 
    /* Sanity check */
-   if (hypre_ParVectorNumVectors(f) > 1)
+   if (hypre_ParVectorNumVectors(f) != num_vectors)
    {
-      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
-                        "Jacobi relaxation doesn't support multicomponent vectors");
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "num_vectors for u and f do not match!");
       return hypre_error_flag;
    }
 
@@ -228,10 +246,12 @@ hypre_BoomerAMGRelaxWeightedJacobi_core( hypre_ParCSRMatrix *A,
 
    if (num_procs > 1)
    {
+      /* Multivectors are exchanged at once (interleaved in v_ext_data) */
+      hypre_ParCSRCommPkgUpdateVecStarts(comm_pkg, u);
       num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
       v_buf_data = hypre_CTAlloc(HYPRE_Real, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
                                  HYPRE_MEMORY_HOST);
-      v_ext_data = hypre_CTAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
+      v_ext_data = hypre_CTAlloc(HYPRE_Real, num_cols_offd * num_vectors, HYPRE_MEMORY_HOST);
 
       index = 0;
       for (i = 0; i < num_sends; i++)
@@ -250,11 +270,14 @@ hypre_BoomerAMGRelaxWeightedJacobi_core( hypre_ParCSRMatrix *A,
     * Copy current approximation into temporary vector.
     *-----------------------------------------------------------------*/
 #ifdef HYPRE_USING_OPENMP
-   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+   #pragma omp parallel for private(i, k) HYPRE_SMP_SCHEDULE
 #endif
    for (i = 0; i < num_rows; i++)
    {
-      Vtemp_data[i] = u_data[i];
+      for (k = 0; k < num_vectors; k++)
+      {
+         Vtemp_data[i * idxstride + k * vecstride] = u_data[i * idxstride + k * vecstride];
+      }
    }
 
    if (num_procs > 1)
@@ -266,40 +289,128 @@ hypre_BoomerAMGRelaxWeightedJacobi_core( hypre_ParCSRMatrix *A,
    /*-----------------------------------------------------------------
     * Relax all points.
     *-----------------------------------------------------------------*/
+   if (num_vectors > 1)
+   {
+      /* Multivector case: read each row of A once for all vectors */
 #ifdef HYPRE_USING_OPENMP
-   #pragma omp parallel for private(i,ii,jj,res) HYPRE_SMP_SCHEDULE
+      #pragma omp parallel private(i,ii,jj,k)
 #endif
-   for (i = 0; i < num_rows; i++)
-   {
-      const HYPRE_Complex di = l1_norms ? l1_norms[i] : A_diag_data[A_diag_i[i]];
-
-      /*-----------------------------------------------------------
-       * If i is of the right type ( C or F or All ) and diagonal is
-       * nonzero, relax point i; otherwise, skip it.
-       * Relax only C or F points as determined by relax_points.
-       *-----------------------------------------------------------*/
-      if ( (relax_points == 0 || cf_marker[i] == relax_points) && di != zero )
       {
-         res = f_data[i];
-         for (jj = A_diag_i[i] + Skip_diag; jj < A_diag_i[i + 1]; jj++)
-         {
-            ii = A_diag_j[jj];
-            res -= A_diag_data[jj] * Vtemp_data[ii];
-         }
-         for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+         HYPRE_Complex *res_mv = hypre_TAlloc(HYPRE_Complex, num_vectors, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < num_rows; i++)
          {
-            ii = A_offd_j[jj];
-            res -= A_offd_data[jj] * v_ext_data[ii];
+            const HYPRE_Complex di = l1_norms ? l1_norms[i] : A_diag_data[A_diag_i[i]];
+
+            if ( (relax_points == 0 || cf_marker[i] == relax_points) && di != zero )
+            {
+               for (k = 0; k < num_vectors; k++)
+               {
+                  res_mv[k] = f_data[i * f_idxstride + k * f_vecstride];
+               }
+               for (jj = A_diag_i[i] + Skip_diag; jj < A_diag_i[i + 1]; jj++)
+               {
+                  ii = A_diag_j[jj];
+                  for (k = 0; k < num_vectors; k++)
+                  {
+                     res_mv[k] -= A_diag_data[jj] * Vtemp_data[ii * idxstride + k * vecstride];
+                  }
+               }
+               for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+               {
+                  ii = A_offd_j[jj];
+                  for (k = 0; k < num_vectors; k++)
+                  {
+                     res_mv[k] -= A_offd_data[jj] * v_ext_data[ii * num_vectors + k];
+                  }
+               }
+
+               for (k = 0; k < num_vectors; k++)
+               {
+                  if (Skip_diag)
+                  {
+                     u_data[i * idxstride + k * vecstride] *= one_minus_weight;
+                  }
+                  u_data[i * idxstride + k * vecstride] += relax_weight * res_mv[k] / di;
+               }
+            }
          }
 
-         if (Skip_diag)
+         hypre_TFree(res_mv, HYPRE_MEMORY_HOST);
+      }
+   }
+   else if (use_single)
+   {
+      /* Same as below, reading single-precision matrix values */
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i,ii,jj,res) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         const HYPRE_Complex di = l1_norms ? l1_norms[i] : A_diag_data_s[A_diag_i[i]];
+
+         if ( (relax_points == 0 || cf_marker[i] == relax_points) && di != zero )
          {
-            u_data[i] *= one_minus_weight;
+            res = f_data[i];
+            for (jj = A_diag_i[i] + Skip_diag; jj < A_diag_i[i + 1]; jj++)
+            {
+               ii = A_diag_j[jj];
+               res -= A_diag_data_s[jj] * Vtemp_data[ii];
+            }
+            for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+            {
+               ii = A_offd_j[jj];
+               res -= A_offd_data_s[jj] * v_ext_data[ii];
+            }
+
+            if (Skip_diag)
+            {
+               u_data[i] *= one_minus_weight;
+            }
             u_data[i] += relax_weight * res / di;
          }
-         else
+      }
+   }
+   else
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i,ii,jj,res) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         const HYPRE_Complex di = l1_norms ? l1_norms[i] : A_diag_data[A_diag_i[i]];
+
+         /*-----------------------------------------------------------
+          * If i is of the right type ( C or F or All ) and diagonal is
+          * nonzero, relax point i; otherwise, skip it.
+          * Relax only C or F points as determined by relax_points.
+          *-----------------------------------------------------------*/
+         if ( (relax_points == 0 || cf_marker[i] == relax_points) && di != zero )
          {
-            u_data[i] += relax_weight * res / di;
+            res = f_data[i];
+            for (jj = A_diag_i[i] + Skip_diag; jj < A_diag_i[i + 1]; jj++)
+            {
+               ii = A_diag_j[jj];
+               res -= A_diag_data[jj] * Vtemp_data[ii];
+            }
+            for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+            {
+               ii = A_offd_j[jj];
+               res -= A_offd_data[jj] * v_ext_data[ii];
+            }
+
+            if (Skip_diag)
+            {
+               u_data[i] *= one_minus_weight;
+               u_data[i] += relax_weight * res / di;
+            }
+            else
+            {
+               u_data[i] += relax_weight * res / di;
+            }
          }
       }
    }
@@ -734,12 +845,20 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
    hypre_MPI_Comm_rank(comm, &my_id);
    num_threads = forced_seq ? 1 : hypre_NumThreads();
 
-   /* Sanity check */
+   /* Multivectors are relaxed all at once */
    if (hypre_ParVectorNumVectors(f) > 1)
    {
-      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
-                        "Hybrid GS relaxation doesn't support multicomponent vectors");
-      return hypre_error_flag;
+      if (Topo_order)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                           "Ordered GS relaxation doesn't support multicomponent vectors");
+         return hypre_error_flag;
+      }
+
+      return hypre_BoomerAMGRelaxHybridGaussSeidelMultiVec(A, f, cf_marker, relax_points,
+                                                           relax_weight, omega, l1_norms,
+                                                           u, Vtemp, GS_order, Symm,
+                                                           Skip_diag, forced_seq);
    }
 
    /* GS order: forward or backward */
@@ -750,6 +869,11 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
    const HYPRE_Int non_scale = relax_weight == 1.0 && omega == 1.0;
    /* */
    const HYPRE_Real prod = 1.0 - relax_weight * omega;
+   /* single-precision matrix values, if available (see hypre_ParCSRMatrixSetSinglePrecision) */
+   hypre_float *A_diag_data_single = hypre_CSRMatrixDataSingle(A_diag);
+   hypre_float *A_offd_data_single = hypre_CSRMatrixDataSingle(A_offd);
+   const HYPRE_Int use_single = A_diag_data_single && non_scale && !Topo_order &&
+                                (A_offd_data_single || !hypre_CSRMatrixNumNonzeros(A_offd));
 
    /*
    if (num_threads > 1)
@@ -771,6 +895,8 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
          comm_pkg = hypre_ParCSRMatrixCommPkg(A);
       }
 
+      /* The comm. package may still describe multivectors from a previous call */
+      hypre_ParCSRCommPkgUpdateVecStarts(comm_pkg, u);
       num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
 
 #if defined(HYPRE_USING_PERSISTENT_COMM)
@@ -868,7 +994,14 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
             const HYPRE_Int ibegin = iorder > 0 ? ns : ne - 1;
             const HYPRE_Int iend = iorder > 0 ? ne : ns - 1;
 
-            if (non_scale)
+            if (use_single)
+            {
+               hypre_HybridGaussSeidelNSSingle(A_diag_i, A_diag_j, A_diag_data_single, A_offd_i, A_offd_j,
+                                               A_offd_data_single, f_data, cf_marker, relax_points, l1_norms,
+                                               u_data, Vtemp_data, v_ext_data, ns, ne, ibegin, iend, iorder,
+                                               Skip_diag);
+            }
+            else if (non_scale)
             {
                hypre_HybridGaussSeidelNSThreads(A_diag_i, A_diag_j, A_diag_data, A_offd_i, A_offd_j, A_offd_data,
                                                 f_data, cf_marker, relax_points, l1_norms, u_data, Vtemp_data, v_ext_data,
@@ -900,7 +1033,14 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
          }
          else
          {
-            if (non_scale)
+            if (use_single)
+            {
+               hypre_HybridGaussSeidelNSSingle(A_diag_i, A_diag_j, A_diag_data_single, A_offd_i, A_offd_j,
+                                               A_offd_data_single, f_data, cf_marker, relax_points, l1_norms,
+                                               u_data, Vtemp_data, v_ext_data, 0, num_rows, ibegin, iend,
+                                               iorder, Skip_diag);
+            }
+            else if (non_scale)
             {
                hypre_HybridGaussSeidelNS(A_diag_i, A_diag_j, A_diag_data, A_offd_i, A_offd_j, A_offd_data,
                                          f_data, cf_marker, relax_points, l1_norms, u_data, Vtemp_data, v_ext_data,
@@ -931,6 +1071,182 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxHybridGaussSeidelMultiVec
+ *
+ * Host hybrid GS for multivectors. Each row of A is read once per sweep
+ * and applied to all vectors of u. Same options as the scalar core.
+ *--------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxHybridGaussSeidelMultiVec( hypre_ParCSRMatrix *A,
+                                               hypre_ParVector    *f,
+                                               HYPRE_Int          *cf_marker,
+                                               HYPRE_Int           relax_points,
+                                               HYPRE_Real          relax_weight,
+                                               HYPRE_Real          omega,
+                                               HYPRE_Real         *l1_norms,
+                                               hypre_ParVector    *u,
+                                               hypre_ParVector    *Vtemp,
+                                               HYPRE_Int           GS_order,
+                                               HYPRE_Int           Symm,
+                                               HYPRE_Int           Skip_diag,
+                                               HYPRE_Int           forced_seq )
+{
+   MPI_Comm             comm          = hypre_ParCSRMatrixComm(A);
+   hypre_CSRMatrix     *A_diag        = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Real          *A_diag_data   = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int           *A_diag_i      = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int           *A_diag_j      = hypre_CSRMatrixJ(A_diag);
+   hypre_CSRMatrix     *A_offd        = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int           *A_offd_i      = hypre_CSRMatrixI(A_offd);
+   HYPRE_Real          *A_offd_data   = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int           *A_offd_j      = hypre_CSRMatrixJ(A_offd);
+   hypre_ParCSRCommPkg *comm_pkg      = hypre_ParCSRMatrixCommPkg(A);
+   HYPRE_Int            num_rows      = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int            num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
+   hypre_Vector        *u_local       = hypre_ParVectorLocalVector(u);
+   HYPRE_Complex       *u_data        = hypre_VectorData(u_local);
+   HYPRE_Int            num_vectors   = hypre_VectorNumVectors(u_local);
+   HYPRE_Int            vecstride     = hypre_VectorVectorStride(u_local);
+   HYPRE_Int            idxstride     = hypre_VectorIndexStride(u_local);
+   hypre_Vector        *f_local       = hypre_ParVectorLocalVector(f);
+   HYPRE_Complex       *f_data        = hypre_VectorData(f_local);
+   HYPRE_Int            f_vecstride   = hypre_VectorVectorStride(f_local);
+   HYPRE_Int            f_idxstride   = hypre_VectorIndexStride(f_local);
+   HYPRE_Complex       *Vtemp_data    = Vtemp ? hypre_VectorData(hypre_ParVectorLocalVector(Vtemp)) : NULL;
+   HYPRE_Complex       *v_ext_data    = NULL;
+   HYPRE_Complex       *v_buf_data    = NULL;
+
+   hypre_ParCSRCommHandle *comm_handle;
+   HYPRE_Int            num_procs, num_threads, i, j, k, num_sends;
+
+   /* GS order: forward or backward */
+   const HYPRE_Int gs_order = GS_order > 0 ? 1 : -1;
+   /* for symmetric GS, a forward followed by a backward */
+   const HYPRE_Int num_sweeps = Symm ? 2 : 1;
+   /* if relax_weight and omega are both 1.0 */
+   const HYPRE_Int non_scale = relax_weight == 1.0 && omega == 1.0;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   num_threads = forced_seq ? 1 : hypre_NumThreads();
+
+   if (hypre_ParVectorNumVectors(u) != num_vectors)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "num_vectors for u and f do not match!");
+      return hypre_error_flag;
+   }
+
+   if ((num_threads > 1 || !non_scale) && !Vtemp_data)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Multivector hybrid GS needs a work vector!");
+      return hypre_error_flag;
+   }
+
+   /*-----------------------------------------------------------------
+    * Exchange the halo of all vectors at once
+    *-----------------------------------------------------------------*/
+   if (num_procs > 1)
+   {
+#ifdef HYPRE_PROFILE
+      hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
+#endif
+
+      if (!comm_pkg)
+      {
+         hypre_MatvecCommPkgCreate(A);
+         comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+      }
+
+      hypre_ParCSRCommPkgUpdateVecStarts(comm_pkg, u);
+      num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+
+      v_buf_data = hypre_CTAlloc(HYPRE_Complex,
+                                 hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                                 HYPRE_MEMORY_HOST);
+      v_ext_data = hypre_CTAlloc(HYPRE_Complex, num_cols_offd * num_vectors, HYPRE_MEMORY_HOST);
+
+      HYPRE_Int begin = hypre_ParCSRCommPkgSendMapStart(comm_pkg, 0);
+      HYPRE_Int end   = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for HYPRE_SMP_SCHEDULE
+#endif
+      for (j = begin; j < end; j++)
+      {
+         v_buf_data[j - begin] = u_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, j)];
+      }
+
+#ifdef HYPRE_PROFILE
+      hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] += hypre_MPI_Wtime();
+      hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+      comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, v_buf_data, v_ext_data);
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+
+#ifdef HYPRE_PROFILE
+      hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+#endif
+   }
+
+   /*-----------------------------------------------------------------
+    * Relax all points.
+    *-----------------------------------------------------------------*/
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_RELAX] -= hypre_MPI_Wtime();
+#endif
+
+   if ( (num_threads > 1 || !non_scale) && Vtemp_data )
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i, k) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         for (k = 0; k < num_vectors; k++)
+         {
+            Vtemp_data[i * idxstride + k * vecstride] = u_data[i * idxstride + k * vecstride];
+         }
+      }
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
+#endif
+   for (j = 0; j < num_threads; j++)
+   {
+      HYPRE_Complex *res = hypre_TAlloc(HYPRE_Complex, 3 * num_vectors, HYPRE_MEMORY_HOST);
+      HYPRE_Int      ns, ne, sweep;
+
+      hypre_partition1D(num_rows, num_threads, j, &ns, &ne);
+
+      for (sweep = 0; sweep < num_sweeps; sweep++)
+      {
+         const HYPRE_Int iorder = num_sweeps == 1 ? gs_order : sweep == 0 ? 1 : -1;
+         const HYPRE_Int ibegin = iorder > 0 ? ns : ne - 1;
+         const HYPRE_Int iend = iorder > 0 ? ne : ns - 1;
+
+         hypre_HybridGaussSeidelMultiVec(A_diag_i, A_diag_j, A_diag_data, A_offd_i, A_offd_j,
+                                         A_offd_data, f_data, f_vecstride, f_idxstride,
+                                         cf_marker, relax_points, relax_weight, omega, non_scale,
+                                         l1_norms, u_data, Vtemp_data, vecstride, idxstride,
+                                         v_ext_data, num_vectors, res, ns, ne, ibegin, iend,
+                                         iorder, Skip_diag);
+      }
+
+      hypre_TFree(res, HYPRE_MEMORY_HOST);
+   }
+
+   hypre_TFree(v_ext_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_RELAX] += hypre_MPI_Wtime();
+#endif
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------
  * hypre_BoomerAMGRelax3HybridGaussSeidel
  *
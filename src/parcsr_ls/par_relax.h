@@ -218,6 +218,72 @@ hypre_HybridGaussSeidelNSThreads( HYPRE_Int     *A_diag_i,
    }
 }
 
+/* Non-Scale version reading single-precision matrix values. Columns in
+   [ns, ne) are read from u_data, the other local columns from v_tmp_data */
+static inline void
+hypre_HybridGaussSeidelNSSingle( HYPRE_Int     *A_diag_i,
+                                 HYPRE_Int     *A_diag_j,
+                                 hypre_float   *A_diag_data,
+                                 HYPRE_Int     *A_offd_i,
+                                 HYPRE_Int     *A_offd_j,
+                                 hypre_float   *A_offd_data,
+                                 HYPRE_Complex *f_data,
+                                 HYPRE_Int     *cf_marker,
+                                 HYPRE_Int      relax_points,
+                                 HYPRE_Complex *l1_norms,
+                                 HYPRE_Complex *u_data,
+                                 HYPRE_Complex *v_tmp_data,
+                                 HYPRE_Complex *v_ext_data,
+                                 HYPRE_Int      ns,
+                                 HYPRE_Int      ne,
+                                 HYPRE_Int      ibegin,
+                                 HYPRE_Int      iend,
+                                 HYPRE_Int      iorder,
+                                 HYPRE_Int      Skip_diag )
+{
+   HYPRE_Int i;
+   const HYPRE_Complex zero = 0.0;
+
+   for (i = ibegin; i != iend; i += iorder)
+   {
+      const HYPRE_Complex di = l1_norms ? l1_norms[i] : A_diag_data[A_diag_i[i]];
+
+      if ( (relax_points == 0 || cf_marker[i] == relax_points) && di != zero )
+      {
+         HYPRE_Int jj;
+         HYPRE_Complex res = f_data[i];
+
+         for (jj = A_diag_i[i] + Skip_diag; jj < A_diag_i[i + 1]; jj++)
+         {
+            const HYPRE_Int ii = A_diag_j[jj];
+            if (ii >= ns && ii < ne)
+            {
+               res -= A_diag_data[jj] * u_data[ii];
+            }
+            else
+            {
+               res -= A_diag_data[jj] * v_tmp_data[ii];
+            }
+         }
+
+         for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+         {
+            const HYPRE_Int ii = A_offd_j[jj];
+            res -= A_offd_data[jj] * v_ext_data[ii];
+         }
+
+         if (Skip_diag)
+         {
+            u_data[i] = res / di;
+         }
+         else
+         {
+            u_data[i] += res / di;
+         }
+      }
+   } /* for ( i = ...) */
+}
+
 /* Scaled version */
 static inline void
 hypre_HybridGaussSeidel( HYPRE_Int     *A_diag_i,
@@ -504,5 +570,132 @@ hypre_HybridGaussSeidelOrderedNS( HYPRE_Int     *A_diag_i,
    } /* for ( i = ...) */
 }
 
+/* Multivector version (scaled/non-scaled, threaded or not)
+ * Each row of A is read once and applied to all num_vectors vectors.
+ * Rows in [ns, ne) are updated in place, the remaining local rows are
+ * taken from v_tmp_data. v_ext_data holds the interleaved external values
+ * received through the comm package. res must hold 3 * num_vectors entries */
+static inline void
+hypre_HybridGaussSeidelMultiVec( HYPRE_Int     *A_diag_i,
+                                 HYPRE_Int     *A_diag_j,
+                                 HYPRE_Complex *A_diag_data,
+                                 HYPRE_Int     *A_offd_i,
+                                 HYPRE_Int     *A_offd_j,
+                                 HYPRE_Complex *A_offd_data,
+                                 HYPRE_Complex *f_data,
+                                 HYPRE_Int      f_vecstride,
+                                 HYPRE_Int      f_idxstride,
+                                 HYPRE_Int     *cf_marker,
+                                 HYPRE_Int      relax_points,
+                                 HYPRE_Real     relax_weight,
+                                 HYPRE_Real     omega,
+                                 HYPRE_Int      non_scale,
+                                 HYPRE_Complex *l1_norms,
+                                 HYPRE_Complex *u_data,
+                                 HYPRE_Complex *v_tmp_data,
+                                 HYPRE_Int      vecstride,
+                                 HYPRE_Int      idxstride,
+                                 HYPRE_Complex *v_ext_data,
+                                 HYPRE_Int      num_vectors,
+                                 HYPRE_Complex *res,
+                                 HYPRE_Int      ns,
+                                 HYPRE_Int      ne,
+                                 HYPRE_Int      ibegin,
+                                 HYPRE_Int      iend,
+                                 HYPRE_Int      iorder,
+                                 HYPRE_Int      Skip_diag )
+{
+   HYPRE_Int i, jj, k;
+   HYPRE_Complex *res0 = res + num_vectors;
+   HYPRE_Complex *res2 = res + 2 * num_vectors;
+   const HYPRE_Complex zero = 0.0;
+   const HYPRE_Real one_minus_omega = 1.0 - omega;
+   const HYPRE_Real prod = 1.0 - relax_weight * omega;
+
+   for (i = ibegin; i != iend; i += iorder)
+   {
+      const HYPRE_Complex di = l1_norms ? l1_norms[i] : A_diag_data[A_diag_i[i]];
+
+      /*-----------------------------------------------------------
+       * Relax only C or F points as determined by relax_points.
+       * If i is of the right type ( C or F or All) and diagonal is
+       * nonzero, relax point i; otherwise, skip it.
+       *-----------------------------------------------------------*/
+      if ( (relax_points == 0 || cf_marker[i] == relax_points) && di != zero )
+      {
+         for (k = 0; k < num_vectors; k++)
+         {
+            res[k]  = f_data[i * f_idxstride + k * f_vecstride];
+            res0[k] = 0.0;
+            res2[k] = 0.0;
+         }
+
+         for (jj = A_diag_i[i] + Skip_diag; jj < A_diag_i[i + 1]; jj++)
+         {
+            const HYPRE_Int     ii = A_diag_j[jj];
+            const HYPRE_Complex a  = A_diag_data[jj];
+
+            if (ii >= ns && ii < ne)
+            {
+               for (k = 0; k < num_vectors; k++)
+               {
+                  res0[k] -= a * u_data[ii * idxstride + k * vecstride];
+               }
+               if (!non_scale)
+               {
+                  for (k = 0; k < num_vectors; k++)
+                  {
+                     res2[k] += a * v_tmp_data[ii * idxstride + k * vecstride];
+                  }
+               }
+            }
+            else
+            {
+               for (k = 0; k < num_vectors; k++)
+               {
+                  res[k] -= a * v_tmp_data[ii * idxstride + k * vecstride];
+               }
+            }
+         }
+
+         for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+         {
+            const HYPRE_Int     ii = A_offd_j[jj];
+            const HYPRE_Complex a  = A_offd_data[jj];
+
+            for (k = 0; k < num_vectors; k++)
+            {
+               res[k] -= a * v_ext_data[ii * num_vectors + k];
+            }
+         }
+
+         for (k = 0; k < num_vectors; k++)
+         {
+            HYPRE_Complex *ui = &u_data[i * idxstride + k * vecstride];
+
+            if (non_scale)
+            {
+               if (Skip_diag)
+               {
+                  *ui = (res[k] + res0[k]) / di;
+               }
+               else
+               {
+                  *ui += (res[k] + res0[k]) / di;
+               }
+            }
+            else
+            {
+               if (Skip_diag)
+               {
+                  *ui *= prod;
+               }
+               *ui += relax_weight * (omega * res[k] + res0[k] + one_minus_omega * res2[k]) / di;
+            }
+         }
+      }
+   } /* for ( i = ...) */
+}
+
 #endif /* #ifndef HYPRE_PAR_RELAX_HEADER */
 
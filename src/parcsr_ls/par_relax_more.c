@@ -394,6 +394,209 @@ hypre_ParCSRMaxEigEstimateCGHost( hypre_ParCSRMatrix *A,     /* matrix to relax
    return hypre_error_flag;
 }
 
+/**
+ *  @brief Uses Lanczos to get the eigenvalue estimate. Will determine whether
+ *  to use host or device internally. On the device, the equivalent CG-based
+ *  estimate is used.
+ *
+ *  @param[in] A Matrix to relax with
+ *  @param[in] scale Gets the eigenvalue est of D^{-1/2} A D^{-1/2}
+ *  @param[in] max_iter Maximum number of Lanczos steps
+ *  @param[out] max_eig Estimated max eigenvalue
+ *  @param[out] min_eig Estimated min eigenvalue
+ */
+HYPRE_Int
+hypre_ParCSRMaxEigEstimateLanczos(hypre_ParCSRMatrix *A,     /* matrix to relax with */
+                                  HYPRE_Int           scale, /* scale by diagonal?*/
+                                  HYPRE_Int           max_iter,
+                                  HYPRE_Real         *max_eig,
+                                  HYPRE_Real         *min_eig)
+{
+   hypre_GpuProfilingPushRange("ParCSRMaxEigEstimateLanczos");
+   HYPRE_Int             ierr = 0;
+#if defined(HYPRE_USING_GPU)
+   HYPRE_ExecutionPolicy exec = hypre_GetExecPolicy1(hypre_ParCSRMatrixMemoryLocation(A));
+   if (exec == HYPRE_EXEC_DEVICE)
+   {
+      ierr = hypre_ParCSRMaxEigEstimateCGDevice(A, scale, max_iter, max_eig, min_eig);
+   }
+   else
+#endif
+   {
+      ierr = hypre_ParCSRMaxEigEstimateLanczosHost(A, scale, max_iter, max_eig, min_eig);
+   }
+   hypre_GpuProfilingPopRange();
+   return ierr;
+}
+
+/**
+ *  @brief Uses Lanczos to get the eigenvalue estimate on the host
+ *
+ *  The Lanczos vectors are orthonormal, so the norm of the new direction
+ *  w - alpha v - beta v_old equals <w,w> - alpha^2 - beta^2. Both inner
+ *  products of a step are thus combined into a single global reduction.
+ *
+ *  @param[in] A Matrix to relax with
+ *  @param[in] scale Gets the eigenvalue est of D^{-1/2} A D^{-1/2}
+ *  @param[in] max_iter Maximum number of Lanczos steps
+ *  @param[out] max_eig Estimated max eigenvalue
+ *  @param[out] min_eig Estimated min eigenvalue
+ */
+HYPRE_Int
+hypre_ParCSRMaxEigEstimateLanczosHost( hypre_ParCSRMatrix *A,     /* matrix to relax with */
+                                       HYPRE_Int           scale, /* scale by diagonal?*/
+                                       HYPRE_Int           max_iter,
+                                       HYPRE_Real         *max_eig,
+                                       HYPRE_Real         *min_eig )
+{
+   MPI_Comm         comm = hypre_ParCSRMatrixComm(A);
+   HYPRE_Int        local_size = hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A));
+   HYPRE_BigInt     size = hypre_ParCSRMatrixGlobalNumRows(A);
+
+   hypre_ParVector *v;
+   hypre_ParVector *v_old;
+   hypre_ParVector *w;
+   hypre_ParVector *u = NULL;
+   HYPRE_Real      *v_data, *v_old_data, *w_data, *u_data = NULL;
+   HYPRE_Real      *ds_data = NULL;
+
+   HYPRE_Real      *tridiag;
+   HYPRE_Real      *trioffd;
+   HYPRE_Real       local_dots[2], dots[2];
+   HYPRE_Real       wv, ww, alpha, beta, beta_new, vnorm, tmp;
+   HYPRE_Int        i, j, n, err;
+
+   /* check the size of A - don't iterate more than the size */
+   if (size < (HYPRE_BigInt) max_iter)
+   {
+      max_iter = (HYPRE_Int) size;
+   }
+   if (max_iter < 1)
+   {
+      *max_eig = 0.0;
+      *min_eig = 0.0;
+      return hypre_error_flag;
+   }
+
+   v = hypre_ParVectorCreate(comm, size, hypre_ParCSRMatrixRowStarts(A));
+   hypre_ParVectorInitialize(v);
+   v_old = hypre_ParVectorCreate(comm, size, hypre_ParCSRMatrixRowStarts(A));
+   hypre_ParVectorInitialize(v_old);
+   w = hypre_ParVectorCreate(comm, size, hypre_ParCSRMatrixRowStarts(A));
+   hypre_ParVectorInitialize(w);
+
+   v_data     = hypre_VectorData(hypre_ParVectorLocalVector(v));
+   v_old_data = hypre_VectorData(hypre_ParVectorLocalVector(v_old));
+   w_data     = hypre_VectorData(hypre_ParVectorLocalVector(w));
+
+   if (scale)
+   {
+      u = hypre_ParVectorCreate(comm, size, hypre_ParCSRMatrixRowStarts(A));
+      hypre_ParVectorInitialize(u);
+      u_data  = hypre_VectorData(hypre_ParVectorLocalVector(u));
+      ds_data = hypre_CTAlloc(HYPRE_Real, local_size, HYPRE_MEMORY_HOST);
+      hypre_CSRMatrixExtractDiagonal(hypre_ParCSRMatrixDiag(A), ds_data, 4);
+   }
+
+   /* make room for tri-diag matrix */
+   tridiag = hypre_CTAlloc(HYPRE_Real, max_iter + 1, HYPRE_MEMORY_HOST);
+   trioffd = hypre_CTAlloc(HYPRE_Real, max_iter + 1, HYPRE_MEMORY_HOST);
+
+   /* v = random, normalized */
+   hypre_ParVectorSetRandomValues(v, 1);
+   vnorm = hypre_sqrt(hypre_ParVectorInnerProd(v, v));
+   hypre_ParVectorScale(1.0 / vnorm, v);
+
+   beta = 0.0;
+   n = 0;
+   while (n < max_iter)
+   {
+      if (scale)
+      {
+         /* w = D^{-1/2}A*D^{-1/2}*v */
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
+#endif
+         for (j = 0; j < local_size; j++)
+         {
+            u_data[j] = ds_data[j] * v_data[j];
+         }
+         hypre_ParCSRMatrixMatvec(1.0, A, u, 0.0, w);
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
+#endif
+         for (j = 0; j < local_size; j++)
+         {
+            w_data[j] *= ds_data[j];
+         }
+      }
+      else
+      {
+         /* w = A*v */
+         hypre_ParCSRMatrixMatvec(1.0, A, v, 0.0, w);
+      }
+
+      /* <w,v> and <w,w> in one reduction */
+      wv = 0.0;
+      ww = 0.0;
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(j) reduction(+:wv,ww) HYPRE_SMP_SCHEDULE
+#endif
+      for (j = 0; j < local_size; j++)
+      {
+         wv += w_data[j] * v_data[j];
+         ww += w_data[j] * w_data[j];
+      }
+      local_dots[0] = wv;
+      local_dots[1] = ww;
+      hypre_MPI_Allreduce(local_dots, dots, 2, HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+
+      alpha = dots[0];
+      tridiag[n] = alpha;
+      n++;
+
+      /* stop on (near) breakdown: the new direction would be dominated by
+         rounding errors of the norm update */
+      tmp = dots[1] - alpha * alpha - beta * beta;
+      if (n == max_iter || tmp <= 1.0e-10 * dots[1])
+      {
+         break;
+      }
+      beta_new = hypre_sqrt(tmp);
+      trioffd[n] = beta_new;
+
+      /* v_old = v; v = (w - alpha*v - beta*v_old) / beta_new */
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(j, tmp) HYPRE_SMP_SCHEDULE
+#endif
+      for (j = 0; j < local_size; j++)
+      {
+         tmp = (w_data[j] - alpha * v_data[j] - beta * v_old_data[j]) / beta_new;
+         v_old_data[j] = v_data[j];
+         v_data[j] = tmp;
+      }
+      beta = beta_new;
+   }
+
+   /* eispack routine - eigenvalues return in tridiag and ordered*/
+   i = n;
+   hypre_LINPACKcgtql1(&i, tridiag, trioffd, &err);
+
+   *max_eig = tridiag[n - 1];
+   *min_eig = tridiag[0];
+
+   hypre_TFree(tridiag, HYPRE_MEMORY_HOST);
+   hypre_TFree(trioffd, HYPRE_MEMORY_HOST);
+   hypre_TFree(ds_data, HYPRE_MEMORY_HOST);
+
+   hypre_ParVectorDestroy(v);
+   hypre_ParVectorDestroy(v_old);
+   hypre_ParVectorDestroy(w);
+   hypre_ParVectorDestroy(u);
+
+   return hypre_error_flag;
+}
+
 /******************************************************************************
 Chebyshev relaxation
 
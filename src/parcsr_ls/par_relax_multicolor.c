@@ -0,0 +1,355 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Multicolor hybrid Gauss-Seidel (relaxation types 31, 32 and 33)
+ *
+ * The rows of the local diag part are colored with a distance-1 greedy
+ * coloring, so that rows of the same color do not couple to each other.
+ * Each color is then relaxed in parallel by all threads, and the result does
+ * not depend on the number of threads. As in the hybrid smoothers, the
+ * off-processor part is treated Jacobi-like.
+ *
+ * The rows of the diag part are stored permuted by color, with the diagonal
+ * entry first, so that the sweep over a color reads contiguous memory.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxMulticolorSetup
+ *
+ * Colors the local rows of A and returns:
+ *   mc_diag_ptr      : the rows of the diag part of A in color order, with
+ *                      the diagonal entry stored first (zero if missing).
+ *                      Column indices are not permuted.
+ *   perm_ptr         : the original row of each row of mc_diag.
+ *   color_starts_ptr : the first row of mc_diag of each color (num_colors + 1).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxMulticolorSetup( hypre_ParCSRMatrix  *A,
+                                     hypre_CSRMatrix    **mc_diag_ptr,
+                                     hypre_IntArray     **perm_ptr,
+                                     hypre_IntArray     **color_starts_ptr )
+{
+   hypre_CSRMatrix     *A_diag      = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Real          *A_diag_data = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int           *A_diag_i    = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int           *A_diag_j    = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Int            num_rows    = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int            num_nonzeros;
+
+   hypre_CSRMatrix     *AT_diag;
+   HYPRE_Int           *AT_diag_i;
+   HYPRE_Int           *AT_diag_j;
+
+   hypre_CSRMatrix     *mc_diag;
+   HYPRE_Real          *mc_data;
+   HYPRE_Int           *mc_i;
+   HYPRE_Int           *mc_j;
+   hypre_IntArray      *perm;
+   hypre_IntArray      *color_starts;
+   HYPRE_Int           *perm_data;
+   HYPRE_Int           *starts;
+
+   HYPRE_Int           *color;
+   HYPRE_Int           *color_mark;
+   HYPRE_Int            num_colors = 0;
+   HYPRE_Int            i, ii, jj, k, c, cnt;
+
+   if (hypre_GetActualMemLocation(hypre_CSRMatrixMemoryLocation(A_diag)) != hypre_MEMORY_HOST)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Multicolor Gauss-Seidel is only supported on the host!\n");
+      return hypre_error_flag;
+   }
+
+   /* rows i and j conflict if either couples to the other */
+   hypre_CSRMatrixTranspose(A_diag, &AT_diag, 0);
+   AT_diag_i = hypre_CSRMatrixI(AT_diag);
+   AT_diag_j = hypre_CSRMatrixJ(AT_diag);
+
+   /* greedy coloring in natural order; color_mark[c] == i if c is taken
+      by a neighbor of row i */
+   color      = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   color_mark = hypre_TAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_rows; i++)
+   {
+      color[i] = -1;
+      color_mark[i] = -1;
+   }
+   color_mark[num_rows] = -1;
+
+   for (i = 0; i < num_rows; i++)
+   {
+      for (jj = A_diag_i[i]; jj < A_diag_i[i + 1]; jj++)
+      {
+         ii = A_diag_j[jj];
+         if (ii != i && color[ii] >= 0)
+         {
+            color_mark[color[ii]] = i;
+         }
+      }
+      for (jj = AT_diag_i[i]; jj < AT_diag_i[i + 1]; jj++)
+      {
+         ii = AT_diag_j[jj];
+         if (ii != i && color[ii] >= 0)
+         {
+            color_mark[color[ii]] = i;
+         }
+      }
+      c = 0;
+      while (color_mark[c] == i)
+      {
+         c++;
+      }
+      color[i] = c;
+      num_colors = hypre_max(num_colors, c + 1);
+   }
+   hypre_CSRMatrixDestroy(AT_diag);
+   hypre_TFree(color_mark, HYPRE_MEMORY_HOST);
+
+   /* sort the rows by color */
+   color_starts = hypre_IntArrayCreate(num_colors + 1);
+   hypre_IntArrayInitialize_v2(color_starts, HYPRE_MEMORY_HOST);
+   starts = hypre_IntArrayData(color_starts);
+   for (c = 0; c <= num_colors; c++)
+   {
+      starts[c] = 0;
+   }
+   for (i = 0; i < num_rows; i++)
+   {
+      starts[color[i] + 1]++;
+   }
+   for (c = 0; c < num_colors; c++)
+   {
+      starts[c + 1] += starts[c];
+   }
+
+   perm = hypre_IntArrayCreate(num_rows);
+   hypre_IntArrayInitialize_v2(perm, HYPRE_MEMORY_HOST);
+   perm_data = hypre_IntArrayData(perm);
+   for (i = 0; i < num_rows; i++)
+   {
+      perm_data[starts[color[i]]++] = i;
+   }
+   for (c = num_colors; c > 0; c--)
+   {
+      starts[c] = starts[c - 1];
+   }
+   starts[0] = 0;
+   hypre_TFree(color, HYPRE_MEMORY_HOST);
+
+   /* copy the rows in color order, diagonal first */
+   num_nonzeros = 0;
+   for (k = 0; k < num_rows; k++)
+   {
+      i = perm_data[k];
+      num_nonzeros += A_diag_i[i + 1] - A_diag_i[i] + 1;
+      for (jj = A_diag_i[i]; jj < A_diag_i[i + 1]; jj++)
+      {
+         if (A_diag_j[jj] == i)
+         {
+            num_nonzeros--;
+            break;
+         }
+      }
+   }
+
+   mc_diag = hypre_CSRMatrixCreate(num_rows, hypre_CSRMatrixNumCols(A_diag), num_nonzeros);
+   hypre_CSRMatrixInitialize_v2(mc_diag, 0, HYPRE_MEMORY_HOST);
+   mc_data = hypre_CSRMatrixData(mc_diag);
+   mc_i    = hypre_CSRMatrixI(mc_diag);
+   mc_j    = hypre_CSRMatrixJ(mc_diag);
+
+   cnt = 0;
+   for (k = 0; k < num_rows; k++)
+   {
+      i = perm_data[k];
+      mc_i[k] = cnt;
+      mc_j[cnt] = i;
+      mc_data[cnt++] = 0.0;
+      for (jj = A_diag_i[i]; jj < A_diag_i[i + 1]; jj++)
+      {
+         if (A_diag_j[jj] == i)
+         {
+            mc_data[mc_i[k]] = A_diag_data[jj];
+         }
+         else
+         {
+            mc_j[cnt] = A_diag_j[jj];
+            mc_data[cnt++] = A_diag_data[jj];
+         }
+      }
+   }
+   mc_i[num_rows] = cnt;
+
+   *mc_diag_ptr      = mc_diag;
+   *perm_ptr         = perm;
+   *color_starts_ptr = color_starts;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxMulticolor
+ *
+ * One sweep of multicolor hybrid Gauss-Seidel/SOR using the data built by
+ * hypre_BoomerAMGRelaxMulticolorSetup. Colors are visited in increasing
+ * order for relax_type 31, in decreasing order for 32, and in increasing
+ * followed by decreasing order (symmetric) for 33.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxMulticolor( hypre_ParCSRMatrix *A,
+                                hypre_ParVector    *f,
+                                hypre_CSRMatrix    *mc_diag,
+                                hypre_IntArray     *perm,
+                                hypre_IntArray     *color_starts,
+                                HYPRE_Int           relax_type,
+                                HYPRE_Real          relax_weight,
+                                hypre_ParVector    *u,
+                                hypre_ParVector    *Vtemp )
+{
+   MPI_Comm             comm          = hypre_ParCSRMatrixComm(A);
+   hypre_CSRMatrix     *A_offd        = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int            num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
+   hypre_ParCSRCommPkg *comm_pkg      = hypre_ParCSRMatrixCommPkg(A);
+
+   HYPRE_Real          *mc_data       = hypre_CSRMatrixData(mc_diag);
+   HYPRE_Int           *mc_i          = hypre_CSRMatrixI(mc_diag);
+   HYPRE_Int           *mc_j          = hypre_CSRMatrixJ(mc_diag);
+   HYPRE_Int           *perm_data     = hypre_IntArrayData(perm);
+   HYPRE_Int           *starts        = hypre_IntArrayData(color_starts);
+   HYPRE_Int            num_colors    = hypre_IntArraySize(color_starts) - 1;
+
+   HYPRE_Real          *u_data        = hypre_VectorData(hypre_ParVectorLocalVector(u));
+   HYPRE_Real          *f_data        = hypre_VectorData(hypre_ParVectorLocalVector(f));
+   HYPRE_Real          *v_data        = hypre_VectorData(hypre_ParVectorLocalVector(Vtemp));
+   HYPRE_Real          *rhs_data;
+
+   hypre_ParCSRCommHandle *comm_handle;
+   hypre_Vector        *u_ext;
+   HYPRE_Real          *v_buf_data;
+   HYPRE_Int            num_procs, num_sends, begin, end;
+   HYPRE_Int            sweep, num_sweeps, c, cc, k, i, jj;
+   HYPRE_Real           res, diag;
+
+   const HYPRE_Real     one_minus_weight = 1.0 - relax_weight;
+
+   if (hypre_ParVectorNumVectors(f) > 1)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Multicolor relaxation doesn't support multicomponent vectors");
+      return hypre_error_flag;
+   }
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   /* rhs = f - A_offd * u_ext, frozen during the sweep */
+   rhs_data = f_data;
+   if (num_procs > 1 && num_cols_offd)
+   {
+      if (!comm_pkg)
+      {
+         hypre_MatvecCommPkgCreate(A);
+         comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+      }
+      hypre_ParCSRCommPkgUpdateVecStarts(comm_pkg, u);
+      num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+      begin     = hypre_ParCSRCommPkgSendMapStart(comm_pkg, 0);
+      end       = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+
+      u_ext = hypre_SeqVectorCreate(num_cols_offd);
+      hypre_SeqVectorInitialize_v2(u_ext, HYPRE_MEMORY_HOST);
+      v_buf_data = hypre_TAlloc(HYPRE_Real, end - begin, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(k) HYPRE_SMP_SCHEDULE
+#endif
+      for (k = begin; k < end; k++)
+      {
+         v_buf_data[k - begin] = u_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, k)];
+      }
+      comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, v_buf_data,
+                                                 hypre_VectorData(u_ext));
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+
+      hypre_CSRMatrixMatvecOutOfPlace(-1.0, A_offd, u_ext, 1.0, hypre_ParVectorLocalVector(f),
+                                      hypre_ParVectorLocalVector(Vtemp), 0);
+      rhs_data = v_data;
+
+      hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
+      hypre_SeqVectorDestroy(u_ext);
+   }
+
+   num_sweeps = (relax_type == 33) ? 2 : 1;
+   for (sweep = 0; sweep < num_sweeps; sweep++)
+   {
+      for (cc = 0; cc < num_colors; cc++)
+      {
+         c = (relax_type == 32 || sweep == 1) ? num_colors - 1 - cc : cc;
+
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(k, i, jj, res, diag) HYPRE_SMP_SCHEDULE
+#endif
+         for (k = starts[c]; k < starts[c + 1]; k++)
+         {
+            diag = mc_data[mc_i[k]];
+            if (diag != 0.0)
+            {
+               i   = perm_data[k];
+               res = rhs_data[i];
+               for (jj = mc_i[k] + 1; jj < mc_i[k + 1]; jj++)
+               {
+                  res -= mc_data[jj] * u_data[mc_j[jj]];
+               }
+               u_data[i] = one_minus_weight * u_data[i] + relax_weight * res / diag;
+            }
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxMulticolorOnce
+ *
+ * Colors A, relaxes once and discards the coloring. Used by callers of
+ * hypre_BoomerAMGRelax that do not keep the data of
+ * hypre_BoomerAMGRelaxMulticolorSetup; BoomerAMG computes it once at setup.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxMulticolorOnce( hypre_ParCSRMatrix *A,
+                                    hypre_ParVector    *f,
+                                    HYPRE_Int           relax_type,
+                                    HYPRE_Real          relax_weight,
+                                    hypre_ParVector    *u,
+                                    hypre_ParVector    *Vtemp )
+{
+   hypre_CSRMatrix *mc_diag      = NULL;
+   hypre_IntArray  *perm         = NULL;
+   hypre_IntArray  *color_starts = NULL;
+
+   hypre_BoomerAMGRelaxMulticolorSetup(A, &mc_diag, &perm, &color_starts);
+   if (mc_diag)
+   {
+      hypre_BoomerAMGRelaxMulticolor(A, f, mc_diag, perm, color_starts, relax_type,
+                                     relax_weight, u, Vtemp);
+   }
+
+   hypre_CSRMatrixDestroy(mc_diag);
+   hypre_IntArrayDestroy(perm);
+   hypre_IntArrayDestroy(color_starts);
+
+   return hypre_error_flag;
+}
@@ -121,6 +121,9 @@ hypre_BoomerAMGSetupStats( void               *amg_vdata,
    HYPRE_Real   operat_cmplxty;
    HYPRE_Real   grid_cmplxty = 0;
    HYPRE_Real   memory_cmplxty = 0;
+   HYPRE_Real  *mem_bytes;
+   HYPRE_Real  *mem_bytes_glob;
+   HYPRE_Real   mem, mem_total, mem_max;
 
    /* amg solve params */
    HYPRE_Int      max_iter;
@@ -993,6 +996,64 @@ hypre_BoomerAMGSetupStats( void               *amg_vdata,
       hypre_printf("\n\n");
    }
 
+   /* Memory usage per level and object class, summed over all tasks */
+   mem_bytes      = hypre_CTAlloc(HYPRE_Real, num_levels * HYPRE_AMG_NUM_MEMORY_CLASSES,
+                                  HYPRE_MEMORY_HOST);
+   mem_bytes_glob = hypre_CTAlloc(HYPRE_Real, num_levels * HYPRE_AMG_NUM_MEMORY_CLASSES,
+                                  HYPRE_MEMORY_HOST);
+   mem_total      = 0.0;
+   for (level = 0; level < num_levels; level++)
+   {
+      hypre_BoomerAMGLevelMemoryUsage(amg_data, level,
+                                      &mem_bytes[level * HYPRE_AMG_NUM_MEMORY_CLASSES]);
+   }
+   for (j = 0; j < num_levels * HYPRE_AMG_NUM_MEMORY_CLASSES; j++)
+   {
+      mem_total += mem_bytes[j];
+   }
+   hypre_MPI_Allreduce(mem_bytes, mem_bytes_glob, num_levels * HYPRE_AMG_NUM_MEMORY_CLASSES,
+                       HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+   hypre_MPI_Allreduce(&mem_total, &mem_max, 1, HYPRE_MPI_REAL, hypre_MPI_MAX, comm);
+
+   if (my_id == 0)
+   {
+      HYPRE_Real  mb = 1024.0 * 1024.0;
+      HYPRE_Real  level_total, col_total[HYPRE_AMG_NUM_MEMORY_CLASSES];
+
+      hypre_printf("Memory usage (MB, sum over all tasks):\n\n");
+      hypre_printf("lev          A          P          R       Comm   Smoother"
+                   "    Vectors      Other      Total\n");
+      for (i = 0; i < HYPRE_AMG_NUM_MEMORY_CLASSES; i++)
+      {
+         col_total[i] = 0.0;
+      }
+      for (level = 0; level < num_levels; level++)
+      {
+         level_total = 0.0;
+         hypre_printf("%3d", level);
+         for (i = 0; i < HYPRE_AMG_NUM_MEMORY_CLASSES; i++)
+         {
+            mem = mem_bytes_glob[level * HYPRE_AMG_NUM_MEMORY_CLASSES + i];
+            level_total  += mem;
+            col_total[i] += mem;
+            hypre_printf(" %10.3f", mem / mb);
+         }
+         hypre_printf(" %10.3f\n", level_total / mb);
+      }
+      level_total = 0.0;
+      hypre_printf("all");
+      for (i = 0; i < HYPRE_AMG_NUM_MEMORY_CLASSES; i++)
+      {
+         level_total += col_total[i];
+         hypre_printf(" %10.3f", col_total[i] / mb);
+      }
+      hypre_printf(" %10.3f\n\n", level_total / mb);
+      hypre_printf("     Max. per task = %.3f MB\n\n", mem_max / mb);
+   }
+
+   hypre_TFree(mem_bytes, HYPRE_MEMORY_HOST);
+   hypre_TFree(mem_bytes_glob, HYPRE_MEMORY_HOST);
+
    if (my_id == 0)
    {
       hypre_printf("\n\nBoomerAMG SOLVER PARAMETERS:\n\n");
@@ -1006,6 +1067,27 @@ hypre_BoomerAMGSetupStats( void               *amg_vdata,
       {
          hypre_printf( "  Cycle type (1 = V, 2 = W, etc.):  %d\n\n", cycle_type);
       }
+      if (hypre_ParAMGDataAdaptiveCycle(amg_data))
+      {
+         hypre_printf( "  Adaptive cycle, probing every %d cycles, tolerance %f\n\n",
+                       hypre_ParAMGDataAdaptiveCycle(amg_data),
+                       hypre_ParAMGDataAdaptiveCycleTol(amg_data));
+      }
+      if (grid_relax_type[1] == 16 || grid_relax_type[2] == 16 || grid_relax_type[3] == 16)
+      {
+         hypre_printf( "  Chebyshev variant %d, order %d, bounds from %d %s iterations\n",
+                       hypre_ParAMGDataChebyVariant(amg_data),
+                       hypre_ParAMGDataChebyOrder(amg_data),
+                       hypre_ParAMGDataChebyEigEst(amg_data),
+                       hypre_ParAMGDataChebyLanczos(amg_data) ? "Lanczos" : "CG");
+         if (hypre_ParAMGDataChebyEigRefreshTol(amg_data) > 0.0)
+         {
+            hypre_printf( "  Chebyshev bounds reused on %d levels (refresh tolerance %f)\n",
+                          hypre_ParAMGDataChebyEigReused(amg_data),
+                          hypre_ParAMGDataChebyEigRefreshTol(amg_data));
+         }
+         hypre_printf( "\n");
+      }
 
       if (additive == 0 || mult_additive == 0 || simple == 0)
       {
@@ -1778,3 +1860,260 @@ hypre_BoomerAMGPrintGeneralInfo(hypre_ParAMGData *amg_data,
 
    return hypre_error_flag;
 }
+
+/*--------------------------------------------------------------------
+ * hypre_BoomerAMGLevelMemoryUsage
+ *
+ * Adds the bytes held on this process by the data of the given level to
+ * bytes[0..HYPRE_AMG_NUM_MEMORY_CLASSES-1], one entry per object class:
+ *
+ *   0: operator A                 4: smoother data
+ *   1: interpolation P            5: vectors
+ *   2: restriction R              6: other setup data (CF markers,
+ *   3: comm packages of A, P, R      dof_func, reused setup data)
+ *
+ * P and R are counted on their fine level. Level 0 also carries the work
+ * vectors of the solve phase; its F and U belong to the user and are
+ * not counted. Block matrices and external solvers other than FSAI are
+ * not accounted for.
+ *--------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGLevelMemoryUsage( void       *data,
+                                 HYPRE_Int   level,
+                                 HYPRE_Real *bytes )
+{
+   hypre_ParAMGData     *amg_data   = (hypre_ParAMGData*) data;
+   HYPRE_Int             num_levels = hypre_ParAMGDataNumLevels(amg_data);
+   hypre_ParCSRMatrix  **A_array    = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParCSRMatrix  **P_array    = hypre_ParAMGDataPArray(amg_data);
+   hypre_ParCSRMatrix  **R_array    = hypre_ParAMGDataRArray(amg_data);
+   hypre_ParVector     **F_array    = hypre_ParAMGDataFArray(amg_data);
+   hypre_ParVector     **U_array    = hypre_ParAMGDataUArray(amg_data);
+   HYPRE_Int             smooth_type;
+   HYPRE_Int             cheby_order;
+
+   hypre_ParCSRMatrix   *M[3] = {NULL, NULL, NULL};
+   hypre_ParFSAIData    *fsai_data;
+   hypre_IntArray       *int_array;
+   HYPRE_Int             i;
+
+   if (level < 0 || level >= num_levels)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   /* Operators and their communication packages */
+   if (A_array)
+   {
+      M[0] = A_array[level];
+   }
+   if (level < num_levels - 1)
+   {
+      if (P_array)
+      {
+         M[1] = P_array[level];
+      }
+      if (R_array && R_array != P_array)
+      {
+         M[2] = R_array[level];
+      }
+   }
+   for (i = 0; i < 3; i++)
+   {
+      if (M[i])
+      {
+         bytes[i] += (HYPRE_Real) hypre_ParCSRMatrixMemorySize(M[i]);
+         bytes[3] += (HYPRE_Real) hypre_ParCSRCommPkgMemorySize(hypre_ParCSRMatrixCommPkg(M[i]));
+         bytes[3] += (HYPRE_Real) hypre_ParCSRCommPkgMemorySize(hypre_ParCSRMatrixCommPkgT(M[i]));
+      }
+   }
+
+   /* Smoother data */
+   if (hypre_ParAMGDataL1Norms(amg_data))
+   {
+      bytes[4] += (HYPRE_Real) hypre_SeqVectorMemorySize(hypre_ParAMGDataL1Norms(amg_data)[level]);
+   }
+   if (hypre_ParAMGDataChebyDS(amg_data))
+   {
+      bytes[4] += (HYPRE_Real) hypre_SeqVectorMemorySize(hypre_ParAMGDataChebyDS(amg_data)[level]);
+   }
+   if (hypre_ParAMGDataChebyCoefs(amg_data) && hypre_ParAMGDataChebyCoefs(amg_data)[level])
+   {
+      cheby_order = hypre_ParAMGDataChebyOrder(amg_data);
+      bytes[4] += (HYPRE_Real) (hypre_max(cheby_order + 1, 2 * cheby_order) * sizeof(HYPRE_Real));
+   }
+   if (hypre_ParAMGDataMCDiag(amg_data))
+   {
+      bytes[4] += (HYPRE_Real) hypre_CSRMatrixMemorySize(hypre_ParAMGDataMCDiag(amg_data)[level]);
+   }
+   if (hypre_ParAMGDataMCPerm(amg_data) &&
+       (int_array = hypre_ParAMGDataMCPerm(amg_data)[level]) != NULL)
+   {
+      bytes[4] += (HYPRE_Real) (sizeof(hypre_IntArray) +
+                                hypre_IntArraySize(int_array) * sizeof(HYPRE_Int));
+   }
+   if (hypre_ParAMGDataMCColorStarts(amg_data) &&
+       (int_array = hypre_ParAMGDataMCColorStarts(amg_data)[level]) != NULL)
+   {
+      bytes[4] += (HYPRE_Real) (sizeof(hypre_IntArray) +
+                                hypre_IntArraySize(int_array) * sizeof(HYPRE_Int));
+   }
+
+   smooth_type = hypre_ParAMGDataSmoothType(amg_data);
+   if ((smooth_type == 4 || smooth_type == 14) &&
+       level < hypre_ParAMGDataSmoothNumLevels(amg_data) &&
+       hypre_ParAMGDataSmoother(amg_data) &&
+       (fsai_data = (hypre_ParFSAIData *) hypre_ParAMGDataSmoother(amg_data)[level]) != NULL)
+   {
+      M[0] = hypre_ParFSAIDataGmat(fsai_data);
+      M[1] = hypre_ParFSAIDataGTmat(fsai_data);
+      for (i = 0; i < 2; i++)
+      {
+         bytes[4] += (HYPRE_Real) hypre_ParCSRMatrixMemorySize(M[i]);
+         if (M[i])
+         {
+            bytes[4] += (HYPRE_Real) hypre_ParCSRCommPkgMemorySize(hypre_ParCSRMatrixCommPkg(M[i]));
+         }
+      }
+      bytes[4] += (HYPRE_Real) hypre_ParVectorMemorySize(hypre_ParFSAIDataRWork(fsai_data));
+      bytes[4] += (HYPRE_Real) hypre_ParVectorMemorySize(hypre_ParFSAIDataZWork(fsai_data));
+   }
+
+   /* Vectors */
+   if (level > 0)
+   {
+      if (F_array)
+      {
+         bytes[5] += (HYPRE_Real) hypre_ParVectorMemorySize(F_array[level]);
+      }
+      if (U_array)
+      {
+         bytes[5] += (HYPRE_Real) hypre_ParVectorMemorySize(U_array[level]);
+      }
+   }
+   else
+   {
+      bytes[5] += (HYPRE_Real) hypre_ParVectorMemorySize(hypre_ParAMGDataVtemp(amg_data));
+      bytes[5] += (HYPRE_Real) hypre_ParVectorMemorySize(hypre_ParAMGDataRtemp(amg_data));
+      bytes[5] += (HYPRE_Real) hypre_ParVectorMemorySize(hypre_ParAMGDataPtemp(amg_data));
+      bytes[5] += (HYPRE_Real) hypre_ParVectorMemorySize(hypre_ParAMGDataZtemp(amg_data));
+      bytes[5] += (HYPRE_Real) hypre_ParVectorMemorySize(hypre_ParAMGDataResidual(amg_data));
+   }
+
+   /* Other setup data */
+   if (hypre_ParAMGDataCFMarkerArray(amg_data) &&
+       (int_array = hypre_ParAMGDataCFMarkerArray(amg_data)[level]) != NULL)
+   {
+      bytes[6] += (HYPRE_Real) (sizeof(hypre_IntArray) +
+                                hypre_IntArraySize(int_array) * sizeof(HYPRE_Int));
+   }
+   if (hypre_ParAMGDataDofFuncArray(amg_data) &&
+       (int_array = hypre_ParAMGDataDofFuncArray(amg_data)[level]) != NULL)
+   {
+      bytes[6] += (HYPRE_Real) (sizeof(hypre_IntArray) +
+                                hypre_IntArraySize(int_array) * sizeof(HYPRE_Int));
+   }
+   if (level < hypre_ParAMGDataReuseNumLevels(amg_data))
+   {
+      if (hypre_ParAMGDataReuseSArray(amg_data) && hypre_ParAMGDataReuseSArray(amg_data)[level])
+      {
+         M[0] = hypre_ParAMGDataReuseSArray(amg_data)[level];
+         bytes[6] += (HYPRE_Real) hypre_ParCSRMatrixMemorySize(M[0]);
+         bytes[6] += (HYPRE_Real) hypre_ParCSRCommPkgMemorySize(hypre_ParCSRMatrixCommPkg(M[0]));
+      }
+      if (hypre_ParAMGDataReuseCFMarkerArray(amg_data) &&
+          (int_array = hypre_ParAMGDataReuseCFMarkerArray(amg_data)[level]) != NULL)
+      {
+         bytes[6] += (HYPRE_Real) (sizeof(hypre_IntArray) +
+                                   hypre_IntArraySize(int_array) * sizeof(HYPRE_Int));
+      }
+      if (hypre_ParAMGDataReuseAPArray(amg_data))
+      {
+         bytes[6] += (HYPRE_Real)
+                     hypre_ParCSRMatMatDataMemorySize(hypre_ParAMGDataReuseAPArray(amg_data)[level]);
+      }
+      if (hypre_ParAMGDataReuseRAPArray(amg_data))
+      {
+         bytes[6] += (HYPRE_Real)
+                     hypre_ParCSRMatMatDataMemorySize(hypre_ParAMGDataReuseRAPArray(amg_data)[level]);
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------
+ * hypre_BoomerAMGGetMemoryUsage
+ *
+ * Returns the bytes held on this process by the AMG hierarchy for the
+ * given level (-1 for all levels) and object class (-1 for all classes).
+ * See hypre_BoomerAMGLevelMemoryUsage for the list of classes. The sizes
+ * are computed from the current hierarchy on each call.
+ *--------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGGetMemoryUsage( void       *data,
+                               HYPRE_Int   level,
+                               HYPRE_Int   object_class,
+                               HYPRE_Real *bytes )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+   HYPRE_Real        class_bytes[HYPRE_AMG_NUM_MEMORY_CLASSES];
+   HYPRE_Int         num_levels, first, last, i;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   num_levels = hypre_ParAMGDataNumLevels(amg_data);
+   if (level < -1 || level >= num_levels)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   if (object_class < -1 || object_class >= HYPRE_AMG_NUM_MEMORY_CLASSES)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+   if (!bytes)
+   {
+      hypre_error_in_arg(4);
+      return hypre_error_flag;
+   }
+
+   for (i = 0; i < HYPRE_AMG_NUM_MEMORY_CLASSES; i++)
+   {
+      class_bytes[i] = 0.0;
+   }
+
+   /* Nothing to count before the setup */
+   if (hypre_ParAMGDataAArray(amg_data))
+   {
+      first = (level < 0) ? 0 : level;
+      last  = (level < 0) ? num_levels : level + 1;
+      for (i = first; i < last; i++)
+      {
+         hypre_BoomerAMGLevelMemoryUsage(data, i, class_bytes);
+      }
+   }
+
+   if (object_class < 0)
+   {
+      *bytes = 0.0;
+      for (i = 0; i < HYPRE_AMG_NUM_MEMORY_CLASSES; i++)
+      {
+         *bytes += class_bytes[i];
+      }
+   }
+   else
+   {
+      *bytes = class_bytes[object_class];
+   }
+
+   return hypre_error_flag;
+}
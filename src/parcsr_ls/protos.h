@@ -436,6 +436,11 @@ HYPRE_Int HYPRE_BoomerAMGSetSetupType ( HYPRE_Solver solver, HYPRE_Int setup_typ
 HYPRE_Int HYPRE_BoomerAMGSetOldDefault ( HYPRE_Solver solver );
 HYPRE_Int HYPRE_BoomerAMGSetFCycle ( HYPRE_Solver solver, HYPRE_Int fcycle );
 HYPRE_Int HYPRE_BoomerAMGGetFCycle ( HYPRE_Solver solver, HYPRE_Int *fcycle );
+HYPRE_Int HYPRE_BoomerAMGSetAdaptiveCycle ( HYPRE_Solver solver, HYPRE_Int adaptive_cycle );
+HYPRE_Int HYPRE_BoomerAMGGetAdaptiveCycle ( HYPRE_Solver solver, HYPRE_Int *adaptive_cycle );
+HYPRE_Int HYPRE_BoomerAMGSetAdaptiveCycleTol ( HYPRE_Solver solver, HYPRE_Real adaptive_cycle_tol );
+HYPRE_Int HYPRE_BoomerAMGGetAdaptiveCycleTol ( HYPRE_Solver solver,
+                                               HYPRE_Real *adaptive_cycle_tol );
 HYPRE_Int HYPRE_BoomerAMGSetCycleType ( HYPRE_Solver solver, HYPRE_Int cycle_type );
 HYPRE_Int HYPRE_BoomerAMGGetCycleType ( HYPRE_Solver solver, HYPRE_Int *cycle_type );
 HYPRE_Int HYPRE_BoomerAMGSetConvergeType ( HYPRE_Solver solver, HYPRE_Int type );
@@ -566,6 +571,8 @@ HYPRE_Int HYPRE_BoomerAMGSetChebyFraction ( HYPRE_Solver solver, HYPRE_Real rati
 HYPRE_Int HYPRE_BoomerAMGSetChebyEigEst ( HYPRE_Solver solver, HYPRE_Int eig_est );
 HYPRE_Int HYPRE_BoomerAMGSetChebyVariant ( HYPRE_Solver solver, HYPRE_Int variant );
 HYPRE_Int HYPRE_BoomerAMGSetChebyScale ( HYPRE_Solver solver, HYPRE_Int scale );
+HYPRE_Int HYPRE_BoomerAMGSetChebyLanczos ( HYPRE_Solver solver, HYPRE_Int lanczos );
+HYPRE_Int HYPRE_BoomerAMGSetChebyEigRefreshTol ( HYPRE_Solver solver, HYPRE_Real refresh_tol );
 HYPRE_Int HYPRE_BoomerAMGSetInterpVectors ( HYPRE_Solver solver, HYPRE_Int num_vectors,
                                             HYPRE_ParVector *vectors );
 HYPRE_Int HYPRE_BoomerAMGSetInterpVecVariant ( HYPRE_Solver solver, HYPRE_Int num );
@@ -590,6 +597,11 @@ HYPRE_Int HYPRE_BoomerAMGSetNonGalerkTol ( HYPRE_Solver solver, HYPRE_Int nongal
 HYPRE_Int HYPRE_BoomerAMGSetRAP2 ( HYPRE_Solver solver, HYPRE_Int rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetModuleRAP2 ( HYPRE_Solver solver, HYPRE_Int mod_rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetKeepTranspose ( HYPRE_Solver solver, HYPRE_Int keepTranspose );
+HYPRE_Int HYPRE_BoomerAMGSetMatvecFormat ( HYPRE_Solver solver, HYPRE_Int matvec_format );
+HYPRE_Int HYPRE_BoomerAMGSetMatvecFormatNumLevels ( HYPRE_Solver solver, HYPRE_Int num_levels );
+HYPRE_Int HYPRE_BoomerAMGSetMatvecOverlap ( HYPRE_Solver solver, HYPRE_Int matvec_overlap );
+HYPRE_Int HYPRE_BoomerAMGSetSinglePrecisionLevel ( HYPRE_Solver solver, HYPRE_Int level );
+HYPRE_Int HYPRE_BoomerAMGSetSetupReuse ( HYPRE_Solver solver, HYPRE_Int setup_reuse );
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int HYPRE_BoomerAMGSetDSLUThreshold ( HYPRE_Solver solver, HYPRE_Int slu_threshold );
 #endif
@@ -603,6 +615,8 @@ HYPRE_Int HYPRE_BoomerAMGSetFPoints( HYPRE_Solver solver, HYPRE_Int num_fpt,
                                      HYPRE_BigInt *fpt_index );
 HYPRE_Int HYPRE_BoomerAMGSetCumNnzAP ( HYPRE_Solver solver, HYPRE_Real cum_nnz_AP );
 HYPRE_Int HYPRE_BoomerAMGGetCumNnzAP ( HYPRE_Solver solver, HYPRE_Real *cum_nnz_AP );
+HYPRE_Int HYPRE_BoomerAMGGetMemoryUsage ( HYPRE_Solver solver, HYPRE_Int level,
+                                         HYPRE_Int object_class, HYPRE_Real *bytes );
 
 /* HYPRE_parcsr_amgdd.c */
 HYPRE_Int HYPRE_BoomerAMGDDSetup ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A, HYPRE_ParVector b,
@@ -935,6 +949,8 @@ HYPRE_Int HYPRE_FSAISetThreshold ( HYPRE_Solver solver, HYPRE_Real threshold );
 HYPRE_Int HYPRE_FSAIGetThreshold ( HYPRE_Solver solver, HYPRE_Real *threshold );
 HYPRE_Int HYPRE_FSAISetKapTolerance ( HYPRE_Solver solver, HYPRE_Real kap_tolerance );
 HYPRE_Int HYPRE_FSAIGetKapTolerance ( HYPRE_Solver solver, HYPRE_Real *kap_tolerance );
+HYPRE_Int HYPRE_FSAISetReuse ( HYPRE_Solver solver, HYPRE_Int reuse );
+HYPRE_Int HYPRE_FSAIGetReuse ( HYPRE_Solver solver, HYPRE_Int *reuse );
 HYPRE_Int HYPRE_FSAISetTolerance ( HYPRE_Solver solver, HYPRE_Real tolerance );
 HYPRE_Int HYPRE_FSAIGetTolerance ( HYPRE_Solver solver, HYPRE_Real *tolerance );
 HYPRE_Int HYPRE_FSAISetOmega ( HYPRE_Solver solver, HYPRE_Real omega );
@@ -1060,6 +1076,10 @@ HYPRE_Int hypre_BoomerAMGSetSetupType ( void *data, HYPRE_Int setup_type );
 HYPRE_Int hypre_BoomerAMGGetSetupType ( void *data, HYPRE_Int *setup_type );
 HYPRE_Int hypre_BoomerAMGSetFCycle ( void *data, HYPRE_Int fcycle );
 HYPRE_Int hypre_BoomerAMGGetFCycle ( void *data, HYPRE_Int *fcycle );
+HYPRE_Int hypre_BoomerAMGSetAdaptiveCycle ( void *data, HYPRE_Int adaptive_cycle );
+HYPRE_Int hypre_BoomerAMGGetAdaptiveCycle ( void *data, HYPRE_Int *adaptive_cycle );
+HYPRE_Int hypre_BoomerAMGSetAdaptiveCycleTol ( void *data, HYPRE_Real adaptive_cycle_tol );
+HYPRE_Int hypre_BoomerAMGGetAdaptiveCycleTol ( void *data, HYPRE_Real *adaptive_cycle_tol );
 HYPRE_Int hypre_BoomerAMGSetCycleType ( void *data, HYPRE_Int cycle_type );
 HYPRE_Int hypre_BoomerAMGGetCycleType ( void *data, HYPRE_Int *cycle_type );
 HYPRE_Int hypre_BoomerAMGSetConvergeType ( void *data, HYPRE_Int type );
@@ -1187,6 +1207,8 @@ HYPRE_Int hypre_BoomerAMGSetChebyFraction ( void *data, HYPRE_Real ratio );
 HYPRE_Int hypre_BoomerAMGSetChebyEigEst ( void *data, HYPRE_Int eig_est );
 HYPRE_Int hypre_BoomerAMGSetChebyVariant ( void *data, HYPRE_Int variant );
 HYPRE_Int hypre_BoomerAMGSetChebyScale ( void *data, HYPRE_Int scale );
+HYPRE_Int hypre_BoomerAMGSetChebyLanczos ( void *data, HYPRE_Int cheby_lanczos );
+HYPRE_Int hypre_BoomerAMGSetChebyEigRefreshTol ( void *data, HYPRE_Real refresh_tol );
 HYPRE_Int hypre_BoomerAMGSetInterpVectors ( void *solver, HYPRE_Int num_vectors,
                                             hypre_ParVector **interp_vectors );
 HYPRE_Int hypre_BoomerAMGSetInterpVecVariant ( void *solver, HYPRE_Int var );
@@ -1210,6 +1232,16 @@ HYPRE_Int hypre_BoomerAMGSetNonGalerkTol ( void *data, HYPRE_Int nongalerk_num_t
 HYPRE_Int hypre_BoomerAMGSetRAP2 ( void *data, HYPRE_Int rap2 );
 HYPRE_Int hypre_BoomerAMGSetModuleRAP2 ( void *data, HYPRE_Int mod_rap2 );
 HYPRE_Int hypre_BoomerAMGSetKeepTranspose ( void *data, HYPRE_Int keepTranspose );
+HYPRE_Int hypre_BoomerAMGSetMatvecFormat ( void *data, HYPRE_Int matvec_format );
+HYPRE_Int hypre_BoomerAMGSetMatvecFormatNumLevels ( void *data, HYPRE_Int num_levels );
+HYPRE_Int hypre_BoomerAMGSetMatvecOverlap ( void *data, HYPRE_Int matvec_overlap );
+HYPRE_Int hypre_BoomerAMGSetSinglePrecisionLevel ( void *data, HYPRE_Int level );
+HYPRE_Int hypre_BoomerAMGSetSetupReuse ( void *data, HYPRE_Int setup_reuse );
+HYPRE_Int hypre_BoomerAMGSetupReuseCreate ( void *data, HYPRE_Int num_levels );
+HYPRE_Int hypre_BoomerAMGSetupReuseDestroy ( void *data );
+HYPRE_Int hypre_BoomerAMGSetupReuseClearLevels ( void *data, HYPRE_Int level );
+HYPRE_Int hypre_BoomerAMGSetupReuseStoreKey ( void *data, hypre_ParCSRMatrix *A, HYPRE_Int level );
+HYPRE_Int hypre_BoomerAMGSetupReuseMatches ( void *data, hypre_ParCSRMatrix *A, HYPRE_Int level );
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int hypre_BoomerAMGSetDSLUThreshold ( void *data, HYPRE_Int slu_threshold );
 #endif
@@ -1268,6 +1300,9 @@ HYPRE_Int hypre_ParCSRRelax_Cheby_Solve ( hypre_ParCSRMatrix *A, hypre_ParVector
                                           hypre_ParVector *u, hypre_ParVector *v, hypre_ParVector *r, hypre_ParVector *orig_u_vec,
                                           hypre_ParVector *tmp_vec);
 
+HYPRE_Int hypre_ParCSRRelax_Cheby_SolveFourthKindHost ( hypre_ParCSRMatrix *A, hypre_ParVector *f,
+                                                        HYPRE_Real *ds_data, HYPRE_Real *coefs, HYPRE_Int order, HYPRE_Int scale, hypre_ParVector *u,
+                                                        hypre_ParVector *v, hypre_ParVector *r );
 HYPRE_Int hypre_ParCSRRelax_Cheby_SolveHost ( hypre_ParCSRMatrix *A, hypre_ParVector *f,
                                               HYPRE_Real *ds_data, HYPRE_Real *coefs, HYPRE_Int order, HYPRE_Int scale, HYPRE_Int variant,
                                               hypre_ParVector *u, hypre_ParVector *v, hypre_ParVector *r, hypre_ParVector *orig_u_vec,
@@ -1672,6 +1707,9 @@ HYPRE_Int hypre_BoomerAMGBuildCoarseOperator ( hypre_ParCSRMatrix *RT, hypre_Par
                                                hypre_ParCSRMatrix *P, hypre_ParCSRMatrix **RAP_ptr );
 HYPRE_Int hypre_BoomerAMGBuildCoarseOperatorKT ( hypre_ParCSRMatrix *RT, hypre_ParCSRMatrix *A,
                                                  hypre_ParCSRMatrix *P, HYPRE_Int keepTranspose, hypre_ParCSRMatrix **RAP_ptr );
+HYPRE_Int hypre_BoomerAMGBuildCoarseOperatorReuse ( hypre_ParCSRMatrix *P, hypre_ParCSRMatrix *A,
+                                                    HYPRE_Int keepTranspose, hypre_ParCSRMatMatData **AP_data_ptr,
+                                                    hypre_ParCSRMatMatData **RAP_data_ptr, hypre_ParCSRMatrix **RAP_ptr );
 
 /* par_rap_communication.c */
 HYPRE_Int hypre_GetCommPkgRTFromCommPkgA ( hypre_ParCSRMatrix *RT, hypre_ParCSRMatrix *A,
@@ -1690,6 +1728,12 @@ HYPRE_Int hypre_GaussElimSetup ( hypre_ParAMGData *amg_data, HYPRE_Int level,
                                  HYPRE_Int solver_type );
 HYPRE_Int hypre_GaussElimSolve ( hypre_ParAMGData *amg_data, HYPRE_Int level,
                                  HYPRE_Int solver_type );
+HYPRE_Int hypre_GaussElimBandFactor ( HYPRE_Int n, HYPRE_Int kl, HYPRE_Int ku, HYPRE_Real *ab,
+                                      HYPRE_Int *piv );
+HYPRE_Int hypre_GaussElimBandSolve ( HYPRE_Int n, HYPRE_Int kl, HYPRE_Int ku, HYPRE_Real *ab,
+                                     HYPRE_Int *piv, HYPRE_Real *b );
+HYPRE_Int hypre_GaussElimBandedSetup ( hypre_ParAMGData *amg_data, HYPRE_Int level );
+HYPRE_Int hypre_GaussElimBandedSolve ( hypre_ParAMGData *amg_data, HYPRE_Int level );
 
 /* par_relax.c */
 HYPRE_Int hypre_BoomerAMGRelax ( hypre_ParCSRMatrix *A, hypre_ParVector *f, HYPRE_Int *cf_marker,
@@ -1700,6 +1744,10 @@ HYPRE_Int hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A, hyp
                                                       HYPRE_Real *l1_norms, hypre_ParVector *u, hypre_ParVector *Vtemp, hypre_ParVector *Ztemp,
                                                       HYPRE_Int GS_order, HYPRE_Int Symm, HYPRE_Int Skip_diag, HYPRE_Int forced_seq,
                                                       HYPRE_Int Topo_order );
+HYPRE_Int hypre_BoomerAMGRelaxHybridGaussSeidelMultiVec( hypre_ParCSRMatrix *A, hypre_ParVector *f,
+                                                         HYPRE_Int *cf_marker, HYPRE_Int relax_points, HYPRE_Real relax_weight, HYPRE_Real omega,
+                                                         HYPRE_Real *l1_norms, hypre_ParVector *u, hypre_ParVector *Vtemp, HYPRE_Int GS_order,
+                                                         HYPRE_Int Symm, HYPRE_Int Skip_diag, HYPRE_Int forced_seq );
 HYPRE_Int hypre_BoomerAMGRelax0WeightedJacobi( hypre_ParCSRMatrix *A, hypre_ParVector *f,
                                                HYPRE_Int *cf_marker, HYPRE_Int relax_points, HYPRE_Real relax_weight, hypre_ParVector *u,
                                                hypre_ParVector *Vtemp );
@@ -1802,6 +1850,16 @@ HYPRE_Int hypre_BoomerAMGRelaxIF ( hypre_ParCSRMatrix *A, hypre_ParVector *f, HY
                                    HYPRE_Real omega, HYPRE_Real *l1_norms, hypre_ParVector *u, hypre_ParVector *Vtemp,
                                    hypre_ParVector *Ztemp );
 
+/* par_relax_multicolor.c */
+HYPRE_Int hypre_BoomerAMGRelaxMulticolorSetup ( hypre_ParCSRMatrix *A, hypre_CSRMatrix **mc_diag_ptr,
+                                                hypre_IntArray **perm_ptr, hypre_IntArray **color_starts_ptr );
+HYPRE_Int hypre_BoomerAMGRelaxMulticolor ( hypre_ParCSRMatrix *A, hypre_ParVector *f,
+                                           hypre_CSRMatrix *mc_diag, hypre_IntArray *perm, hypre_IntArray *color_starts,
+                                           HYPRE_Int relax_type, HYPRE_Real relax_weight, hypre_ParVector *u, hypre_ParVector *Vtemp );
+HYPRE_Int hypre_BoomerAMGRelaxMulticolorOnce ( hypre_ParCSRMatrix *A, hypre_ParVector *f,
+                                               HYPRE_Int relax_type, HYPRE_Real relax_weight, hypre_ParVector *u,
+                                               hypre_ParVector *Vtemp );
+
 /* par_relax_more.c */
 HYPRE_Int hypre_ParCSRMaxEigEstimate ( hypre_ParCSRMatrix *A, HYPRE_Int scale, HYPRE_Real *max_eig,
                                        HYPRE_Real *min_eig );
@@ -1811,6 +1869,10 @@ HYPRE_Int hypre_ParCSRMaxEigEstimateCG ( hypre_ParCSRMatrix *A, HYPRE_Int scale,
                                          HYPRE_Real *max_eig, HYPRE_Real *min_eig );
 HYPRE_Int hypre_ParCSRMaxEigEstimateCGHost ( hypre_ParCSRMatrix *A, HYPRE_Int scale,
                                              HYPRE_Int max_iter, HYPRE_Real *max_eig, HYPRE_Real *min_eig );
+HYPRE_Int hypre_ParCSRMaxEigEstimateLanczos ( hypre_ParCSRMatrix *A, HYPRE_Int scale,
+                                              HYPRE_Int max_iter, HYPRE_Real *max_eig, HYPRE_Real *min_eig );
+HYPRE_Int hypre_ParCSRMaxEigEstimateLanczosHost ( hypre_ParCSRMatrix *A, HYPRE_Int scale,
+                                                  HYPRE_Int max_iter, HYPRE_Real *max_eig, HYPRE_Real *min_eig );
 HYPRE_Int hypre_ParCSRRelax_Cheby ( hypre_ParCSRMatrix *A, hypre_ParVector *f, HYPRE_Real max_eig,
                                     HYPRE_Real min_eig, HYPRE_Real fraction, HYPRE_Int order, HYPRE_Int scale, HYPRE_Int variant,
                                     hypre_ParVector *u, hypre_ParVector *v, hypre_ParVector *r );
@@ -1863,6 +1925,9 @@ HYPRE_Int hypre_SchwarzSetDofFunc ( void *data, HYPRE_Int *dof_func );
 /* par_stats.c */
 HYPRE_Int hypre_BoomerAMGSetupStats ( void *amg_vdata, hypre_ParCSRMatrix *A );
 HYPRE_Int hypre_BoomerAMGWriteSolverParams ( void *data );
+HYPRE_Int hypre_BoomerAMGLevelMemoryUsage ( void *data, HYPRE_Int level, HYPRE_Real *bytes );
+HYPRE_Int hypre_BoomerAMGGetMemoryUsage ( void *data, HYPRE_Int level, HYPRE_Int object_class,
+                                         HYPRE_Real *bytes );
 const char* hypre_BoomerAMGGetProlongationName( hypre_ParAMGData *amg_data );
 const char* hypre_BoomerAMGGetAggProlongationName( hypre_ParAMGData *amg_data );
 const char* hypre_BoomerAMGGetCoarseningName( hypre_ParAMGData *amg_data );
@@ -1987,6 +2052,11 @@ HYPRE_Int hypre_ParKrylovMatvecDestroy ( void *matvec_data );
 HYPRE_Real hypre_ParKrylovInnerProd ( void *x, void *y );
 HYPRE_Int hypre_ParKrylovMassInnerProd ( void *x, void **y, HYPRE_Int k, HYPRE_Int unroll,
                                          void *result );
+HYPRE_Int hypre_ParKrylovIInnerProd ( HYPRE_Int nprod, void **x, void **y, HYPRE_Real *result,
+                                      void **request );
+HYPRE_Int hypre_ParKrylovInnerProdWait ( void *request );
+HYPRE_Int hypre_ParKrylovBlockInnerProd ( void **x, HYPRE_Int nx, void **y, HYPRE_Int ny,
+                                         HYPRE_Real *result );
 HYPRE_Int hypre_ParKrylovMassDotpTwo ( void *x, void *y, void **z, HYPRE_Int k, HYPRE_Int unroll,
                                        void *result_x, void *result_y );
 HYPRE_Int hypre_ParKrylovMassAxpy( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k,
@@ -2381,6 +2451,10 @@ HYPRE_Int hypre_ILUGetInteriorExteriorPerm( hypre_ParCSRMatrix *A,
                                             HYPRE_MemoryLocation memory_location,
                                             HYPRE_Int **perm, HYPRE_Int *nLU,
                                             HYPRE_Int reordering_type );
+HYPRE_Int hypre_ILUGetDomainPartitionPerm( hypre_ParCSRMatrix *A, HYPRE_MemoryLocation memory_location,
+                                           HYPRE_Int **perm_ptr, HYPRE_Int nLU,
+                                           HYPRE_Int num_domains, HYPRE_Int *num_domains_ptr,
+                                           HYPRE_Int **domain_starts_ptr );
 HYPRE_Int hypre_ILUGetLocalPerm( hypre_ParCSRMatrix *A, HYPRE_Int **perm_ptr,
                                  HYPRE_Int *nLU, HYPRE_Int reordering_type );
 HYPRE_Int hypre_ILUBuildRASExternalMatrix( hypre_ParCSRMatrix *A, HYPRE_Int *rperm,
@@ -2482,6 +2556,9 @@ HYPRE_Int hypre_ILUSetupRAPILU0( hypre_ParCSRMatrix *A, HYPRE_Int *perm, HYPRE_I
                                  hypre_ParCSRMatrix **Uptr, hypre_ParCSRMatrix **mLptr,
                                  HYPRE_Real **mDptr, hypre_ParCSRMatrix **mUptr,
                                  HYPRE_Int **u_end );
+HYPRE_Int hypre_ILUSetupLevelSchedule( hypre_CSRMatrix *T, HYPRE_Int upper,
+                                       HYPRE_Int *num_levels_ptr, HYPRE_Int **level_i_ptr,
+                                       HYPRE_Int **level_j_ptr );
 HYPRE_Int hypre_ILUSetupILU0( hypre_ParCSRMatrix  *A, HYPRE_Int *perm, HYPRE_Int *qperm,
                               HYPRE_Int nLU, HYPRE_Int nI, hypre_ParCSRMatrix **Lptr,
                               HYPRE_Real **Dptr, hypre_ParCSRMatrix **Uptr,
@@ -2497,14 +2574,32 @@ HYPRE_Int hypre_ILUSetupILUKSymbolic( HYPRE_Int n, HYPRE_Int *A_diag_i, HYPRE_In
                                       HYPRE_Int *U_diag_i, HYPRE_Int *S_diag_i,
                                       HYPRE_Int **L_diag_j, HYPRE_Int **U_diag_j,
                                       HYPRE_Int **S_diag_j, HYPRE_Int **u_end );
+HYPRE_Int hypre_ILUSetupILUKRows( HYPRE_Int row_start, HYPRE_Int row_end,
+                                  hypre_CSRMatrix *A_diag, HYPRE_Int *perm, HYPRE_Int *rperm,
+                                  HYPRE_Int *iw, HYPRE_Real *D_data, HYPRE_Int *L_diag_i,
+                                  HYPRE_Int *L_diag_j, HYPRE_Real *L_diag_data,
+                                  HYPRE_Int *U_diag_i, HYPRE_Int *U_diag_j,
+                                  HYPRE_Real *U_diag_data );
 HYPRE_Int hypre_ILUSetupILUK( hypre_ParCSRMatrix *A, HYPRE_Int lfil, HYPRE_Int *permp,
                               HYPRE_Int *qpermp, HYPRE_Int nLU, HYPRE_Int nI,
+                              HYPRE_Int num_domains, HYPRE_Int *domain_starts,
                               hypre_ParCSRMatrix **Lptr, HYPRE_Real **Dptr,
                               hypre_ParCSRMatrix **Uptr, hypre_ParCSRMatrix **Sptr,
                               HYPRE_Int **u_end );
+HYPRE_Int hypre_ILUSetupILUTRows( HYPRE_Int row_start, HYPRE_Int row_end, HYPRE_Int row_offset,
+                                  HYPRE_Int lfil, HYPRE_Real *tol, HYPRE_Int nLU, HYPRE_Int m,
+                                  hypre_CSRMatrix *A_diag, HYPRE_Int *perm, HYPRE_Int *rperm,
+                                  HYPRE_Int *iw, HYPRE_Int *iL, HYPRE_Real *w,
+                                  HYPRE_Real *D_data, HYPRE_Int *L_diag_i,
+                                  HYPRE_Int **L_diag_j_ptr, HYPRE_Real **L_diag_data_ptr,
+                                  HYPRE_Int *capacity_L_ptr, HYPRE_Int *U_diag_i,
+                                  HYPRE_Int **U_diag_j_ptr, HYPRE_Real **U_diag_data_ptr,
+                                  HYPRE_Int *capacity_U_ptr, HYPRE_Int *u_end_array,
+                                  HYPRE_MemoryLocation memory_location );
 HYPRE_Int hypre_ILUSetupILUT( hypre_ParCSRMatrix *A, HYPRE_Int lfil, HYPRE_Real *tol,
                               HYPRE_Int *permp, HYPRE_Int *qpermp, HYPRE_Int nLU,
-                              HYPRE_Int nI, hypre_ParCSRMatrix **Lptr, HYPRE_Real **Dptr,
+                              HYPRE_Int nI, HYPRE_Int num_domains, HYPRE_Int *domain_starts,
+                              hypre_ParCSRMatrix **Lptr, HYPRE_Real **Dptr,
                               hypre_ParCSRMatrix **Uptr, hypre_ParCSRMatrix **Sptr,
                               HYPRE_Int **u_end );
 HYPRE_Int hypre_NSHSetup( void *nsh_vdata, hypre_ParCSRMatrix *A,
@@ -2557,6 +2652,13 @@ HYPRE_Int hypre_ILUSolveLU( hypre_ParCSRMatrix *A, hypre_ParVector *f,
                             hypre_ParVector *u, HYPRE_Int *perm, HYPRE_Int nLU,
                             hypre_ParCSRMatrix *L, HYPRE_Real *D, hypre_ParCSRMatrix *U,
                             hypre_ParVector *ftemp, hypre_ParVector *utemp );
+HYPRE_Int hypre_ILUSolveLULevels( hypre_ParCSRMatrix *A, hypre_ParVector *f,
+                                  hypre_ParVector *u, HYPRE_Int *perm, HYPRE_Int nLU,
+                                  hypre_ParCSRMatrix *L, HYPRE_Real *D, hypre_ParCSRMatrix *U,
+                                  hypre_ParVector *ftemp, hypre_ParVector *utemp,
+                                  HYPRE_Int num_lower_levels, HYPRE_Int *lower_level_i,
+                                  HYPRE_Int *lower_level_j, HYPRE_Int num_upper_levels,
+                                  HYPRE_Int *upper_level_i, HYPRE_Int *upper_level_j );
 HYPRE_Int hypre_ILUSolveLUIter( hypre_ParCSRMatrix *A, hypre_ParVector *f,
                                 hypre_ParVector *u, HYPRE_Int *perm, HYPRE_Int nLU,
                                 hypre_ParCSRMatrix *L, HYPRE_Real *D, hypre_ParCSRMatrix *U,
@@ -2797,6 +2899,7 @@ HYPRE_Int hypre_FSAISetMaxNnzRow ( void *data, HYPRE_Int max_nnz_row );
 HYPRE_Int hypre_FSAISetNumLevels ( void *data, HYPRE_Int num_levels );
 HYPRE_Int hypre_FSAISetThreshold ( void *data, HYPRE_Real threshold );
 HYPRE_Int hypre_FSAISetKapTolerance ( void *data, HYPRE_Real kap_tolerance );
+HYPRE_Int hypre_FSAISetReuse ( void *data, HYPRE_Int reuse );
 HYPRE_Int hypre_FSAISetMaxIterations ( void *data, HYPRE_Int max_iterations );
 HYPRE_Int hypre_FSAISetEigMaxIters ( void *data, HYPRE_Int eig_max_iters );
 HYPRE_Int hypre_FSAISetZeroGuess ( void *data, HYPRE_Int zero_guess );
@@ -2813,6 +2916,7 @@ HYPRE_Int hypre_FSAIGetMaxNnzRow ( void *data, HYPRE_Int *max_nnz_row );
 HYPRE_Int hypre_FSAIGetNumLevels ( void *data, HYPRE_Int *num_levels );
 HYPRE_Int hypre_FSAIGetThreshold ( void *data, HYPRE_Real *threshold );
 HYPRE_Int hypre_FSAIGetKapTolerance ( void *data, HYPRE_Real *kap_tolerance );
+HYPRE_Int hypre_FSAIGetReuse ( void *data, HYPRE_Int *reuse );
 HYPRE_Int hypre_FSAIGetMaxIterations ( void *data, HYPRE_Int *max_iterations );
 HYPRE_Int hypre_FSAIGetEigMaxIters ( void *data, HYPRE_Int *eig_max_iters );
 HYPRE_Int hypre_FSAIGetZeroGuess ( void *data, HYPRE_Int *zero_guess );
@@ -2841,6 +2945,9 @@ HYPRE_Int hypre_FSAISetupNative ( void *fsai_vdata, hypre_ParCSRMatrix *A,
                                   hypre_ParVector *f, hypre_ParVector *u );
 HYPRE_Int hypre_FSAISetupOMPDyn ( void *fsai_vdata, hypre_ParCSRMatrix *A,
                                   hypre_ParVector *f, hypre_ParVector *u );
+HYPRE_Int hypre_FSAISetupStaticPowerHost ( void *fsai_vdata, hypre_ParCSRMatrix *A,
+                                           hypre_ParVector *f, hypre_ParVector *u );
+HYPRE_Int hypre_FSAISetupValuesHost ( void *fsai_vdata, hypre_ParCSRMatrix *A );
 HYPRE_Int hypre_FSAIPrintStats ( void *fsai_vdata, hypre_ParCSRMatrix *A );
 HYPRE_Int hypre_FSAIComputeOmega ( void *fsai_vdata, hypre_ParCSRMatrix *A );
 void hypre_swap2_ci ( HYPRE_Complex *v, HYPRE_Int *w, HYPRE_Int i, HYPRE_Int j );
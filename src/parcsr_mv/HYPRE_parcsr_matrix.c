@@ -93,6 +93,39 @@ HYPRE_ParCSRMatrixPrint( HYPRE_ParCSRMatrix  matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRMatrixReadMPIIO
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRMatrixReadMPIIO( MPI_Comm            comm,
+                             const char         *file_name,
+                             HYPRE_BigInt       *row_starts,
+                             HYPRE_BigInt       *col_starts,
+                             HYPRE_ParCSRMatrix *matrix )
+{
+   if (!matrix)
+   {
+      hypre_error_in_arg(5);
+      return hypre_error_flag;
+   }
+
+   return ( hypre_ParCSRMatrixReadMPIIO( comm, file_name, row_starts, col_starts,
+                                         (hypre_ParCSRMatrix **) matrix ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRMatrixPrintMPIIO
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRMatrixPrintMPIIO( HYPRE_ParCSRMatrix  matrix,
+                              const char         *file_name )
+{
+   return ( hypre_ParCSRMatrixPrintMPIIO( (hypre_ParCSRMatrix *) matrix,
+                                          file_name ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_ParCSRMatrixGetComm
  *--------------------------------------------------------------------------*/
@@ -408,3 +441,103 @@ HYPRE_ParCSRMatrixMatvecT( HYPRE_Complex      alpha,
                alpha, (hypre_ParCSRMatrix *) A,
                (hypre_ParVector *) x, beta, (hypre_ParVector *) y) );
 }
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRMatrixSetMatvecFormat
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRMatrixSetMatvecFormat( HYPRE_ParCSRMatrix A,
+                                   HYPRE_Int          format )
+{
+   return ( hypre_ParCSRMatrixSetMatvecFormat( (hypre_ParCSRMatrix *) A, format ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRMatrixSetMatvecOverlap
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRMatrixSetMatvecOverlap( HYPRE_ParCSRMatrix A,
+                                    HYPRE_Int          overlap )
+{
+   return ( hypre_ParCSRMatrixSetMatvecOverlap( (hypre_ParCSRMatrix *) A, overlap ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRMatrixSetSinglePrecision
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRMatrixSetSinglePrecision( HYPRE_ParCSRMatrix A,
+                                      HYPRE_Int          single_precision )
+{
+   return ( hypre_ParCSRMatrixSetSinglePrecision( (hypre_ParCSRMatrix *) A, single_precision ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRMatrixCreateFromCSR
+ * Output argument (tenth argument): a new ParCSRmatrix built from the local
+ * rows of the calling process, given in CSR form with global column indices.
+ * row_starts and col_starts contain the first local row (column) followed
+ * by the first row (column) of the next process.
+ * If alias_values is nonzero, the matrix may keep a reference to values
+ * instead of copying them; values must then outlive the matrix.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRMatrixCreateFromCSR( MPI_Comm            comm,
+                                 HYPRE_BigInt        global_num_rows,
+                                 HYPRE_BigInt        global_num_cols,
+                                 HYPRE_BigInt       *row_starts,
+                                 HYPRE_BigInt       *col_starts,
+                                 HYPRE_Int          *row_ptr,
+                                 HYPRE_BigInt       *cols,
+                                 HYPRE_Complex      *values,
+                                 HYPRE_Int           alias_values,
+                                 HYPRE_ParCSRMatrix *matrix )
+{
+   if (!row_starts)
+   {
+      hypre_error_in_arg(4);
+      return hypre_error_flag;
+   }
+   if (!col_starts)
+   {
+      hypre_error_in_arg(5);
+      return hypre_error_flag;
+   }
+   if (!row_ptr)
+   {
+      hypre_error_in_arg(6);
+      return hypre_error_flag;
+   }
+   if (!matrix)
+   {
+      hypre_error_in_arg(10);
+      return hypre_error_flag;
+   }
+
+   *matrix = (HYPRE_ParCSRMatrix)
+             hypre_ParCSRMatrixCreateFromCSR( comm, global_num_rows, global_num_cols,
+                                              row_starts, col_starts, row_ptr,
+                                              cols, values, alias_values );
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRMatrixUpdateValuesFromCSR
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRMatrixUpdateValuesFromCSR( HYPRE_ParCSRMatrix  matrix,
+                                       HYPRE_Complex      *values )
+{
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   return ( hypre_ParCSRMatrixUpdateValuesFromCSR( (hypre_ParCSRMatrix *) matrix, values ) );
+}
@@ -44,6 +44,10 @@ HYPRE_Int HYPRE_ParCSRMatrixInitialize( HYPRE_ParCSRMatrix matrix );
 HYPRE_Int HYPRE_ParCSRMatrixRead( MPI_Comm comm, const char *file_name,
                                   HYPRE_ParCSRMatrix *matrix );
 HYPRE_Int HYPRE_ParCSRMatrixPrint( HYPRE_ParCSRMatrix matrix, const char *file_name );
+HYPRE_Int HYPRE_ParCSRMatrixReadMPIIO( MPI_Comm comm, const char *file_name,
+                                       HYPRE_BigInt *row_starts, HYPRE_BigInt *col_starts,
+                                       HYPRE_ParCSRMatrix *matrix );
+HYPRE_Int HYPRE_ParCSRMatrixPrintMPIIO( HYPRE_ParCSRMatrix matrix, const char *file_name );
 HYPRE_Int HYPRE_ParCSRMatrixGetComm( HYPRE_ParCSRMatrix matrix, MPI_Comm *comm );
 HYPRE_Int HYPRE_ParCSRMatrixGetDims( HYPRE_ParCSRMatrix matrix, HYPRE_BigInt *M, HYPRE_BigInt *N );
 HYPRE_Int HYPRE_ParCSRMatrixGetRowPartitioning( HYPRE_ParCSRMatrix matrix,
@@ -62,6 +66,14 @@ HYPRE_Int HYPRE_ParCSRMatrixMatvec( HYPRE_Complex alpha, HYPRE_ParCSRMatrix A, H
                                     HYPRE_Complex beta, HYPRE_ParVector y );
 HYPRE_Int HYPRE_ParCSRMatrixMatvecT( HYPRE_Complex alpha, HYPRE_ParCSRMatrix A, HYPRE_ParVector x,
                                      HYPRE_Complex beta, HYPRE_ParVector y );
+HYPRE_Int HYPRE_ParCSRMatrixSetMatvecFormat( HYPRE_ParCSRMatrix A, HYPRE_Int format );
+HYPRE_Int HYPRE_ParCSRMatrixSetMatvecOverlap( HYPRE_ParCSRMatrix A, HYPRE_Int overlap );
+HYPRE_Int HYPRE_ParCSRMatrixSetSinglePrecision( HYPRE_ParCSRMatrix A, HYPRE_Int single_precision );
+HYPRE_Int HYPRE_ParCSRMatrixCreateFromCSR( MPI_Comm comm, HYPRE_BigInt global_num_rows,
+                                           HYPRE_BigInt global_num_cols, HYPRE_BigInt *row_starts, HYPRE_BigInt *col_starts,
+                                           HYPRE_Int *row_ptr, HYPRE_BigInt *cols, HYPRE_Complex *values, HYPRE_Int alias_values,
+                                           HYPRE_ParCSRMatrix *matrix );
+HYPRE_Int HYPRE_ParCSRMatrixUpdateValuesFromCSR( HYPRE_ParCSRMatrix matrix, HYPRE_Complex *values );
 
 /* HYPRE_parcsr_vector.c */
 HYPRE_Int HYPRE_ParVectorCreate( MPI_Comm comm, HYPRE_BigInt global_size,
@@ -71,6 +83,9 @@ HYPRE_Int HYPRE_ParVectorInitialize( HYPRE_ParVector vector );
 HYPRE_Int HYPRE_ParVectorRead( MPI_Comm comm, const char *file_name, HYPRE_ParVector *vector );
 HYPRE_Int HYPRE_ParVectorPrint( HYPRE_ParVector vector, const char *file_name );
 HYPRE_Int HYPRE_ParVectorPrintBinaryIJ( HYPRE_ParVector vector, const char *file_name );
+HYPRE_Int HYPRE_ParVectorReadMPIIO( MPI_Comm comm, const char *file_name,
+                                    HYPRE_BigInt *partitioning, HYPRE_ParVector *vector );
+HYPRE_Int HYPRE_ParVectorPrintMPIIO( HYPRE_ParVector vector, const char *file_name );
 HYPRE_Int HYPRE_ParVectorSetConstantValues( HYPRE_ParVector vector, HYPRE_Complex value );
 HYPRE_Int HYPRE_ParVectorSetRandomValues( HYPRE_ParVector vector, HYPRE_Int seed );
 HYPRE_Int HYPRE_ParVectorCopy( HYPRE_ParVector x, HYPRE_ParVector y );
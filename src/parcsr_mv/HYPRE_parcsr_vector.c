@@ -116,6 +116,38 @@ HYPRE_ParVectorPrintBinaryIJ( HYPRE_ParVector  vector,
                                           file_name ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_ParVectorReadMPIIO
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParVectorReadMPIIO( MPI_Comm          comm,
+                          const char       *file_name,
+                          HYPRE_BigInt     *partitioning,
+                          HYPRE_ParVector  *vector )
+{
+   if (!vector)
+   {
+      hypre_error_in_arg(4);
+      return hypre_error_flag;
+   }
+
+   return ( hypre_ParVectorReadMPIIO( comm, file_name, partitioning,
+                                      (hypre_ParVector **) vector ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParVectorPrintMPIIO
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParVectorPrintMPIIO( HYPRE_ParVector  vector,
+                           const char      *file_name )
+{
+   return ( hypre_ParVectorPrintMPIIO( (hypre_ParVector *) vector,
+                                       file_name ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_ParVectorSetConstantValues
  *--------------------------------------------------------------------------*/
@@ -28,7 +28,6 @@ extern "C" {
  *   Structure containing information for doing communications
  *--------------------------------------------------------------------------*/
 
-#ifdef HYPRE_USING_PERSISTENT_COMM
 typedef enum CommPkgJobType
 {
    HYPRE_COMM_PKG_JOB_COMPLEX = 0,
@@ -39,7 +38,6 @@ typedef enum CommPkgJobType
    HYPRE_COMM_PKG_JOB_BIGINT_TRANSPOSE,
    NUM_OF_COMM_PKG_JOB_TYPE,
 } CommPkgJobType;
-#endif
 
 /*--------------------------------------------------------------------------
  * hypre_ParCSRCommHandle, hypre_ParCSRPersistentCommHandle
@@ -59,10 +57,98 @@ typedef struct
    void                 *recv_data_buffer;
    HYPRE_Int             num_requests;
    hypre_MPI_Request    *requests;
+   /* node-aware exchange: bytes per element (0 if not used), staging buffer,
+      schedule in use, and whether the leader has forwarded the gathered data */
+   HYPRE_Int             node_block_bytes;
+   void                 *node_buffer;
+   struct _hypre_ParCSRCommNodePkg *node_pkg;
+   HYPRE_Int             node_forwarded;
 } hypre_ParCSRCommHandle;
 
 typedef hypre_ParCSRCommHandle hypre_ParCSRPersistentCommHandle;
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommNodePkg:
+ *   Node-aware (two-level) schedule for the forward exchanges of a
+ *   hypre_ParCSRCommPkg. Neighbors on the same node are served directly.
+ *   Data for other nodes is gathered by the node leader, sent in one
+ *   message per pair of nodes, and scattered by
+ *   the leader of the destination node. Counts and positions below are in
+ *   units of one component of the comm package.
+ *
+ *   The optional merged schedule sends an element that goes to several ranks
+ *   of a node only once to that node. It is only valid for exchanges in
+ *   which the value sent at position i depends on send_map_elmts[i] alone.
+ *--------------------------------------------------------------------------*/
+
+typedef struct _hypre_ParCSRCommNodePkg
+{
+   HYPRE_Int   leader;           /* rank (in comm) of the leader of this node */
+
+   /* all ranks: on-node neighbors, as indices into send_procs/recv_procs */
+   HYPRE_Int   num_local_sends;
+   HYPRE_Int  *local_sends;
+   HYPRE_Int   num_local_recvs;
+   HYPRE_Int  *local_recvs;
+
+   /* all ranks: off-node data sent to and received from the leader,
+      as positions in the send/recv buffers of the exchange */
+   HYPRE_Int   num_send_elmts;
+   HYPRE_Int  *send_elmts;
+   HYPRE_Int   num_recv_elmts;
+   HYPRE_Int  *recv_elmts;
+
+   /* leader only: gather from on-node ranks */
+   HYPRE_Int   num_gathers;
+   HYPRE_Int  *gather_procs;
+   HYPRE_Int  *gather_starts;
+
+   /* leader only: messages to other leaders, packed from the gather buffer */
+   HYPRE_Int   num_node_sends;
+   HYPRE_Int  *node_send_procs;
+   HYPRE_Int  *node_send_starts;
+   HYPRE_Int  *node_send_elmts;
+
+   /* leader only: messages from other leaders */
+   HYPRE_Int   num_node_recvs;
+   HYPRE_Int  *node_recv_procs;
+   HYPRE_Int  *node_recv_starts;
+
+   /* leader only: scatter to on-node ranks, packed from the node recv buffer */
+   HYPRE_Int   num_scatters;
+   HYPRE_Int  *scatter_procs;
+   HYPRE_Int  *scatter_starts;
+   HYPRE_Int  *scatter_elmts;
+
+   /* schedule merging repeated elements (NULL if no rank has any) */
+   struct _hypre_ParCSRCommNodePkg *merged;
+} hypre_ParCSRCommNodePkg;
+
+#define hypre_ParCSRCommNodePkgLeader(node_pkg)          ((node_pkg) -> leader)
+#define hypre_ParCSRCommNodePkgNumLocalSends(node_pkg)   ((node_pkg) -> num_local_sends)
+#define hypre_ParCSRCommNodePkgLocalSends(node_pkg)      ((node_pkg) -> local_sends)
+#define hypre_ParCSRCommNodePkgNumLocalRecvs(node_pkg)   ((node_pkg) -> num_local_recvs)
+#define hypre_ParCSRCommNodePkgLocalRecvs(node_pkg)      ((node_pkg) -> local_recvs)
+#define hypre_ParCSRCommNodePkgNumSendElmts(node_pkg)    ((node_pkg) -> num_send_elmts)
+#define hypre_ParCSRCommNodePkgSendElmts(node_pkg)       ((node_pkg) -> send_elmts)
+#define hypre_ParCSRCommNodePkgNumRecvElmts(node_pkg)    ((node_pkg) -> num_recv_elmts)
+#define hypre_ParCSRCommNodePkgRecvElmts(node_pkg)       ((node_pkg) -> recv_elmts)
+#define hypre_ParCSRCommNodePkgNumGathers(node_pkg)      ((node_pkg) -> num_gathers)
+#define hypre_ParCSRCommNodePkgGatherProcs(node_pkg)     ((node_pkg) -> gather_procs)
+#define hypre_ParCSRCommNodePkgGatherStarts(node_pkg)    ((node_pkg) -> gather_starts)
+#define hypre_ParCSRCommNodePkgNumNodeSends(node_pkg)    ((node_pkg) -> num_node_sends)
+#define hypre_ParCSRCommNodePkgNodeSendProcs(node_pkg)   ((node_pkg) -> node_send_procs)
+#define hypre_ParCSRCommNodePkgNodeSendStarts(node_pkg)  ((node_pkg) -> node_send_starts)
+#define hypre_ParCSRCommNodePkgNodeSendElmts(node_pkg)   ((node_pkg) -> node_send_elmts)
+#define hypre_ParCSRCommNodePkgNumNodeRecvs(node_pkg)    ((node_pkg) -> num_node_recvs)
+#define hypre_ParCSRCommNodePkgNodeRecvProcs(node_pkg)   ((node_pkg) -> node_recv_procs)
+#define hypre_ParCSRCommNodePkgNodeRecvStarts(node_pkg)  ((node_pkg) -> node_recv_starts)
+#define hypre_ParCSRCommNodePkgNumScatters(node_pkg)     ((node_pkg) -> num_scatters)
+#define hypre_ParCSRCommNodePkgScatterProcs(node_pkg)    ((node_pkg) -> scatter_procs)
+#define hypre_ParCSRCommNodePkgScatterStarts(node_pkg)   ((node_pkg) -> scatter_starts)
+#define hypre_ParCSRCommNodePkgScatterElmts(node_pkg)    ((node_pkg) -> scatter_elmts)
+#define hypre_ParCSRCommNodePkgMerged(node_pkg)          ((node_pkg) -> merged)
+
 typedef struct _hypre_ParCSRCommPkg
 {
    MPI_Comm                          comm;
@@ -78,9 +164,9 @@ typedef struct _hypre_ParCSRCommPkg
    /* remote communication information */
    hypre_MPI_Datatype               *send_mpi_types;
    hypre_MPI_Datatype               *recv_mpi_types;
-#ifdef HYPRE_USING_PERSISTENT_COMM
    hypre_ParCSRPersistentCommHandle *persistent_comm_handles[NUM_OF_COMM_PKG_JOB_TYPE];
-#endif
+   /* node-aware schedule for jobs 1, 11 and 21 (NULL if not used) */
+   hypre_ParCSRCommNodePkg          *node_pkg;
 #if defined(HYPRE_USING_GPU) || defined(HYPRE_USING_DEVICE_OPENMP)
    /* temporary memory for matvec. cudaMalloc is expensive. alloc once and reuse */
    HYPRE_Complex                    *tmp_data;
@@ -113,6 +199,7 @@ typedef struct _hypre_ParCSRCommPkg
 #define hypre_ParCSRCommPkgSendMPIType(comm_pkg,i)       (comm_pkg -> send_mpi_types[i])
 #define hypre_ParCSRCommPkgRecvMPITypes(comm_pkg)        (comm_pkg -> recv_mpi_types)
 #define hypre_ParCSRCommPkgRecvMPIType(comm_pkg,i)       (comm_pkg -> recv_mpi_types[i])
+#define hypre_ParCSRCommPkgNodePkg(comm_pkg)             (comm_pkg -> node_pkg)
 
 #if defined(HYPRE_USING_GPU) || defined(HYPRE_USING_DEVICE_OPENMP)
 #define hypre_ParCSRCommPkgTmpData(comm_pkg)             ((comm_pkg) -> tmp_data)
@@ -159,6 +246,10 @@ hypre_ParCSRCommPkgCopySendMapElmtsToDevice(hypre_ParCSRCommPkg *comm_pkg)
 #define hypre_ParCSRCommHandleNumRequests(comm_handle)            (comm_handle -> num_requests)
 #define hypre_ParCSRCommHandleRequests(comm_handle)               (comm_handle -> requests)
 #define hypre_ParCSRCommHandleRequest(comm_handle, i)             (comm_handle -> requests[i])
+#define hypre_ParCSRCommHandleNodeBlockBytes(comm_handle)         (comm_handle -> node_block_bytes)
+#define hypre_ParCSRCommHandleNodeBuffer(comm_handle)             (comm_handle -> node_buffer)
+#define hypre_ParCSRCommHandleNodePkg(comm_handle)                (comm_handle -> node_pkg)
+#define hypre_ParCSRCommHandleNodeForwarded(comm_handle)          (comm_handle -> node_forwarded)
 
 #endif /* HYPRE_PAR_CSR_COMMUNICATION_HEADER */
 /******************************************************************************
@@ -303,6 +394,10 @@ hypre_ParVectorMemoryLocation(hypre_ParVector *vector)
 #define HYPRE_PAR_CSR_MATRIX_STRUCT
 #endif
 
+/* Number of chunks of interior rows computed between MPI progress calls
+   in the overlapped host matvec */
+#define HYPRE_MATVEC_OVERLAP_NUM_CHUNKS 8
+
 typedef struct hypre_ParCSRMatrix_struct
 {
    MPI_Comm              comm;
@@ -351,6 +446,21 @@ typedef struct hypre_ParCSRMatrix_struct
    used for triangulr matrices that are not ordered to be triangular. */
    HYPRE_Int            *proc_ordering;
 
+   /* Host matvec with communication/computation overlap: local rows without
+      offd entries (interior) come first in overlap_rows, followed by the
+      rows that need halo values (boundary). Built lazily. */
+   HYPRE_Int             matvec_overlap;
+   HYPRE_Int             num_interior_rows;
+   HYPRE_Int            *overlap_rows;
+
+   /* Matrices built from user CSR arrays (hypre_ParCSRMatrixCreateFromCSR):
+      csr_value_map[k] is the position of the k-th user value in diag (>= 0)
+      or offd (-pos-1). If csr_values_aliased is set, the values of diag are
+      the user array itself and there is no map. */
+   HYPRE_Int             csr_num_values;
+   HYPRE_Int            *csr_value_map;
+   HYPRE_Int             csr_values_aliased;
+
    /* Save block diagonal inverse */
    HYPRE_Int             bdiag_size;
    HYPRE_Complex        *bdiaginv;
@@ -395,6 +505,12 @@ typedef struct hypre_ParCSRMatrix_struct
 #define hypre_ParCSRMatrixAssumedPartition(matrix)       ((matrix) -> assumed_partition)
 #define hypre_ParCSRMatrixOwnsAssumedPartition(matrix)   ((matrix) -> owns_assumed_partition)
 #define hypre_ParCSRMatrixProcOrdering(matrix)           ((matrix) -> proc_ordering)
+#define hypre_ParCSRMatrixMatvecOverlap(matrix)          ((matrix) -> matvec_overlap)
+#define hypre_ParCSRMatrixNumInteriorRows(matrix)        ((matrix) -> num_interior_rows)
+#define hypre_ParCSRMatrixOverlapRows(matrix)            ((matrix) -> overlap_rows)
+#define hypre_ParCSRMatrixCSRNumValues(matrix)           ((matrix) -> csr_num_values)
+#define hypre_ParCSRMatrixCSRValueMap(matrix)            ((matrix) -> csr_value_map)
+#define hypre_ParCSRMatrixCSRValuesAliased(matrix)       ((matrix) -> csr_values_aliased)
 #if defined(HYPRE_USING_GPU)
 #define hypre_ParCSRMatrixSocDiagJ(matrix)               ((matrix) -> soc_diag_j)
 #define hypre_ParCSRMatrixSocOffdJ(matrix)               ((matrix) -> soc_offd_j)
@@ -437,6 +553,57 @@ hypre_ParCSRMatrixMemoryLocation(hypre_ParCSRMatrix *matrix)
    return HYPRE_MEMORY_UNDEFINED;
 }
 
+/*--------------------------------------------------------------------------
+ * Symbolic data of a host product C = A * B
+ *
+ * Built by hypre_ParCSRMatMatSymbolicHost and reused by
+ * hypre_ParCSRMatMatNumericHost for as long as A and B keep their patterns.
+ * The local product is C = A_cat * [B_cat_diag, B_cat_offd], where A_cat holds
+ * the rows of [A_diag, A_offd] and the B_cat matrices hold the local rows of B
+ * followed by the external rows received from other processes.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   /* operands seen by the symbolic phase */
+   HYPRE_BigInt           global_num_rows_A;
+   HYPRE_BigInt           global_num_cols_B;
+   hypre_ulonglongint     pattern_key_A;
+   hypre_ulonglongint     pattern_key_B;
+
+   /* local operands and pattern of the product */
+   hypre_CSRMatrix       *A_cat;
+   hypre_CSRMatrix       *B_cat_diag;
+   hypre_CSRMatrix       *B_cat_offd;
+   hypre_CSRMatrix       *C_diag;
+   hypre_CSRMatrix       *C_offd;
+   HYPRE_Int              num_cols_offd_C;
+   HYPRE_BigInt          *col_map_offd_C;
+
+   /* values-only exchange of the external rows of B */
+   hypre_ParCSRCommPkg   *ext_comm_pkg;
+   HYPRE_Int             *ext_send_offsets;
+   HYPRE_Int              num_ext_nonzeros;
+   HYPRE_Int             *ext_map;
+
+} hypre_ParCSRMatMatData;
+
+#define hypre_ParCSRMatMatDataGlobalNumRowsA(data)  ((data) -> global_num_rows_A)
+#define hypre_ParCSRMatMatDataGlobalNumColsB(data)  ((data) -> global_num_cols_B)
+#define hypre_ParCSRMatMatDataPatternKeyA(data)     ((data) -> pattern_key_A)
+#define hypre_ParCSRMatMatDataPatternKeyB(data)     ((data) -> pattern_key_B)
+#define hypre_ParCSRMatMatDataACat(data)            ((data) -> A_cat)
+#define hypre_ParCSRMatMatDataBCatDiag(data)        ((data) -> B_cat_diag)
+#define hypre_ParCSRMatMatDataBCatOffd(data)        ((data) -> B_cat_offd)
+#define hypre_ParCSRMatMatDataCDiag(data)           ((data) -> C_diag)
+#define hypre_ParCSRMatMatDataCOffd(data)           ((data) -> C_offd)
+#define hypre_ParCSRMatMatDataNumColsOffdC(data)    ((data) -> num_cols_offd_C)
+#define hypre_ParCSRMatMatDataColMapOffdC(data)     ((data) -> col_map_offd_C)
+#define hypre_ParCSRMatMatDataExtCommPkg(data)      ((data) -> ext_comm_pkg)
+#define hypre_ParCSRMatMatDataExtSendOffsets(data)  ((data) -> ext_send_offsets)
+#define hypre_ParCSRMatMatDataNumExtNonzeros(data)  ((data) -> num_ext_nonzeros)
+#define hypre_ParCSRMatMatDataExtMap(data)          ((data) -> ext_map)
+
 /*--------------------------------------------------------------------------
  * Parallel CSR Boolean Matrix
  *--------------------------------------------------------------------------*/
@@ -700,6 +867,10 @@ HYPRE_Int HYPRE_ParCSRMatrixBigInitialize ( HYPRE_ParCSRMatrix matrix );
 HYPRE_Int HYPRE_ParCSRMatrixRead ( MPI_Comm comm, const char *file_name,
                                    HYPRE_ParCSRMatrix *matrix );
 HYPRE_Int HYPRE_ParCSRMatrixPrint ( HYPRE_ParCSRMatrix matrix, const char *file_name );
+HYPRE_Int HYPRE_ParCSRMatrixReadMPIIO ( MPI_Comm comm, const char *file_name,
+                                        HYPRE_BigInt *row_starts, HYPRE_BigInt *col_starts,
+                                        HYPRE_ParCSRMatrix *matrix );
+HYPRE_Int HYPRE_ParCSRMatrixPrintMPIIO ( HYPRE_ParCSRMatrix matrix, const char *file_name );
 HYPRE_Int HYPRE_ParCSRMatrixGetComm ( HYPRE_ParCSRMatrix matrix, MPI_Comm *comm );
 HYPRE_Int HYPRE_ParCSRMatrixGetDims ( HYPRE_ParCSRMatrix matrix, HYPRE_BigInt *M, HYPRE_BigInt *N );
 HYPRE_Int HYPRE_ParCSRMatrixGetRowPartitioning ( HYPRE_ParCSRMatrix matrix,
@@ -722,6 +893,13 @@ HYPRE_Int HYPRE_ParCSRMatrixMatvec ( HYPRE_Complex alpha, HYPRE_ParCSRMatrix A,
                                      HYPRE_Complex beta, HYPRE_ParVector y );
 HYPRE_Int HYPRE_ParCSRMatrixMatvecT ( HYPRE_Complex alpha, HYPRE_ParCSRMatrix A, HYPRE_ParVector x,
                                       HYPRE_Complex beta, HYPRE_ParVector y );
+HYPRE_Int HYPRE_ParCSRMatrixSetMatvecFormat ( HYPRE_ParCSRMatrix A, HYPRE_Int format );
+HYPRE_Int HYPRE_ParCSRMatrixSetSinglePrecision ( HYPRE_ParCSRMatrix A, HYPRE_Int single_precision );
+HYPRE_Int HYPRE_ParCSRMatrixCreateFromCSR ( MPI_Comm comm, HYPRE_BigInt global_num_rows,
+                                            HYPRE_BigInt global_num_cols, HYPRE_BigInt *row_starts, HYPRE_BigInt *col_starts,
+                                            HYPRE_Int *row_ptr, HYPRE_BigInt *cols, HYPRE_Complex *values, HYPRE_Int alias_values,
+                                            HYPRE_ParCSRMatrix *matrix );
+HYPRE_Int HYPRE_ParCSRMatrixUpdateValuesFromCSR ( HYPRE_ParCSRMatrix matrix, HYPRE_Complex *values );
 
 /* HYPRE_parcsr_vector.c */
 HYPRE_Int HYPRE_ParVectorCreate ( MPI_Comm comm, HYPRE_BigInt global_size,
@@ -733,6 +911,9 @@ HYPRE_Int HYPRE_ParVectorInitialize ( HYPRE_ParVector vector );
 HYPRE_Int HYPRE_ParVectorRead ( MPI_Comm comm, const char *file_name, HYPRE_ParVector *vector );
 HYPRE_Int HYPRE_ParVectorPrint ( HYPRE_ParVector vector, const char *file_name );
 HYPRE_Int HYPRE_ParVectorPrintBinaryIJ ( HYPRE_ParVector vector, const char *file_name );
+HYPRE_Int HYPRE_ParVectorReadMPIIO ( MPI_Comm comm, const char *file_name,
+                                     HYPRE_BigInt *partitioning, HYPRE_ParVector *vector );
+HYPRE_Int HYPRE_ParVectorPrintMPIIO ( HYPRE_ParVector vector, const char *file_name );
 HYPRE_Int HYPRE_ParVectorSetConstantValues ( HYPRE_ParVector vector, HYPRE_Complex value );
 HYPRE_Int HYPRE_ParVectorSetRandomValues ( HYPRE_ParVector vector, HYPRE_Int seed );
 HYPRE_Int HYPRE_ParVectorCopy ( HYPRE_ParVector x, HYPRE_ParVector y );
@@ -894,6 +1075,12 @@ hypre_ParCSRCommHandle *hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int job,
                                                           void *send_data_in,
                                                           HYPRE_MemoryLocation recv_memory_location,
                                                           void *recv_data_in );
+hypre_ParCSRCommHandle *hypre_ParCSRCommHandleCreate_v3 ( HYPRE_Int job,
+                                                          hypre_ParCSRCommPkg *comm_pkg,
+                                                          HYPRE_MemoryLocation send_memory_location,
+                                                          void *send_data_in,
+                                                          HYPRE_MemoryLocation recv_memory_location,
+                                                          void *recv_data_in, HYPRE_Int elmtwise );
 HYPRE_Int hypre_ParCSRCommHandleDestroy ( hypre_ParCSRCommHandle *comm_handle );
 void hypre_ParCSRCommPkgCreate_core ( MPI_Comm comm, HYPRE_BigInt *col_map_offd,
                                       HYPRE_BigInt first_col_diag, HYPRE_BigInt *col_starts, HYPRE_Int num_cols_diag,
@@ -912,6 +1099,7 @@ HYPRE_Int hypre_ParCSRCommPkgCreateAndFill ( MPI_Comm comm, HYPRE_Int num_recvs,
 HYPRE_Int hypre_ParCSRCommPkgUpdateVecStarts ( hypre_ParCSRCommPkg *comm_pkg, hypre_ParVector *x );
 HYPRE_Int hypre_MatvecCommPkgCreate ( hypre_ParCSRMatrix *A );
 HYPRE_Int hypre_MatvecCommPkgDestroy ( hypre_ParCSRCommPkg *comm_pkg );
+size_t hypre_ParCSRCommPkgMemorySize ( hypre_ParCSRCommPkg *comm_pkg );
 HYPRE_Int hypre_BuildCSRMatrixMPIDataType ( HYPRE_Int num_nonzeros, HYPRE_Int num_rows,
                                             HYPRE_Complex *a_data, HYPRE_Int *a_i, HYPRE_Int *a_j,
                                             hypre_MPI_Datatype *csr_matrix_datatype );
@@ -1017,7 +1205,6 @@ HYPRE_Int hypre_ParCSRMatrixDropSmallEntriesDevice( hypre_ParCSRMatrix *A, HYPRE
 
 HYPRE_Int hypre_ParCSRCommPkgCreateMatrixE( hypre_ParCSRCommPkg *comm_pkg, HYPRE_Int local_ncols );
 
-#ifdef HYPRE_USING_PERSISTENT_COMM
 hypre_ParCSRPersistentCommHandle* hypre_ParCSRPersistentCommHandleCreate(HYPRE_Int job,
                                                                          hypre_ParCSRCommPkg *comm_pkg);
 hypre_ParCSRPersistentCommHandle* hypre_ParCSRCommPkgGetPersistentCommHandle(HYPRE_Int job,
@@ -1027,7 +1214,6 @@ void hypre_ParCSRPersistentCommHandleStart(hypre_ParCSRPersistentCommHandle *com
                                            HYPRE_MemoryLocation send_memory_location, void *send_data);
 void hypre_ParCSRPersistentCommHandleWait(hypre_ParCSRPersistentCommHandle *comm_handle,
                                           HYPRE_MemoryLocation recv_memory_location, void *recv_data);
-#endif
 
 HYPRE_Int hypre_ParcsrGetExternalRowsInit( hypre_ParCSRMatrix *A, HYPRE_Int indices_len,
                                            HYPRE_BigInt *indices, hypre_ParCSRCommPkg *comm_pkg, HYPRE_Int want_data, void **request_ptr);
@@ -1064,6 +1250,14 @@ HYPRE_Int hypre_ParCSRMatrixDiagScaleDevice ( hypre_ParCSRMatrix *par_A, hypre_P
 HYPRE_Int hypre_ParCSRMatrixCompressOffdMapDevice(hypre_ParCSRMatrix *A);
 HYPRE_Int hypre_ParCSRMatrixCompressOffdMap(hypre_ParCSRMatrix *A);
 
+/* par_csr_from_csr.c */
+hypre_ParCSRMatrix* hypre_ParCSRMatrixCreateFromCSR ( MPI_Comm comm, HYPRE_BigInt global_num_rows,
+                                                      HYPRE_BigInt global_num_cols, HYPRE_BigInt *row_starts, HYPRE_BigInt *col_starts,
+                                                      HYPRE_Int *row_ptr, HYPRE_BigInt *cols, HYPRE_Complex *values, HYPRE_Int alias_values );
+HYPRE_Int hypre_ParCSRMatrixUpdateValuesFromCSR ( hypre_ParCSRMatrix *matrix,
+                                                  HYPRE_Complex *values );
+HYPRE_Int hypre_ParCSRMatrixDetachCSRValues ( hypre_ParCSRMatrix *matrix );
+
 /* par_csr_matop_marked.c */
 void hypre_ParMatmul_RowSizes_Marked ( HYPRE_Int **C_diag_i, HYPRE_Int **C_offd_i,
                                        HYPRE_Int **B_marker, HYPRE_Int *A_diag_i,
@@ -1101,6 +1295,7 @@ hypre_ParCSRMatrix *hypre_ParCSRMatrixCreate ( MPI_Comm comm, HYPRE_BigInt globa
                                                HYPRE_Int num_nonzeros_diag,
                                                HYPRE_Int num_nonzeros_offd );
 HYPRE_Int hypre_ParCSRMatrixDestroy ( hypre_ParCSRMatrix *matrix );
+size_t hypre_ParCSRMatrixMemorySize ( hypre_ParCSRMatrix *matrix );
 HYPRE_Int hypre_ParCSRMatrixInitialize_v2( hypre_ParCSRMatrix *matrix,
                                            HYPRE_MemoryLocation memory_location );
 HYPRE_Int hypre_ParCSRMatrixInitialize ( hypre_ParCSRMatrix *matrix );
@@ -1109,6 +1304,11 @@ HYPRE_Int hypre_ParCSRMatrixSetDNumNonzeros ( hypre_ParCSRMatrix *matrix );
 HYPRE_Int hypre_ParCSRMatrixSetNumRownnz ( hypre_ParCSRMatrix *matrix );
 HYPRE_Int hypre_ParCSRMatrixSetDataOwner ( hypre_ParCSRMatrix *matrix, HYPRE_Int owns_data );
 HYPRE_Int hypre_ParCSRMatrixSetPatternOnly( hypre_ParCSRMatrix *matrix, HYPRE_Int pattern_only);
+HYPRE_Int hypre_ParCSRMatrixSetMatvecFormat( hypre_ParCSRMatrix *matrix, HYPRE_Int format );
+HYPRE_Int hypre_ParCSRMatrixRefreshMatvecFormat( hypre_ParCSRMatrix *matrix );
+HYPRE_Int hypre_ParCSRMatrixSetMatvecOverlap( hypre_ParCSRMatrix *matrix, HYPRE_Int overlap );
+HYPRE_Int hypre_ParCSRMatrixSetSinglePrecision( hypre_ParCSRMatrix *matrix,
+                                                HYPRE_Int single_precision );
 hypre_ParCSRMatrix *hypre_ParCSRMatrixRead ( MPI_Comm comm, const char *file_name );
 HYPRE_Int hypre_ParCSRMatrixPrint ( hypre_ParCSRMatrix *matrix, const char *file_name );
 HYPRE_Int hypre_ParCSRMatrixPrintIJ ( const hypre_ParCSRMatrix *matrix, const HYPRE_Int base_i,
@@ -1163,6 +1363,10 @@ HYPRE_Int hypre_ParCSRMatrixMatvecOutOfPlace ( HYPRE_Complex alpha, hypre_ParCSR
 HYPRE_Int hypre_ParCSRMatrixMatvecOutOfPlaceDevice ( HYPRE_Complex alpha, hypre_ParCSRMatrix *A,
                                                      hypre_ParVector *x, HYPRE_Complex beta,
                                                      hypre_ParVector *b, hypre_ParVector *y );
+HYPRE_Int hypre_ParCSRMatrixMatvecOutOfPlaceOverlapHost ( HYPRE_Complex alpha,
+                                                          hypre_ParCSRMatrix *A,
+                                                          hypre_ParVector *x, HYPRE_Complex beta,
+                                                          hypre_ParVector *b, hypre_ParVector *y );
 // y = alpha*A*x + beta*y
 HYPRE_Int hypre_ParCSRMatrixMatvec ( HYPRE_Complex alpha, hypre_ParCSRMatrix *A, hypre_ParVector *x,
                                      HYPRE_Complex beta, hypre_ParVector *y );
@@ -1171,12 +1375,47 @@ HYPRE_Int hypre_ParCSRMatrixMatvecT ( HYPRE_Complex alpha, hypre_ParCSRMatrix *A
 HYPRE_Int hypre_ParCSRMatrixMatvecTDevice ( HYPRE_Complex alpha, hypre_ParCSRMatrix *A,
                                             hypre_ParVector *x, HYPRE_Complex beta,
                                             hypre_ParVector *y );
+// fc = P^T*(f - A*u)
+HYPRE_Int hypre_ParCSRMatrixResidualRestrictHost ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *P,
+                                                   hypre_ParVector *u, hypre_ParVector *f,
+                                                   hypre_ParVector *fc, HYPRE_Real *rnorm2,
+                                                   HYPRE_Complex *work );
 HYPRE_Int hypre_ParCSRMatrixMatvecT_unpack( hypre_ParCSRCommPkg *comm_pkg, HYPRE_Int num_cols,
                                             HYPRE_Complex *recv_data, HYPRE_Complex *local_data );
 HYPRE_Int hypre_ParCSRMatrixMatvec_FF ( HYPRE_Complex alpha, hypre_ParCSRMatrix *A,
                                         hypre_ParVector *x, HYPRE_Complex beta, hypre_ParVector *y,
                                         HYPRE_Int *CF_marker, HYPRE_Int fpt );
 
+/* par_csr_mpiio.c */
+HYPRE_Int hypre_ParCSRMatrixPrintMPIIO ( hypre_ParCSRMatrix *matrix, const char *filename );
+HYPRE_Int hypre_ParCSRMatrixReadMPIIO ( MPI_Comm comm, const char *filename,
+                                        HYPRE_BigInt *row_starts_in, HYPRE_BigInt *col_starts_in,
+                                        hypre_ParCSRMatrix **matrix_ptr );
+HYPRE_Int hypre_ParVectorPrintMPIIO ( hypre_ParVector *vector, const char *filename );
+HYPRE_Int hypre_ParVectorReadMPIIO ( MPI_Comm comm, const char *filename,
+                                     HYPRE_BigInt *partitioning, hypre_ParVector **vector_ptr );
+
+/* par_csr_node_comm.c */
+HYPRE_Int hypre_ParCSRCommPkgCreateNodePkg ( hypre_ParCSRCommPkg *comm_pkg, HYPRE_Int node_size );
+HYPRE_Int hypre_ParCSRCommNodePkgDestroy ( hypre_ParCSRCommNodePkg *node_pkg );
+size_t hypre_ParCSRCommNodePkgMemorySize ( hypre_ParCSRCommNodePkg *node_pkg );
+HYPRE_Int hypre_ParCSRCommHandleNodeStart ( hypre_ParCSRCommHandle *comm_handle,
+                                            hypre_ParCSRCommNodePkg *node_pkg, HYPRE_Int block_bytes );
+HYPRE_Int hypre_ParCSRCommHandleNodeFinish ( hypre_ParCSRCommHandle *comm_handle );
+
+/* par_csr_spgemm_host.c */
+hypre_ulonglongint hypre_ParCSRMatrixPatternKey ( hypre_ParCSRMatrix *A );
+HYPRE_Int hypre_ParCSRMatMatDataDestroy ( hypre_ParCSRMatMatData *data );
+size_t hypre_ParCSRMatMatDataMemorySize ( hypre_ParCSRMatMatData *data );
+HYPRE_Int hypre_ParCSRMatMatSymbolicHost ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *B,
+                                           hypre_ParCSRMatMatData **data_ptr );
+hypre_ParCSRMatrix *hypre_ParCSRMatMatNumericHost ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *B,
+                                                    hypre_ParCSRMatMatData *data );
+HYPRE_Int hypre_ParCSRMatMatDataMatches ( hypre_ParCSRMatMatData *data, hypre_ParCSRMatrix *A,
+                                          hypre_ParCSRMatrix *B );
+hypre_ParCSRMatrix *hypre_ParCSRMatMatReuseHost ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *B,
+                                                  hypre_ParCSRMatMatData **data_ptr );
+
 /* par_csr_triplemat.c */
 HYPRE_Int hypre_ParCSRTMatMatPartialAddDevice( hypre_ParCSRCommPkg *comm_pkg_A,
                                                HYPRE_Int num_cols_A, HYPRE_Int num_cols_B, HYPRE_BigInt first_col_diag_B,
@@ -1215,6 +1454,7 @@ hypre_ParVector *hypre_ParVectorCreate ( MPI_Comm comm, HYPRE_BigInt global_size
 hypre_ParVector *hypre_ParMultiVectorCreate ( MPI_Comm comm, HYPRE_BigInt global_size,
                                               HYPRE_BigInt *partitioning, HYPRE_Int num_vectors );
 HYPRE_Int hypre_ParVectorDestroy ( hypre_ParVector *vector );
+size_t hypre_ParVectorMemorySize ( hypre_ParVector *vector );
 HYPRE_Int hypre_ParVectorInitialize ( hypre_ParVector *vector );
 HYPRE_Int hypre_ParVectorInitialize_v2( hypre_ParVector *vector,
                                         HYPRE_MemoryLocation memory_location );
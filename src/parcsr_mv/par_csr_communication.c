@@ -9,7 +9,6 @@
 
 /*==========================================================================*/
 
-#ifdef HYPRE_USING_PERSISTENT_COMM
 static CommPkgJobType getJobTypeOf(HYPRE_Int job)
 {
    CommPkgJobType job_type = HYPRE_COMM_PKG_JOB_COMPLEX;
@@ -286,12 +285,16 @@ hypre_ParCSRPersistentCommHandleStart( hypre_ParCSRPersistentCommHandle *comm_ha
 
    if (hypre_ParCSRCommHandleNumRequests(comm_handle) > 0)
    {
-      hypre_TMemcpy( hypre_ParCSRCommHandleSendDataBuffer(comm_handle),
-                     send_data,
-                     char,
-                     hypre_ParCSRCommHandleNumSendBytes(comm_handle),
-                     HYPRE_MEMORY_HOST,
-                     send_memory_location );
+      /* Callers may pack directly into the send buffer */
+      if (send_data != hypre_ParCSRCommHandleSendDataBuffer(comm_handle))
+      {
+         hypre_TMemcpy( hypre_ParCSRCommHandleSendDataBuffer(comm_handle),
+                        send_data,
+                        char,
+                        hypre_ParCSRCommHandleNumSendBytes(comm_handle),
+                        HYPRE_MEMORY_HOST,
+                        send_memory_location );
+      }
 
       HYPRE_Int ret = hypre_MPI_Startall(hypre_ParCSRCommHandleNumRequests(comm_handle),
                                          hypre_ParCSRCommHandleRequests(comm_handle));
@@ -326,15 +329,18 @@ hypre_ParCSRPersistentCommHandleWait( hypre_ParCSRPersistentCommHandle *comm_han
          /*hypre_printf("MPI error %d in %s (%s, line %u)\n", ret, __FUNCTION__, __FILE__, __LINE__);*/
       }
 
-      hypre_TMemcpy(recv_data,
-                    hypre_ParCSRCommHandleRecvDataBuffer(comm_handle),
-                    char,
-                    hypre_ParCSRCommHandleNumRecvBytes(comm_handle),
-                    recv_memory_location,
-                    HYPRE_MEMORY_HOST);
+      /* Callers may read directly from the receive buffer */
+      if (recv_data != hypre_ParCSRCommHandleRecvDataBuffer(comm_handle))
+      {
+         hypre_TMemcpy(recv_data,
+                       hypre_ParCSRCommHandleRecvDataBuffer(comm_handle),
+                       char,
+                       hypre_ParCSRCommHandleNumRecvBytes(comm_handle),
+                       recv_memory_location,
+                       HYPRE_MEMORY_HOST);
+      }
    }
 }
-#endif // HYPRE_USING_PERSISTENT_COMM
 
 /*------------------------------------------------------------------
  * hypre_ParCSRCommHandleCreate
@@ -362,7 +368,29 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
                                   HYPRE_MemoryLocation recv_memory_location,
                                   void                *recv_data_in )
 {
-   hypre_GpuProfilingPushRange("hypre_ParCSRCommHandleCreate_v2");
+   return hypre_ParCSRCommHandleCreate_v3(job, comm_pkg, send_memory_location, send_data_in,
+                                          recv_memory_location, recv_data_in, 0);
+}
+
+/*------------------------------------------------------------------
+ * hypre_ParCSRCommHandleCreate_v3
+ *
+ * elmtwise = 1 declares a forward exchange (jobs 1, 11, 21) in which the
+ * value sent at position i of the send buffer depends on send_map_elmts[i]
+ * alone, as in the matvec. A node-aware exchange then sends an element
+ * needed by several ranks of another node only once to that node.
+ *------------------------------------------------------------------*/
+
+hypre_ParCSRCommHandle*
+hypre_ParCSRCommHandleCreate_v3 ( HYPRE_Int            job,
+                                  hypre_ParCSRCommPkg *comm_pkg,
+                                  HYPRE_MemoryLocation send_memory_location,
+                                  void                *send_data_in,
+                                  HYPRE_MemoryLocation recv_memory_location,
+                                  void                *recv_data_in,
+                                  HYPRE_Int            elmtwise )
+{
+   hypre_GpuProfilingPushRange("hypre_ParCSRCommHandleCreate_v3");
 
    HYPRE_Int                  num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
    HYPRE_Int                  num_recvs = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
@@ -471,6 +499,57 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
    recv_data = recv_data_in;
 #endif
 
+   comm_handle = hypre_CTAlloc(hypre_ParCSRCommHandle,  1, HYPRE_MEMORY_HOST);
+
+   hypre_ParCSRCommHandleCommPkg(comm_handle)            = comm_pkg;
+   hypre_ParCSRCommHandleSendMemoryLocation(comm_handle) = send_memory_location;
+   hypre_ParCSRCommHandleRecvMemoryLocation(comm_handle) = recv_memory_location;
+   hypre_ParCSRCommHandleNumSendBytes(comm_handle)       = num_send_bytes;
+   hypre_ParCSRCommHandleNumRecvBytes(comm_handle)       = num_recv_bytes;
+   hypre_ParCSRCommHandleSendData(comm_handle)           = send_data_in;
+   hypre_ParCSRCommHandleRecvData(comm_handle)           = recv_data_in;
+   hypre_ParCSRCommHandleSendDataBuffer(comm_handle)     = send_data;
+   hypre_ParCSRCommHandleRecvDataBuffer(comm_handle)     = recv_data;
+
+   /*--------------------------------------------------------------------
+    * Forward exchanges of host data go through the node leaders if the
+    * comm package has a node-aware schedule
+    *--------------------------------------------------------------------*/
+
+   if (hypre_ParCSRCommPkgNodePkg(comm_pkg) && (job == 1 || job == 11 || job == 21))
+   {
+      HYPRE_Int use_node = 1;
+
+#if defined(HYPRE_WITH_GPU_AWARE_MPI)
+      hypre_MemoryLocation act_send_memory_location = hypre_GetActualMemLocation(send_memory_location);
+      hypre_MemoryLocation act_recv_memory_location = hypre_GetActualMemLocation(recv_memory_location);
+
+      use_node = !(act_send_memory_location == hypre_MEMORY_DEVICE ||
+                   act_send_memory_location == hypre_MEMORY_UNIFIED ||
+                   act_recv_memory_location == hypre_MEMORY_DEVICE ||
+                   act_recv_memory_location == hypre_MEMORY_UNIFIED);
+#endif
+      if (use_node)
+      {
+         hypre_ParCSRCommNodePkg *node_pkg = hypre_ParCSRCommPkgNodePkg(comm_pkg);
+         HYPRE_Int elmt_bytes = (job == 1) ? sizeof(HYPRE_Complex) :
+                                (job == 11) ? sizeof(HYPRE_Int) : sizeof(HYPRE_BigInt);
+
+         /* The merged schedule assumes one value per send map element */
+         if (elmtwise && hypre_ParCSRCommNodePkgMerged(node_pkg) &&
+             hypre_ParCSRCommPkgNumComponents(comm_pkg) == 1)
+         {
+            node_pkg = hypre_ParCSRCommNodePkgMerged(node_pkg);
+         }
+
+         hypre_ParCSRCommHandleNodeStart(comm_handle, node_pkg, elmt_bytes *
+                                         hypre_ParCSRCommPkgNumComponents(comm_pkg));
+         hypre_GpuProfilingPopRange();
+
+         return ( comm_handle );
+      }
+   }
+
    num_requests = num_sends + num_recvs;
    requests = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
 
@@ -617,17 +696,6 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
     * set up comm_handle and return
     *--------------------------------------------------------------------*/
 
-   comm_handle = hypre_CTAlloc(hypre_ParCSRCommHandle,  1, HYPRE_MEMORY_HOST);
-
-   hypre_ParCSRCommHandleCommPkg(comm_handle)            = comm_pkg;
-   hypre_ParCSRCommHandleSendMemoryLocation(comm_handle) = send_memory_location;
-   hypre_ParCSRCommHandleRecvMemoryLocation(comm_handle) = recv_memory_location;
-   hypre_ParCSRCommHandleNumSendBytes(comm_handle)       = num_send_bytes;
-   hypre_ParCSRCommHandleNumRecvBytes(comm_handle)       = num_recv_bytes;
-   hypre_ParCSRCommHandleSendData(comm_handle)           = send_data_in;
-   hypre_ParCSRCommHandleRecvData(comm_handle)           = recv_data_in;
-   hypre_ParCSRCommHandleSendDataBuffer(comm_handle)     = send_data;
-   hypre_ParCSRCommHandleRecvDataBuffer(comm_handle)     = recv_data;
    hypre_ParCSRCommHandleNumRequests(comm_handle)        = num_requests;
    hypre_ParCSRCommHandleRequests(comm_handle)           = requests;
 
@@ -650,6 +718,11 @@ hypre_ParCSRCommHandleDestroy( hypre_ParCSRCommHandle *comm_handle )
 
    hypre_GpuProfilingPushRange("hypre_ParCSRCommHandleDestroy");
 
+   if (hypre_ParCSRCommHandleNodeBlockBytes(comm_handle))
+   {
+      hypre_ParCSRCommHandleNodeFinish(comm_handle);
+   }
+
    if (hypre_ParCSRCommHandleNumRequests(comm_handle))
    {
       hypre_MPI_Status *status0;
@@ -1021,14 +1094,13 @@ hypre_ParCSRCommPkgCreateAndFill( MPI_Comm              comm,
    hypre_ParCSRCommPkgBufData(comm_pkg)            = NULL;
    hypre_ParCSRCommPkgMatrixE(comm_pkg)            = NULL;
 #endif
-#if defined(HYPRE_USING_PERSISTENT_COMM)
    HYPRE_Int i;
 
    for (i = 0; i < NUM_OF_COMM_PKG_JOB_TYPE; i++)
    {
       comm_pkg->persistent_comm_handles[i] = NULL;
    }
-#endif
+   hypre_ParCSRCommPkgNodePkg(comm_pkg) = NULL;
 
    /* Set input info */
    hypre_ParCSRCommPkgComm(comm_pkg)          = comm;
@@ -1132,6 +1204,13 @@ hypre_ParCSRCommPkgUpdateVecStarts( hypre_ParCSRCommPkg *comm_pkg,
       }
       hypre_ParCSRCommPkgSendMapElmts(comm_pkg) = send_map_elmts_new;
 
+      /* Persistent handles were sized for the previous number of components */
+      for (i = HYPRE_COMM_PKG_JOB_COMPLEX; i < NUM_OF_COMM_PKG_JOB_TYPE; i++)
+      {
+         hypre_ParCSRPersistentCommHandleDestroy(comm_pkg->persistent_comm_handles[i]);
+         comm_pkg->persistent_comm_handles[i] = NULL;
+      }
+
       /* Free memory */
       hypre_TFree(send_map_elmts, HYPRE_MEMORY_HOST);
       hypre_TFree(hypre_ParCSRCommPkgDeviceSendMapElmts(comm_pkg), HYPRE_MEMORY_DEVICE);
@@ -1195,6 +1274,12 @@ hypre_MatvecCommPkgCreate ( hypre_ParCSRMatrix *A )
                                    apart,
                                    comm_pkg );
 
+   /* Schedule the halo exchange of the matvec through the node leaders */
+   if (hypre_HandleNodeAwareComm(hypre_handle()))
+   {
+      hypre_ParCSRCommPkgCreateNodePkg(comm_pkg, hypre_HandleNodeAwareComm(hypre_handle()));
+   }
+
    HYPRE_ANNOTATE_FUNC_END;
 
    return hypre_error_flag;
@@ -1207,7 +1292,6 @@ hypre_MatvecCommPkgCreate ( hypre_ParCSRMatrix *A )
 HYPRE_Int
 hypre_MatvecCommPkgDestroy( hypre_ParCSRCommPkg *comm_pkg )
 {
-#ifdef HYPRE_USING_PERSISTENT_COMM
    HYPRE_Int i;
    for (i = HYPRE_COMM_PKG_JOB_COMPLEX; i < NUM_OF_COMM_PKG_JOB_TYPE; ++i)
    {
@@ -1216,7 +1300,7 @@ hypre_MatvecCommPkgDestroy( hypre_ParCSRCommPkg *comm_pkg )
          hypre_ParCSRPersistentCommHandleDestroy(comm_pkg->persistent_comm_handles[i]);
       }
    }
-#endif
+   hypre_ParCSRCommNodePkgDestroy(hypre_ParCSRCommPkgNodePkg(comm_pkg));
 
    if (hypre_ParCSRCommPkgNumSends(comm_pkg))
    {
@@ -1246,6 +1330,54 @@ hypre_MatvecCommPkgDestroy( hypre_ParCSRCommPkg *comm_pkg )
    return hypre_error_flag;
 }
 
+/*------------------------------------------------------------------
+ * hypre_ParCSRCommPkgMemorySize
+ *
+ * Returns the number of bytes held by the comm package, including its
+ * persistent handles and its node-aware schedule.
+ *------------------------------------------------------------------*/
+
+size_t
+hypre_ParCSRCommPkgMemorySize( hypre_ParCSRCommPkg *comm_pkg )
+{
+   hypre_ParCSRPersistentCommHandle *handle;
+   HYPRE_Int                         num_sends, num_recvs, i;
+   size_t                            bytes;
+
+   if (!comm_pkg)
+   {
+      return 0;
+   }
+
+   num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   num_recvs = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+   bytes     = sizeof(hypre_ParCSRCommPkg);
+
+   bytes += (size_t) (2 * num_sends + 1) * sizeof(HYPRE_Int);
+   bytes += (size_t) (2 * num_recvs + 1) * sizeof(HYPRE_Int);
+   if (hypre_ParCSRCommPkgSendMapStarts(comm_pkg))
+   {
+      bytes += (size_t) hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends) *
+               sizeof(HYPRE_Int);
+   }
+
+   for (i = HYPRE_COMM_PKG_JOB_COMPLEX; i < NUM_OF_COMM_PKG_JOB_TYPE; i++)
+   {
+      if ((handle = comm_pkg->persistent_comm_handles[i]) != NULL)
+      {
+         bytes += sizeof(hypre_ParCSRPersistentCommHandle);
+         bytes += (size_t) hypre_ParCSRCommHandleNumSendBytes(handle);
+         bytes += (size_t) hypre_ParCSRCommHandleNumRecvBytes(handle);
+         bytes += (size_t) hypre_ParCSRCommHandleNumRequests(handle) *
+                  sizeof(hypre_MPI_Request);
+      }
+   }
+
+   bytes += hypre_ParCSRCommNodePkgMemorySize(hypre_ParCSRCommPkgNodePkg(comm_pkg));
+
+   return bytes;
+}
+
 /*------------------------------------------------------------------
  * hypre_ParCSRFindExtendCommPkg
  *
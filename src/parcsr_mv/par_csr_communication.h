@@ -13,7 +13,6 @@
  *   Structure containing information for doing communications
  *--------------------------------------------------------------------------*/
 
-#ifdef HYPRE_USING_PERSISTENT_COMM
 typedef enum CommPkgJobType
 {
    HYPRE_COMM_PKG_JOB_COMPLEX = 0,
@@ -24,7 +23,6 @@ typedef enum CommPkgJobType
    HYPRE_COMM_PKG_JOB_BIGINT_TRANSPOSE,
    NUM_OF_COMM_PKG_JOB_TYPE,
 } CommPkgJobType;
-#endif
 
 /*--------------------------------------------------------------------------
  * hypre_ParCSRCommHandle, hypre_ParCSRPersistentCommHandle
@@ -44,10 +42,98 @@ typedef struct
    void                 *recv_data_buffer;
    HYPRE_Int             num_requests;
    hypre_MPI_Request    *requests;
+   /* node-aware exchange: bytes per element (0 if not used), staging buffer,
+      schedule in use, and whether the leader has forwarded the gathered data */
+   HYPRE_Int             node_block_bytes;
+   void                 *node_buffer;
+   struct _hypre_ParCSRCommNodePkg *node_pkg;
+   HYPRE_Int             node_forwarded;
 } hypre_ParCSRCommHandle;
 
 typedef hypre_ParCSRCommHandle hypre_ParCSRPersistentCommHandle;
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommNodePkg:
+ *   Node-aware (two-level) schedule for the forward exchanges of a
+ *   hypre_ParCSRCommPkg. Neighbors on the same node are served directly.
+ *   Data for other nodes is gathered by the node leader, sent in one
+ *   message per pair of nodes, and scattered by
+ *   the leader of the destination node. Counts and positions below are in
+ *   units of one component of the comm package.
+ *
+ *   The optional merged schedule sends an element that goes to several ranks
+ *   of a node only once to that node. It is only valid for exchanges in
+ *   which the value sent at position i depends on send_map_elmts[i] alone.
+ *--------------------------------------------------------------------------*/
+
+typedef struct _hypre_ParCSRCommNodePkg
+{
+   HYPRE_Int   leader;           /* rank (in comm) of the leader of this node */
+
+   /* all ranks: on-node neighbors, as indices into send_procs/recv_procs */
+   HYPRE_Int   num_local_sends;
+   HYPRE_Int  *local_sends;
+   HYPRE_Int   num_local_recvs;
+   HYPRE_Int  *local_recvs;
+
+   /* all ranks: off-node data sent to and received from the leader,
+      as positions in the send/recv buffers of the exchange */
+   HYPRE_Int   num_send_elmts;
+   HYPRE_Int  *send_elmts;
+   HYPRE_Int   num_recv_elmts;
+   HYPRE_Int  *recv_elmts;
+
+   /* leader only: gather from on-node ranks */
+   HYPRE_Int   num_gathers;
+   HYPRE_Int  *gather_procs;
+   HYPRE_Int  *gather_starts;
+
+   /* leader only: messages to other leaders, packed from the gather buffer */
+   HYPRE_Int   num_node_sends;
+   HYPRE_Int  *node_send_procs;
+   HYPRE_Int  *node_send_starts;
+   HYPRE_Int  *node_send_elmts;
+
+   /* leader only: messages from other leaders */
+   HYPRE_Int   num_node_recvs;
+   HYPRE_Int  *node_recv_procs;
+   HYPRE_Int  *node_recv_starts;
+
+   /* leader only: scatter to on-node ranks, packed from the node recv buffer */
+   HYPRE_Int   num_scatters;
+   HYPRE_Int  *scatter_procs;
+   HYPRE_Int  *scatter_starts;
+   HYPRE_Int  *scatter_elmts;
+
+   /* schedule merging repeated elements (NULL if no rank has any) */
+   struct _hypre_ParCSRCommNodePkg *merged;
+} hypre_ParCSRCommNodePkg;
+
+#define hypre_ParCSRCommNodePkgLeader(node_pkg)          ((node_pkg) -> leader)
+#define hypre_ParCSRCommNodePkgNumLocalSends(node_pkg)   ((node_pkg) -> num_local_sends)
+#define hypre_ParCSRCommNodePkgLocalSends(node_pkg)      ((node_pkg) -> local_sends)
+#define hypre_ParCSRCommNodePkgNumLocalRecvs(node_pkg)   ((node_pkg) -> num_local_recvs)
+#define hypre_ParCSRCommNodePkgLocalRecvs(node_pkg)      ((node_pkg) -> local_recvs)
+#define hypre_ParCSRCommNodePkgNumSendElmts(node_pkg)    ((node_pkg) -> num_send_elmts)
+#define hypre_ParCSRCommNodePkgSendElmts(node_pkg)       ((node_pkg) -> send_elmts)
+#define hypre_ParCSRCommNodePkgNumRecvElmts(node_pkg)    ((node_pkg) -> num_recv_elmts)
+#define hypre_ParCSRCommNodePkgRecvElmts(node_pkg)       ((node_pkg) -> recv_elmts)
+#define hypre_ParCSRCommNodePkgNumGathers(node_pkg)      ((node_pkg) -> num_gathers)
+#define hypre_ParCSRCommNodePkgGatherProcs(node_pkg)     ((node_pkg) -> gather_procs)
+#define hypre_ParCSRCommNodePkgGatherStarts(node_pkg)    ((node_pkg) -> gather_starts)
+#define hypre_ParCSRCommNodePkgNumNodeSends(node_pkg)    ((node_pkg) -> num_node_sends)
+#define hypre_ParCSRCommNodePkgNodeSendProcs(node_pkg)   ((node_pkg) -> node_send_procs)
+#define hypre_ParCSRCommNodePkgNodeSendStarts(node_pkg)  ((node_pkg) -> node_send_starts)
+#define hypre_ParCSRCommNodePkgNodeSendElmts(node_pkg)   ((node_pkg) -> node_send_elmts)
+#define hypre_ParCSRCommNodePkgNumNodeRecvs(node_pkg)    ((node_pkg) -> num_node_recvs)
+#define hypre_ParCSRCommNodePkgNodeRecvProcs(node_pkg)   ((node_pkg) -> node_recv_procs)
+#define hypre_ParCSRCommNodePkgNodeRecvStarts(node_pkg)  ((node_pkg) -> node_recv_starts)
+#define hypre_ParCSRCommNodePkgNumScatters(node_pkg)     ((node_pkg) -> num_scatters)
+#define hypre_ParCSRCommNodePkgScatterProcs(node_pkg)    ((node_pkg) -> scatter_procs)
+#define hypre_ParCSRCommNodePkgScatterStarts(node_pkg)   ((node_pkg) -> scatter_starts)
+#define hypre_ParCSRCommNodePkgScatterElmts(node_pkg)    ((node_pkg) -> scatter_elmts)
+#define hypre_ParCSRCommNodePkgMerged(node_pkg)          ((node_pkg) -> merged)
+
 typedef struct _hypre_ParCSRCommPkg
 {
    MPI_Comm                          comm;
@@ -63,9 +149,9 @@ typedef struct _hypre_ParCSRCommPkg
    /* remote communication information */
    hypre_MPI_Datatype               *send_mpi_types;
    hypre_MPI_Datatype               *recv_mpi_types;
-#ifdef HYPRE_USING_PERSISTENT_COMM
    hypre_ParCSRPersistentCommHandle *persistent_comm_handles[NUM_OF_COMM_PKG_JOB_TYPE];
-#endif
+   /* node-aware schedule for jobs 1, 11 and 21 (NULL if not used) */
+   hypre_ParCSRCommNodePkg          *node_pkg;
 #if defined(HYPRE_USING_GPU) || defined(HYPRE_USING_DEVICE_OPENMP)
    /* temporary memory for matvec. cudaMalloc is expensive. alloc once and reuse */
    HYPRE_Complex                    *tmp_data;
@@ -98,6 +184,7 @@ typedef struct _hypre_ParCSRCommPkg
 #define hypre_ParCSRCommPkgSendMPIType(comm_pkg,i)       (comm_pkg -> send_mpi_types[i])
 #define hypre_ParCSRCommPkgRecvMPITypes(comm_pkg)        (comm_pkg -> recv_mpi_types)
 #define hypre_ParCSRCommPkgRecvMPIType(comm_pkg,i)       (comm_pkg -> recv_mpi_types[i])
+#define hypre_ParCSRCommPkgNodePkg(comm_pkg)             (comm_pkg -> node_pkg)
 
 #if defined(HYPRE_USING_GPU) || defined(HYPRE_USING_DEVICE_OPENMP)
 #define hypre_ParCSRCommPkgTmpData(comm_pkg)             ((comm_pkg) -> tmp_data)
@@ -144,5 +231,9 @@ hypre_ParCSRCommPkgCopySendMapElmtsToDevice(hypre_ParCSRCommPkg *comm_pkg)
 #define hypre_ParCSRCommHandleNumRequests(comm_handle)            (comm_handle -> num_requests)
 #define hypre_ParCSRCommHandleRequests(comm_handle)               (comm_handle -> requests)
 #define hypre_ParCSRCommHandleRequest(comm_handle, i)             (comm_handle -> requests[i])
+#define hypre_ParCSRCommHandleNodeBlockBytes(comm_handle)         (comm_handle -> node_block_bytes)
+#define hypre_ParCSRCommHandleNodeBuffer(comm_handle)             (comm_handle -> node_buffer)
+#define hypre_ParCSRCommHandleNodePkg(comm_handle)                (comm_handle -> node_pkg)
+#define hypre_ParCSRCommHandleNodeForwarded(comm_handle)          (comm_handle -> node_forwarded)
 
 #endif /* HYPRE_PAR_CSR_COMMUNICATION_HEADER */
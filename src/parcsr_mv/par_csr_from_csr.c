@@ -0,0 +1,364 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Construction of a hypre_ParCSRMatrix directly from the local rows of the
+ * calling process given in CSR form with global column indices, without
+ * going through the IJ interface.
+ *
+ * The local rows are split into diag and offd in a single parallel pass.
+ * When the local rows have no offd entries and the diagonal entry of each
+ * row already comes first, the values of diag can alias the user array.
+ * Otherwise, a map from the user values to their position in diag or offd
+ * is kept, so that hypre_ParCSRMatrixUpdateValuesFromCSR can refresh the
+ * values without rebuilding the matrix.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_mv.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixCreateFromCSR
+ *
+ * row_starts and col_starts hold the first local row (column) followed by
+ * the first row (column) of the next process. row_ptr (local_num_rows + 1
+ * entries), cols and values describe the local rows; row_ptr[0] does not
+ * need to be zero. cols holds global column indices.
+ *
+ * If alias_values is set and the layout permits it (see above), the values
+ * of diag point to values, which must then stay valid for as long as the
+ * matrix exists. Otherwise the values are copied.
+ *
+ * Only host memory is supported.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParCSRMatrix*
+hypre_ParCSRMatrixCreateFromCSR( MPI_Comm        comm,
+                                 HYPRE_BigInt    global_num_rows,
+                                 HYPRE_BigInt    global_num_cols,
+                                 HYPRE_BigInt   *row_starts,
+                                 HYPRE_BigInt   *col_starts,
+                                 HYPRE_Int      *row_ptr,
+                                 HYPRE_BigInt   *cols,
+                                 HYPRE_Complex  *values,
+                                 HYPRE_Int       alias_values )
+{
+   hypre_ParCSRMatrix  *matrix;
+   hypre_CSRMatrix     *diag;
+   hypre_CSRMatrix     *offd;
+
+   HYPRE_BigInt         first_row   = row_starts[0];
+   HYPRE_BigInt         first_col   = col_starts[0];
+   HYPRE_BigInt         last_col    = col_starts[1] - 1;
+   HYPRE_Int            num_rows    = (HYPRE_Int) (row_starts[1] - row_starts[0]);
+   HYPRE_Int            num_values  = row_ptr[num_rows] - row_ptr[0];
+   HYPRE_Int            base        = row_ptr[0];
+
+   /* The diagonal is stored first in each row when diag is square */
+   HYPRE_Int            diag_first  = (first_row == first_col &&
+                                       row_starts[1] == col_starts[1]);
+
+   HYPRE_Int           *diag_i, *diag_j;
+   HYPRE_Int           *offd_i, *offd_j;
+   HYPRE_BigInt        *big_offd_j;
+   HYPRE_BigInt        *col_map_offd;
+   HYPRE_Int           *value_map;
+   HYPRE_Int            num_cols_offd;
+   HYPRE_Int            num_moved;
+   HYPRE_Int            i, k;
+
+   hypre_assert(row_ptr[0] >= 0);
+
+   diag_i    = hypre_CTAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   offd_i    = hypre_CTAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   value_map = hypre_TAlloc(HYPRE_Int, num_values, HYPRE_MEMORY_HOST);
+
+   /* Count the diag and offd entries of each row */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i, k) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      for (k = row_ptr[i]; k < row_ptr[i + 1]; k++)
+      {
+         if (cols[k - base] < first_col || cols[k - base] > last_col)
+         {
+            offd_i[i + 1]++;
+         }
+         else
+         {
+            diag_i[i + 1]++;
+         }
+      }
+   }
+
+   for (i = 0; i < num_rows; i++)
+   {
+      diag_i[i + 1] += diag_i[i];
+      offd_i[i + 1] += offd_i[i];
+   }
+
+   diag_j     = hypre_TAlloc(HYPRE_Int, diag_i[num_rows], HYPRE_MEMORY_HOST);
+   offd_j     = hypre_TAlloc(HYPRE_Int, offd_i[num_rows], HYPRE_MEMORY_HOST);
+   big_offd_j = hypre_TAlloc(HYPRE_BigInt, offd_i[num_rows], HYPRE_MEMORY_HOST);
+
+   /* Split the rows and record where each value goes; num_moved counts the
+      values that do not keep their position in diag */
+   num_moved = 0;
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i, k) reduction(+:num_moved) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      HYPRE_Int     cnt_diag = diag_i[i];
+      HYPRE_Int     cnt_offd = offd_i[i];
+      HYPRE_Int     has_diag = 0;
+      HYPRE_BigInt  col;
+
+      if (diag_first)
+      {
+         for (k = row_ptr[i]; k < row_ptr[i + 1]; k++)
+         {
+            if (cols[k - base] == first_row + i)
+            {
+               has_diag = 1;
+               break;
+            }
+         }
+         cnt_diag += has_diag;
+      }
+
+      for (k = row_ptr[i]; k < row_ptr[i + 1]; k++)
+      {
+         col = cols[k - base];
+         if (col < first_col || col > last_col)
+         {
+            big_offd_j[cnt_offd] = col;
+            value_map[k - base]  = -cnt_offd - 1;
+            cnt_offd++;
+         }
+         else if (has_diag && col == first_row + i)
+         {
+            diag_j[diag_i[i]]   = i;
+            value_map[k - base] = diag_i[i];
+            has_diag = 0;
+         }
+         else
+         {
+            diag_j[cnt_diag]    = (HYPRE_Int) (col - first_col);
+            value_map[k - base] = cnt_diag;
+            cnt_diag++;
+         }
+
+         if (value_map[k - base] != k - base)
+         {
+            num_moved++;
+         }
+      }
+   }
+
+   /* Build col_map_offd and the local offd column indices */
+   num_cols_offd = 0;
+   col_map_offd  = NULL;
+   if (offd_i[num_rows])
+   {
+      col_map_offd = hypre_TAlloc(HYPRE_BigInt, offd_i[num_rows], HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(col_map_offd, big_offd_j, HYPRE_BigInt, offd_i[num_rows],
+                    HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      hypre_BigQsort0(col_map_offd, 0, offd_i[num_rows] - 1);
+
+      num_cols_offd = 1;
+      for (k = 1; k < offd_i[num_rows]; k++)
+      {
+         if (col_map_offd[k] > col_map_offd[num_cols_offd - 1])
+         {
+            col_map_offd[num_cols_offd++] = col_map_offd[k];
+         }
+      }
+      col_map_offd = hypre_TReAlloc(col_map_offd, HYPRE_BigInt, num_cols_offd, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(k) HYPRE_SMP_SCHEDULE
+#endif
+      for (k = 0; k < offd_i[num_rows]; k++)
+      {
+         offd_j[k] = hypre_BigBinarySearch(col_map_offd, big_offd_j[k], num_cols_offd);
+      }
+   }
+   hypre_TFree(big_offd_j, HYPRE_MEMORY_HOST);
+
+   /* Create the matrix */
+   matrix = hypre_ParCSRMatrixCreate(comm, global_num_rows, global_num_cols,
+                                     row_starts, col_starts, num_cols_offd,
+                                     diag_i[num_rows], offd_i[num_rows]);
+   diag = hypre_ParCSRMatrixDiag(matrix);
+   offd = hypre_ParCSRMatrixOffd(matrix);
+
+   hypre_CSRMatrixI(diag) = diag_i;
+   hypre_CSRMatrixJ(diag) = diag_j;
+   hypre_CSRMatrixI(offd) = offd_i;
+   hypre_CSRMatrixJ(offd) = offd_j;
+   hypre_CSRMatrixMemoryLocation(diag) = HYPRE_MEMORY_HOST;
+   hypre_CSRMatrixMemoryLocation(offd) = HYPRE_MEMORY_HOST;
+   hypre_ParCSRMatrixColMapOffd(matrix) = col_map_offd;
+   hypre_ParCSRMatrixCSRNumValues(matrix) = num_values;
+
+   if (alias_values && num_moved == 0)
+   {
+      /* diag has the same layout as the user rows */
+      hypre_CSRMatrixData(diag) = values;
+      hypre_ParCSRMatrixCSRValuesAliased(matrix) = 1;
+      hypre_TFree(value_map, HYPRE_MEMORY_HOST);
+   }
+   else
+   {
+      hypre_CSRMatrixData(diag) = hypre_TAlloc(HYPRE_Complex, diag_i[num_rows], HYPRE_MEMORY_HOST);
+      hypre_CSRMatrixData(offd) = hypre_TAlloc(HYPRE_Complex, offd_i[num_rows], HYPRE_MEMORY_HOST);
+      hypre_ParCSRMatrixCSRValueMap(matrix) = value_map;
+      hypre_ParCSRMatrixUpdateValuesFromCSR(matrix, values);
+   }
+
+   hypre_CSRMatrixSetRownnz(diag);
+   hypre_CSRMatrixSetRownnz(offd);
+   hypre_ParCSRMatrixSetNumNonzeros(matrix);
+   hypre_ParCSRMatrixDNumNonzeros(matrix) = (HYPRE_Real) hypre_ParCSRMatrixNumNonzeros(matrix);
+   hypre_MatvecCommPkgCreate(matrix);
+
+   return matrix;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixUpdateValuesFromCSR
+ *
+ * Replaces the values of a matrix built by hypre_ParCSRMatrixCreateFromCSR
+ * with values given in the layout of the original user CSR arrays. The
+ * sparsity pattern must be unchanged. If the matrix aliases the user values,
+ * diag is pointed to the new array (which may be the original one, updated
+ * in place). Copies derived from the values (transposes, single-precision
+ * and SELL copies, block diagonal inverse) are refreshed or discarded.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixUpdateValuesFromCSR( hypre_ParCSRMatrix *matrix,
+                                       HYPRE_Complex      *values )
+{
+   hypre_CSRMatrix  *diag       = hypre_ParCSRMatrixDiag(matrix);
+   hypre_CSRMatrix  *offd       = hypre_ParCSRMatrixOffd(matrix);
+   HYPRE_Int        *value_map  = hypre_ParCSRMatrixCSRValueMap(matrix);
+   HYPRE_Int         num_values = hypre_ParCSRMatrixCSRNumValues(matrix);
+   HYPRE_Complex    *diag_data;
+   HYPRE_Complex    *offd_data;
+   HYPRE_Int         k;
+
+   if (!value_map && !hypre_ParCSRMatrixCSRValuesAliased(matrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Matrix was not created from CSR arrays!\n");
+      return hypre_error_flag;
+   }
+
+   if (hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(matrix)) != hypre_MEMORY_HOST)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Updating values from CSR arrays only supported on the host!\n");
+      return hypre_error_flag;
+   }
+
+   if (hypre_ParCSRMatrixCSRValuesAliased(matrix))
+   {
+      hypre_CSRMatrixData(diag) = values;
+   }
+   else
+   {
+      diag_data = hypre_CSRMatrixData(diag);
+      offd_data = hypre_CSRMatrixData(offd);
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(k) HYPRE_SMP_SCHEDULE
+#endif
+      for (k = 0; k < num_values; k++)
+      {
+         if (value_map[k] >= 0)
+         {
+            diag_data[value_map[k]] = values[k];
+         }
+         else
+         {
+            offd_data[-value_map[k] - 1] = values[k];
+         }
+      }
+   }
+
+   /* Refresh or discard copies derived from the old values */
+   if (hypre_ParCSRMatrixDiagT(matrix))
+   {
+      hypre_CSRMatrixDestroy(hypre_ParCSRMatrixDiagT(matrix));
+      hypre_ParCSRMatrixDiagT(matrix) = NULL;
+   }
+   if (hypre_ParCSRMatrixOffdT(matrix))
+   {
+      hypre_CSRMatrixDestroy(hypre_ParCSRMatrixOffdT(matrix));
+      hypre_ParCSRMatrixOffdT(matrix) = NULL;
+   }
+   hypre_TFree(matrix->bdiaginv, HYPRE_MEMORY_HOST);
+   matrix->bdiag_size = -1;
+
+   hypre_ParCSRMatrixRefreshMatvecFormat(matrix);
+   if (hypre_CSRMatrixDataSingle(diag))
+   {
+      hypre_CSRMatrixSetSinglePrecision(diag, 1);
+   }
+   if (hypre_CSRMatrixDataSingle(offd))
+   {
+      hypre_CSRMatrixSetSinglePrecision(offd, 1);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixDetachCSRValues
+ *
+ * Gives a matrix that aliases user values its own copy of them (with an
+ * identity value map), e.g., before the matrix is moved to another memory
+ * location. Does nothing for other matrices.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixDetachCSRValues( hypre_ParCSRMatrix *matrix )
+{
+   hypre_CSRMatrix  *diag       = hypre_ParCSRMatrixDiag(matrix);
+   HYPRE_Int         num_values = hypre_ParCSRMatrixCSRNumValues(matrix);
+   HYPRE_Complex    *diag_data;
+   HYPRE_Int        *value_map;
+   HYPRE_Int         k;
+
+   if (!hypre_ParCSRMatrixCSRValuesAliased(matrix))
+   {
+      return hypre_error_flag;
+   }
+
+   diag_data = hypre_TAlloc(HYPRE_Complex, num_values, HYPRE_MEMORY_HOST);
+   value_map = hypre_TAlloc(HYPRE_Int, num_values, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(diag_data, hypre_CSRMatrixData(diag), HYPRE_Complex, num_values,
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(k) HYPRE_SMP_SCHEDULE
+#endif
+   for (k = 0; k < num_values; k++)
+   {
+      value_map[k] = k;
+   }
+
+   hypre_CSRMatrixData(diag)                  = diag_data;
+   hypre_ParCSRMatrixCSRValueMap(matrix)      = value_map;
+   hypre_ParCSRMatrixCSRValuesAliased(matrix) = 0;
+
+   return hypre_error_flag;
+}
@@ -341,7 +341,8 @@ hypre_ParMatmul_RowSizes( HYPRE_MemoryLocation memory_location,
  * hypre_ParMatmul:
  *
  * Multiplies two ParCSRMatrices A and B and returns the product in
- * ParCSRMatrix C.
+ * ParCSRMatrix C. Products repeated with unchanged patterns should use
+ * hypre_ParCSRMatMatReuseHost instead (see par_csr_spgemm_host.c).
  *--------------------------------------------------------------------------*/
 
 hypre_ParCSRMatrix*
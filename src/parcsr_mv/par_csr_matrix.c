@@ -110,6 +110,12 @@ hypre_ParCSRMatrixCreate( MPI_Comm      comm,
    hypre_ParCSRMatrixColMapOffd(matrix)       = NULL;
    hypre_ParCSRMatrixDeviceColMapOffd(matrix) = NULL;
    hypre_ParCSRMatrixProcOrdering(matrix)     = NULL;
+   hypre_ParCSRMatrixMatvecOverlap(matrix)    = 0;
+   hypre_ParCSRMatrixNumInteriorRows(matrix)  = 0;
+   hypre_ParCSRMatrixOverlapRows(matrix)      = NULL;
+   hypre_ParCSRMatrixCSRNumValues(matrix)     = 0;
+   hypre_ParCSRMatrixCSRValueMap(matrix)      = NULL;
+   hypre_ParCSRMatrixCSRValuesAliased(matrix) = 0;
 
    hypre_ParCSRMatrixAssumedPartition(matrix) = NULL;
    hypre_ParCSRMatrixOwnsAssumedPartition(matrix) = 1;
@@ -148,6 +154,11 @@ hypre_ParCSRMatrixDestroy( hypre_ParCSRMatrix *matrix )
 
       if ( hypre_ParCSRMatrixOwnsData(matrix) )
       {
+         /* the values of diag belong to the user */
+         if (hypre_ParCSRMatrixCSRValuesAliased(matrix))
+         {
+            hypre_CSRMatrixData(hypre_ParCSRMatrixDiag(matrix)) = NULL;
+         }
          hypre_CSRMatrixDestroy(hypre_ParCSRMatrixDiag(matrix));
          hypre_CSRMatrixDestroy(hypre_ParCSRMatrixOffd(matrix));
 
@@ -196,6 +207,8 @@ hypre_ParCSRMatrixDestroy( hypre_ParCSRMatrix *matrix )
       {
          hypre_TFree(hypre_ParCSRMatrixProcOrdering(matrix), HYPRE_MEMORY_HOST);
       }
+      hypre_TFree(hypre_ParCSRMatrixOverlapRows(matrix), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRMatrixCSRValueMap(matrix), HYPRE_MEMORY_HOST);
 
       hypre_TFree(matrix->bdiaginv, HYPRE_MEMORY_HOST);
       if (matrix->bdiaginv_comm_pkg)
@@ -214,6 +227,63 @@ hypre_ParCSRMatrixDestroy( hypre_ParCSRMatrix *matrix )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixMemorySize
+ *
+ * Returns the number of bytes held by the matrix on this process: the local
+ * diag and offd blocks (and their stored transposes), col_map_offd and the
+ * auxiliary arrays built by the solvers. Communication packages are not
+ * included; see hypre_ParCSRCommPkgMemorySize.
+ *--------------------------------------------------------------------------*/
+
+size_t
+hypre_ParCSRMatrixMemorySize( hypre_ParCSRMatrix *matrix )
+{
+   HYPRE_Int  num_rows, bdiag_size;
+   size_t     bytes;
+
+   if (!matrix)
+   {
+      return 0;
+   }
+
+   num_rows = hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(matrix));
+   bytes    = sizeof(hypre_ParCSRMatrix);
+
+   if (hypre_ParCSRMatrixOwnsData(matrix))
+   {
+      bytes += hypre_CSRMatrixMemorySize(hypre_ParCSRMatrixDiag(matrix));
+      bytes += hypre_CSRMatrixMemorySize(hypre_ParCSRMatrixOffd(matrix));
+      bytes += hypre_CSRMatrixMemorySize(hypre_ParCSRMatrixDiagT(matrix));
+      bytes += hypre_CSRMatrixMemorySize(hypre_ParCSRMatrixOffdT(matrix));
+
+      if (hypre_ParCSRMatrixColMapOffd(matrix))
+      {
+         bytes += (size_t) hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(matrix)) *
+                  sizeof(HYPRE_BigInt);
+      }
+   }
+
+   if (hypre_ParCSRMatrixOverlapRows(matrix))
+   {
+      bytes += (size_t) num_rows * sizeof(HYPRE_Int);
+   }
+
+   if (hypre_ParCSRMatrixCSRValueMap(matrix))
+   {
+      bytes += (size_t) hypre_ParCSRMatrixCSRNumValues(matrix) * sizeof(HYPRE_Int);
+   }
+
+   if (matrix->bdiaginv)
+   {
+      bdiag_size = matrix->bdiag_size;
+      bytes += (size_t) ((num_rows + bdiag_size - 1) / bdiag_size) *
+               bdiag_size * bdiag_size * sizeof(HYPRE_Complex);
+   }
+
+   return bytes;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParCSRMatrixInitialize
  *--------------------------------------------------------------------------*/
@@ -297,6 +367,13 @@ hypre_ParCSRMatrixMigrate(hypre_ParCSRMatrix *A, HYPRE_MemoryLocation memory_loc
 
    HYPRE_MemoryLocation old_memory_location = hypre_ParCSRMatrixMemoryLocation(A);
 
+   /* Values owned by the user cannot be moved */
+   if ( hypre_GetActualMemLocation(memory_location) !=
+        hypre_GetActualMemLocation(old_memory_location) )
+   {
+      hypre_ParCSRMatrixDetachCSRValues(A);
+   }
+
    hypre_CSRMatrixMigrate(hypre_ParCSRMatrixDiag(A), memory_location);
    hypre_CSRMatrixMigrate(hypre_ParCSRMatrixOffd(A), memory_location);
 
@@ -476,6 +553,113 @@ hypre_ParCSRMatrixSetPatternOnly( hypre_ParCSRMatrix *matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixSetMatvecFormat
+ *
+ * Selects the host matvec kernel (HYPRE_CSR_MATVEC_FORMAT_*) used for the
+ * diag and offd blocks of the matrix, and for their stored transposes.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixSetMatvecFormat( hypre_ParCSRMatrix *matrix,
+                                   HYPRE_Int           format )
+{
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_CSRMatrixSetMatvecFormat(hypre_ParCSRMatrixDiag(matrix), format);
+   hypre_CSRMatrixSetMatvecFormat(hypre_ParCSRMatrixOffd(matrix), format);
+   hypre_CSRMatrixSetMatvecFormat(hypre_ParCSRMatrixDiagT(matrix), format);
+   hypre_CSRMatrixSetMatvecFormat(hypre_ParCSRMatrixOffdT(matrix), format);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixRefreshMatvecFormat
+ *
+ * Drops the SELL copies of the diag and offd blocks (and of their stored
+ * transposes) after the values of the matrix have changed. The selected
+ * format is kept and the copies are rebuilt on the next matvec.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixRefreshMatvecFormat( hypre_ParCSRMatrix *matrix )
+{
+   if (!matrix)
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_CSRMatrixRefreshMatvecFormat(hypre_ParCSRMatrixDiag(matrix));
+   hypre_CSRMatrixRefreshMatvecFormat(hypre_ParCSRMatrixOffd(matrix));
+   hypre_CSRMatrixRefreshMatvecFormat(hypre_ParCSRMatrixDiagT(matrix));
+   hypre_CSRMatrixRefreshMatvecFormat(hypre_ParCSRMatrixOffdT(matrix));
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixSetMatvecOverlap
+ *
+ * Turns on (overlap = 1) or off (overlap = 0) the host matvec variant that
+ * splits the local rows into interior and boundary rows and computes the
+ * interior rows while the halo exchange is in flight. The row splitting is
+ * recomputed at the next matvec.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixSetMatvecOverlap( hypre_ParCSRMatrix *matrix,
+                                    HYPRE_Int           overlap )
+{
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (overlap != 0 && overlap != 1)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_TFree(hypre_ParCSRMatrixOverlapRows(matrix), HYPRE_MEMORY_HOST);
+   hypre_ParCSRMatrixNumInteriorRows(matrix) = 0;
+   hypre_ParCSRMatrixMatvecOverlap(matrix)   = overlap;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixSetSinglePrecision
+ *
+ * Builds (single_precision = 1) or discards (single_precision = 0) the
+ * single-precision copy of the values of the diag and offd blocks, and of
+ * their stored transposes, used by the host matvecs and smoothers.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixSetSinglePrecision( hypre_ParCSRMatrix *matrix,
+                                      HYPRE_Int           single_precision )
+{
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_CSRMatrixSetSinglePrecision(hypre_ParCSRMatrixDiag(matrix), single_precision);
+   hypre_CSRMatrixSetSinglePrecision(hypre_ParCSRMatrixOffd(matrix), single_precision);
+   hypre_CSRMatrixSetSinglePrecision(hypre_ParCSRMatrixDiagT(matrix), single_precision);
+   hypre_CSRMatrixSetSinglePrecision(hypre_ParCSRMatrixOffdT(matrix), single_precision);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParCSRMatrixRead
  *--------------------------------------------------------------------------*/
@@ -24,6 +24,10 @@
 #define HYPRE_PAR_CSR_MATRIX_STRUCT
 #endif
 
+/* Number of chunks of interior rows computed between MPI progress calls
+   in the overlapped host matvec */
+#define HYPRE_MATVEC_OVERLAP_NUM_CHUNKS 8
+
 typedef struct hypre_ParCSRMatrix_struct
 {
    MPI_Comm              comm;
@@ -72,6 +76,21 @@ typedef struct hypre_ParCSRMatrix_struct
    used for triangulr matrices that are not ordered to be triangular. */
    HYPRE_Int            *proc_ordering;
 
+   /* Host matvec with communication/computation overlap: local rows without
+      offd entries (interior) come first in overlap_rows, followed by the
+      rows that need halo values (boundary). Built lazily. */
+   HYPRE_Int             matvec_overlap;
+   HYPRE_Int             num_interior_rows;
+   HYPRE_Int            *overlap_rows;
+
+   /* Matrices built from user CSR arrays (hypre_ParCSRMatrixCreateFromCSR):
+      csr_value_map[k] is the position of the k-th user value in diag (>= 0)
+      or offd (-pos-1). If csr_values_aliased is set, the values of diag are
+      the user array itself and there is no map. */
+   HYPRE_Int             csr_num_values;
+   HYPRE_Int            *csr_value_map;
+   HYPRE_Int             csr_values_aliased;
+
    /* Save block diagonal inverse */
    HYPRE_Int             bdiag_size;
    HYPRE_Complex        *bdiaginv;
@@ -116,6 +135,12 @@ typedef struct hypre_ParCSRMatrix_struct
 #define hypre_ParCSRMatrixAssumedPartition(matrix)       ((matrix) -> assumed_partition)
 #define hypre_ParCSRMatrixOwnsAssumedPartition(matrix)   ((matrix) -> owns_assumed_partition)
 #define hypre_ParCSRMatrixProcOrdering(matrix)           ((matrix) -> proc_ordering)
+#define hypre_ParCSRMatrixMatvecOverlap(matrix)          ((matrix) -> matvec_overlap)
+#define hypre_ParCSRMatrixNumInteriorRows(matrix)        ((matrix) -> num_interior_rows)
+#define hypre_ParCSRMatrixOverlapRows(matrix)            ((matrix) -> overlap_rows)
+#define hypre_ParCSRMatrixCSRNumValues(matrix)           ((matrix) -> csr_num_values)
+#define hypre_ParCSRMatrixCSRValueMap(matrix)            ((matrix) -> csr_value_map)
+#define hypre_ParCSRMatrixCSRValuesAliased(matrix)       ((matrix) -> csr_values_aliased)
 #if defined(HYPRE_USING_GPU)
 #define hypre_ParCSRMatrixSocDiagJ(matrix)               ((matrix) -> soc_diag_j)
 #define hypre_ParCSRMatrixSocOffdJ(matrix)               ((matrix) -> soc_offd_j)
@@ -158,6 +183,57 @@ hypre_ParCSRMatrixMemoryLocation(hypre_ParCSRMatrix *matrix)
    return HYPRE_MEMORY_UNDEFINED;
 }
 
+/*--------------------------------------------------------------------------
+ * Symbolic data of a host product C = A * B
+ *
+ * Built by hypre_ParCSRMatMatSymbolicHost and reused by
+ * hypre_ParCSRMatMatNumericHost for as long as A and B keep their patterns.
+ * The local product is C = A_cat * [B_cat_diag, B_cat_offd], where A_cat holds
+ * the rows of [A_diag, A_offd] and the B_cat matrices hold the local rows of B
+ * followed by the external rows received from other processes.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   /* operands seen by the symbolic phase */
+   HYPRE_BigInt           global_num_rows_A;
+   HYPRE_BigInt           global_num_cols_B;
+   hypre_ulonglongint     pattern_key_A;
+   hypre_ulonglongint     pattern_key_B;
+
+   /* local operands and pattern of the product */
+   hypre_CSRMatrix       *A_cat;
+   hypre_CSRMatrix       *B_cat_diag;
+   hypre_CSRMatrix       *B_cat_offd;
+   hypre_CSRMatrix       *C_diag;
+   hypre_CSRMatrix       *C_offd;
+   HYPRE_Int              num_cols_offd_C;
+   HYPRE_BigInt          *col_map_offd_C;
+
+   /* values-only exchange of the external rows of B */
+   hypre_ParCSRCommPkg   *ext_comm_pkg;
+   HYPRE_Int             *ext_send_offsets;
+   HYPRE_Int              num_ext_nonzeros;
+   HYPRE_Int             *ext_map;
+
+} hypre_ParCSRMatMatData;
+
+#define hypre_ParCSRMatMatDataGlobalNumRowsA(data)  ((data) -> global_num_rows_A)
+#define hypre_ParCSRMatMatDataGlobalNumColsB(data)  ((data) -> global_num_cols_B)
+#define hypre_ParCSRMatMatDataPatternKeyA(data)     ((data) -> pattern_key_A)
+#define hypre_ParCSRMatMatDataPatternKeyB(data)     ((data) -> pattern_key_B)
+#define hypre_ParCSRMatMatDataACat(data)            ((data) -> A_cat)
+#define hypre_ParCSRMatMatDataBCatDiag(data)        ((data) -> B_cat_diag)
+#define hypre_ParCSRMatMatDataBCatOffd(data)        ((data) -> B_cat_offd)
+#define hypre_ParCSRMatMatDataCDiag(data)           ((data) -> C_diag)
+#define hypre_ParCSRMatMatDataCOffd(data)           ((data) -> C_offd)
+#define hypre_ParCSRMatMatDataNumColsOffdC(data)    ((data) -> num_cols_offd_C)
+#define hypre_ParCSRMatMatDataColMapOffdC(data)     ((data) -> col_map_offd_C)
+#define hypre_ParCSRMatMatDataExtCommPkg(data)      ((data) -> ext_comm_pkg)
+#define hypre_ParCSRMatMatDataExtSendOffsets(data)  ((data) -> ext_send_offsets)
+#define hypre_ParCSRMatMatDataNumExtNonzeros(data)  ((data) -> num_ext_nonzeros)
+#define hypre_ParCSRMatMatDataExtMap(data)          ((data) -> ext_map)
+
 /*--------------------------------------------------------------------------
  * Parallel CSR Boolean Matrix
  *--------------------------------------------------------------------------*/
@@ -182,9 +182,9 @@ hypre_ParCSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex       alpha,
    hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle,
                                          HYPRE_MEMORY_HOST, x_buf_data);
 #else
-   comm_handle = hypre_ParCSRCommHandleCreate_v2(1, comm_pkg,
+   comm_handle = hypre_ParCSRCommHandleCreate_v3(1, comm_pkg,
                                                  HYPRE_MEMORY_HOST, x_buf_data,
-                                                 HYPRE_MEMORY_HOST, x_tmp_data);
+                                                 HYPRE_MEMORY_HOST, x_tmp_data, 1);
 #endif
 
 #ifdef HYPRE_PROFILE
@@ -229,6 +229,237 @@ hypre_ParCSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex       alpha,
    return ierr;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixMatvecOutOfPlaceOverlapHost
+ *
+ * Host matvec with communication/computation overlap. The halo exchange uses
+ * the persistent handle of the comm package (send data is packed in place by
+ * all threads). Interior rows, i.e. rows without offd entries, are computed
+ * in chunks while the messages are in flight; between chunks the requests are
+ * tested to let MPI progress. Boundary rows are computed in a single pass
+ * over their diag and offd entries after the exchange completes.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixMatvecOutOfPlaceOverlapHost( HYPRE_Complex       alpha,
+                                               hypre_ParCSRMatrix *A,
+                                               hypre_ParVector    *x,
+                                               HYPRE_Complex       beta,
+                                               hypre_ParVector    *b,
+                                               hypre_ParVector    *y )
+{
+   hypre_ParCSRCommPkg     *comm_pkg      = hypre_ParCSRMatrixCommPkg(A);
+
+   hypre_CSRMatrix         *diag          = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int               *diag_i        = hypre_CSRMatrixI(diag);
+   HYPRE_Int               *diag_j        = hypre_CSRMatrixJ(diag);
+   HYPRE_Complex           *diag_data     = hypre_CSRMatrixData(diag);
+   hypre_CSRMatrix         *offd          = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int               *offd_i        = hypre_CSRMatrixI(offd);
+   HYPRE_Int               *offd_j        = hypre_CSRMatrixJ(offd);
+   HYPRE_Complex           *offd_data     = hypre_CSRMatrixData(offd);
+   HYPRE_Int                num_rows      = hypre_CSRMatrixNumRows(diag);
+
+   hypre_Vector            *x_local       = hypre_ParVectorLocalVector(x);
+   hypre_Vector            *b_local       = hypre_ParVectorLocalVector(b);
+   hypre_Vector            *y_local       = hypre_ParVectorLocalVector(y);
+   HYPRE_Complex           *x_data        = hypre_VectorData(x_local);
+   HYPRE_Complex           *b_data        = hypre_VectorData(b_local);
+   HYPRE_Complex           *y_data        = hypre_VectorData(y_local);
+   HYPRE_Int                num_vectors   = hypre_VectorNumVectors(x_local);
+   HYPRE_Int                x_vecstride   = hypre_VectorVectorStride(x_local);
+   HYPRE_Int                b_vecstride   = hypre_VectorVectorStride(b_local);
+   HYPRE_Int                y_vecstride   = hypre_VectorVectorStride(y_local);
+
+   HYPRE_BigInt             num_rows_g    = hypre_ParCSRMatrixGlobalNumRows(A);
+   HYPRE_BigInt             num_cols_g    = hypre_ParCSRMatrixGlobalNumCols(A);
+   HYPRE_BigInt             x_size        = hypre_ParVectorGlobalSize(x);
+   HYPRE_BigInt             b_size        = hypre_ParVectorGlobalSize(b);
+   HYPRE_BigInt             y_size        = hypre_ParVectorGlobalSize(y);
+
+   hypre_ParCSRPersistentCommHandle *comm_handle;
+   HYPRE_Complex           *x_buf_data;
+   HYPRE_Complex           *x_ext_data;
+   HYPRE_Int               *rows;
+   HYPRE_Int                num_interior, num_sends, num_requests;
+   HYPRE_Int                chunk, start, end, done;
+   HYPRE_Int                i, ii, jj, k, row;
+   HYPRE_Int                ierr = 0;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   /* See hypre_ParCSRMatrixMatvecOutOfPlaceHost for the meaning of ierr */
+   if (num_cols_g != x_size)
+   {
+      ierr = 11;
+   }
+
+   if (num_rows_g != y_size || num_rows_g != b_size)
+   {
+      ierr = 12;
+   }
+
+   if (num_cols_g != x_size && (num_rows_g != y_size || num_rows_g != b_size))
+   {
+      ierr = 13;
+   }
+
+   hypre_assert( hypre_VectorIndexStride(x_local) == 1 );
+   hypre_assert( hypre_VectorNumVectors(b_local) == num_vectors );
+   hypre_assert( hypre_VectorNumVectors(y_local) == num_vectors );
+
+   if (!comm_pkg)
+   {
+      hypre_MatvecCommPkgCreate(A);
+      comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   }
+   hypre_ParCSRCommPkgUpdateVecStarts(comm_pkg, x);
+   num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+
+   /*---------------------------------------------------------------------
+    * Split local rows into interior and boundary rows (done once)
+    *--------------------------------------------------------------------*/
+
+   if (!hypre_ParCSRMatrixOverlapRows(A))
+   {
+      HYPRE_Int num_boundary = 0;
+
+      rows = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+      num_interior = 0;
+      for (i = 0; i < num_rows; i++)
+      {
+         if (offd_i[i + 1] == offd_i[i])
+         {
+            rows[num_interior++] = i;
+         }
+      }
+      for (i = 0; i < num_rows; i++)
+      {
+         if (offd_i[i + 1] > offd_i[i])
+         {
+            rows[num_interior + num_boundary++] = i;
+         }
+      }
+
+      hypre_ParCSRMatrixOverlapRows(A)     = rows;
+      hypre_ParCSRMatrixNumInteriorRows(A) = num_interior;
+   }
+   rows         = hypre_ParCSRMatrixOverlapRows(A);
+   num_interior = hypre_ParCSRMatrixNumInteriorRows(A);
+
+   /*---------------------------------------------------------------------
+    * Pack send data directly into the persistent buffer and start
+    *--------------------------------------------------------------------*/
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
+#endif
+
+   comm_handle  = hypre_ParCSRCommPkgGetPersistentCommHandle(1, comm_pkg);
+   num_requests = hypre_ParCSRCommHandleNumRequests(comm_handle);
+   x_buf_data   = (HYPRE_Complex *) hypre_ParCSRCommHandleSendDataBuffer(comm_handle);
+   x_ext_data   = (HYPRE_Complex *) hypre_ParCSRCommHandleRecvDataBuffer(comm_handle);
+
+#if defined(HYPRE_USING_OPENMP)
+   #pragma omp parallel for HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends); i++)
+   {
+      x_buf_data[i] = x_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i)];
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK]   += hypre_MPI_Wtime();
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+   hypre_ParCSRPersistentCommHandleStart(comm_handle, HYPRE_MEMORY_HOST, x_buf_data);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+#endif
+
+   /*---------------------------------------------------------------------
+    * Interior rows, overlapped with the halo exchange
+    *--------------------------------------------------------------------*/
+
+   chunk = hypre_max(num_interior / HYPRE_MATVEC_OVERLAP_NUM_CHUNKS, 1);
+   done  = (num_requests == 0);
+   for (start = 0; start < num_interior; start += chunk)
+   {
+      end = hypre_min(start + chunk, num_interior);
+
+#if defined(HYPRE_USING_OPENMP)
+      #pragma omp parallel for private(ii, jj, k, row) HYPRE_SMP_SCHEDULE
+#endif
+      for (ii = start; ii < end; ii++)
+      {
+         row = rows[ii];
+         for (k = 0; k < num_vectors; k++)
+         {
+            HYPRE_Complex sum = 0.0;
+
+            for (jj = diag_i[row]; jj < diag_i[row + 1]; jj++)
+            {
+               sum += diag_data[jj] * x_data[diag_j[jj] + k * x_vecstride];
+            }
+
+            y_data[row + k * y_vecstride] = (beta == 0.0) ? alpha * sum :
+                                            alpha * sum + beta * b_data[row + k * b_vecstride];
+         }
+      }
+
+      /* Let MPI progress the messages */
+      if (!done)
+      {
+         hypre_MPI_Testall(num_requests, hypre_ParCSRCommHandleRequests(comm_handle),
+                           &done, hypre_MPI_STATUSES_IGNORE);
+      }
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+   hypre_ParCSRPersistentCommHandleWait(comm_handle, HYPRE_MEMORY_HOST, x_ext_data);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+#endif
+
+   /*---------------------------------------------------------------------
+    * Boundary rows: diag and offd parts in one pass
+    *--------------------------------------------------------------------*/
+
+#if defined(HYPRE_USING_OPENMP)
+   #pragma omp parallel for private(ii, jj, k, row) HYPRE_SMP_SCHEDULE
+#endif
+   for (ii = num_interior; ii < num_rows; ii++)
+   {
+      row = rows[ii];
+      for (k = 0; k < num_vectors; k++)
+      {
+         HYPRE_Complex sum = 0.0;
+
+         for (jj = diag_i[row]; jj < diag_i[row + 1]; jj++)
+         {
+            sum += diag_data[jj] * x_data[diag_j[jj] + k * x_vecstride];
+         }
+         for (jj = offd_i[row]; jj < offd_i[row + 1]; jj++)
+         {
+            sum += offd_data[jj] * x_ext_data[offd_j[jj] * num_vectors + k];
+         }
+
+         y_data[row + k * y_vecstride] = (beta == 0.0) ? alpha * sum :
+                                         alpha * sum + beta * b_data[row + k * b_vecstride];
+      }
+   }
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return ierr;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParCSRMatrixMatvecOutOfPlace
  *
@@ -256,7 +487,19 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
    else
 #endif
    {
-      ierr = hypre_ParCSRMatrixMatvecOutOfPlaceHost(alpha, A, x, beta, b, y);
+      HYPRE_Int num_procs;
+
+      hypre_MPI_Comm_size(hypre_ParCSRMatrixComm(A), &num_procs);
+      /* the overlapped kernel reads the double-precision values only */
+      if (hypre_ParCSRMatrixMatvecOverlap(A) && num_procs > 1 &&
+          !hypre_CSRMatrixDataSingle(hypre_ParCSRMatrixDiag(A)))
+      {
+         ierr = hypre_ParCSRMatrixMatvecOutOfPlaceOverlapHost(alpha, A, x, beta, b, y);
+      }
+      else
+      {
+         ierr = hypre_ParCSRMatrixMatvecOutOfPlaceHost(alpha, A, x, beta, b, y);
+      }
    }
 
    return ierr;
@@ -541,6 +784,334 @@ hypre_ParCSRMatrixMatvecT( HYPRE_Complex       alpha,
    return ierr;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixResidualRestrictHost
+ *
+ * Performs fc <- P^T * (f - A * u) in a single sweep over the fine rows.
+ * Each residual entry r_i is scattered into the coarse rows of P^T as soon
+ * as it is computed, so the fine residual is never stored. The offd part of
+ * P^T * r is summed into a buffer that is sent back to the owners of the
+ * coarse points, as in hypre_ParCSRMatrixMatvecTHost. If rnorm2 is not NULL,
+ * the local sum of squares of r is returned in it.
+ *
+ * Threads accumulate into private copies of the coarse vector that are
+ * added up at the end. The copies are kept in work, which must hold
+ * (num_threads - 1) * (num_coarse + num_cols_offd(P)) entries; if work is
+ * NULL, they are allocated here. Single vectors and double-precision values
+ * only.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixResidualRestrictHost( hypre_ParCSRMatrix *A,
+                                        hypre_ParCSRMatrix *P,
+                                        hypre_ParVector    *u,
+                                        hypre_ParVector    *f,
+                                        hypre_ParVector    *fc,
+                                        HYPRE_Real         *rnorm2,
+                                        HYPRE_Complex      *work )
+{
+   hypre_ParCSRCommPkg     *A_comm_pkg    = hypre_ParCSRMatrixCommPkg(A);
+   hypre_ParCSRCommPkg     *P_comm_pkg    = hypre_ParCSRMatrixCommPkg(P);
+
+   hypre_CSRMatrix         *A_diag        = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int               *A_diag_i      = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int               *A_diag_j      = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Complex           *A_diag_data   = hypre_CSRMatrixData(A_diag);
+   hypre_CSRMatrix         *A_offd        = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int               *A_offd_i      = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int               *A_offd_j      = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Complex           *A_offd_data   = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int                num_rows      = hypre_CSRMatrixNumRows(A_diag);
+
+   hypre_CSRMatrix         *P_diag        = hypre_ParCSRMatrixDiag(P);
+   HYPRE_Int               *P_diag_i      = hypre_CSRMatrixI(P_diag);
+   HYPRE_Int               *P_diag_j      = hypre_CSRMatrixJ(P_diag);
+   HYPRE_Complex           *P_diag_data   = hypre_CSRMatrixData(P_diag);
+   hypre_CSRMatrix         *P_offd        = hypre_ParCSRMatrixOffd(P);
+   HYPRE_Int               *P_offd_i      = hypre_CSRMatrixI(P_offd);
+   HYPRE_Int               *P_offd_j      = hypre_CSRMatrixJ(P_offd);
+   HYPRE_Complex           *P_offd_data   = hypre_CSRMatrixData(P_offd);
+   HYPRE_Int                num_coarse    = hypre_CSRMatrixNumCols(P_diag);
+   HYPRE_Int                P_num_cols_offd = hypre_CSRMatrixNumCols(P_offd);
+
+   HYPRE_Complex           *u_data        = hypre_VectorData(hypre_ParVectorLocalVector(u));
+   HYPRE_Complex           *f_data        = hypre_VectorData(hypre_ParVectorLocalVector(f));
+   HYPRE_Complex           *fc_data       = hypre_VectorData(hypre_ParVectorLocalVector(fc));
+
+   HYPRE_Complex           *u_buf_data;
+   HYPRE_Complex           *u_ext_data;
+   HYPRE_Complex           *fc_offd_data;
+   HYPRE_Complex           *fc_buf_data;
+   HYPRE_Complex           *fc_expand = NULL;
+   HYPRE_Int                expand_size   = num_coarse + P_num_cols_offd;
+   HYPRE_Int                num_threads   = hypre_NumThreads();
+   HYPRE_Int                A_num_sends, P_num_sends;
+   HYPRE_Int                i, t;
+   HYPRE_Real               norm2 = 0.0;
+
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+   hypre_ParCSRPersistentCommHandle *u_comm_handle;
+   hypre_ParCSRPersistentCommHandle *fc_comm_handle;
+#else
+   hypre_ParCSRCommHandle  *comm_handle;
+#endif
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   hypre_assert( hypre_VectorNumVectors(hypre_ParVectorLocalVector(u)) == 1 );
+   hypre_assert( hypre_CSRMatrixNumRows(P_diag) == num_rows );
+
+   if (!A_comm_pkg)
+   {
+      hypre_MatvecCommPkgCreate(A);
+      A_comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   }
+   if (!P_comm_pkg)
+   {
+      hypre_MatvecCommPkgCreate(P);
+      P_comm_pkg = hypre_ParCSRMatrixCommPkg(P);
+   }
+   hypre_ParCSRCommPkgUpdateVecStarts(A_comm_pkg, u);
+   hypre_ParCSRCommPkgUpdateVecStarts(P_comm_pkg, fc);
+   A_num_sends = hypre_ParCSRCommPkgNumSends(A_comm_pkg);
+   P_num_sends = hypre_ParCSRCommPkgNumSends(P_comm_pkg);
+
+   /*---------------------------------------------------------------------
+    * Start the halo exchange of u
+    *--------------------------------------------------------------------*/
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
+#endif
+
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+   u_comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(1, A_comm_pkg);
+   u_buf_data    = (HYPRE_Complex *) hypre_ParCSRCommHandleSendDataBuffer(u_comm_handle);
+   u_ext_data    = (HYPRE_Complex *) hypre_ParCSRCommHandleRecvDataBuffer(u_comm_handle);
+#else
+   u_buf_data = hypre_TAlloc(HYPRE_Complex,
+                             hypre_ParCSRCommPkgSendMapStart(A_comm_pkg, A_num_sends),
+                             HYPRE_MEMORY_HOST);
+   u_ext_data = hypre_TAlloc(HYPRE_Complex, hypre_CSRMatrixNumCols(A_offd), HYPRE_MEMORY_HOST);
+#endif
+
+#if defined(HYPRE_USING_OPENMP)
+   #pragma omp parallel for HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < hypre_ParCSRCommPkgSendMapStart(A_comm_pkg, A_num_sends); i++)
+   {
+      u_buf_data[i] = u_data[hypre_ParCSRCommPkgSendMapElmt(A_comm_pkg, i)];
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK]   += hypre_MPI_Wtime();
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+   hypre_ParCSRPersistentCommHandleStart(u_comm_handle, HYPRE_MEMORY_HOST, u_buf_data);
+#else
+   comm_handle = hypre_ParCSRCommHandleCreate_v3(1, A_comm_pkg,
+                                                 HYPRE_MEMORY_HOST, u_buf_data,
+                                                 HYPRE_MEMORY_HOST, u_ext_data, 1);
+#endif
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+#endif
+
+   /*---------------------------------------------------------------------
+    * Get the buffer for the offd part of P^T * r while the messages are
+    * in flight
+    *--------------------------------------------------------------------*/
+
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+   fc_comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(2, P_comm_pkg);
+   fc_offd_data   = (HYPRE_Complex *) hypre_ParCSRCommHandleSendDataBuffer(fc_comm_handle);
+   fc_buf_data    = (HYPRE_Complex *) hypre_ParCSRCommHandleRecvDataBuffer(fc_comm_handle);
+#else
+   fc_offd_data = hypre_TAlloc(HYPRE_Complex, P_num_cols_offd, HYPRE_MEMORY_HOST);
+   fc_buf_data  = hypre_TAlloc(HYPRE_Complex,
+                               hypre_ParCSRCommPkgSendMapStart(P_comm_pkg, P_num_sends),
+                               HYPRE_MEMORY_HOST);
+#endif
+
+   if (num_threads > 1)
+   {
+      fc_expand = work ? work :
+                  hypre_TAlloc(HYPRE_Complex, (num_threads - 1) * expand_size,
+                               HYPRE_MEMORY_HOST);
+   }
+
+#if defined(HYPRE_USING_OPENMP)
+   #pragma omp parallel for HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_coarse; i++)
+   {
+      fc_data[i] = 0.0;
+   }
+#if defined(HYPRE_USING_OPENMP)
+   #pragma omp parallel for HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < (num_threads - 1) * expand_size; i++)
+   {
+      fc_expand[i] = 0.0;
+   }
+   for (i = 0; i < P_num_cols_offd; i++)
+   {
+      fc_offd_data[i] = 0.0;
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+   hypre_ParCSRPersistentCommHandleWait(u_comm_handle, HYPRE_MEMORY_HOST, u_ext_data);
+#else
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+#endif
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+#endif
+
+   /*---------------------------------------------------------------------
+    * r_i = f_i - (A u)_i, scattered into fc and fc_offd by the rows of P
+    *--------------------------------------------------------------------*/
+
+#if defined(HYPRE_USING_OPENMP)
+   #pragma omp parallel private(i, t) reduction(+:norm2)
+#endif
+   {
+      HYPRE_Complex *fc_diag_t, *fc_offd_t, r;
+      HYPRE_Int      ns, ne, jj;
+
+      t = hypre_GetThreadNum();
+      if (t == 0)
+      {
+         fc_diag_t = fc_data;
+         fc_offd_t = fc_offd_data;
+      }
+      else
+      {
+         fc_diag_t = fc_expand + (t - 1) * expand_size;
+         fc_offd_t = fc_diag_t + num_coarse;
+      }
+
+      hypre_GetSimpleThreadPartition(&ns, &ne, num_rows);
+      for (i = ns; i < ne; i++)
+      {
+         /* same order of operations as hypre_ParCSRMatrixMatvecOutOfPlace */
+         r = 0.0;
+         for (jj = A_diag_i[i]; jj < A_diag_i[i + 1]; jj++)
+         {
+            r -= A_diag_data[jj] * u_data[A_diag_j[jj]];
+         }
+         r += f_data[i];
+         if (A_offd_i[i + 1] > A_offd_i[i])
+         {
+            HYPRE_Complex r_offd = 0.0;
+
+            for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+            {
+               r_offd -= A_offd_data[jj] * u_ext_data[A_offd_j[jj]];
+            }
+            r += r_offd;
+         }
+         norm2 += hypre_creal(hypre_conj(r) * r);
+
+         for (jj = P_diag_i[i]; jj < P_diag_i[i + 1]; jj++)
+         {
+            fc_diag_t[P_diag_j[jj]] += P_diag_data[jj] * r;
+         }
+         for (jj = P_offd_i[i]; jj < P_offd_i[i + 1]; jj++)
+         {
+            fc_offd_t[P_offd_j[jj]] += P_offd_data[jj] * r;
+         }
+      }
+   }
+
+   /* Add up the contributions of the other threads */
+   if (num_threads > 1)
+   {
+#if defined(HYPRE_USING_OPENMP)
+      #pragma omp parallel for private(i, t) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < expand_size; i++)
+      {
+         HYPRE_Complex sum = 0.0;
+
+         for (t = 0; t < num_threads - 1; t++)
+         {
+            sum += fc_expand[t * expand_size + i];
+         }
+         if (i < num_coarse)
+         {
+            fc_data[i] += sum;
+         }
+         else
+         {
+            fc_offd_data[i - num_coarse] += sum;
+         }
+      }
+      if (fc_expand != work)
+      {
+         hypre_TFree(fc_expand, HYPRE_MEMORY_HOST);
+      }
+   }
+
+   /*---------------------------------------------------------------------
+    * Send the offd part of P^T * r to the owners of the coarse points
+    *--------------------------------------------------------------------*/
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+   hypre_ParCSRPersistentCommHandleStart(fc_comm_handle, HYPRE_MEMORY_HOST, fc_offd_data);
+   hypre_ParCSRPersistentCommHandleWait(fc_comm_handle, HYPRE_MEMORY_HOST, fc_buf_data);
+#else
+   comm_handle = hypre_ParCSRCommHandleCreate_v2(2, P_comm_pkg,
+                                                 HYPRE_MEMORY_HOST, fc_offd_data,
+                                                 HYPRE_MEMORY_HOST, fc_buf_data);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+#endif
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK]   -= hypre_MPI_Wtime();
+#endif
+
+   for (i = hypre_ParCSRCommPkgSendMapStart(P_comm_pkg, 0);
+        i < hypre_ParCSRCommPkgSendMapStart(P_comm_pkg, P_num_sends);
+        i++)
+   {
+      fc_data[hypre_ParCSRCommPkgSendMapElmt(P_comm_pkg, i)] += fc_buf_data[i];
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] += hypre_MPI_Wtime();
+#endif
+
+#if !defined(HYPRE_USING_PERSISTENT_COMM)
+   hypre_TFree(u_buf_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(u_ext_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(fc_offd_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(fc_buf_data, HYPRE_MEMORY_HOST);
+#endif
+
+   if (rnorm2)
+   {
+      *rnorm2 = norm2;
+   }
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParCSRMatrixMatvec_FF
  *--------------------------------------------------------------------------*/
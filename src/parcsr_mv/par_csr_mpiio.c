@@ -0,0 +1,704 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Single-file binary I/O of ParCSR matrices and ParVectors with MPI-IO
+ *
+ * All processes of the communicator write their part of the object into one
+ * shared file with collective calls. The file does not depend on the number
+ * of processes or on the partitioning used when writing, so it can be read
+ * back on any number of processes with any row partitioning.
+ *
+ * Every file starts with a header of HYPRE_MPIIO_HEADER_SIZE entries stored
+ * as 8-byte unsigned integers. Their meanings are:
+ *
+ *    0) Magic number (the characters "hypreMIO")
+ *    1) Header version
+ *    2) Object type: 0 = ParCSR matrix, 1 = ParVector
+ *    3) Number of bytes for storing an integer type (column indices)
+ *    4) Number of bytes for storing a real type (coefficients)
+ *    5) Global number of rows
+ *    6) Global number of columns (matrix) or of components (vector)
+ *    7) Global number of nonzero coefficients (matrix) or of entries (vector)
+ *    8) Byte offset of the row index (matrix) or of the entries (vector)
+ *    9) Byte offset of the column indices (matrix)
+ *   10) Byte offset of the coefficients (matrix)
+ *   11-15) Reserved, zero
+ *
+ * A matrix is stored in global CSR format: the row index holds the global
+ * number of nonzeros preceding each row (global number of rows + 1 entries,
+ * 8 bytes each), followed by the global column indices and the coefficients.
+ * Within a row, the entries of the diagonal block come first. A vector is
+ * stored component after component, each in global row order.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_mv.h"
+
+#define HYPRE_MPIIO_HEADER_SIZE  16
+#define HYPRE_MPIIO_MAGIC        ((hypre_uint64) 0x4f494d6572707968)
+#define HYPRE_MPIIO_VERSION      1
+
+#define HYPRE_MPIIO_MATRIX       0
+#define HYPRE_MPIIO_VECTOR       1
+
+/*--------------------------------------------------------------------------
+ * hypre_MPIIOCheckHeader
+ *
+ * Checks that a header read from file describes an object of the given type
+ * that was written with the integer and real types of this build. Returns 1
+ * if the header is not valid, 0 otherwise.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_MPIIOCheckHeader( hypre_uint64 *header,
+                        HYPRE_Int     object_type )
+{
+   HYPRE_Int one = 1;
+
+   /* The format is little-endian */
+   if ((*(char*)&one) == 0)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Support to big-endian machines is incomplete!\n");
+      return 1;
+   }
+
+   if (header[0] != HYPRE_MPIIO_MAGIC || header[1] != HYPRE_MPIIO_VERSION)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Not a hypre MPI-IO file\n");
+      return 1;
+   }
+
+   if (header[2] != (hypre_uint64) object_type)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Wrong object type in MPI-IO file\n");
+      return 1;
+   }
+
+   if (header[3] != (hypre_uint64) sizeof(HYPRE_BigInt) ||
+       header[4] != (hypre_uint64) sizeof(HYPRE_Complex))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "MPI-IO file written with different integer or real types\n");
+      return 1;
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixPrintMPIIO
+ *
+ * Writes a ParCSRMatrix to a single file (see the format above).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixPrintMPIIO( hypre_ParCSRMatrix *matrix,
+                              const char         *filename )
+{
+   MPI_Comm              comm;
+   HYPRE_MemoryLocation  memory_location;
+   hypre_ParCSRMatrix   *h_matrix;
+
+   hypre_CSRMatrix      *diag, *offd;
+   HYPRE_Int            *diag_i, *diag_j, *offd_i, *offd_j;
+   HYPRE_Complex        *diag_data, *offd_data;
+   HYPRE_BigInt         *col_map_offd;
+   HYPRE_BigInt          first_row, first_col, global_num_rows;
+   HYPRE_Int             num_rows, local_nnz, num_index;
+
+   hypre_uint64          header[HYPRE_MPIIO_HEADER_SIZE];
+   hypre_uint64         *row_index;
+   HYPRE_BigInt         *big_j;
+   HYPRE_Complex        *data;
+   HYPRE_BigInt          big_nnz, first_nnz, global_nnz;
+   hypre_MPI_Offset      index_offset, cols_offset, data_offset;
+   hypre_MPI_File        fh;
+
+   HYPRE_Int             one = 1;
+   HYPRE_Int             myid, i, j, k;
+   HYPRE_Int             ierr = 0, all_ierr;
+
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   /* Exit if trying to write from big-endian machine */
+   if ((*(char*)&one) == 0)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Support to big-endian machines is incomplete!\n");
+      return hypre_error_flag;
+   }
+
+   comm            = hypre_ParCSRMatrixComm(matrix);
+   memory_location = hypre_ParCSRMatrixMemoryLocation(matrix);
+   hypre_MPI_Comm_rank(comm, &myid);
+
+   /* Create temporary matrix on host memory if needed */
+   h_matrix = (hypre_GetActualMemLocation(memory_location) == hypre_MEMORY_DEVICE) ?
+              hypre_ParCSRMatrixClone_v2(matrix, 1, HYPRE_MEMORY_HOST) : matrix;
+
+   diag            = hypre_ParCSRMatrixDiag(h_matrix);
+   offd            = hypre_ParCSRMatrixOffd(h_matrix);
+   diag_i          = hypre_CSRMatrixI(diag);
+   diag_j          = hypre_CSRMatrixJ(diag);
+   diag_data       = hypre_CSRMatrixData(diag);
+   offd_i          = hypre_CSRMatrixI(offd);
+   offd_j          = hypre_CSRMatrixJ(offd);
+   offd_data       = hypre_CSRMatrixData(offd);
+   col_map_offd    = hypre_ParCSRMatrixColMapOffd(h_matrix);
+   first_row       = hypre_ParCSRMatrixFirstRowIndex(h_matrix);
+   first_col       = hypre_ParCSRMatrixFirstColDiag(h_matrix);
+   global_num_rows = hypre_ParCSRMatrixGlobalNumRows(h_matrix);
+   num_rows        = hypre_CSRMatrixNumRows(diag);
+   local_nnz       = diag_i[num_rows] + offd_i[num_rows];
+
+   /* Position of the local entries in the global CSR arrays */
+   big_nnz = (HYPRE_BigInt) local_nnz;
+   hypre_MPI_Scan(&big_nnz, &first_nnz, 1, HYPRE_MPI_BIG_INT, hypre_MPI_SUM, comm);
+   first_nnz -= big_nnz;
+   hypre_MPI_Allreduce(&big_nnz, &global_nnz, 1, HYPRE_MPI_BIG_INT, hypre_MPI_SUM, comm);
+
+   index_offset = (hypre_MPI_Offset) (HYPRE_MPIIO_HEADER_SIZE * sizeof(hypre_uint64));
+   cols_offset  = index_offset + (hypre_MPI_Offset) ((global_num_rows + 1) * sizeof(hypre_uint64));
+   data_offset  = cols_offset + (hypre_MPI_Offset) (global_nnz * sizeof(HYPRE_BigInt));
+
+   /*---------------------------------------------
+    * Merge diag and offd into global CSR rows
+    *---------------------------------------------*/
+
+   /* The process owning the last row also writes the final row index entry */
+   num_index = (first_row + num_rows == global_num_rows) ? num_rows + 1 : num_rows;
+   row_index = hypre_TAlloc(hypre_uint64, num_rows + 1, HYPRE_MEMORY_HOST);
+   big_j     = hypre_TAlloc(HYPRE_BigInt, local_nnz, HYPRE_MEMORY_HOST);
+   data      = hypre_TAlloc(HYPRE_Complex, local_nnz, HYPRE_MEMORY_HOST);
+
+   for (i = 0, k = 0; i < num_rows; i++)
+   {
+      row_index[i] = (hypre_uint64) (first_nnz + k);
+      for (j = diag_i[i]; j < diag_i[i + 1]; j++, k++)
+      {
+         big_j[k] = first_col + (HYPRE_BigInt) diag_j[j];
+         data[k]  = diag_data[j];
+      }
+      for (j = offd_i[i]; j < offd_i[i + 1]; j++, k++)
+      {
+         big_j[k] = col_map_offd[offd_j[j]];
+         data[k]  = offd_data[j];
+      }
+   }
+   row_index[num_rows] = (hypre_uint64) (first_nnz + k);
+
+   /*---------------------------------------------
+    * Write file
+    *---------------------------------------------*/
+
+   if (hypre_MPI_File_open(comm, filename, hypre_MPI_MODE_WRONLY | hypre_MPI_MODE_CREATE,
+                           hypre_MPI_INFO_NULL, &fh))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Could not open output file!");
+      ierr = 1;
+   }
+   else
+   {
+      hypre_Memset(header, 0, sizeof(header), HYPRE_MEMORY_HOST);
+      header[0]  = HYPRE_MPIIO_MAGIC;
+      header[1]  = (hypre_uint64) HYPRE_MPIIO_VERSION;
+      header[2]  = (hypre_uint64) HYPRE_MPIIO_MATRIX;
+      header[3]  = (hypre_uint64) sizeof(HYPRE_BigInt);
+      header[4]  = (hypre_uint64) sizeof(HYPRE_Complex);
+      header[5]  = (hypre_uint64) global_num_rows;
+      header[6]  = (hypre_uint64) hypre_ParCSRMatrixGlobalNumCols(h_matrix);
+      header[7]  = (hypre_uint64) global_nnz;
+      header[8]  = (hypre_uint64) index_offset;
+      header[9]  = (hypre_uint64) cols_offset;
+      header[10] = (hypre_uint64) data_offset;
+
+      ierr |= hypre_MPI_File_write_at_all(fh, 0, header, myid ? 0 : (HYPRE_Int) sizeof(header),
+                                          hypre_MPI_BYTE, NULL);
+      ierr |= hypre_MPI_File_write_at_all(fh, index_offset + (hypre_MPI_Offset)
+                                          (first_row * sizeof(hypre_uint64)),
+                                          row_index, num_index * (HYPRE_Int) sizeof(hypre_uint64),
+                                          hypre_MPI_BYTE, NULL);
+      ierr |= hypre_MPI_File_write_at_all(fh, cols_offset + (hypre_MPI_Offset)
+                                          (first_nnz * sizeof(HYPRE_BigInt)),
+                                          big_j, local_nnz, HYPRE_MPI_BIG_INT, NULL);
+      ierr |= hypre_MPI_File_write_at_all(fh, data_offset + (hypre_MPI_Offset)
+                                          (first_nnz * sizeof(HYPRE_Complex)),
+                                          data, local_nnz, HYPRE_MPI_COMPLEX, NULL);
+
+      /* Drop trailing data of an older, larger file */
+      ierr |= hypre_MPI_File_set_size(fh, data_offset + (hypre_MPI_Offset)
+                                      (global_nnz * sizeof(HYPRE_Complex)));
+      hypre_MPI_File_close(&fh);
+
+      /* Make all processes report a failed write */
+      hypre_MPI_Allreduce(&ierr, &all_ierr, 1, HYPRE_MPI_INT, hypre_MPI_MAX, comm);
+      if (all_ierr)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Could not write all entries\n");
+      }
+   }
+
+   hypre_TFree(row_index, HYPRE_MEMORY_HOST);
+   hypre_TFree(big_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(data, HYPRE_MEMORY_HOST);
+
+   if (h_matrix != matrix)
+   {
+      hypre_ParCSRMatrixDestroy(h_matrix);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixReadMPIIO
+ *
+ * Reads a ParCSRMatrix written by hypre_ParCSRMatrixPrintMPIIO. Each process
+ * reads the rows given by row_starts (start of the local rows followed by
+ * the start of the next process' rows). The columns of the diagonal block
+ * are given by col_starts. If row_starts is NULL, the rows are distributed
+ * evenly. If col_starts is NULL, the columns are partitioned like the rows
+ * for square matrices and evenly otherwise.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixReadMPIIO( MPI_Comm             comm,
+                             const char          *filename,
+                             HYPRE_BigInt        *row_starts_in,
+                             HYPRE_BigInt        *col_starts_in,
+                             hypre_ParCSRMatrix **matrix_ptr )
+{
+   hypre_ParCSRMatrix   *matrix;
+   hypre_CSRMatrix      *diag, *offd;
+   HYPRE_Int            *diag_i, *diag_j, *offd_i, *offd_j;
+   HYPRE_Complex        *diag_data, *offd_data;
+   HYPRE_BigInt         *col_map_offd;
+
+   HYPRE_BigInt          row_starts[2], col_starts[2];
+   HYPRE_BigInt          global_num_rows, global_num_cols;
+   HYPRE_Int             num_rows, local_nnz, diag_nnz, offd_nnz, num_cols_offd;
+
+   hypre_uint64          header[HYPRE_MPIIO_HEADER_SIZE];
+   hypre_uint64         *row_index;
+   HYPRE_BigInt         *big_j;
+   HYPRE_Complex        *data;
+   HYPRE_BigInt         *offd_cols;
+   hypre_MPI_File        fh;
+
+   HYPRE_Int             num_procs, myid, i, j;
+   HYPRE_Int             ierr = 0, all_ierr;
+
+   *matrix_ptr = NULL;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &myid);
+
+   if (hypre_MPI_File_open(comm, filename, hypre_MPI_MODE_RDONLY, hypre_MPI_INFO_NULL, &fh))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Could not open input file!");
+      return hypre_error_flag;
+   }
+
+   /*---------------------------------------------
+    * Read and check header
+    *---------------------------------------------*/
+
+   if (hypre_MPI_File_read_at_all(fh, 0, header, (HYPRE_Int) sizeof(header),
+                                  hypre_MPI_BYTE, NULL))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Could not read header\n");
+      hypre_MPI_File_close(&fh);
+      return hypre_error_flag;
+   }
+
+   if (hypre_MPIIOCheckHeader(header, HYPRE_MPIIO_MATRIX))
+   {
+      hypre_MPI_File_close(&fh);
+      return hypre_error_flag;
+   }
+
+   global_num_rows = (HYPRE_BigInt) header[5];
+   global_num_cols = (HYPRE_BigInt) header[6];
+
+   /*---------------------------------------------
+    * Set up the new partitioning
+    *---------------------------------------------*/
+
+   if (row_starts_in)
+   {
+      row_starts[0] = row_starts_in[0];
+      row_starts[1] = row_starts_in[1];
+   }
+   else
+   {
+      hypre_GenerateLocalPartitioning(global_num_rows, num_procs, myid, row_starts);
+   }
+
+   if (col_starts_in)
+   {
+      col_starts[0] = col_starts_in[0];
+      col_starts[1] = col_starts_in[1];
+   }
+   else if (global_num_rows == global_num_cols)
+   {
+      col_starts[0] = row_starts[0];
+      col_starts[1] = row_starts[1];
+   }
+   else
+   {
+      hypre_GenerateLocalPartitioning(global_num_cols, num_procs, myid, col_starts);
+   }
+
+   num_rows = (HYPRE_Int) (row_starts[1] - row_starts[0]);
+
+   /*---------------------------------------------
+    * Read the local row range
+    *---------------------------------------------*/
+
+   row_index = hypre_TAlloc(hypre_uint64, num_rows + 1, HYPRE_MEMORY_HOST);
+   ierr |= hypre_MPI_File_read_at_all(fh, (hypre_MPI_Offset) (header[8] + (hypre_uint64)
+                                                              row_starts[0] * sizeof(hypre_uint64)),
+                                      row_index, (num_rows + 1) * (HYPRE_Int) sizeof(hypre_uint64),
+                                      hypre_MPI_BYTE, NULL);
+
+   local_nnz = (HYPRE_Int) (row_index[num_rows] - row_index[0]);
+   big_j = hypre_TAlloc(HYPRE_BigInt, local_nnz, HYPRE_MEMORY_HOST);
+   data  = hypre_TAlloc(HYPRE_Complex, local_nnz, HYPRE_MEMORY_HOST);
+
+   ierr |= hypre_MPI_File_read_at_all(fh, (hypre_MPI_Offset) (header[9] + row_index[0] *
+                                                              sizeof(HYPRE_BigInt)),
+                                      big_j, local_nnz, HYPRE_MPI_BIG_INT, NULL);
+   ierr |= hypre_MPI_File_read_at_all(fh, (hypre_MPI_Offset) (header[10] + row_index[0] *
+                                                              sizeof(HYPRE_Complex)),
+                                      data, local_nnz, HYPRE_MPI_COMPLEX, NULL);
+   hypre_MPI_File_close(&fh);
+
+   /* Make all processes report a failed read */
+   hypre_MPI_Allreduce(&ierr, &all_ierr, 1, HYPRE_MPI_INT, hypre_MPI_MAX, comm);
+   if (all_ierr)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Could not read all entries\n");
+      hypre_TFree(row_index, HYPRE_MEMORY_HOST);
+      hypre_TFree(big_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(data, HYPRE_MEMORY_HOST);
+      return hypre_error_flag;
+   }
+
+   /*---------------------------------------------
+    * Split the rows into diag and offd
+    *---------------------------------------------*/
+
+   offd_cols = hypre_TAlloc(HYPRE_BigInt, local_nnz, HYPRE_MEMORY_HOST);
+   diag_nnz = offd_nnz = 0;
+   for (j = 0; j < local_nnz; j++)
+   {
+      if (big_j[j] >= col_starts[0] && big_j[j] < col_starts[1])
+      {
+         diag_nnz++;
+      }
+      else
+      {
+         offd_cols[offd_nnz++] = big_j[j];
+      }
+   }
+
+   /* Sorted list of the distinct offd columns */
+   num_cols_offd = 0;
+   if (offd_nnz)
+   {
+      hypre_BigQsort0(offd_cols, 0, offd_nnz - 1);
+      num_cols_offd = 1;
+      for (j = 1; j < offd_nnz; j++)
+      {
+         if (offd_cols[j] > offd_cols[num_cols_offd - 1])
+         {
+            offd_cols[num_cols_offd++] = offd_cols[j];
+         }
+      }
+   }
+
+   matrix = hypre_ParCSRMatrixCreate(comm, global_num_rows, global_num_cols,
+                                     row_starts, col_starts, num_cols_offd,
+                                     diag_nnz, offd_nnz);
+   hypre_ParCSRMatrixInitialize_v2(matrix, HYPRE_MEMORY_HOST);
+
+   diag         = hypre_ParCSRMatrixDiag(matrix);
+   offd         = hypre_ParCSRMatrixOffd(matrix);
+   diag_i       = hypre_CSRMatrixI(diag);
+   diag_j       = hypre_CSRMatrixJ(diag);
+   diag_data    = hypre_CSRMatrixData(diag);
+   offd_i       = hypre_CSRMatrixI(offd);
+   offd_j       = hypre_CSRMatrixJ(offd);
+   offd_data    = hypre_CSRMatrixData(offd);
+   col_map_offd = hypre_ParCSRMatrixColMapOffd(matrix);
+
+   hypre_TMemcpy(col_map_offd, offd_cols, HYPRE_BigInt, num_cols_offd,
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+
+   diag_nnz = offd_nnz = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      diag_i[i] = diag_nnz;
+      offd_i[i] = offd_nnz;
+      for (j = (HYPRE_Int) (row_index[i] - row_index[0]);
+           j < (HYPRE_Int) (row_index[i + 1] - row_index[0]); j++)
+      {
+         if (big_j[j] >= col_starts[0] && big_j[j] < col_starts[1])
+         {
+            diag_j[diag_nnz]    = (HYPRE_Int) (big_j[j] - col_starts[0]);
+            diag_data[diag_nnz] = data[j];
+            diag_nnz++;
+         }
+         else
+         {
+            offd_j[offd_nnz]    = hypre_BigBinarySearch(col_map_offd, big_j[j], num_cols_offd);
+            offd_data[offd_nnz] = data[j];
+            offd_nnz++;
+         }
+      }
+   }
+   diag_i[num_rows] = diag_nnz;
+   offd_i[num_rows] = offd_nnz;
+
+   /* Put the diagonal entries first if the partitioning has changed */
+   if (row_starts[0] == col_starts[0] && row_starts[1] == col_starts[1])
+   {
+      hypre_CSRMatrixReorder(diag);
+   }
+
+   hypre_TFree(row_index, HYPRE_MEMORY_HOST);
+   hypre_TFree(big_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(data, HYPRE_MEMORY_HOST);
+   hypre_TFree(offd_cols, HYPRE_MEMORY_HOST);
+
+   hypre_ParCSRMatrixSetNumNonzeros(matrix);
+   hypre_ParCSRMatrixSetDNumNonzeros(matrix);
+   hypre_ParCSRMatrixMigrate(matrix, hypre_HandleMemoryLocation(hypre_handle()));
+
+   *matrix_ptr = matrix;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorPrintMPIIO
+ *
+ * Writes a ParVector to a single file (see the format above).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorPrintMPIIO( hypre_ParVector *vector,
+                           const char      *filename )
+{
+   MPI_Comm               comm;
+   HYPRE_MemoryLocation   memory_location;
+   hypre_ParVector       *h_vector;
+   hypre_Vector          *local_vector;
+
+   HYPRE_BigInt           global_size, first_index;
+   HYPRE_Int              size, num_vectors, vecstride, idxstride;
+   HYPRE_Complex         *data, *buffer = NULL;
+
+   hypre_uint64           header[HYPRE_MPIIO_HEADER_SIZE];
+   hypre_MPI_Offset       data_offset;
+   hypre_MPI_File         fh;
+
+   HYPRE_Int              one = 1;
+   HYPRE_Int              myid, i, k;
+   HYPRE_Int              ierr = 0, all_ierr;
+
+   if (!vector)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   /* Exit if trying to write from big-endian machine */
+   if ((*(char*)&one) == 0)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Support to big-endian machines is incomplete!\n");
+      return hypre_error_flag;
+   }
+
+   comm            = hypre_ParVectorComm(vector);
+   memory_location = hypre_ParVectorMemoryLocation(vector);
+   hypre_MPI_Comm_rank(comm, &myid);
+
+   /* Create temporary vector on host memory if needed */
+   h_vector = (hypre_GetActualMemLocation(memory_location) == hypre_MEMORY_DEVICE) ?
+              hypre_ParVectorCloneDeep_v2(vector, HYPRE_MEMORY_HOST) : vector;
+
+   local_vector = hypre_ParVectorLocalVector(h_vector);
+   global_size  = hypre_ParVectorGlobalSize(h_vector);
+   first_index  = hypre_ParVectorFirstIndex(h_vector);
+   size         = hypre_VectorSize(local_vector);
+   num_vectors  = hypre_VectorNumVectors(local_vector);
+   vecstride    = hypre_VectorVectorStride(local_vector);
+   idxstride    = hypre_VectorIndexStride(local_vector);
+   data         = hypre_VectorData(local_vector);
+   data_offset  = (hypre_MPI_Offset) (HYPRE_MPIIO_HEADER_SIZE * sizeof(hypre_uint64));
+
+   /* Components stored with interleaved entries are written one at a time */
+   if (idxstride != 1)
+   {
+      buffer = hypre_TAlloc(HYPRE_Complex, size, HYPRE_MEMORY_HOST);
+   }
+
+   if (hypre_MPI_File_open(comm, filename, hypre_MPI_MODE_WRONLY | hypre_MPI_MODE_CREATE,
+                           hypre_MPI_INFO_NULL, &fh))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Could not open output file!");
+      ierr = 1;
+   }
+   else
+   {
+      hypre_Memset(header, 0, sizeof(header), HYPRE_MEMORY_HOST);
+      header[0] = HYPRE_MPIIO_MAGIC;
+      header[1] = (hypre_uint64) HYPRE_MPIIO_VERSION;
+      header[2] = (hypre_uint64) HYPRE_MPIIO_VECTOR;
+      header[3] = (hypre_uint64) sizeof(HYPRE_BigInt);
+      header[4] = (hypre_uint64) sizeof(HYPRE_Complex);
+      header[5] = (hypre_uint64) global_size;
+      header[6] = (hypre_uint64) num_vectors;
+      header[7] = (hypre_uint64) global_size * (hypre_uint64) num_vectors;
+      header[8] = (hypre_uint64) data_offset;
+
+      ierr |= hypre_MPI_File_write_at_all(fh, 0, header, myid ? 0 : (HYPRE_Int) sizeof(header),
+                                          hypre_MPI_BYTE, NULL);
+
+      for (k = 0; k < num_vectors; k++)
+      {
+         HYPRE_Complex *component = data + k * vecstride;
+
+         if (buffer)
+         {
+            for (i = 0; i < size; i++)
+            {
+               buffer[i] = component[i * idxstride];
+            }
+            component = buffer;
+         }
+
+         ierr |= hypre_MPI_File_write_at_all(fh, data_offset + (hypre_MPI_Offset)
+                                             ((k * global_size + first_index) *
+                                              sizeof(HYPRE_Complex)),
+                                             component, size, HYPRE_MPI_COMPLEX, NULL);
+      }
+
+      ierr |= hypre_MPI_File_set_size(fh, data_offset + (hypre_MPI_Offset)
+                                      (num_vectors * global_size * sizeof(HYPRE_Complex)));
+      hypre_MPI_File_close(&fh);
+
+      /* Make all processes report a failed write */
+      hypre_MPI_Allreduce(&ierr, &all_ierr, 1, HYPRE_MPI_INT, hypre_MPI_MAX, comm);
+      if (all_ierr)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Could not write all entries\n");
+      }
+   }
+
+   hypre_TFree(buffer, HYPRE_MEMORY_HOST);
+
+   if (h_vector != vector)
+   {
+      hypre_ParVectorDestroy(h_vector);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorReadMPIIO
+ *
+ * Reads a ParVector written by hypre_ParVectorPrintMPIIO. The local range of
+ * each process is given by partitioning (same meaning as in
+ * hypre_ParVectorCreate); if it is NULL, the entries are distributed evenly.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorReadMPIIO( MPI_Comm          comm,
+                          const char       *filename,
+                          HYPRE_BigInt     *partitioning,
+                          hypre_ParVector **vector_ptr )
+{
+   hypre_ParVector       *vector;
+   hypre_Vector          *local_vector;
+   HYPRE_BigInt           global_size, first_index;
+   HYPRE_Int              size, num_vectors, vecstride;
+   HYPRE_Complex         *data;
+
+   hypre_uint64           header[HYPRE_MPIIO_HEADER_SIZE];
+   hypre_MPI_File         fh;
+
+   HYPRE_Int              k;
+   HYPRE_Int              ierr = 0, all_ierr;
+
+   *vector_ptr = NULL;
+
+   if (hypre_MPI_File_open(comm, filename, hypre_MPI_MODE_RDONLY, hypre_MPI_INFO_NULL, &fh))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Could not open input file!");
+      return hypre_error_flag;
+   }
+
+   if (hypre_MPI_File_read_at_all(fh, 0, header, (HYPRE_Int) sizeof(header),
+                                  hypre_MPI_BYTE, NULL))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Could not read header\n");
+      hypre_MPI_File_close(&fh);
+      return hypre_error_flag;
+   }
+
+   if (hypre_MPIIOCheckHeader(header, HYPRE_MPIIO_VECTOR))
+   {
+      hypre_MPI_File_close(&fh);
+      return hypre_error_flag;
+   }
+
+   global_size = (HYPRE_BigInt) header[5];
+   num_vectors = (HYPRE_Int) header[6];
+
+   vector = (num_vectors > 1) ?
+            hypre_ParMultiVectorCreate(comm, global_size, partitioning, num_vectors) :
+            hypre_ParVectorCreate(comm, global_size, partitioning);
+   hypre_ParVectorInitialize_v2(vector, HYPRE_MEMORY_HOST);
+
+   local_vector = hypre_ParVectorLocalVector(vector);
+   first_index  = hypre_ParVectorFirstIndex(vector);
+   size         = hypre_VectorSize(local_vector);
+   vecstride    = hypre_VectorVectorStride(local_vector);
+   data         = hypre_VectorData(local_vector);
+
+   for (k = 0; k < num_vectors; k++)
+   {
+      ierr |= hypre_MPI_File_read_at_all(fh, (hypre_MPI_Offset) (header[8] + (hypre_uint64)
+                                                                 (k * global_size + first_index) *
+                                                                 sizeof(HYPRE_Complex)),
+                                         data + k * vecstride, size, HYPRE_MPI_COMPLEX, NULL);
+   }
+   hypre_MPI_File_close(&fh);
+
+   /* Make all processes report a failed read */
+   hypre_MPI_Allreduce(&ierr, &all_ierr, 1, HYPRE_MPI_INT, hypre_MPI_MAX, comm);
+   if (all_ierr)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Could not read all entries\n");
+      hypre_ParVectorDestroy(vector);
+      return hypre_error_flag;
+   }
+
+   hypre_ParVectorMigrate(vector, hypre_HandleMemoryLocation(hypre_handle()));
+
+   *vector_ptr = vector;
+
+   return hypre_error_flag;
+}
@@ -0,0 +1,1141 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Node-aware (two-level) halo exchange for hypre_ParCSRCommPkg.
+ *
+ * A forward exchange (jobs 1, 11, 21) is split into
+ *   - direct messages between ranks of the same node,
+ *   - a gather of the off-node data of each rank to its node leader,
+ *   - one message per pair of nodes between the leaders,
+ *   - a scatter from the leader to the ranks of the destination node.
+ *
+ * The schedule is built once, collectively, when the comm package is created
+ * and HYPRE_SetNodeAwareComm has been called. The exchange itself keeps the
+ * send_map/recv_vec_starts layout of the comm package, so callers of
+ * hypre_ParCSRCommHandleCreate/Destroy are not affected. Since callers may
+ * pack different values of the same element for different ranks, elements
+ * sent to several ranks of a node are only merged, by a second schedule, in
+ * exchanges declared element-wise (hypre_ParCSRCommHandleCreate_v3).
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_mv.h"
+
+#define HYPRE_NODE_COMM_TAG_LEADER     311
+#define HYPRE_NODE_COMM_TAG_LEADER_T   312
+#define HYPRE_NODE_COMM_TAG_GATHER     314
+#define HYPRE_NODE_COMM_TAG_NODE       315
+#define HYPRE_NODE_COMM_TAG_SCATTER    316
+#define HYPRE_NODE_COMM_TAG_MERGE      317
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommNodeHasRepeats
+ *
+ * Returns 1 if some element of the send buffer goes to several ranks of one
+ * other node, i.e., if the merged schedule would send less data.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRCommNodeHasRepeats( hypre_ParCSRCommPkg *comm_pkg,
+                                HYPRE_Int            leader,
+                                HYPRE_Int           *send_leaders )
+{
+   HYPRE_Int   num_sends       = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   HYPRE_Int  *send_map_starts = hypre_ParCSRCommPkgSendMapStarts(comm_pkg);
+   HYPRE_Int  *send_map_elmts  = hypre_ParCSRCommPkgSendMapElmts(comm_pkg);
+
+   HYPRE_Int  *keys, *order, *marker;
+   HYPRE_Int   num_off_sends, max_elmt, repeats;
+   HYPRE_Int   i, j, k;
+
+   keys  = hypre_TAlloc(HYPRE_Int, num_sends, HYPRE_MEMORY_HOST);
+   order = hypre_TAlloc(HYPRE_Int, num_sends, HYPRE_MEMORY_HOST);
+   num_off_sends = 0;
+   for (i = 0; i < num_sends; i++)
+   {
+      if (send_leaders[i] != leader)
+      {
+         keys[num_off_sends]    = send_leaders[i];
+         order[num_off_sends++] = i;
+      }
+   }
+   hypre_qsort2i(keys, order, 0, num_off_sends - 1);
+
+   max_elmt = -1;
+   for (j = 0; j < send_map_starts[num_sends]; j++)
+   {
+      max_elmt = hypre_max(max_elmt, send_map_elmts[j]);
+   }
+
+   /* marker[e] is the last destination node that takes element e; the sends
+      to one node are visited together */
+   marker = hypre_TAlloc(HYPRE_Int, max_elmt + 1, HYPRE_MEMORY_HOST);
+   for (j = 0; j <= max_elmt; j++)
+   {
+      marker[j] = -1;
+   }
+
+   repeats = 0;
+   for (k = 0; k < num_off_sends && !repeats; k++)
+   {
+      i = order[k];
+      for (j = send_map_starts[i]; j < send_map_starts[i + 1]; j++)
+      {
+         if (marker[send_map_elmts[j]] == keys[k])
+         {
+            repeats = 1;
+            break;
+         }
+         marker[send_map_elmts[j]] = keys[k];
+      }
+   }
+
+   hypre_TFree(keys, HYPRE_MEMORY_HOST);
+   hypre_TFree(order, HYPRE_MEMORY_HOST);
+   hypre_TFree(marker, HYPRE_MEMORY_HOST);
+
+   return repeats;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommNodePkgBuild
+ *
+ * Builds a node-aware schedule of comm_pkg, given the node communicator and
+ * the leaders of the neighbors. Collective on the communicator of comm_pkg.
+ *
+ * The off-node data of a rank is ordered by destination node, then by
+ * destination rank. The leader forwards the data of its ranks in ascending
+ * rank order, so the leader of the destination node can locate the data of
+ * each of its ranks from their receive lists alone.
+ *
+ * With merge = 1, the data of a rank for a destination node holds each
+ * element once, and the rank sends the leader of that node the position of
+ * each of its entries (in the order above) in the merged data.
+ *--------------------------------------------------------------------------*/
+
+static hypre_ParCSRCommNodePkg *
+hypre_ParCSRCommNodePkgBuild( hypre_ParCSRCommPkg *comm_pkg,
+                              hypre_MPI_Comm       node_comm,
+                              HYPRE_Int            leader,
+                              HYPRE_Int           *send_leaders,
+                              HYPRE_Int           *recv_leaders,
+                              HYPRE_Int            merge )
+{
+   MPI_Comm                  comm            = hypre_ParCSRCommPkgComm(comm_pkg);
+   HYPRE_Int                 num_sends       = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   HYPRE_Int                *send_procs      = hypre_ParCSRCommPkgSendProcs(comm_pkg);
+   HYPRE_Int                *send_map_starts = hypre_ParCSRCommPkgSendMapStarts(comm_pkg);
+   HYPRE_Int                *send_map_elmts  = hypre_ParCSRCommPkgSendMapElmts(comm_pkg);
+   HYPRE_Int                 num_recvs       = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+   HYPRE_Int                *recv_procs      = hypre_ParCSRCommPkgRecvProcs(comm_pkg);
+   HYPRE_Int                *recv_vec_starts = hypre_ParCSRCommPkgRecvVecStarts(comm_pkg);
+
+   hypre_ParCSRCommNodePkg  *node_pkg;
+   HYPRE_Int                 my_id, node_id, node_nprocs;
+
+   HYPRE_Int                *send_order;
+   HYPRE_Int                *send_keys;
+   HYPRE_Int                 num_off_sends;
+   HYPRE_Int                 num_dests;
+   HYPRE_Int                *dest_leaders;
+
+   /* per-rank info gathered by the leader:
+      send_info = [dest leader, count] per destination node,
+      recv_info = [source rank, source leader, count] per off-node receive */
+   HYPRE_Int                 my_info[3];
+   HYPRE_Int                *send_info, *recv_info;
+   HYPRE_Int                 num_send_info, num_recv_info;
+   HYPRE_Int                *all_info = NULL;
+   HYPRE_Int                *all_send_info = NULL, *all_recv_info = NULL;
+   HYPRE_Int                *send_info_starts = NULL, *recv_info_starts = NULL;
+   HYPRE_Int                *counts = NULL;
+
+   /* merged schedule: marker[e] is the last destination node that takes
+      element e, and position[e] its position in the data for that node;
+      merge_buf holds [merged count, positions] per destination node */
+   HYPRE_Int                *marker = NULL, *position = NULL;
+   HYPRE_Int                *merge_buf = NULL;
+   hypre_MPI_Request        *merge_requests = NULL;
+   HYPRE_Int                 max_elmt, m, m0;
+
+   HYPRE_Int                 num_local_sends, num_local_recvs;
+   HYPRE_Int                 num_send_elmts, num_recv_elmts;
+   HYPRE_Int                 i, j, k, d, n, r, cnt;
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+   hypre_MPI_Comm_rank(node_comm, &node_id);
+   hypre_MPI_Comm_size(node_comm, &node_nprocs);
+
+   node_pkg = hypre_CTAlloc(hypre_ParCSRCommNodePkg, 1, HYPRE_MEMORY_HOST);
+   hypre_ParCSRCommNodePkgLeader(node_pkg) = leader;
+
+   /*--------------------------------------------------------------------
+    * Sender side: on-node sends and the off-node data per destination node
+    *--------------------------------------------------------------------*/
+
+   num_local_sends = 0;
+   num_off_sends   = 0;
+   send_order      = hypre_TAlloc(HYPRE_Int, num_sends, HYPRE_MEMORY_HOST);
+   send_keys       = hypre_TAlloc(HYPRE_Int, num_sends, HYPRE_MEMORY_HOST);
+   hypre_ParCSRCommNodePkgLocalSends(node_pkg) = hypre_TAlloc(HYPRE_Int, num_sends,
+                                                              HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_sends; i++)
+   {
+      if (send_leaders[i] == leader)
+      {
+         hypre_ParCSRCommNodePkgLocalSends(node_pkg)[num_local_sends++] = i;
+      }
+      else if (send_map_starts[i + 1] > send_map_starts[i])
+      {
+         send_keys[num_off_sends]    = send_procs[i];
+         send_order[num_off_sends++] = i;
+      }
+   }
+   hypre_ParCSRCommNodePkgNumLocalSends(node_pkg) = num_local_sends;
+
+   /* off-node sends in ascending order of the destination rank */
+   hypre_qsort2i(send_keys, send_order, 0, num_off_sends - 1);
+
+   /* destination nodes in ascending order */
+   dest_leaders = hypre_TAlloc(HYPRE_Int, num_off_sends, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_off_sends; i++)
+   {
+      dest_leaders[i] = send_leaders[send_order[i]];
+   }
+   hypre_qsort0(dest_leaders, 0, num_off_sends - 1);
+   num_dests = 0;
+   for (i = 0; i < num_off_sends; i++)
+   {
+      if (num_dests == 0 || dest_leaders[i] != dest_leaders[num_dests - 1])
+      {
+         dest_leaders[num_dests++] = dest_leaders[i];
+      }
+   }
+
+   if (merge)
+   {
+      max_elmt = -1;
+      for (j = 0; j < send_map_starts[num_sends]; j++)
+      {
+         max_elmt = hypre_max(max_elmt, send_map_elmts[j]);
+      }
+      marker   = hypre_TAlloc(HYPRE_Int, max_elmt + 1, HYPRE_MEMORY_HOST);
+      position = hypre_TAlloc(HYPRE_Int, max_elmt + 1, HYPRE_MEMORY_HOST);
+      for (j = 0; j <= max_elmt; j++)
+      {
+         marker[j] = -1;
+      }
+      merge_buf      = hypre_TAlloc(HYPRE_Int, num_dests + send_map_starts[num_sends],
+                                    HYPRE_MEMORY_HOST);
+      merge_requests = hypre_CTAlloc(hypre_MPI_Request, num_dests, HYPRE_MEMORY_HOST);
+   }
+
+   num_send_info  = 2 * num_dests;
+   send_info      = hypre_TAlloc(HYPRE_Int, num_send_info, HYPRE_MEMORY_HOST);
+   num_send_elmts = 0;
+   hypre_ParCSRCommNodePkgSendElmts(node_pkg) = hypre_TAlloc(HYPRE_Int,
+                                                             send_map_starts[num_sends],
+                                                             HYPRE_MEMORY_HOST);
+   m = 0;
+   for (d = 0; d < num_dests; d++)
+   {
+      cnt = num_send_elmts;
+      m0  = m++;
+      for (k = 0; k < num_off_sends; k++)
+      {
+         i = send_order[k];
+         if (send_leaders[i] == dest_leaders[d])
+         {
+            for (j = send_map_starts[i]; j < send_map_starts[i + 1]; j++)
+            {
+               if (!merge)
+               {
+                  hypre_ParCSRCommNodePkgSendElmts(node_pkg)[num_send_elmts++] = j;
+               }
+               else
+               {
+                  if (marker[send_map_elmts[j]] != d)
+                  {
+                     marker[send_map_elmts[j]]   = d;
+                     position[send_map_elmts[j]] = num_send_elmts - cnt;
+                     hypre_ParCSRCommNodePkgSendElmts(node_pkg)[num_send_elmts++] = j;
+                  }
+                  merge_buf[m++] = position[send_map_elmts[j]];
+               }
+            }
+         }
+      }
+      send_info[2 * d]     = dest_leaders[d];
+      send_info[2 * d + 1] = num_send_elmts - cnt;
+
+      if (merge)
+      {
+         merge_buf[m0] = num_send_elmts - cnt;
+         hypre_MPI_Isend(&merge_buf[m0], m - m0, HYPRE_MPI_INT, dest_leaders[d],
+                         HYPRE_NODE_COMM_TAG_MERGE, comm, &merge_requests[d]);
+      }
+   }
+   hypre_ParCSRCommNodePkgNumSendElmts(node_pkg) = num_send_elmts;
+
+   hypre_TFree(send_keys, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_order, HYPRE_MEMORY_HOST);
+   hypre_TFree(dest_leaders, HYPRE_MEMORY_HOST);
+   hypre_TFree(marker, HYPRE_MEMORY_HOST);
+   hypre_TFree(position, HYPRE_MEMORY_HOST);
+
+   /*--------------------------------------------------------------------
+    * Receiver side: on-node receives and the positions of the off-node
+    * data in the receive buffer
+    *--------------------------------------------------------------------*/
+
+   num_local_recvs = 0;
+   num_recv_elmts  = 0;
+   num_recv_info   = 0;
+   recv_info       = hypre_TAlloc(HYPRE_Int, 3 * num_recvs, HYPRE_MEMORY_HOST);
+   hypre_ParCSRCommNodePkgLocalRecvs(node_pkg) = hypre_TAlloc(HYPRE_Int, num_recvs,
+                                                              HYPRE_MEMORY_HOST);
+   hypre_ParCSRCommNodePkgRecvElmts(node_pkg)  = hypre_TAlloc(HYPRE_Int,
+                                                              recv_vec_starts[num_recvs],
+                                                              HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_recvs; i++)
+   {
+      if (recv_leaders[i] == leader)
+      {
+         hypre_ParCSRCommNodePkgLocalRecvs(node_pkg)[num_local_recvs++] = i;
+      }
+      else if (recv_vec_starts[i + 1] > recv_vec_starts[i])
+      {
+         for (j = recv_vec_starts[i]; j < recv_vec_starts[i + 1]; j++)
+         {
+            hypre_ParCSRCommNodePkgRecvElmts(node_pkg)[num_recv_elmts++] = j;
+         }
+         recv_info[num_recv_info++] = recv_procs[i];
+         recv_info[num_recv_info++] = recv_leaders[i];
+         recv_info[num_recv_info++] = recv_vec_starts[i + 1] - recv_vec_starts[i];
+      }
+   }
+   hypre_ParCSRCommNodePkgNumLocalRecvs(node_pkg) = num_local_recvs;
+   hypre_ParCSRCommNodePkgNumRecvElmts(node_pkg)  = num_recv_elmts;
+
+   /*--------------------------------------------------------------------
+    * Gather the info of the ranks of the node on the leader
+    *--------------------------------------------------------------------*/
+
+   my_info[0] = my_id;
+   my_info[1] = num_send_info;
+   my_info[2] = num_recv_info;
+   if (node_id == 0)
+   {
+      all_info         = hypre_TAlloc(HYPRE_Int, 3 * node_nprocs, HYPRE_MEMORY_HOST);
+      counts           = hypre_TAlloc(HYPRE_Int, node_nprocs, HYPRE_MEMORY_HOST);
+      send_info_starts = hypre_TAlloc(HYPRE_Int, node_nprocs + 1, HYPRE_MEMORY_HOST);
+      recv_info_starts = hypre_TAlloc(HYPRE_Int, node_nprocs + 1, HYPRE_MEMORY_HOST);
+   }
+   hypre_MPI_Gather(my_info, 3, HYPRE_MPI_INT, all_info, 3, HYPRE_MPI_INT, 0, node_comm);
+
+   if (node_id == 0)
+   {
+      send_info_starts[0] = 0;
+      recv_info_starts[0] = 0;
+      for (r = 0; r < node_nprocs; r++)
+      {
+         send_info_starts[r + 1] = send_info_starts[r] + all_info[3 * r + 1];
+         recv_info_starts[r + 1] = recv_info_starts[r] + all_info[3 * r + 2];
+         counts[r] = all_info[3 * r + 1];
+      }
+      all_send_info = hypre_TAlloc(HYPRE_Int, send_info_starts[node_nprocs], HYPRE_MEMORY_HOST);
+      all_recv_info = hypre_TAlloc(HYPRE_Int, recv_info_starts[node_nprocs], HYPRE_MEMORY_HOST);
+   }
+   hypre_MPI_Gatherv(send_info, num_send_info, HYPRE_MPI_INT, all_send_info, counts,
+                     send_info_starts, HYPRE_MPI_INT, 0, node_comm);
+   if (node_id == 0)
+   {
+      for (r = 0; r < node_nprocs; r++)
+      {
+         counts[r] = all_info[3 * r + 2];
+      }
+   }
+   hypre_MPI_Gatherv(recv_info, num_recv_info, HYPRE_MPI_INT, all_recv_info, counts,
+                     recv_info_starts, HYPRE_MPI_INT, 0, node_comm);
+
+   hypre_TFree(send_info, HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_info, HYPRE_MEMORY_HOST);
+
+   /*--------------------------------------------------------------------
+    * Leader: gather, node and scatter schedules
+    *--------------------------------------------------------------------*/
+
+   if (node_id == 0)
+   {
+      HYPRE_Int   num_gathers, num_node_sends, num_node_recvs, num_scatters;
+      HYPRE_Int  *gather_procs, *gather_starts;
+      HYPRE_Int  *node_send_procs, *node_send_starts, *node_send_elmts;
+      HYPRE_Int  *node_recv_procs, *node_recv_starts;
+      HYPRE_Int  *scatter_procs, *scatter_starts, *scatter_elmts;
+      HYPRE_Int   num_sources;
+      HYPRE_Int  *sources, *source_leaders, *source_offsets;
+      HYPRE_Int  *source_maps = NULL, *source_map_starts = NULL;
+
+      /* Ranks with off-node data, in ascending order; counts[r] is the
+         offset of the data of rank r in the gather buffer */
+      gather_procs     = hypre_TAlloc(HYPRE_Int, node_nprocs, HYPRE_MEMORY_HOST);
+      gather_starts    = hypre_TAlloc(HYPRE_Int, node_nprocs + 1, HYPRE_MEMORY_HOST);
+      num_gathers      = 0;
+      gather_starts[0] = 0;
+      for (r = 0; r < node_nprocs; r++)
+      {
+         cnt = 0;
+         for (k = send_info_starts[r]; k < send_info_starts[r + 1]; k += 2)
+         {
+            cnt += all_send_info[k + 1];
+         }
+         counts[r] = gather_starts[num_gathers];
+         if (cnt > 0)
+         {
+            gather_procs[num_gathers]      = all_info[3 * r];
+            gather_starts[num_gathers + 1] = gather_starts[num_gathers] + cnt;
+            num_gathers++;
+         }
+      }
+
+      /* Destination nodes in ascending order; the message to a node holds
+         the data of the ranks of this node in ascending order */
+      n = send_info_starts[node_nprocs] / 2;
+      node_send_procs = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+      for (k = 0; k < n; k++)
+      {
+         node_send_procs[k] = all_send_info[2 * k];
+      }
+      hypre_qsort0(node_send_procs, 0, n - 1);
+      num_node_sends = 0;
+      for (k = 0; k < n; k++)
+      {
+         if (num_node_sends == 0 || node_send_procs[k] != node_send_procs[num_node_sends - 1])
+         {
+            node_send_procs[num_node_sends++] = node_send_procs[k];
+         }
+      }
+      node_send_starts = hypre_CTAlloc(HYPRE_Int, num_node_sends + 1, HYPRE_MEMORY_HOST);
+      node_send_elmts  = hypre_TAlloc(HYPRE_Int, gather_starts[num_gathers], HYPRE_MEMORY_HOST);
+      cnt = 0;
+      for (d = 0; d < num_node_sends; d++)
+      {
+         for (r = 0; r < node_nprocs; r++)
+         {
+            j = counts[r];
+            for (k = send_info_starts[r]; k < send_info_starts[r + 1]; k += 2)
+            {
+               if (all_send_info[k] == node_send_procs[d])
+               {
+                  for (i = 0; i < all_send_info[k + 1]; i++)
+                  {
+                     node_send_elmts[cnt++] = j + i;
+                  }
+               }
+               j += all_send_info[k + 1];
+            }
+         }
+         node_send_starts[d + 1] = cnt;
+      }
+
+      /* Off-node ranks sending to this node in ascending order, and the size
+         of their data, which is ordered by receiving rank */
+      n = recv_info_starts[node_nprocs] / 3;
+      sources        = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+      source_leaders = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+      for (k = 0; k < n; k++)
+      {
+         sources[k]        = all_recv_info[3 * k];
+         source_leaders[k] = all_recv_info[3 * k + 1];
+      }
+      hypre_qsort2i(sources, source_leaders, 0, n - 1);
+      num_sources = 0;
+      for (k = 0; k < n; k++)
+      {
+         if (num_sources == 0 || sources[k] != sources[num_sources - 1])
+         {
+            sources[num_sources]        = sources[k];
+            source_leaders[num_sources] = source_leaders[k];
+            num_sources++;
+         }
+      }
+      source_offsets = hypre_CTAlloc(HYPRE_Int, num_sources, HYPRE_MEMORY_HOST);
+      for (k = 0; k < n; k++)
+      {
+         i = hypre_BinarySearch(sources, all_recv_info[3 * k], num_sources);
+         source_offsets[i] += all_recv_info[3 * k + 2];
+      }
+
+      /* Merged schedule: receive the positions of the entries of each source
+         in its merged data, whose size replaces the size of its data */
+      if (merge)
+      {
+         hypre_MPI_Request *requests;
+
+         source_map_starts    = hypre_TAlloc(HYPRE_Int, num_sources + 1, HYPRE_MEMORY_HOST);
+         source_map_starts[0] = 0;
+         for (i = 0; i < num_sources; i++)
+         {
+            source_map_starts[i + 1] = source_map_starts[i] + 1 + source_offsets[i];
+         }
+         source_maps = hypre_TAlloc(HYPRE_Int, source_map_starts[num_sources], HYPRE_MEMORY_HOST);
+         requests    = hypre_CTAlloc(hypre_MPI_Request, num_sources, HYPRE_MEMORY_HOST);
+         for (i = 0; i < num_sources; i++)
+         {
+            hypre_MPI_Irecv(&source_maps[source_map_starts[i]], 1 + source_offsets[i],
+                            HYPRE_MPI_INT, sources[i], HYPRE_NODE_COMM_TAG_MERGE, comm,
+                            &requests[i]);
+         }
+         hypre_MPI_Waitall(num_sources, requests, hypre_MPI_STATUSES_IGNORE);
+         hypre_TFree(requests, HYPRE_MEMORY_HOST);
+
+         for (i = 0; i < num_sources; i++)
+         {
+            source_offsets[i] = source_maps[source_map_starts[i]];
+         }
+      }
+
+      /* Source nodes in ascending order; the message from a node holds the
+         data of its ranks in ascending order */
+      node_recv_procs  = hypre_TAlloc(HYPRE_Int, num_sources, HYPRE_MEMORY_HOST);
+      node_recv_starts = hypre_CTAlloc(HYPRE_Int, num_sources + 1, HYPRE_MEMORY_HOST);
+      for (i = 0; i < num_sources; i++)
+      {
+         node_recv_procs[i] = source_leaders[i];
+      }
+      hypre_qsort0(node_recv_procs, 0, num_sources - 1);
+      num_node_recvs = 0;
+      for (i = 0; i < num_sources; i++)
+      {
+         if (num_node_recvs == 0 || node_recv_procs[i] != node_recv_procs[num_node_recvs - 1])
+         {
+            node_recv_procs[num_node_recvs++] = node_recv_procs[i];
+         }
+      }
+      cnt = 0;
+      for (d = 0; d < num_node_recvs; d++)
+      {
+         for (i = 0; i < num_sources; i++)
+         {
+            if (source_leaders[i] == node_recv_procs[d])
+            {
+               j = source_offsets[i];
+               source_offsets[i] = cnt;
+               cnt += j;
+            }
+         }
+         node_recv_starts[d + 1] = cnt;
+      }
+
+      /* Scatter to the ranks of this node in the order of their receives;
+         the ranks are visited in ascending order, as laid out by the sources */
+      n = recv_info_starts[node_nprocs] / 3;
+      cnt = 0;
+      for (k = 0; k < n; k++)
+      {
+         cnt += all_recv_info[3 * k + 2];
+      }
+      scatter_procs     = hypre_TAlloc(HYPRE_Int, node_nprocs, HYPRE_MEMORY_HOST);
+      scatter_starts    = hypre_TAlloc(HYPRE_Int, node_nprocs + 1, HYPRE_MEMORY_HOST);
+      scatter_elmts     = hypre_TAlloc(HYPRE_Int, cnt, HYPRE_MEMORY_HOST);
+      num_scatters      = 0;
+      scatter_starts[0] = 0;
+      cnt = 0;
+      for (r = 0; r < node_nprocs; r++)
+      {
+         if (recv_info_starts[r + 1] == recv_info_starts[r])
+         {
+            continue;
+         }
+         for (k = recv_info_starts[r]; k < recv_info_starts[r + 1]; k += 3)
+         {
+            i = hypre_BinarySearch(sources, all_recv_info[k], num_sources);
+            for (j = 0; j < all_recv_info[k + 2]; j++)
+            {
+               if (merge)
+               {
+                  scatter_elmts[cnt++] = source_offsets[i] + source_maps[++source_map_starts[i]];
+               }
+               else
+               {
+                  scatter_elmts[cnt++] = source_offsets[i]++;
+               }
+            }
+         }
+         scatter_procs[num_scatters]      = all_info[3 * r];
+         scatter_starts[num_scatters + 1] = cnt;
+         num_scatters++;
+      }
+
+      hypre_TFree(sources, HYPRE_MEMORY_HOST);
+      hypre_TFree(source_leaders, HYPRE_MEMORY_HOST);
+      hypre_TFree(source_offsets, HYPRE_MEMORY_HOST);
+      hypre_TFree(source_maps, HYPRE_MEMORY_HOST);
+      hypre_TFree(source_map_starts, HYPRE_MEMORY_HOST);
+
+      hypre_ParCSRCommNodePkgNumGathers(node_pkg)     = num_gathers;
+      hypre_ParCSRCommNodePkgGatherProcs(node_pkg)    = gather_procs;
+      hypre_ParCSRCommNodePkgGatherStarts(node_pkg)   = gather_starts;
+      hypre_ParCSRCommNodePkgNumNodeSends(node_pkg)   = num_node_sends;
+      hypre_ParCSRCommNodePkgNodeSendProcs(node_pkg)  = node_send_procs;
+      hypre_ParCSRCommNodePkgNodeSendStarts(node_pkg) = node_send_starts;
+      hypre_ParCSRCommNodePkgNodeSendElmts(node_pkg)  = node_send_elmts;
+      hypre_ParCSRCommNodePkgNumNodeRecvs(node_pkg)   = num_node_recvs;
+      hypre_ParCSRCommNodePkgNodeRecvProcs(node_pkg)  = node_recv_procs;
+      hypre_ParCSRCommNodePkgNodeRecvStarts(node_pkg) = node_recv_starts;
+      hypre_ParCSRCommNodePkgNumScatters(node_pkg)    = num_scatters;
+      hypre_ParCSRCommNodePkgScatterProcs(node_pkg)   = scatter_procs;
+      hypre_ParCSRCommNodePkgScatterStarts(node_pkg)  = scatter_starts;
+      hypre_ParCSRCommNodePkgScatterElmts(node_pkg)   = scatter_elmts;
+   }
+
+   if (merge)
+   {
+      hypre_MPI_Waitall(num_dests, merge_requests, hypre_MPI_STATUSES_IGNORE);
+      hypre_TFree(merge_requests, HYPRE_MEMORY_HOST);
+      hypre_TFree(merge_buf, HYPRE_MEMORY_HOST);
+   }
+
+   hypre_TFree(all_info, HYPRE_MEMORY_HOST);
+   hypre_TFree(all_send_info, HYPRE_MEMORY_HOST);
+   hypre_TFree(all_recv_info, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_info_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_info_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(counts, HYPRE_MEMORY_HOST);
+
+   return node_pkg;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommPkgCreateNodePkg
+ *
+ * Builds the node-aware schedule of comm_pkg. Must be called by all ranks of
+ * the communicator of comm_pkg while it has a single component. Ranks are
+ * grouped into nodes with MPI_COMM_TYPE_SHARED, or into groups of node_size
+ * consecutive ranks if node_size > 1. If some rank sends an element to
+ * several ranks of one node, the merged schedule is built as well.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRCommPkgCreateNodePkg( hypre_ParCSRCommPkg *comm_pkg,
+                                  HYPRE_Int            node_size )
+{
+   MPI_Comm                  comm            = hypre_ParCSRCommPkgComm(comm_pkg);
+   HYPRE_Int                 num_sends       = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   HYPRE_Int                *send_procs      = hypre_ParCSRCommPkgSendProcs(comm_pkg);
+   HYPRE_Int                 num_recvs       = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+   HYPRE_Int                *recv_procs      = hypre_ParCSRCommPkgRecvProcs(comm_pkg);
+
+   hypre_ParCSRCommNodePkg  *node_pkg;
+   hypre_MPI_Comm            node_comm;
+   hypre_MPI_Request        *requests;
+   HYPRE_Int                 my_id, num_procs, leader;
+   HYPRE_Int                *send_leaders;
+   HYPRE_Int                *recv_leaders;
+   HYPRE_Int                 repeats, any_repeats;
+   HYPRE_Int                 i, j;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   if (num_procs == 1 || hypre_ParCSRCommPkgNumComponents(comm_pkg) != 1)
+   {
+      return hypre_error_flag;
+   }
+
+   /*--------------------------------------------------------------------
+    * Group the ranks into nodes; the leader is the lowest rank of a node
+    *--------------------------------------------------------------------*/
+
+   if (node_size > 1)
+   {
+      hypre_MPI_Comm_split(comm, my_id / node_size, my_id, &node_comm);
+   }
+   else
+   {
+      hypre_MPI_Comm_split_type(comm, hypre_MPI_COMM_TYPE_SHARED, my_id,
+                                hypre_MPI_INFO_NULL, &node_comm);
+   }
+
+   leader = my_id;
+   hypre_MPI_Bcast(&leader, 1, HYPRE_MPI_INT, 0, node_comm);
+
+   /*--------------------------------------------------------------------
+    * Exchange the leaders with the neighbors
+    *--------------------------------------------------------------------*/
+
+   send_leaders = hypre_CTAlloc(HYPRE_Int, num_sends, HYPRE_MEMORY_HOST);
+   recv_leaders = hypre_CTAlloc(HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST);
+   requests     = hypre_CTAlloc(hypre_MPI_Request, 2 * (num_sends + num_recvs),
+                                HYPRE_MEMORY_HOST);
+   j = 0;
+   for (i = 0; i < num_recvs; i++)
+   {
+      hypre_MPI_Irecv(&recv_leaders[i], 1, HYPRE_MPI_INT, recv_procs[i],
+                      HYPRE_NODE_COMM_TAG_LEADER, comm, &requests[j++]);
+   }
+   for (i = 0; i < num_sends; i++)
+   {
+      hypre_MPI_Irecv(&send_leaders[i], 1, HYPRE_MPI_INT, send_procs[i],
+                      HYPRE_NODE_COMM_TAG_LEADER_T, comm, &requests[j++]);
+   }
+   for (i = 0; i < num_sends; i++)
+   {
+      hypre_MPI_Isend(&leader, 1, HYPRE_MPI_INT, send_procs[i],
+                      HYPRE_NODE_COMM_TAG_LEADER, comm, &requests[j++]);
+   }
+   for (i = 0; i < num_recvs; i++)
+   {
+      hypre_MPI_Isend(&leader, 1, HYPRE_MPI_INT, recv_procs[i],
+                      HYPRE_NODE_COMM_TAG_LEADER_T, comm, &requests[j++]);
+   }
+   hypre_MPI_Waitall(j, requests, hypre_MPI_STATUSES_IGNORE);
+   hypre_TFree(requests, HYPRE_MEMORY_HOST);
+
+   /*--------------------------------------------------------------------
+    * Build the schedules
+    *--------------------------------------------------------------------*/
+
+   node_pkg = hypre_ParCSRCommNodePkgBuild(comm_pkg, node_comm, leader,
+                                           send_leaders, recv_leaders, 0);
+
+   repeats = hypre_ParCSRCommNodeHasRepeats(comm_pkg, leader, send_leaders);
+   hypre_MPI_Allreduce(&repeats, &any_repeats, 1, HYPRE_MPI_INT, hypre_MPI_MAX, comm);
+   if (any_repeats)
+   {
+      hypre_ParCSRCommNodePkgMerged(node_pkg) =
+         hypre_ParCSRCommNodePkgBuild(comm_pkg, node_comm, leader,
+                                      send_leaders, recv_leaders, 1);
+   }
+
+   hypre_TFree(send_leaders, HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_leaders, HYPRE_MEMORY_HOST);
+   hypre_MPI_Comm_free(&node_comm);
+
+   hypre_ParCSRCommPkgNodePkg(comm_pkg) = node_pkg;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommNodePkgDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRCommNodePkgDestroy( hypre_ParCSRCommNodePkg *node_pkg )
+{
+   if (node_pkg)
+   {
+      hypre_TFree(hypre_ParCSRCommNodePkgLocalSends(node_pkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRCommNodePkgLocalRecvs(node_pkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRCommNodePkgSendElmts(node_pkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRCommNodePkgRecvElmts(node_pkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRCommNodePkgGatherProcs(node_pkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRCommNodePkgGatherStarts(node_pkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRCommNodePkgNodeSendProcs(node_pkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRCommNodePkgNodeSendStarts(node_pkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRCommNodePkgNodeSendElmts(node_pkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRCommNodePkgNodeRecvProcs(node_pkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRCommNodePkgNodeRecvStarts(node_pkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRCommNodePkgScatterProcs(node_pkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRCommNodePkgScatterStarts(node_pkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRCommNodePkgScatterElmts(node_pkg), HYPRE_MEMORY_HOST);
+      hypre_ParCSRCommNodePkgDestroy(hypre_ParCSRCommNodePkgMerged(node_pkg));
+      hypre_TFree(node_pkg, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommNodePkgMemorySize
+ *--------------------------------------------------------------------------*/
+
+size_t
+hypre_ParCSRCommNodePkgMemorySize( hypre_ParCSRCommNodePkg *node_pkg )
+{
+   size_t num_ints;
+
+   if (!node_pkg)
+   {
+      return 0;
+   }
+
+   num_ints  = (size_t) hypre_ParCSRCommNodePkgNumLocalSends(node_pkg);
+   num_ints += (size_t) hypre_ParCSRCommNodePkgNumLocalRecvs(node_pkg);
+   num_ints += (size_t) hypre_ParCSRCommNodePkgNumSendElmts(node_pkg);
+   num_ints += (size_t) hypre_ParCSRCommNodePkgNumRecvElmts(node_pkg);
+   if (hypre_ParCSRCommNodePkgGatherStarts(node_pkg))
+   {
+      /* node_send_elmts holds one entry per gathered element */
+      num_ints += (size_t) 2 * hypre_ParCSRCommNodePkgNumGathers(node_pkg) + 1;
+      num_ints += (size_t) hypre_ParCSRCommNodePkgGatherStarts(node_pkg)
+                  [hypre_ParCSRCommNodePkgNumGathers(node_pkg)];
+   }
+   if (hypre_ParCSRCommNodePkgNodeSendStarts(node_pkg))
+   {
+      num_ints += (size_t) 2 * hypre_ParCSRCommNodePkgNumNodeSends(node_pkg) + 1;
+   }
+   if (hypre_ParCSRCommNodePkgNodeRecvStarts(node_pkg))
+   {
+      num_ints += (size_t) 2 * hypre_ParCSRCommNodePkgNumNodeRecvs(node_pkg) + 1;
+   }
+   if (hypre_ParCSRCommNodePkgScatterStarts(node_pkg))
+   {
+      num_ints += (size_t) 2 * hypre_ParCSRCommNodePkgNumScatters(node_pkg) + 1;
+      num_ints += (size_t) hypre_ParCSRCommNodePkgScatterStarts(node_pkg)
+                  [hypre_ParCSRCommNodePkgNumScatters(node_pkg)];
+   }
+
+   return sizeof(hypre_ParCSRCommNodePkg) + num_ints * sizeof(HYPRE_Int) +
+          hypre_ParCSRCommNodePkgMemorySize(hypre_ParCSRCommNodePkgMerged(node_pkg));
+}
+
+/*--------------------------------------------------------------------------
+ * Copy blocks of block_bytes bytes: dst[i] = src[elmts[i]] (pack) or
+ * dst[elmts[i]] = src[i] (unpack)
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ParCSRCommNodePack( char      *dst,
+                          char      *src,
+                          HYPRE_Int *elmts,
+                          HYPRE_Int  n,
+                          HYPRE_Int  block_bytes )
+{
+   HYPRE_Int i;
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < n; i++)
+   {
+      memcpy(dst + (size_t) i * block_bytes, src + (size_t) elmts[i] * block_bytes,
+             (size_t) block_bytes);
+   }
+}
+
+static void
+hypre_ParCSRCommNodeUnpack( char      *dst,
+                            char      *src,
+                            HYPRE_Int *elmts,
+                            HYPRE_Int  n,
+                            HYPRE_Int  block_bytes )
+{
+   HYPRE_Int i;
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < n; i++)
+   {
+      memcpy(dst + (size_t) elmts[i] * block_bytes, src + (size_t) i * block_bytes,
+             (size_t) block_bytes);
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * Staging areas of a node-aware exchange, in blocks:
+ * [send to leader | recv from leader | gather | node send | node recv | scatter]
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRCommNodeBufferOffsets( hypre_ParCSRCommNodePkg *node_pkg,
+                                   HYPRE_Int               *offsets )
+{
+   offsets[0] = 0;
+   offsets[1] = offsets[0] + hypre_ParCSRCommNodePkgNumSendElmts(node_pkg);
+   offsets[2] = offsets[1] + hypre_ParCSRCommNodePkgNumRecvElmts(node_pkg);
+   offsets[3] = offsets[2];
+   offsets[4] = offsets[3];
+   offsets[5] = offsets[4];
+   offsets[6] = offsets[5];
+   if (hypre_ParCSRCommNodePkgGatherStarts(node_pkg))
+   {
+      offsets[3] += hypre_ParCSRCommNodePkgGatherStarts(node_pkg)
+                    [hypre_ParCSRCommNodePkgNumGathers(node_pkg)];
+      offsets[4]  = offsets[3] + hypre_ParCSRCommNodePkgNodeSendStarts(node_pkg)
+                    [hypre_ParCSRCommNodePkgNumNodeSends(node_pkg)];
+      offsets[5]  = offsets[4] + hypre_ParCSRCommNodePkgNodeRecvStarts(node_pkg)
+                    [hypre_ParCSRCommNodePkgNumNodeRecvs(node_pkg)];
+      offsets[6]  = offsets[5] + hypre_ParCSRCommNodePkgScatterStarts(node_pkg)
+                    [hypre_ParCSRCommNodePkgNumScatters(node_pkg)];
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommHandleNodeForward
+ *
+ * Leader: packs the gathered data and sends it to the other leaders. The
+ * gathers must be complete.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRCommHandleNodeForward( hypre_ParCSRCommHandle *comm_handle )
+{
+   hypre_ParCSRCommPkg      *comm_pkg     = hypre_ParCSRCommHandleCommPkg(comm_handle);
+   hypre_ParCSRCommNodePkg  *node_pkg     = hypre_ParCSRCommHandleNodePkg(comm_handle);
+   MPI_Comm                  comm         = hypre_ParCSRCommPkgComm(comm_pkg);
+   char                     *buffer       = (char *) hypre_ParCSRCommHandleNodeBuffer(comm_handle);
+   HYPRE_Int                 block_bytes  = hypre_ParCSRCommHandleNodeBlockBytes(comm_handle);
+   HYPRE_Int                 num_requests = hypre_ParCSRCommHandleNumRequests(comm_handle);
+   hypre_MPI_Request        *requests     = hypre_ParCSRCommHandleRequests(comm_handle);
+
+   HYPRE_Int                 num_node_sends = hypre_ParCSRCommNodePkgNumNodeSends(node_pkg);
+   HYPRE_Int                 num_scatters   = hypre_ParCSRCommNodePkgNumScatters(node_pkg);
+
+   HYPRE_Int                 offsets[7];
+   HYPRE_Int                 i, j, start, len;
+
+   hypre_ParCSRCommNodeBufferOffsets(node_pkg, offsets);
+
+   hypre_ParCSRCommNodePack(buffer + (size_t) offsets[3] * block_bytes,
+                            buffer + (size_t) offsets[2] * block_bytes,
+                            hypre_ParCSRCommNodePkgNodeSendElmts(node_pkg),
+                            hypre_ParCSRCommNodePkgNodeSendStarts(node_pkg)[num_node_sends],
+                            block_bytes);
+
+   j = num_requests - num_scatters - num_node_sends;
+   for (i = 0; i < num_node_sends; i++)
+   {
+      start = hypre_ParCSRCommNodePkgNodeSendStarts(node_pkg)[i];
+      len   = hypre_ParCSRCommNodePkgNodeSendStarts(node_pkg)[i + 1] - start;
+      hypre_MPI_Isend(buffer + (size_t) (offsets[3] + start) * block_bytes, len * block_bytes,
+                      hypre_MPI_BYTE, hypre_ParCSRCommNodePkgNodeSendProcs(node_pkg)[i],
+                      HYPRE_NODE_COMM_TAG_NODE, comm, &requests[j++]);
+   }
+
+   hypre_ParCSRCommHandleNodeForwarded(comm_handle) = 1;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommHandleNodeProgress
+ *
+ * Leader: forwards the gathered data to the other leaders if the gathers
+ * have already arrived. Does not block.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRCommHandleNodeProgress( hypre_ParCSRCommHandle *comm_handle )
+{
+   hypre_ParCSRCommNodePkg  *node_pkg = hypre_ParCSRCommHandleNodePkg(comm_handle);
+   hypre_MPI_Request        *requests = hypre_ParCSRCommHandleRequests(comm_handle);
+   HYPRE_Int                 flag, j;
+
+   if (hypre_ParCSRCommNodePkgNumNodeSends(node_pkg) > 0 &&
+       !hypre_ParCSRCommHandleNodeForwarded(comm_handle))
+   {
+      j = hypre_ParCSRCommNodePkgNumLocalRecvs(node_pkg) +
+          (hypre_ParCSRCommNodePkgNumRecvElmts(node_pkg) > 0);
+      hypre_MPI_Testall(hypre_ParCSRCommNodePkgNumGathers(node_pkg), &requests[j], &flag,
+                        hypre_MPI_STATUSES_IGNORE);
+      if (flag)
+      {
+         hypre_ParCSRCommHandleNodeForward(comm_handle);
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommHandleNodeStart
+ *
+ * Starts a node-aware forward exchange of blocks of block_bytes bytes with
+ * the schedule node_pkg. Only posts messages. A leader whose gathers have
+ * already arrived forwards their data to the other leaders right away;
+ * otherwise this happens in hypre_ParCSRCommHandleNodeFinish, so that
+ * callers can overlap computation with the gathers.
+ *
+ * Request layout:
+ * [local recvs | recv from leader | gathers | node recvs |
+ *  local sends | send to leader | node sends | scatters]
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRCommHandleNodeStart( hypre_ParCSRCommHandle  *comm_handle,
+                                 hypre_ParCSRCommNodePkg *node_pkg,
+                                 HYPRE_Int                block_bytes )
+{
+   hypre_ParCSRCommPkg      *comm_pkg  = hypre_ParCSRCommHandleCommPkg(comm_handle);
+   MPI_Comm                  comm      = hypre_ParCSRCommPkgComm(comm_pkg);
+   HYPRE_Int                 nc        = hypre_ParCSRCommPkgNumComponents(comm_pkg);
+   char                     *send_data = (char *) hypre_ParCSRCommHandleSendDataBuffer(comm_handle);
+   char                     *recv_data = (char *) hypre_ParCSRCommHandleRecvDataBuffer(comm_handle);
+
+   HYPRE_Int                 num_local_sends = hypre_ParCSRCommNodePkgNumLocalSends(node_pkg);
+   HYPRE_Int                 num_local_recvs = hypre_ParCSRCommNodePkgNumLocalRecvs(node_pkg);
+   HYPRE_Int                 num_send_elmts  = hypre_ParCSRCommNodePkgNumSendElmts(node_pkg);
+   HYPRE_Int                 num_recv_elmts  = hypre_ParCSRCommNodePkgNumRecvElmts(node_pkg);
+   HYPRE_Int                 num_gathers     = hypre_ParCSRCommNodePkgNumGathers(node_pkg);
+   HYPRE_Int                 num_node_sends  = hypre_ParCSRCommNodePkgNumNodeSends(node_pkg);
+   HYPRE_Int                 num_node_recvs  = hypre_ParCSRCommNodePkgNumNodeRecvs(node_pkg);
+   HYPRE_Int                 num_scatters    = hypre_ParCSRCommNodePkgNumScatters(node_pkg);
+   HYPRE_Int                 leader          = hypre_ParCSRCommNodePkgLeader(node_pkg);
+
+   HYPRE_Int                 num_requests;
+   hypre_MPI_Request        *requests;
+   HYPRE_Int                 offsets[7];
+   char                     *buffer;
+   HYPRE_Int                 i, ip, j, start, len;
+
+   num_requests = num_local_recvs + num_local_sends + num_gathers + num_node_recvs +
+                  num_node_sends + num_scatters + (num_send_elmts > 0) + (num_recv_elmts > 0);
+   requests     = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
+
+   hypre_ParCSRCommNodeBufferOffsets(node_pkg, offsets);
+   buffer = hypre_TAlloc(char, (size_t) offsets[6] * block_bytes, HYPRE_MEMORY_HOST);
+
+   /* Receives */
+   j = 0;
+   for (i = 0; i < num_local_recvs; i++)
+   {
+      ip    = hypre_ParCSRCommNodePkgLocalRecvs(node_pkg)[i];
+      start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, ip);
+      len   = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, ip + 1) - start;
+      hypre_MPI_Irecv(recv_data + (size_t) start * (block_bytes / nc), len * (block_bytes / nc),
+                      hypre_MPI_BYTE, hypre_ParCSRCommPkgRecvProc(comm_pkg, ip), 0, comm,
+                      &requests[j++]);
+   }
+   if (num_recv_elmts > 0)
+   {
+      hypre_MPI_Irecv(buffer + (size_t) offsets[1] * block_bytes, num_recv_elmts * block_bytes,
+                      hypre_MPI_BYTE, leader, HYPRE_NODE_COMM_TAG_SCATTER, comm, &requests[j++]);
+   }
+   for (i = 0; i < num_gathers; i++)
+   {
+      start = hypre_ParCSRCommNodePkgGatherStarts(node_pkg)[i];
+      len   = hypre_ParCSRCommNodePkgGatherStarts(node_pkg)[i + 1] - start;
+      hypre_MPI_Irecv(buffer + (size_t) (offsets[2] + start) * block_bytes, len * block_bytes,
+                      hypre_MPI_BYTE, hypre_ParCSRCommNodePkgGatherProcs(node_pkg)[i],
+                      HYPRE_NODE_COMM_TAG_GATHER, comm, &requests[j++]);
+   }
+   for (i = 0; i < num_node_recvs; i++)
+   {
+      start = hypre_ParCSRCommNodePkgNodeRecvStarts(node_pkg)[i];
+      len   = hypre_ParCSRCommNodePkgNodeRecvStarts(node_pkg)[i + 1] - start;
+      hypre_MPI_Irecv(buffer + (size_t) (offsets[4] + start) * block_bytes, len * block_bytes,
+                      hypre_MPI_BYTE, hypre_ParCSRCommNodePkgNodeRecvProcs(node_pkg)[i],
+                      HYPRE_NODE_COMM_TAG_NODE, comm, &requests[j++]);
+   }
+
+   /* Sends to on-node neighbors and to the leader */
+   for (i = 0; i < num_local_sends; i++)
+   {
+      ip    = hypre_ParCSRCommNodePkgLocalSends(node_pkg)[i];
+      start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, ip);
+      len   = hypre_ParCSRCommPkgSendMapStart(comm_pkg, ip + 1) - start;
+      hypre_MPI_Isend(send_data + (size_t) start * (block_bytes / nc), len * (block_bytes / nc),
+                      hypre_MPI_BYTE, hypre_ParCSRCommPkgSendProc(comm_pkg, ip), 0, comm,
+                      &requests[j++]);
+   }
+   if (num_send_elmts > 0)
+   {
+      hypre_ParCSRCommNodePack(buffer, send_data, hypre_ParCSRCommNodePkgSendElmts(node_pkg),
+                               num_send_elmts, block_bytes);
+      hypre_MPI_Isend(buffer, num_send_elmts * block_bytes, hypre_MPI_BYTE, leader,
+                      HYPRE_NODE_COMM_TAG_GATHER, comm, &requests[j++]);
+   }
+
+   hypre_ParCSRCommHandleNumRequests(comm_handle)    = num_requests;
+   hypre_ParCSRCommHandleRequests(comm_handle)       = requests;
+   hypre_ParCSRCommHandleNodeBlockBytes(comm_handle) = block_bytes;
+   hypre_ParCSRCommHandleNodeBuffer(comm_handle)     = buffer;
+   hypre_ParCSRCommHandleNodePkg(comm_handle)        = node_pkg;
+   hypre_ParCSRCommHandleNodeForwarded(comm_handle)  = 0;
+
+   /* Leader: forward now if the data of the node is already there */
+   hypre_ParCSRCommHandleNodeProgress(comm_handle);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommHandleNodeFinish
+ *
+ * Completes a node-aware exchange started by hypre_ParCSRCommHandleNodeStart.
+ * The leader waits for the gathers and forwards their data to the other
+ * leaders (unless this was done at start), and scatters what it receives
+ * from them.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRCommHandleNodeFinish( hypre_ParCSRCommHandle *comm_handle )
+{
+   hypre_ParCSRCommPkg      *comm_pkg    = hypre_ParCSRCommHandleCommPkg(comm_handle);
+   hypre_ParCSRCommNodePkg  *node_pkg    = hypre_ParCSRCommHandleNodePkg(comm_handle);
+   MPI_Comm                  comm        = hypre_ParCSRCommPkgComm(comm_pkg);
+   char                     *recv_data   = (char *) hypre_ParCSRCommHandleRecvDataBuffer(comm_handle);
+   char                     *buffer      = (char *) hypre_ParCSRCommHandleNodeBuffer(comm_handle);
+   HYPRE_Int                 block_bytes = hypre_ParCSRCommHandleNodeBlockBytes(comm_handle);
+   HYPRE_Int                 num_requests = hypre_ParCSRCommHandleNumRequests(comm_handle);
+   hypre_MPI_Request        *requests    = hypre_ParCSRCommHandleRequests(comm_handle);
+
+   HYPRE_Int                 num_recv_elmts = hypre_ParCSRCommNodePkgNumRecvElmts(node_pkg);
+   HYPRE_Int                 num_gathers    = hypre_ParCSRCommNodePkgNumGathers(node_pkg);
+   HYPRE_Int                 num_node_sends = hypre_ParCSRCommNodePkgNumNodeSends(node_pkg);
+   HYPRE_Int                 num_node_recvs = hypre_ParCSRCommNodePkgNumNodeRecvs(node_pkg);
+   HYPRE_Int                 num_scatters   = hypre_ParCSRCommNodePkgNumScatters(node_pkg);
+
+   HYPRE_Int                 offsets[7];
+   HYPRE_Int                 i, j, start, len;
+
+   hypre_ParCSRCommNodeBufferOffsets(node_pkg, offsets);
+
+   /* Leader: forward the gathered data to the other leaders */
+   if (num_node_sends > 0 && !hypre_ParCSRCommHandleNodeForwarded(comm_handle))
+   {
+      j = hypre_ParCSRCommNodePkgNumLocalRecvs(node_pkg) + (num_recv_elmts > 0);
+      hypre_MPI_Waitall(num_gathers, &requests[j], hypre_MPI_STATUSES_IGNORE);
+
+      hypre_ParCSRCommHandleNodeForward(comm_handle);
+   }
+
+   /* Leader: scatter the data received from the other leaders */
+   if (num_scatters > 0)
+   {
+      j = hypre_ParCSRCommNodePkgNumLocalRecvs(node_pkg) + (num_recv_elmts > 0) + num_gathers;
+      hypre_MPI_Waitall(num_node_recvs, &requests[j], hypre_MPI_STATUSES_IGNORE);
+
+      hypre_ParCSRCommNodePack(buffer + (size_t) offsets[5] * block_bytes,
+                               buffer + (size_t) offsets[4] * block_bytes,
+                               hypre_ParCSRCommNodePkgScatterElmts(node_pkg),
+                               hypre_ParCSRCommNodePkgScatterStarts(node_pkg)[num_scatters],
+                               block_bytes);
+
+      j = num_requests - num_scatters;
+      for (i = 0; i < num_scatters; i++)
+      {
+         start = hypre_ParCSRCommNodePkgScatterStarts(node_pkg)[i];
+         len   = hypre_ParCSRCommNodePkgScatterStarts(node_pkg)[i + 1] - start;
+         hypre_MPI_Isend(buffer + (size_t) (offsets[5] + start) * block_bytes, len * block_bytes,
+                         hypre_MPI_BYTE, hypre_ParCSRCommNodePkgScatterProcs(node_pkg)[i],
+                         HYPRE_NODE_COMM_TAG_SCATTER, comm, &requests[j++]);
+      }
+   }
+
+   hypre_MPI_Waitall(num_requests, requests, hypre_MPI_STATUSES_IGNORE);
+
+   if (num_recv_elmts > 0)
+   {
+      hypre_ParCSRCommNodeUnpack(recv_data, buffer + (size_t) offsets[1] * block_bytes,
+                                 hypre_ParCSRCommNodePkgRecvElmts(node_pkg),
+                                 num_recv_elmts, block_bytes);
+   }
+
+   hypre_TFree(buffer, HYPRE_MEMORY_HOST);
+   hypre_ParCSRCommHandleNodeBuffer(comm_handle)     = NULL;
+   hypre_ParCSRCommHandleNodeBlockBytes(comm_handle) = 0;
+
+   return hypre_error_flag;
+}
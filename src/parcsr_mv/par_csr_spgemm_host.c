@@ -0,0 +1,736 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Host ParCSR matrix-matrix product C = A * B with separate symbolic and
+ * numeric phases.
+ *
+ * The symbolic phase fetches the structure of the external rows of B, builds
+ * a communication package that moves only their values, and computes the
+ * pattern of C. The numeric phase exchanges values and runs the numeric
+ * local products, so products repeated with unchanged patterns (e.g. the
+ * Galerkin product of an AMG re-setup) skip all index work.
+ *
+ * Only hypre_BoomerAMGBuildCoarseOperatorReuse uses these phases. One-shot
+ * products (hypre_ParMatmul, and the MGR products, which rebuild P and R on
+ * every setup) stay on the fused product: a plan that is never reused only
+ * costs an extra pass and memory, and the column order within rows of C
+ * differs from that of hypre_ParMatmul, which would change their results.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_mv.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixPatternKey
+ *
+ * Hash of the local sparsity pattern of A, used to detect pattern changes
+ * between the symbolic and numeric phases. Host memory only.
+ *--------------------------------------------------------------------------*/
+
+hypre_ulonglongint
+hypre_ParCSRMatrixPatternKey( hypre_ParCSRMatrix *A )
+{
+   hypre_CSRMatrix     *A_diag        = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix     *A_offd        = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int           *A_diag_i      = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int           *A_diag_j      = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Int           *A_offd_i      = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int           *A_offd_j      = hypre_CSRMatrixJ(A_offd);
+   HYPRE_BigInt        *col_map_offd  = hypre_ParCSRMatrixColMapOffd(A);
+   HYPRE_Int            num_rows      = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int            num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
+
+   /* FNV-1a style mixing */
+   hypre_ulonglongint   key   = 14695981039346656037ULL;
+   hypre_ulonglongint   prime = 1099511628211ULL;
+   HYPRE_Int            i, k;
+
+   key = (key ^ (hypre_ulonglongint) num_rows) * prime;
+   key = (key ^ (hypre_ulonglongint) hypre_CSRMatrixNumCols(A_diag)) * prime;
+   key = (key ^ (hypre_ulonglongint) num_cols_offd) * prime;
+
+   for (i = 0; i < num_rows; i++)
+   {
+      key = (key ^ (hypre_ulonglongint) A_diag_i[i + 1]) * prime;
+      for (k = A_diag_i[i]; k < A_diag_i[i + 1]; k++)
+      {
+         key = (key ^ (hypre_ulonglongint) A_diag_j[k]) * prime;
+      }
+   }
+
+   if (num_cols_offd)
+   {
+      for (i = 0; i < num_rows; i++)
+      {
+         key = (key ^ (hypre_ulonglongint) A_offd_i[i + 1]) * prime;
+         for (k = A_offd_i[i]; k < A_offd_i[i + 1]; k++)
+         {
+            key = (key ^ (hypre_ulonglongint) A_offd_j[k]) * prime;
+         }
+      }
+
+      for (i = 0; i < num_cols_offd; i++)
+      {
+         key = (key ^ (hypre_ulonglongint) col_map_offd[i]) * prime;
+      }
+   }
+
+   return key;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatDataDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatMatDataDestroy( hypre_ParCSRMatMatData *data )
+{
+   if (data)
+   {
+      hypre_CSRMatrixDestroy(hypre_ParCSRMatMatDataACat(data));
+      hypre_CSRMatrixDestroy(hypre_ParCSRMatMatDataBCatDiag(data));
+      hypre_CSRMatrixDestroy(hypre_ParCSRMatMatDataBCatOffd(data));
+      hypre_CSRMatrixDestroy(hypre_ParCSRMatMatDataCDiag(data));
+      hypre_CSRMatrixDestroy(hypre_ParCSRMatMatDataCOffd(data));
+      hypre_TFree(hypre_ParCSRMatMatDataColMapOffdC(data), HYPRE_MEMORY_HOST);
+      if (hypre_ParCSRMatMatDataExtCommPkg(data))
+      {
+         hypre_MatvecCommPkgDestroy(hypre_ParCSRMatMatDataExtCommPkg(data));
+      }
+      hypre_TFree(hypre_ParCSRMatMatDataExtSendOffsets(data), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRMatMatDataExtMap(data), HYPRE_MEMORY_HOST);
+      hypre_TFree(data, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatDataMemorySize
+ *
+ * Returns the number of bytes held by the data object. The send offsets of
+ * the external rows are not included since their length is not stored.
+ *--------------------------------------------------------------------------*/
+
+size_t
+hypre_ParCSRMatMatDataMemorySize( hypre_ParCSRMatMatData *data )
+{
+   size_t bytes;
+
+   if (!data)
+   {
+      return 0;
+   }
+
+   bytes  = sizeof(hypre_ParCSRMatMatData);
+   bytes += hypre_CSRMatrixMemorySize(hypre_ParCSRMatMatDataACat(data));
+   bytes += hypre_CSRMatrixMemorySize(hypre_ParCSRMatMatDataBCatDiag(data));
+   bytes += hypre_CSRMatrixMemorySize(hypre_ParCSRMatMatDataBCatOffd(data));
+   bytes += hypre_CSRMatrixMemorySize(hypre_ParCSRMatMatDataCDiag(data));
+   bytes += hypre_CSRMatrixMemorySize(hypre_ParCSRMatMatDataCOffd(data));
+   bytes += (size_t) hypre_ParCSRMatMatDataNumColsOffdC(data) * sizeof(HYPRE_BigInt);
+   bytes += hypre_ParCSRCommPkgMemorySize(hypre_ParCSRMatMatDataExtCommPkg(data));
+   if (hypre_ParCSRMatMatDataExtMap(data))
+   {
+      bytes += (size_t) hypre_ParCSRMatMatDataNumExtNonzeros(data) * sizeof(HYPRE_Int);
+   }
+
+   return bytes;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatSymbolicHost
+ *
+ * Symbolic phase of C = A * B. Creates the data object used by
+ * hypre_ParCSRMatMatNumericHost. Collective over the communicator of A.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatMatSymbolicHost( hypre_ParCSRMatrix      *A,
+                                hypre_ParCSRMatrix      *B,
+                                hypre_ParCSRMatMatData **data_ptr )
+{
+   MPI_Comm                 comm              = hypre_ParCSRMatrixComm(A);
+
+   /* A */
+   hypre_CSRMatrix         *A_diag            = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int               *A_diag_i          = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int               *A_diag_j          = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Int                num_rows_A        = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int                num_cols_diag_A   = hypre_CSRMatrixNumCols(A_diag);
+   hypre_CSRMatrix         *A_offd            = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int               *A_offd_i          = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int               *A_offd_j          = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Int                num_cols_offd_A   = hypre_CSRMatrixNumCols(A_offd);
+
+   /* B */
+   hypre_CSRMatrix         *B_diag            = hypre_ParCSRMatrixDiag(B);
+   HYPRE_Int               *B_diag_i          = hypre_CSRMatrixI(B_diag);
+   HYPRE_Int               *B_diag_j          = hypre_CSRMatrixJ(B_diag);
+   HYPRE_Int                num_rows_B        = hypre_CSRMatrixNumRows(B_diag);
+   HYPRE_Int                num_cols_diag_B   = hypre_CSRMatrixNumCols(B_diag);
+   hypre_CSRMatrix         *B_offd            = hypre_ParCSRMatrixOffd(B);
+   HYPRE_Int               *B_offd_i          = hypre_CSRMatrixI(B_offd);
+   HYPRE_Int               *B_offd_j          = hypre_CSRMatrixJ(B_offd);
+   HYPRE_Int                num_cols_offd_B   = hypre_CSRMatrixNumCols(B_offd);
+   HYPRE_BigInt            *col_map_offd_B    = hypre_ParCSRMatrixColMapOffd(B);
+   HYPRE_BigInt             first_col_diag_B  = hypre_ParCSRMatrixFirstColDiag(B);
+   HYPRE_BigInt             last_col_diag_B   = first_col_diag_B + (HYPRE_BigInt) num_cols_diag_B - 1;
+
+   /* External rows of B */
+   hypre_CSRMatrix         *Bs_ext            = NULL;
+   HYPRE_Int               *Bs_ext_i          = NULL;
+   HYPRE_BigInt            *Bs_ext_j          = NULL;
+   HYPRE_Int                num_ext_nonzeros  = 0;
+   HYPRE_Int               *ext_map           = NULL;
+   HYPRE_Int               *ext_send_offsets  = NULL;
+   hypre_ParCSRCommPkg     *ext_comm_pkg      = NULL;
+
+   /* Local operands */
+   hypre_CSRMatrix         *A_cat;
+   hypre_CSRMatrix         *B_cat_diag;
+   hypre_CSRMatrix         *B_cat_offd;
+   HYPRE_Int               *A_cat_i, *A_cat_j;
+   HYPRE_Int               *B_cat_diag_i, *B_cat_diag_j;
+   HYPRE_Int               *B_cat_offd_i, *B_cat_offd_j;
+   HYPRE_Int                B_cat_diag_nnz, B_cat_offd_nnz;
+
+   HYPRE_Int                num_cols_offd_C   = 0;
+   HYPRE_BigInt            *col_map_offd_C    = NULL;
+   HYPRE_Int               *map_B_to_C        = NULL;
+   HYPRE_Int                allsquare;
+
+   hypre_ParCSRMatMatData  *data;
+   HYPRE_Int                num_procs;
+   HYPRE_Int                i, k, cnt, cnt_diag, cnt_offd;
+
+   *data_ptr = NULL;
+
+   if (hypre_ParCSRMatrixGlobalNumCols(A) != hypre_ParCSRMatrixGlobalNumRows(B) ||
+       num_cols_diag_A != num_rows_B)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, " Error! Incompatible matrix dimensions!\n");
+      return hypre_error_flag;
+   }
+
+   if (hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(A)) != hypre_MEMORY_HOST ||
+       hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(B)) != hypre_MEMORY_HOST)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Symbolic/numeric matmat only supported on the host!\n");
+      return hypre_error_flag;
+   }
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   /*-----------------------------------------------------------------------
+    * Structure of the external rows of B and the package exchanging their
+    * values: same neighbors as the comm. package of A, with the message
+    * sizes given by the lengths of the rows sent and received
+    *-----------------------------------------------------------------------*/
+
+   if (num_procs > 1)
+   {
+      hypre_ParCSRCommPkg *comm_pkg;
+      HYPRE_Int            num_sends, num_recvs, num_rows_send;
+      HYPRE_Int           *send_procs, *recv_procs;
+      HYPRE_Int           *send_starts, *recv_starts;
+      HYPRE_BigInt        *big_buf;
+
+      if (!hypre_ParCSRMatrixCommPkg(A))
+      {
+         hypre_MatvecCommPkgCreate(A);
+      }
+      comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+
+      Bs_ext           = hypre_ParCSRMatrixExtractBExt(B, A, 0);
+      Bs_ext_i         = hypre_CSRMatrixI(Bs_ext);
+      Bs_ext_j         = hypre_CSRMatrixBigJ(Bs_ext);
+      num_ext_nonzeros = Bs_ext_i[num_cols_offd_A];
+
+      num_sends     = hypre_ParCSRCommPkgNumSends(comm_pkg);
+      num_recvs     = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+      num_rows_send = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+
+      ext_send_offsets = hypre_TAlloc(HYPRE_Int, num_rows_send + 1, HYPRE_MEMORY_HOST);
+      ext_send_offsets[0] = 0;
+      for (i = 0; i < num_rows_send; i++)
+      {
+         k = hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i);
+         ext_send_offsets[i + 1] = ext_send_offsets[i] + B_diag_i[k + 1] - B_diag_i[k];
+         if (num_cols_offd_B)
+         {
+            ext_send_offsets[i + 1] += B_offd_i[k + 1] - B_offd_i[k];
+         }
+      }
+
+      send_procs  = hypre_TAlloc(HYPRE_Int, num_sends, HYPRE_MEMORY_HOST);
+      recv_procs  = hypre_TAlloc(HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST);
+      send_starts = hypre_TAlloc(HYPRE_Int, num_sends + 1, HYPRE_MEMORY_HOST);
+      recv_starts = hypre_TAlloc(HYPRE_Int, num_recvs + 1, HYPRE_MEMORY_HOST);
+      for (i = 0; i < num_sends; i++)
+      {
+         send_procs[i] = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
+      }
+      for (i = 0; i <= num_sends; i++)
+      {
+         send_starts[i] = ext_send_offsets[hypre_ParCSRCommPkgSendMapStart(comm_pkg, i)];
+      }
+      for (i = 0; i < num_recvs; i++)
+      {
+         recv_procs[i] = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
+      }
+      for (i = 0; i <= num_recvs; i++)
+      {
+         recv_starts[i] = Bs_ext_i[hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i)];
+      }
+
+      hypre_ParCSRCommPkgCreateAndFill(comm, num_recvs, recv_procs, recv_starts,
+                                       num_sends, send_procs, send_starts,
+                                       NULL, &ext_comm_pkg);
+
+      /* col_map_offd_C: union of col_map_offd_B and the off-processor
+         columns of the external rows */
+      big_buf = hypre_TAlloc(HYPRE_BigInt, num_ext_nonzeros + num_cols_offd_B, HYPRE_MEMORY_HOST);
+      cnt = 0;
+      for (k = 0; k < num_ext_nonzeros; k++)
+      {
+         if (Bs_ext_j[k] < first_col_diag_B || Bs_ext_j[k] > last_col_diag_B)
+         {
+            big_buf[cnt++] = Bs_ext_j[k];
+         }
+      }
+      for (k = 0; k < num_cols_offd_B; k++)
+      {
+         big_buf[cnt++] = col_map_offd_B[k];
+      }
+
+      if (cnt)
+      {
+         hypre_BigQsort0(big_buf, 0, cnt - 1);
+         num_cols_offd_C = 1;
+         for (k = 1; k < cnt; k++)
+         {
+            if (big_buf[k] > big_buf[num_cols_offd_C - 1])
+            {
+               big_buf[num_cols_offd_C++] = big_buf[k];
+            }
+         }
+         col_map_offd_C = hypre_TAlloc(HYPRE_BigInt, num_cols_offd_C, HYPRE_MEMORY_HOST);
+         hypre_TMemcpy(col_map_offd_C, big_buf, HYPRE_BigInt, num_cols_offd_C,
+                       HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      }
+      hypre_TFree(big_buf, HYPRE_MEMORY_HOST);
+   }
+
+   map_B_to_C = hypre_TAlloc(HYPRE_Int, num_cols_offd_B, HYPRE_MEMORY_HOST);
+   for (k = 0; k < num_cols_offd_B; k++)
+   {
+      map_B_to_C[k] = hypre_BigBinarySearch(col_map_offd_C, col_map_offd_B[k], num_cols_offd_C);
+   }
+
+   /*-----------------------------------------------------------------------
+    * A_cat = [A_diag, A_offd]
+    *-----------------------------------------------------------------------*/
+
+   A_cat = hypre_CSRMatrixCreate(num_rows_A, num_cols_diag_A + num_cols_offd_A,
+                                 hypre_CSRMatrixNumNonzeros(A_diag) +
+                                 (num_cols_offd_A ? hypre_CSRMatrixNumNonzeros(A_offd) : 0));
+   hypre_CSRMatrixInitialize_v2(A_cat, 0, HYPRE_MEMORY_HOST);
+   A_cat_i = hypre_CSRMatrixI(A_cat);
+   A_cat_j = hypre_CSRMatrixJ(A_cat);
+
+   for (i = 0; i < num_rows_A; i++)
+   {
+      A_cat_i[i + 1] = A_diag_i[i + 1];
+      if (num_cols_offd_A)
+      {
+         A_cat_i[i + 1] += A_offd_i[i + 1];
+      }
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i, k, cnt) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows_A; i++)
+   {
+      cnt = A_cat_i[i];
+      for (k = A_diag_i[i]; k < A_diag_i[i + 1]; k++)
+      {
+         A_cat_j[cnt++] = A_diag_j[k];
+      }
+      if (num_cols_offd_A)
+      {
+         for (k = A_offd_i[i]; k < A_offd_i[i + 1]; k++)
+         {
+            A_cat_j[cnt++] = num_cols_diag_A + A_offd_j[k];
+         }
+      }
+   }
+
+   /*-----------------------------------------------------------------------
+    * B_cat_diag = [B_diag; B_ext_diag], B_cat_offd = [B_offd; B_ext_offd]
+    * with the offd columns numbered as in col_map_offd_C
+    *-----------------------------------------------------------------------*/
+
+   B_cat_diag_nnz = hypre_CSRMatrixNumNonzeros(B_diag);
+   B_cat_offd_nnz = num_cols_offd_B ? hypre_CSRMatrixNumNonzeros(B_offd) : 0;
+   for (k = 0; k < num_ext_nonzeros; k++)
+   {
+      if (Bs_ext_j[k] < first_col_diag_B || Bs_ext_j[k] > last_col_diag_B)
+      {
+         B_cat_offd_nnz++;
+      }
+      else
+      {
+         B_cat_diag_nnz++;
+      }
+   }
+
+   B_cat_diag = hypre_CSRMatrixCreate(num_rows_B + num_cols_offd_A, num_cols_diag_B,
+                                      B_cat_diag_nnz);
+   B_cat_offd = hypre_CSRMatrixCreate(num_rows_B + num_cols_offd_A, num_cols_offd_C,
+                                      B_cat_offd_nnz);
+   hypre_CSRMatrixInitialize_v2(B_cat_diag, 0, HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixInitialize_v2(B_cat_offd, 0, HYPRE_MEMORY_HOST);
+   B_cat_diag_i = hypre_CSRMatrixI(B_cat_diag);
+   B_cat_diag_j = hypre_CSRMatrixJ(B_cat_diag);
+   B_cat_offd_i = hypre_CSRMatrixI(B_cat_offd);
+   B_cat_offd_j = hypre_CSRMatrixJ(B_cat_offd);
+
+   /* Local rows: same layout as B_diag and B_offd */
+   hypre_TMemcpy(B_cat_diag_i, B_diag_i, HYPRE_Int, num_rows_B + 1,
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(B_cat_diag_j, B_diag_j, HYPRE_Int, B_diag_i[num_rows_B],
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   if (num_cols_offd_B)
+   {
+      hypre_TMemcpy(B_cat_offd_i, B_offd_i, HYPRE_Int, num_rows_B + 1,
+                    HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      for (k = 0; k < B_offd_i[num_rows_B]; k++)
+      {
+         B_cat_offd_j[k] = map_B_to_C[B_offd_j[k]];
+      }
+   }
+
+   /* External rows: ext_map[k] >= 0 is the position of the k-th received
+      value in B_cat_diag, ext_map[k] < 0 encodes -(position + 1) in B_cat_offd */
+   if (num_ext_nonzeros)
+   {
+      ext_map = hypre_TAlloc(HYPRE_Int, num_ext_nonzeros, HYPRE_MEMORY_HOST);
+   }
+
+   cnt_diag = B_cat_diag_i[num_rows_B];
+   cnt_offd = B_cat_offd_i[num_rows_B];
+   for (i = 0; i < num_cols_offd_A; i++)
+   {
+      for (k = Bs_ext_i[i]; k < Bs_ext_i[i + 1]; k++)
+      {
+         if (Bs_ext_j[k] < first_col_diag_B || Bs_ext_j[k] > last_col_diag_B)
+         {
+            B_cat_offd_j[cnt_offd] = hypre_BigBinarySearch(col_map_offd_C, Bs_ext_j[k],
+                                                           num_cols_offd_C);
+            ext_map[k] = -(cnt_offd + 1);
+            cnt_offd++;
+         }
+         else
+         {
+            B_cat_diag_j[cnt_diag] = (HYPRE_Int) (Bs_ext_j[k] - first_col_diag_B);
+            ext_map[k] = cnt_diag;
+            cnt_diag++;
+         }
+      }
+      B_cat_diag_i[num_rows_B + i + 1] = cnt_diag;
+      B_cat_offd_i[num_rows_B + i + 1] = cnt_offd;
+   }
+
+   hypre_CSRMatrixDestroy(Bs_ext);
+   hypre_TFree(map_B_to_C, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Patterns of C_diag and C_offd
+    *-----------------------------------------------------------------------*/
+
+   allsquare = (num_rows_A == num_cols_diag_B &&
+                hypre_ParCSRMatrixGlobalNumRows(A) == hypre_ParCSRMatrixGlobalNumCols(B));
+
+   data = hypre_CTAlloc(hypre_ParCSRMatMatData, 1, HYPRE_MEMORY_HOST);
+
+   hypre_ParCSRMatMatDataGlobalNumRowsA(data) = hypre_ParCSRMatrixGlobalNumRows(A);
+   hypre_ParCSRMatMatDataGlobalNumColsB(data) = hypre_ParCSRMatrixGlobalNumCols(B);
+   hypre_ParCSRMatMatDataPatternKeyA(data)    = hypre_ParCSRMatrixPatternKey(A);
+   hypre_ParCSRMatMatDataPatternKeyB(data)    = hypre_ParCSRMatrixPatternKey(B);
+   hypre_ParCSRMatMatDataACat(data)           = A_cat;
+   hypre_ParCSRMatMatDataBCatDiag(data)       = B_cat_diag;
+   hypre_ParCSRMatMatDataBCatOffd(data)       = B_cat_offd;
+   hypre_ParCSRMatMatDataCDiag(data)          = hypre_CSRMatrixMultiplyHostSymbolic(A_cat, B_cat_diag,
+                                                                                    allsquare);
+   hypre_ParCSRMatMatDataCOffd(data)          = hypre_CSRMatrixMultiplyHostSymbolic(A_cat, B_cat_offd, 0);
+   hypre_ParCSRMatMatDataNumColsOffdC(data)   = num_cols_offd_C;
+   hypre_ParCSRMatMatDataColMapOffdC(data)    = col_map_offd_C;
+   hypre_ParCSRMatMatDataExtCommPkg(data)     = ext_comm_pkg;
+   hypre_ParCSRMatMatDataExtSendOffsets(data) = ext_send_offsets;
+   hypre_ParCSRMatMatDataNumExtNonzeros(data) = num_ext_nonzeros;
+   hypre_ParCSRMatMatDataExtMap(data)         = ext_map;
+
+   *data_ptr = data;
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatNumericHost
+ *
+ * Numeric phase of C = A * B. A and B must have the patterns seen by the
+ * symbolic phase that created data. Returns a new matrix C.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParCSRMatrix*
+hypre_ParCSRMatMatNumericHost( hypre_ParCSRMatrix      *A,
+                               hypre_ParCSRMatrix      *B,
+                               hypre_ParCSRMatMatData  *data )
+{
+   MPI_Comm                 comm              = hypre_ParCSRMatrixComm(A);
+
+   hypre_CSRMatrix         *A_diag            = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Complex           *A_diag_a          = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int               *A_diag_i          = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int                num_rows_A        = hypre_CSRMatrixNumRows(A_diag);
+   hypre_CSRMatrix         *A_offd            = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Complex           *A_offd_a          = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int               *A_offd_i          = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int                num_cols_offd_A   = hypre_CSRMatrixNumCols(A_offd);
+
+   hypre_CSRMatrix         *B_diag            = hypre_ParCSRMatrixDiag(B);
+   HYPRE_Complex           *B_diag_a          = hypre_CSRMatrixData(B_diag);
+   HYPRE_Int               *B_diag_i          = hypre_CSRMatrixI(B_diag);
+   hypre_CSRMatrix         *B_offd            = hypre_ParCSRMatrixOffd(B);
+   HYPRE_Complex           *B_offd_a          = hypre_CSRMatrixData(B_offd);
+   HYPRE_Int               *B_offd_i          = hypre_CSRMatrixI(B_offd);
+   HYPRE_Int                num_cols_offd_B   = hypre_CSRMatrixNumCols(B_offd);
+   HYPRE_Int                num_rows_B        = hypre_CSRMatrixNumRows(B_diag);
+
+   hypre_CSRMatrix         *A_cat             = hypre_ParCSRMatMatDataACat(data);
+   hypre_CSRMatrix         *B_cat_diag        = hypre_ParCSRMatMatDataBCatDiag(data);
+   hypre_CSRMatrix         *B_cat_offd        = hypre_ParCSRMatMatDataBCatOffd(data);
+   HYPRE_Complex           *A_cat_a           = hypre_CSRMatrixData(A_cat);
+   HYPRE_Int               *A_cat_i           = hypre_CSRMatrixI(A_cat);
+   HYPRE_Complex           *B_cat_diag_a      = hypre_CSRMatrixData(B_cat_diag);
+   HYPRE_Complex           *B_cat_offd_a      = hypre_CSRMatrixData(B_cat_offd);
+   HYPRE_Int                num_cols_offd_C   = hypre_ParCSRMatMatDataNumColsOffdC(data);
+   hypre_ParCSRCommPkg     *ext_comm_pkg      = hypre_ParCSRMatMatDataExtCommPkg(data);
+   HYPRE_Int               *ext_send_offsets  = hypre_ParCSRMatMatDataExtSendOffsets(data);
+   HYPRE_Int                num_ext_nonzeros  = hypre_ParCSRMatMatDataNumExtNonzeros(data);
+   HYPRE_Int               *ext_map           = hypre_ParCSRMatMatDataExtMap(data);
+
+   hypre_ParCSRCommHandle  *comm_handle       = NULL;
+   HYPRE_Complex           *send_a            = NULL;
+   HYPRE_Complex           *recv_a            = NULL;
+
+   hypre_ParCSRMatrix      *C;
+   hypre_CSRMatrix         *C_diag;
+   hypre_CSRMatrix         *C_offd;
+   HYPRE_Int                i, k, cnt;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   /*-----------------------------------------------------------------------
+    * Start the exchange of the values of the external rows of B
+    *-----------------------------------------------------------------------*/
+
+   if (ext_comm_pkg)
+   {
+      hypre_ParCSRCommPkg *comm_pkg;
+      HYPRE_Int            num_rows_send;
+
+      if (!hypre_ParCSRMatrixCommPkg(A))
+      {
+         hypre_MatvecCommPkgCreate(A);
+      }
+      comm_pkg      = hypre_ParCSRMatrixCommPkg(A);
+      num_rows_send = hypre_ParCSRCommPkgSendMapStart(comm_pkg,
+                                                      hypre_ParCSRCommPkgNumSends(comm_pkg));
+
+      send_a = hypre_TAlloc(HYPRE_Complex, ext_send_offsets[num_rows_send], HYPRE_MEMORY_HOST);
+      recv_a = hypre_TAlloc(HYPRE_Complex, num_ext_nonzeros, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i, k, cnt) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows_send; i++)
+      {
+         HYPRE_Int j = hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i);
+
+         cnt = ext_send_offsets[i];
+         for (k = B_diag_i[j]; k < B_diag_i[j + 1]; k++)
+         {
+            send_a[cnt++] = B_diag_a[k];
+         }
+         if (num_cols_offd_B)
+         {
+            for (k = B_offd_i[j]; k < B_offd_i[j + 1]; k++)
+            {
+               send_a[cnt++] = B_offd_a[k];
+            }
+         }
+      }
+
+      comm_handle = hypre_ParCSRCommHandleCreate(1, ext_comm_pkg, send_a, recv_a);
+   }
+
+   /*-----------------------------------------------------------------------
+    * Refresh the local values of A_cat and B_cat (overlaps the exchange)
+    *-----------------------------------------------------------------------*/
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i, k, cnt) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows_A; i++)
+   {
+      cnt = A_cat_i[i];
+      for (k = A_diag_i[i]; k < A_diag_i[i + 1]; k++)
+      {
+         A_cat_a[cnt++] = A_diag_a[k];
+      }
+      if (num_cols_offd_A)
+      {
+         for (k = A_offd_i[i]; k < A_offd_i[i + 1]; k++)
+         {
+            A_cat_a[cnt++] = A_offd_a[k];
+         }
+      }
+   }
+
+   hypre_TMemcpy(B_cat_diag_a, B_diag_a, HYPRE_Complex, B_diag_i[num_rows_B],
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   if (num_cols_offd_B)
+   {
+      hypre_TMemcpy(B_cat_offd_a, B_offd_a, HYPRE_Complex, B_offd_i[num_rows_B],
+                    HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   }
+
+   if (ext_comm_pkg)
+   {
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(k) HYPRE_SMP_SCHEDULE
+#endif
+      for (k = 0; k < num_ext_nonzeros; k++)
+      {
+         if (ext_map[k] >= 0)
+         {
+            B_cat_diag_a[ext_map[k]] = recv_a[k];
+         }
+         else
+         {
+            B_cat_offd_a[-ext_map[k] - 1] = recv_a[k];
+         }
+      }
+
+      hypre_TFree(send_a, HYPRE_MEMORY_HOST);
+      hypre_TFree(recv_a, HYPRE_MEMORY_HOST);
+   }
+
+   /*-----------------------------------------------------------------------
+    * Local numeric products
+    *-----------------------------------------------------------------------*/
+
+   C_diag = hypre_CSRMatrixClone(hypre_ParCSRMatMatDataCDiag(data), 0);
+   C_offd = hypre_CSRMatrixClone(hypre_ParCSRMatMatDataCOffd(data), 0);
+
+   hypre_CSRMatrixMultiplyHostNumeric(A_cat, B_cat_diag, C_diag);
+   hypre_CSRMatrixMultiplyHostNumeric(A_cat, B_cat_offd, C_offd);
+
+   C = hypre_ParCSRMatrixCreate(comm,
+                                hypre_ParCSRMatrixGlobalNumRows(A),
+                                hypre_ParCSRMatrixGlobalNumCols(B),
+                                hypre_ParCSRMatrixRowStarts(A),
+                                hypre_ParCSRMatrixColStarts(B),
+                                num_cols_offd_C,
+                                hypre_CSRMatrixNumNonzeros(C_diag),
+                                hypre_CSRMatrixNumNonzeros(C_offd));
+
+   hypre_CSRMatrixDestroy(hypre_ParCSRMatrixDiag(C));
+   hypre_CSRMatrixDestroy(hypre_ParCSRMatrixOffd(C));
+   hypre_ParCSRMatrixDiag(C) = C_diag;
+   hypre_ParCSRMatrixOffd(C) = C_offd;
+
+   if (num_cols_offd_C)
+   {
+      hypre_ParCSRMatrixColMapOffd(C) = hypre_TAlloc(HYPRE_BigInt, num_cols_offd_C,
+                                                     HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(hypre_ParCSRMatrixColMapOffd(C), hypre_ParCSRMatMatDataColMapOffdC(data),
+                    HYPRE_BigInt, num_cols_offd_C, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   }
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return C;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatDataMatches
+ *
+ * Returns 1 if data was built for matrices with the sizes and patterns of
+ * A and B on all processes, 0 otherwise. Collective over the communicator of A.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatMatDataMatches( hypre_ParCSRMatMatData *data,
+                               hypre_ParCSRMatrix     *A,
+                               hypre_ParCSRMatrix     *B )
+{
+   HYPRE_Int  local_match = 0;
+   HYPRE_Int  match;
+
+   if (data &&
+       hypre_ParCSRMatMatDataGlobalNumRowsA(data) == hypre_ParCSRMatrixGlobalNumRows(A) &&
+       hypre_ParCSRMatMatDataGlobalNumColsB(data) == hypre_ParCSRMatrixGlobalNumCols(B) &&
+       hypre_CSRMatrixNumRows(hypre_ParCSRMatMatDataACat(data)) ==
+       hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A)) &&
+       hypre_ParCSRMatMatDataPatternKeyA(data) == hypre_ParCSRMatrixPatternKey(A) &&
+       hypre_ParCSRMatMatDataPatternKeyB(data) == hypre_ParCSRMatrixPatternKey(B))
+   {
+      local_match = 1;
+   }
+
+   hypre_MPI_Allreduce(&local_match, &match, 1, HYPRE_MPI_INT, hypre_MPI_MIN,
+                       hypre_ParCSRMatrixComm(A));
+
+   return match;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatReuseHost
+ *
+ * Computes C = A * B, reusing the symbolic data in *data_ptr when it still
+ * matches A and B, and (re)building it otherwise.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParCSRMatrix*
+hypre_ParCSRMatMatReuseHost( hypre_ParCSRMatrix      *A,
+                             hypre_ParCSRMatrix      *B,
+                             hypre_ParCSRMatMatData **data_ptr )
+{
+   if (!hypre_ParCSRMatMatDataMatches(*data_ptr, A, B))
+   {
+      hypre_ParCSRMatMatDataDestroy(*data_ptr);
+      hypre_ParCSRMatMatSymbolicHost(A, B, data_ptr);
+      if (!*data_ptr)
+      {
+         return NULL;
+      }
+   }
+
+   return hypre_ParCSRMatMatNumericHost(A, B, *data_ptr);
+}
@@ -111,6 +111,29 @@ hypre_ParVectorDestroy( hypre_ParVector *vector )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorMemorySize
+ *--------------------------------------------------------------------------*/
+
+size_t
+hypre_ParVectorMemorySize( hypre_ParVector *vector )
+{
+   size_t bytes;
+
+   if (!vector)
+   {
+      return 0;
+   }
+
+   bytes = sizeof(hypre_ParVector);
+   if (hypre_ParVectorOwnsData(vector))
+   {
+      bytes += hypre_SeqVectorMemorySize(hypre_ParVectorLocalVector(vector));
+   }
+
+   return bytes;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParVectorInitialize_v2
  *
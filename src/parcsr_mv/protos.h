@@ -47,6 +47,10 @@ HYPRE_Int HYPRE_ParCSRMatrixBigInitialize ( HYPRE_ParCSRMatrix matrix );
 HYPRE_Int HYPRE_ParCSRMatrixRead ( MPI_Comm comm, const char *file_name,
                                    HYPRE_ParCSRMatrix *matrix );
 HYPRE_Int HYPRE_ParCSRMatrixPrint ( HYPRE_ParCSRMatrix matrix, const char *file_name );
+HYPRE_Int HYPRE_ParCSRMatrixReadMPIIO ( MPI_Comm comm, const char *file_name,
+                                        HYPRE_BigInt *row_starts, HYPRE_BigInt *col_starts,
+                                        HYPRE_ParCSRMatrix *matrix );
+HYPRE_Int HYPRE_ParCSRMatrixPrintMPIIO ( HYPRE_ParCSRMatrix matrix, const char *file_name );
 HYPRE_Int HYPRE_ParCSRMatrixGetComm ( HYPRE_ParCSRMatrix matrix, MPI_Comm *comm );
 HYPRE_Int HYPRE_ParCSRMatrixGetDims ( HYPRE_ParCSRMatrix matrix, HYPRE_BigInt *M, HYPRE_BigInt *N );
 HYPRE_Int HYPRE_ParCSRMatrixGetRowPartitioning ( HYPRE_ParCSRMatrix matrix,
@@ -69,6 +73,13 @@ HYPRE_Int HYPRE_ParCSRMatrixMatvec ( HYPRE_Complex alpha, HYPRE_ParCSRMatrix A,
                                      HYPRE_Complex beta, HYPRE_ParVector y );
 HYPRE_Int HYPRE_ParCSRMatrixMatvecT ( HYPRE_Complex alpha, HYPRE_ParCSRMatrix A, HYPRE_ParVector x,
                                       HYPRE_Complex beta, HYPRE_ParVector y );
+HYPRE_Int HYPRE_ParCSRMatrixSetMatvecFormat ( HYPRE_ParCSRMatrix A, HYPRE_Int format );
+HYPRE_Int HYPRE_ParCSRMatrixSetSinglePrecision ( HYPRE_ParCSRMatrix A, HYPRE_Int single_precision );
+HYPRE_Int HYPRE_ParCSRMatrixCreateFromCSR ( MPI_Comm comm, HYPRE_BigInt global_num_rows,
+                                            HYPRE_BigInt global_num_cols, HYPRE_BigInt *row_starts, HYPRE_BigInt *col_starts,
+                                            HYPRE_Int *row_ptr, HYPRE_BigInt *cols, HYPRE_Complex *values, HYPRE_Int alias_values,
+                                            HYPRE_ParCSRMatrix *matrix );
+HYPRE_Int HYPRE_ParCSRMatrixUpdateValuesFromCSR ( HYPRE_ParCSRMatrix matrix, HYPRE_Complex *values );
 
 /* HYPRE_parcsr_vector.c */
 HYPRE_Int HYPRE_ParVectorCreate ( MPI_Comm comm, HYPRE_BigInt global_size,
@@ -80,6 +91,9 @@ HYPRE_Int HYPRE_ParVectorInitialize ( HYPRE_ParVector vector );
 HYPRE_Int HYPRE_ParVectorRead ( MPI_Comm comm, const char *file_name, HYPRE_ParVector *vector );
 HYPRE_Int HYPRE_ParVectorPrint ( HYPRE_ParVector vector, const char *file_name );
 HYPRE_Int HYPRE_ParVectorPrintBinaryIJ ( HYPRE_ParVector vector, const char *file_name );
+HYPRE_Int HYPRE_ParVectorReadMPIIO ( MPI_Comm comm, const char *file_name,
+                                     HYPRE_BigInt *partitioning, HYPRE_ParVector *vector );
+HYPRE_Int HYPRE_ParVectorPrintMPIIO ( HYPRE_ParVector vector, const char *file_name );
 HYPRE_Int HYPRE_ParVectorSetConstantValues ( HYPRE_ParVector vector, HYPRE_Complex value );
 HYPRE_Int HYPRE_ParVectorSetRandomValues ( HYPRE_ParVector vector, HYPRE_Int seed );
 HYPRE_Int HYPRE_ParVectorCopy ( HYPRE_ParVector x, HYPRE_ParVector y );
@@ -241,6 +255,12 @@ hypre_ParCSRCommHandle *hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int job,
                                                           void *send_data_in,
                                                           HYPRE_MemoryLocation recv_memory_location,
                                                           void *recv_data_in );
+hypre_ParCSRCommHandle *hypre_ParCSRCommHandleCreate_v3 ( HYPRE_Int job,
+                                                          hypre_ParCSRCommPkg *comm_pkg,
+                                                          HYPRE_MemoryLocation send_memory_location,
+                                                          void *send_data_in,
+                                                          HYPRE_MemoryLocation recv_memory_location,
+                                                          void *recv_data_in, HYPRE_Int elmtwise );
 HYPRE_Int hypre_ParCSRCommHandleDestroy ( hypre_ParCSRCommHandle *comm_handle );
 void hypre_ParCSRCommPkgCreate_core ( MPI_Comm comm, HYPRE_BigInt *col_map_offd,
                                       HYPRE_BigInt first_col_diag, HYPRE_BigInt *col_starts, HYPRE_Int num_cols_diag,
@@ -259,6 +279,7 @@ HYPRE_Int hypre_ParCSRCommPkgCreateAndFill ( MPI_Comm comm, HYPRE_Int num_recvs,
 HYPRE_Int hypre_ParCSRCommPkgUpdateVecStarts ( hypre_ParCSRCommPkg *comm_pkg, hypre_ParVector *x );
 HYPRE_Int hypre_MatvecCommPkgCreate ( hypre_ParCSRMatrix *A );
 HYPRE_Int hypre_MatvecCommPkgDestroy ( hypre_ParCSRCommPkg *comm_pkg );
+size_t hypre_ParCSRCommPkgMemorySize ( hypre_ParCSRCommPkg *comm_pkg );
 HYPRE_Int hypre_BuildCSRMatrixMPIDataType ( HYPRE_Int num_nonzeros, HYPRE_Int num_rows,
                                             HYPRE_Complex *a_data, HYPRE_Int *a_i, HYPRE_Int *a_j,
                                             hypre_MPI_Datatype *csr_matrix_datatype );
@@ -364,7 +385,6 @@ HYPRE_Int hypre_ParCSRMatrixDropSmallEntriesDevice( hypre_ParCSRMatrix *A, HYPRE
 
 HYPRE_Int hypre_ParCSRCommPkgCreateMatrixE( hypre_ParCSRCommPkg *comm_pkg, HYPRE_Int local_ncols );
 
-#ifdef HYPRE_USING_PERSISTENT_COMM
 hypre_ParCSRPersistentCommHandle* hypre_ParCSRPersistentCommHandleCreate(HYPRE_Int job,
                                                                          hypre_ParCSRCommPkg *comm_pkg);
 hypre_ParCSRPersistentCommHandle* hypre_ParCSRCommPkgGetPersistentCommHandle(HYPRE_Int job,
@@ -374,7 +394,6 @@ void hypre_ParCSRPersistentCommHandleStart(hypre_ParCSRPersistentCommHandle *com
                                            HYPRE_MemoryLocation send_memory_location, void *send_data);
 void hypre_ParCSRPersistentCommHandleWait(hypre_ParCSRPersistentCommHandle *comm_handle,
                                           HYPRE_MemoryLocation recv_memory_location, void *recv_data);
-#endif
 
 HYPRE_Int hypre_ParcsrGetExternalRowsInit( hypre_ParCSRMatrix *A, HYPRE_Int indices_len,
                                            HYPRE_BigInt *indices, hypre_ParCSRCommPkg *comm_pkg, HYPRE_Int want_data, void **request_ptr);
@@ -411,6 +430,14 @@ HYPRE_Int hypre_ParCSRMatrixDiagScaleDevice ( hypre_ParCSRMatrix *par_A, hypre_P
 HYPRE_Int hypre_ParCSRMatrixCompressOffdMapDevice(hypre_ParCSRMatrix *A);
 HYPRE_Int hypre_ParCSRMatrixCompressOffdMap(hypre_ParCSRMatrix *A);
 
+/* par_csr_from_csr.c */
+hypre_ParCSRMatrix* hypre_ParCSRMatrixCreateFromCSR ( MPI_Comm comm, HYPRE_BigInt global_num_rows,
+                                                      HYPRE_BigInt global_num_cols, HYPRE_BigInt *row_starts, HYPRE_BigInt *col_starts,
+                                                      HYPRE_Int *row_ptr, HYPRE_BigInt *cols, HYPRE_Complex *values, HYPRE_Int alias_values );
+HYPRE_Int hypre_ParCSRMatrixUpdateValuesFromCSR ( hypre_ParCSRMatrix *matrix,
+                                                  HYPRE_Complex *values );
+HYPRE_Int hypre_ParCSRMatrixDetachCSRValues ( hypre_ParCSRMatrix *matrix );
+
 /* par_csr_matop_marked.c */
 void hypre_ParMatmul_RowSizes_Marked ( HYPRE_Int **C_diag_i, HYPRE_Int **C_offd_i,
                                        HYPRE_Int **B_marker, HYPRE_Int *A_diag_i,
@@ -448,6 +475,7 @@ hypre_ParCSRMatrix *hypre_ParCSRMatrixCreate ( MPI_Comm comm, HYPRE_BigInt globa
                                                HYPRE_Int num_nonzeros_diag,
                                                HYPRE_Int num_nonzeros_offd );
 HYPRE_Int hypre_ParCSRMatrixDestroy ( hypre_ParCSRMatrix *matrix );
+size_t hypre_ParCSRMatrixMemorySize ( hypre_ParCSRMatrix *matrix );
 HYPRE_Int hypre_ParCSRMatrixInitialize_v2( hypre_ParCSRMatrix *matrix,
                                            HYPRE_MemoryLocation memory_location );
 HYPRE_Int hypre_ParCSRMatrixInitialize ( hypre_ParCSRMatrix *matrix );
@@ -456,6 +484,11 @@ HYPRE_Int hypre_ParCSRMatrixSetDNumNonzeros ( hypre_ParCSRMatrix *matrix );
 HYPRE_Int hypre_ParCSRMatrixSetNumRownnz ( hypre_ParCSRMatrix *matrix );
 HYPRE_Int hypre_ParCSRMatrixSetDataOwner ( hypre_ParCSRMatrix *matrix, HYPRE_Int owns_data );
 HYPRE_Int hypre_ParCSRMatrixSetPatternOnly( hypre_ParCSRMatrix *matrix, HYPRE_Int pattern_only);
+HYPRE_Int hypre_ParCSRMatrixSetMatvecFormat( hypre_ParCSRMatrix *matrix, HYPRE_Int format );
+HYPRE_Int hypre_ParCSRMatrixRefreshMatvecFormat( hypre_ParCSRMatrix *matrix );
+HYPRE_Int hypre_ParCSRMatrixSetMatvecOverlap( hypre_ParCSRMatrix *matrix, HYPRE_Int overlap );
+HYPRE_Int hypre_ParCSRMatrixSetSinglePrecision( hypre_ParCSRMatrix *matrix,
+                                                HYPRE_Int single_precision );
 hypre_ParCSRMatrix *hypre_ParCSRMatrixRead ( MPI_Comm comm, const char *file_name );
 HYPRE_Int hypre_ParCSRMatrixPrint ( hypre_ParCSRMatrix *matrix, const char *file_name );
 HYPRE_Int hypre_ParCSRMatrixPrintIJ ( const hypre_ParCSRMatrix *matrix, const HYPRE_Int base_i,
@@ -510,6 +543,10 @@ HYPRE_Int hypre_ParCSRMatrixMatvecOutOfPlace ( HYPRE_Complex alpha, hypre_ParCSR
 HYPRE_Int hypre_ParCSRMatrixMatvecOutOfPlaceDevice ( HYPRE_Complex alpha, hypre_ParCSRMatrix *A,
                                                      hypre_ParVector *x, HYPRE_Complex beta,
                                                      hypre_ParVector *b, hypre_ParVector *y );
+HYPRE_Int hypre_ParCSRMatrixMatvecOutOfPlaceOverlapHost ( HYPRE_Complex alpha,
+                                                          hypre_ParCSRMatrix *A,
+                                                          hypre_ParVector *x, HYPRE_Complex beta,
+                                                          hypre_ParVector *b, hypre_ParVector *y );
 // y = alpha*A*x + beta*y
 HYPRE_Int hypre_ParCSRMatrixMatvec ( HYPRE_Complex alpha, hypre_ParCSRMatrix *A, hypre_ParVector *x,
                                      HYPRE_Complex beta, hypre_ParVector *y );
@@ -518,12 +555,47 @@ HYPRE_Int hypre_ParCSRMatrixMatvecT ( HYPRE_Complex alpha, hypre_ParCSRMatrix *A
 HYPRE_Int hypre_ParCSRMatrixMatvecTDevice ( HYPRE_Complex alpha, hypre_ParCSRMatrix *A,
                                             hypre_ParVector *x, HYPRE_Complex beta,
                                             hypre_ParVector *y );
+// fc = P^T*(f - A*u)
+HYPRE_Int hypre_ParCSRMatrixResidualRestrictHost ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *P,
+                                                   hypre_ParVector *u, hypre_ParVector *f,
+                                                   hypre_ParVector *fc, HYPRE_Real *rnorm2,
+                                                   HYPRE_Complex *work );
 HYPRE_Int hypre_ParCSRMatrixMatvecT_unpack( hypre_ParCSRCommPkg *comm_pkg, HYPRE_Int num_cols,
                                             HYPRE_Complex *recv_data, HYPRE_Complex *local_data );
 HYPRE_Int hypre_ParCSRMatrixMatvec_FF ( HYPRE_Complex alpha, hypre_ParCSRMatrix *A,
                                         hypre_ParVector *x, HYPRE_Complex beta, hypre_ParVector *y,
                                         HYPRE_Int *CF_marker, HYPRE_Int fpt );
 
+/* par_csr_mpiio.c */
+HYPRE_Int hypre_ParCSRMatrixPrintMPIIO ( hypre_ParCSRMatrix *matrix, const char *filename );
+HYPRE_Int hypre_ParCSRMatrixReadMPIIO ( MPI_Comm comm, const char *filename,
+                                        HYPRE_BigInt *row_starts_in, HYPRE_BigInt *col_starts_in,
+                                        hypre_ParCSRMatrix **matrix_ptr );
+HYPRE_Int hypre_ParVectorPrintMPIIO ( hypre_ParVector *vector, const char *filename );
+HYPRE_Int hypre_ParVectorReadMPIIO ( MPI_Comm comm, const char *filename,
+                                     HYPRE_BigInt *partitioning, hypre_ParVector **vector_ptr );
+
+/* par_csr_node_comm.c */
+HYPRE_Int hypre_ParCSRCommPkgCreateNodePkg ( hypre_ParCSRCommPkg *comm_pkg, HYPRE_Int node_size );
+HYPRE_Int hypre_ParCSRCommNodePkgDestroy ( hypre_ParCSRCommNodePkg *node_pkg );
+size_t hypre_ParCSRCommNodePkgMemorySize ( hypre_ParCSRCommNodePkg *node_pkg );
+HYPRE_Int hypre_ParCSRCommHandleNodeStart ( hypre_ParCSRCommHandle *comm_handle,
+                                            hypre_ParCSRCommNodePkg *node_pkg, HYPRE_Int block_bytes );
+HYPRE_Int hypre_ParCSRCommHandleNodeFinish ( hypre_ParCSRCommHandle *comm_handle );
+
+/* par_csr_spgemm_host.c */
+hypre_ulonglongint hypre_ParCSRMatrixPatternKey ( hypre_ParCSRMatrix *A );
+HYPRE_Int hypre_ParCSRMatMatDataDestroy ( hypre_ParCSRMatMatData *data );
+size_t hypre_ParCSRMatMatDataMemorySize ( hypre_ParCSRMatMatData *data );
+HYPRE_Int hypre_ParCSRMatMatSymbolicHost ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *B,
+                                           hypre_ParCSRMatMatData **data_ptr );
+hypre_ParCSRMatrix *hypre_ParCSRMatMatNumericHost ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *B,
+                                                    hypre_ParCSRMatMatData *data );
+HYPRE_Int hypre_ParCSRMatMatDataMatches ( hypre_ParCSRMatMatData *data, hypre_ParCSRMatrix *A,
+                                          hypre_ParCSRMatrix *B );
+hypre_ParCSRMatrix *hypre_ParCSRMatMatReuseHost ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *B,
+                                                  hypre_ParCSRMatMatData **data_ptr );
+
 /* par_csr_triplemat.c */
 HYPRE_Int hypre_ParCSRTMatMatPartialAddDevice( hypre_ParCSRCommPkg *comm_pkg_A,
                                                HYPRE_Int num_cols_A, HYPRE_Int num_cols_B, HYPRE_BigInt first_col_diag_B,
@@ -562,6 +634,7 @@ hypre_ParVector *hypre_ParVectorCreate ( MPI_Comm comm, HYPRE_BigInt global_size
 hypre_ParVector *hypre_ParMultiVectorCreate ( MPI_Comm comm, HYPRE_BigInt global_size,
                                               HYPRE_BigInt *partitioning, HYPRE_Int num_vectors );
 HYPRE_Int hypre_ParVectorDestroy ( hypre_ParVector *vector );
+size_t hypre_ParVectorMemorySize ( hypre_ParVector *vector );
 HYPRE_Int hypre_ParVectorInitialize ( hypre_ParVector *vector );
 HYPRE_Int hypre_ParVectorInitialize_v2( hypre_ParVector *vector,
                                         HYPRE_MemoryLocation memory_location );
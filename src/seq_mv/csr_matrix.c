@@ -40,6 +40,9 @@ hypre_CSRMatrixCreate( HYPRE_Int num_rows,
    hypre_CSRMatrixNumCols(matrix)        = num_cols;
    hypre_CSRMatrixNumNonzeros(matrix)    = num_nonzeros;
    hypre_CSRMatrixMemoryLocation(matrix) = hypre_HandleMemoryLocation(hypre_handle());
+   hypre_CSRMatrixMatvecFormat(matrix)   = HYPRE_CSR_MATVEC_FORMAT_CSR;
+   hypre_CSRMatrixSellData(matrix)       = NULL;
+   hypre_CSRMatrixDataSingle(matrix)     = NULL;
 
    /* set defaults */
    hypre_CSRMatrixOwnsData(matrix)       = 1;
@@ -76,6 +79,9 @@ hypre_CSRMatrixDestroy( hypre_CSRMatrix *matrix )
          hypre_TFree(hypre_CSRMatrixBigJ(matrix), memory_location);
       }
 
+      hypre_CSRSellDataDestroy(hypre_CSRMatrixSellData(matrix));
+      hypre_TFree(hypre_CSRMatrixDataSingle(matrix), HYPRE_MEMORY_HOST);
+
 #if defined(HYPRE_USING_CUSPARSE) || defined(HYPRE_USING_ROCSPARSE) || defined(HYPRE_USING_ONEMKLSPARSE)
       hypre_TFree(hypre_CSRMatrixSortedData(matrix), memory_location);
       hypre_TFree(hypre_CSRMatrixSortedJ(matrix), memory_location);
@@ -1425,6 +1431,73 @@ hypre_CSRMatrixPrefetch( hypre_CSRMatrix      *A,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMemorySize
+ *
+ * Returns the number of bytes held by the matrix: the structure itself, the
+ * arrays it owns and the auxiliary copies built for the host matvecs
+ * (SELL-C-sigma and single-precision values).
+ *--------------------------------------------------------------------------*/
+
+size_t
+hypre_CSRMatrixMemorySize( hypre_CSRMatrix *A )
+{
+   hypre_CSRSellData  *sell;
+   HYPRE_Int           num_rows, num_nonzeros, num_slices;
+   size_t              bytes;
+
+   if (!A)
+   {
+      return 0;
+   }
+
+   num_rows     = hypre_CSRMatrixNumRows(A);
+   num_nonzeros = hypre_CSRMatrixNumNonzeros(A);
+   bytes        = sizeof(hypre_CSRMatrix);
+
+   if (hypre_CSRMatrixOwnsData(A))
+   {
+      if (hypre_CSRMatrixI(A))
+      {
+         bytes += (size_t) (num_rows + 1) * sizeof(HYPRE_Int);
+      }
+      if (hypre_CSRMatrixJ(A))
+      {
+         bytes += (size_t) num_nonzeros * sizeof(HYPRE_Int);
+      }
+      if (hypre_CSRMatrixBigJ(A))
+      {
+         bytes += (size_t) num_nonzeros * sizeof(HYPRE_BigInt);
+      }
+      if (hypre_CSRMatrixData(A))
+      {
+         bytes += (size_t) num_nonzeros * sizeof(HYPRE_Complex);
+      }
+   }
+
+   if (hypre_CSRMatrixRownnz(A))
+   {
+      bytes += (size_t) hypre_CSRMatrixNumRownnz(A) * sizeof(HYPRE_Int);
+   }
+
+   if (hypre_CSRMatrixDataSingle(A))
+   {
+      bytes += (size_t) num_nonzeros * sizeof(hypre_float);
+   }
+
+   if ((sell = hypre_CSRMatrixSellData(A)) != NULL)
+   {
+      num_slices = hypre_CSRSellDataNumSlices(sell);
+      bytes += sizeof(hypre_CSRSellData);
+      bytes += (size_t) (2 * num_slices + 1) * sizeof(HYPRE_Int);
+      bytes += (size_t) num_slices * HYPRE_SELL_CHUNK_SIZE * sizeof(HYPRE_Int);
+      bytes += (size_t) hypre_CSRSellDataSlicePtr(sell)[num_slices] *
+               (sizeof(HYPRE_Int) + sizeof(HYPRE_Complex));
+   }
+
+   return bytes;
+}
+
 #if defined(HYPRE_USING_CUSPARSE)  ||\
     defined(HYPRE_USING_ROCSPARSE) ||\
     defined(HYPRE_USING_ONEMKLSPARSE)
@@ -26,6 +26,43 @@ struct hypre_GpuMatData;
 typedef struct hypre_GpuMatData hypre_GpuMatData;
 #endif
 
+/*--------------------------------------------------------------------------
+ * SELL-C-sigma (sliced ELLPACK) copy of a CSR matrix
+ *
+ * Rows are sorted by decreasing length inside windows of sigma rows and
+ * grouped into slices of HYPRE_SELL_CHUNK_SIZE rows. Each slice is padded to
+ * the length of its longest row and stored column-major, so that the inner
+ * loop of the matvec runs over HYPRE_SELL_CHUNK_SIZE consecutive entries.
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_SELL_CHUNK_SIZE 8
+#define HYPRE_SELL_SIGMA      256
+
+/* Host matvec kernels available for a hypre_CSRMatrix */
+#define HYPRE_CSR_MATVEC_FORMAT_CSR  0
+#define HYPRE_CSR_MATVEC_FORMAT_SELL 1
+
+typedef struct
+{
+   HYPRE_Int       num_rows;
+   HYPRE_Int       num_slices;
+   HYPRE_Int       sigma;
+   HYPRE_Int      *slice_ptr;  /* offsets of the slices in j/data (num_slices + 1) */
+   HYPRE_Int      *slice_len;  /* padded row length of each slice */
+   HYPRE_Int      *perm;       /* original row index of each slice row, -1 for padding */
+   HYPRE_Int      *j;
+   HYPRE_Complex  *data;
+} hypre_CSRSellData;
+
+#define hypre_CSRSellDataNumRows(sell)    ((sell) -> num_rows)
+#define hypre_CSRSellDataNumSlices(sell)  ((sell) -> num_slices)
+#define hypre_CSRSellDataSigma(sell)      ((sell) -> sigma)
+#define hypre_CSRSellDataSlicePtr(sell)   ((sell) -> slice_ptr)
+#define hypre_CSRSellDataSliceLen(sell)   ((sell) -> slice_len)
+#define hypre_CSRSellDataPerm(sell)       ((sell) -> perm)
+#define hypre_CSRSellDataJ(sell)          ((sell) -> j)
+#define hypre_CSRSellDataData(sell)       ((sell) -> data)
+
 /*--------------------------------------------------------------------------
  * CSR Matrix
  *--------------------------------------------------------------------------*/
@@ -46,6 +83,10 @@ typedef struct
    HYPRE_Int            *rownnz;          /* for compressing rows in matrix multiplication  */
    HYPRE_Int             num_rownnz;
    HYPRE_MemoryLocation  memory_location; /* memory location of arrays i, j, data */
+   HYPRE_Int             matvec_format;   /* host matvec kernel, see HYPRE_CSR_MATVEC_FORMAT_* */
+   hypre_CSRSellData    *sell_data;       /* SELL-C-sigma copy, built on first use */
+   hypre_float          *data_single;     /* single-precision copy of data used by host
+                                             matvecs and smoothers, if requested */
 
 #if defined(HYPRE_USING_CUSPARSE)  ||\
     defined(HYPRE_USING_ROCSPARSE) ||\
@@ -73,6 +114,9 @@ typedef struct
 #define hypre_CSRMatrixOwnsData(matrix)             ((matrix) -> owns_data)
 #define hypre_CSRMatrixPatternOnly(matrix)          ((matrix) -> pattern_only)
 #define hypre_CSRMatrixMemoryLocation(matrix)       ((matrix) -> memory_location)
+#define hypre_CSRMatrixMatvecFormat(matrix)         ((matrix) -> matvec_format)
+#define hypre_CSRMatrixSellData(matrix)             ((matrix) -> sell_data)
+#define hypre_CSRMatrixDataSingle(matrix)           ((matrix) -> data_single)
 
 #if defined(HYPRE_USING_CUSPARSE)  ||\
     defined(HYPRE_USING_ROCSPARSE) ||\
@@ -879,6 +879,17 @@ hypre_CSRMatrixMatvecOutOfPlace( HYPRE_Complex    alpha,
    }
    else
 #endif
+   if (hypre_CSRMatrixMatvecFormat(A) == HYPRE_CSR_MATVEC_FORMAT_SELL &&
+       hypre_CSRMatrixData(A) && offset == 0 && x != y &&
+       hypre_VectorNumVectors(x) == 1)
+   {
+      ierr = hypre_CSRMatrixMatvecSellHost(alpha, A, x, beta, b, y);
+   }
+   else if (hypre_CSRMatrixDataSingle(A) && offset == 0 && x != y)
+   {
+      ierr = hypre_CSRMatrixMatvecSingleHost(alpha, A, x, beta, b, y);
+   }
+   else
    {
       ierr = hypre_CSRMatrixMatvecOutOfPlaceHost(alpha, A, x, beta, b, y, offset);
    }
@@ -1159,6 +1170,11 @@ hypre_CSRMatrixMatvecT( HYPRE_Complex    alpha,
    }
    else
 #endif
+   if (hypre_CSRMatrixDataSingle(A) && x != y && hypre_VectorNumVectors(x) == 1)
+   {
+      ierr = hypre_CSRMatrixMatvecTSingleHost(alpha, A, x, beta, y);
+   }
+   else
    {
       ierr = hypre_CSRMatrixMatvecTHost(alpha, A, x, beta, y);
    }
@@ -0,0 +1,296 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * SELL-C-sigma (sliced ELLPACK) matvec for hypre_CSRMatrix on the host.
+ *
+ * The SELL copy is built lazily on the first matvec after the matrix has been
+ * switched to HYPRE_CSR_MATVEC_FORMAT_SELL and is kept alongside the CSR
+ * arrays. Code that changes the values or the sparsity pattern of the CSR
+ * matrix must drop the copy (hypre_CSRMatrixRefreshMatvecFormat), so that the
+ * next matvec rebuilds it; the IJ interface does this on SetValues,
+ * AddToValues, SetConstantValues and Assemble.
+ *
+ *****************************************************************************/
+
+#include "seq_mv.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRSellDataCreate
+ *--------------------------------------------------------------------------*/
+
+hypre_CSRSellData *
+hypre_CSRSellDataCreate( hypre_CSRMatrix *A,
+                         HYPRE_Int        sigma )
+{
+   HYPRE_Int          *A_i        = hypre_CSRMatrixI(A);
+   HYPRE_Int          *A_j        = hypre_CSRMatrixJ(A);
+   HYPRE_Complex      *A_data     = hypre_CSRMatrixData(A);
+   HYPRE_Int           num_rows   = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int           chunk      = HYPRE_SELL_CHUNK_SIZE;
+   HYPRE_Int           num_slices = (num_rows + chunk - 1) / chunk;
+
+   hypre_CSRSellData  *sell;
+   HYPRE_Int          *slice_ptr;
+   HYPRE_Int          *slice_len;
+   HYPRE_Int          *perm;
+   HYPRE_Int          *sell_j;
+   HYPRE_Complex      *sell_data;
+   HYPRE_Int          *row_len;
+   HYPRE_Int           i, k, r, s, w, row, len, pos;
+
+   if (sigma < chunk)
+   {
+      sigma = chunk;
+   }
+
+   sell      = hypre_CTAlloc(hypre_CSRSellData, 1, HYPRE_MEMORY_HOST);
+   slice_ptr = hypre_CTAlloc(HYPRE_Int, num_slices + 1, HYPRE_MEMORY_HOST);
+   slice_len = hypre_CTAlloc(HYPRE_Int, num_slices, HYPRE_MEMORY_HOST);
+   perm      = hypre_TAlloc(HYPRE_Int, num_slices * chunk, HYPRE_MEMORY_HOST);
+   row_len   = hypre_TAlloc(HYPRE_Int, num_slices * chunk, HYPRE_MEMORY_HOST);
+
+   /* Sort rows by decreasing length inside windows of sigma rows */
+   for (i = 0; i < num_slices * chunk; i++)
+   {
+      perm[i]    = (i < num_rows) ? i : -1;
+      row_len[i] = (i < num_rows) ? -(A_i[i + 1] - A_i[i]) : 0;
+   }
+
+   for (w = 0; w < num_rows; w += sigma)
+   {
+      hypre_qsort2i(row_len, perm, w, hypre_min(w + sigma, num_rows) - 1);
+   }
+
+   /* Compute the padded length of each slice */
+   for (s = 0; s < num_slices; s++)
+   {
+      len = 0;
+      for (r = 0; r < chunk; r++)
+      {
+         len = hypre_max(len, -row_len[s * chunk + r]);
+      }
+      slice_len[s]     = len;
+      slice_ptr[s + 1] = slice_ptr[s] + len * chunk;
+   }
+
+   sell_j    = hypre_TAlloc(HYPRE_Int, slice_ptr[num_slices], HYPRE_MEMORY_HOST);
+   sell_data = hypre_TAlloc(HYPRE_Complex, slice_ptr[num_slices], HYPRE_MEMORY_HOST);
+
+   /* Fill slices column-major; padding entries point to the row's
+      first column (or column 0) and carry a zero coefficient */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(s, r, k, row, len, pos) HYPRE_SMP_SCHEDULE
+#endif
+   for (s = 0; s < num_slices; s++)
+   {
+      for (r = 0; r < chunk; r++)
+      {
+         row = perm[s * chunk + r];
+         len = (row > -1) ? (A_i[row + 1] - A_i[row]) : 0;
+         pos = slice_ptr[s] + r;
+
+         for (k = 0; k < len; k++, pos += chunk)
+         {
+            sell_j[pos]    = A_j[A_i[row] + k];
+            sell_data[pos] = A_data[A_i[row] + k];
+         }
+         for (; k < slice_len[s]; k++, pos += chunk)
+         {
+            sell_j[pos]    = (len > 0) ? A_j[A_i[row]] : 0;
+            sell_data[pos] = 0.0;
+         }
+      }
+   }
+
+   hypre_TFree(row_len, HYPRE_MEMORY_HOST);
+
+   hypre_CSRSellDataNumRows(sell)   = num_rows;
+   hypre_CSRSellDataNumSlices(sell) = num_slices;
+   hypre_CSRSellDataSigma(sell)     = sigma;
+   hypre_CSRSellDataSlicePtr(sell)  = slice_ptr;
+   hypre_CSRSellDataSliceLen(sell)  = slice_len;
+   hypre_CSRSellDataPerm(sell)      = perm;
+   hypre_CSRSellDataJ(sell)         = sell_j;
+   hypre_CSRSellDataData(sell)      = sell_data;
+
+   return sell;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRSellDataDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRSellDataDestroy( hypre_CSRSellData *sell )
+{
+   if (sell)
+   {
+      hypre_TFree(hypre_CSRSellDataSlicePtr(sell), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRSellDataSliceLen(sell), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRSellDataPerm(sell), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRSellDataJ(sell), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRSellDataData(sell), HYPRE_MEMORY_HOST);
+      hypre_TFree(sell, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSetMatvecFormat
+ *
+ * Selects the host matvec kernel of A. Any existing SELL copy is discarded,
+ * so calling this again after changing the values of A refreshes it.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSetMatvecFormat( hypre_CSRMatrix *A,
+                                HYPRE_Int        format )
+{
+   if (!A)
+   {
+      return hypre_error_flag;
+   }
+
+   if (format != HYPRE_CSR_MATVEC_FORMAT_CSR &&
+       format != HYPRE_CSR_MATVEC_FORMAT_SELL)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_CSRSellDataDestroy(hypre_CSRMatrixSellData(A));
+   hypre_CSRMatrixSellData(A)     = NULL;
+   hypre_CSRMatrixMatvecFormat(A) = format;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixRefreshMatvecFormat
+ *
+ * Drops the SELL copy of A, if any, while keeping the selected format.
+ * The copy is rebuilt from the current CSR arrays on the next matvec.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixRefreshMatvecFormat( hypre_CSRMatrix *A )
+{
+   if (A && hypre_CSRMatrixSellData(A))
+   {
+      hypre_CSRSellDataDestroy(hypre_CSRMatrixSellData(A));
+      hypre_CSRMatrixSellData(A) = NULL;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecSellHost
+ *
+ * Performs y <- alpha * A * x + beta * b using the SELL copy of A.
+ * x and y must not be aliased and must hold a single vector.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecSellHost( HYPRE_Complex    alpha,
+                               hypre_CSRMatrix *A,
+                               hypre_Vector    *x,
+                               HYPRE_Complex    beta,
+                               hypre_Vector    *b,
+                               hypre_Vector    *y )
+{
+   hypre_CSRSellData  *sell;
+   HYPRE_Complex      *x_data = hypre_VectorData(x);
+   HYPRE_Complex      *b_data = hypre_VectorData(b);
+   HYPRE_Complex      *y_data = hypre_VectorData(y);
+   HYPRE_Int           num_slices;
+   HYPRE_Int          *slice_ptr;
+   HYPRE_Int          *slice_len;
+   HYPRE_Int          *perm;
+   HYPRE_Int          *sell_j;
+   HYPRE_Complex      *sell_data;
+   HYPRE_Int           s, k, r, row, pos;
+   HYPRE_Int           ierr = 0;
+
+   hypre_assert(x != y);
+   hypre_assert(hypre_VectorNumVectors(x) == 1);
+
+   if (hypre_CSRMatrixNumCols(A) != hypre_VectorSize(x))
+   {
+      ierr = 1;
+   }
+
+   if (hypre_CSRMatrixNumRows(A) != hypre_VectorSize(y) ||
+       hypre_CSRMatrixNumRows(A) != hypre_VectorSize(b))
+   {
+      ierr = (ierr == 1) ? 3 : 2;
+   }
+
+   if (!hypre_CSRMatrixSellData(A))
+   {
+      hypre_CSRMatrixSellData(A) = hypre_CSRSellDataCreate(A, HYPRE_SELL_SIGMA);
+   }
+
+   sell       = hypre_CSRMatrixSellData(A);
+   num_slices = hypre_CSRSellDataNumSlices(sell);
+   slice_ptr  = hypre_CSRSellDataSlicePtr(sell);
+   slice_len  = hypre_CSRSellDataSliceLen(sell);
+   perm       = hypre_CSRSellDataPerm(sell);
+   sell_j     = hypre_CSRSellDataJ(sell);
+   sell_data  = hypre_CSRSellDataData(sell);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(s, k, r, row, pos) HYPRE_SMP_SCHEDULE
+#endif
+   for (s = 0; s < num_slices; s++)
+   {
+      HYPRE_Complex sum[HYPRE_SELL_CHUNK_SIZE];
+
+      for (r = 0; r < HYPRE_SELL_CHUNK_SIZE; r++)
+      {
+         sum[r] = 0.0;
+      }
+
+      pos = slice_ptr[s];
+      for (k = 0; k < slice_len[s]; k++, pos += HYPRE_SELL_CHUNK_SIZE)
+      {
+         /* unit-stride over the rows of the slice */
+         for (r = 0; r < HYPRE_SELL_CHUNK_SIZE; r++)
+         {
+            sum[r] += sell_data[pos + r] * x_data[sell_j[pos + r]];
+         }
+      }
+
+      if (beta == 0.0)
+      {
+         for (r = 0; r < HYPRE_SELL_CHUNK_SIZE; r++)
+         {
+            row = perm[s * HYPRE_SELL_CHUNK_SIZE + r];
+            if (row > -1)
+            {
+               y_data[row] = alpha * sum[r];
+            }
+         }
+      }
+      else
+      {
+         for (r = 0; r < HYPRE_SELL_CHUNK_SIZE; r++)
+         {
+            row = perm[s * HYPRE_SELL_CHUNK_SIZE + r];
+            if (row > -1)
+            {
+               y_data[row] = alpha * sum[r] + beta * b_data[row];
+            }
+         }
+      }
+   }
+
+   return ierr;
+}
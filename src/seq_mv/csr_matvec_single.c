@@ -0,0 +1,300 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Host matvecs of hypre_CSRMatrix reading a single-precision copy of the
+ * matrix values. Vectors and accumulation stay in HYPRE_Complex, so only the
+ * traffic on the matrix values is reduced.
+ *
+ * The copy is built by hypre_CSRMatrixSetSinglePrecision and must be rebuilt
+ * by calling it again whenever the values of the CSR matrix change.
+ *
+ *****************************************************************************/
+
+#include "seq_mv.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSetSinglePrecision
+ *
+ * Builds (single_precision = 1) or discards (single_precision = 0) the
+ * single-precision copy of the values of A. Only host matrices are supported.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSetSinglePrecision( hypre_CSRMatrix *A,
+                                   HYPRE_Int        single_precision )
+{
+   HYPRE_Complex  *A_data;
+   hypre_float    *A_data_single;
+   HYPRE_Int       num_nonzeros;
+   HYPRE_Int       i;
+
+   if (!A)
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_TFree(hypre_CSRMatrixDataSingle(A), HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixDataSingle(A) = NULL;
+
+   if (!single_precision)
+   {
+      return hypre_error_flag;
+   }
+
+#if defined(HYPRE_COMPLEX)
+   hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Single-precision values not supported for complex!\n");
+   return hypre_error_flag;
+#else
+   if (hypre_GetActualMemLocation(hypre_CSRMatrixMemoryLocation(A)) != hypre_MEMORY_HOST)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Single-precision values only supported on the host!\n");
+      return hypre_error_flag;
+   }
+
+   A_data       = hypre_CSRMatrixData(A);
+   num_nonzeros = hypre_CSRMatrixNumNonzeros(A);
+
+   if (!A_data || num_nonzeros == 0)
+   {
+      return hypre_error_flag;
+   }
+
+   A_data_single = hypre_TAlloc(hypre_float, num_nonzeros, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_nonzeros; i++)
+   {
+      A_data_single[i] = (hypre_float) A_data[i];
+   }
+
+   hypre_CSRMatrixDataSingle(A) = A_data_single;
+
+   return hypre_error_flag;
+#endif
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecSingleHost
+ *
+ * Performs y <- alpha * A * x + beta * b using the single-precision values
+ * of A. x and y must not be aliased.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecSingleHost( HYPRE_Complex    alpha,
+                                 hypre_CSRMatrix *A,
+                                 hypre_Vector    *x,
+                                 HYPRE_Complex    beta,
+                                 hypre_Vector    *b,
+                                 hypre_Vector    *y )
+{
+   hypre_float     *A_data      = hypre_CSRMatrixDataSingle(A);
+   HYPRE_Int       *A_i         = hypre_CSRMatrixI(A);
+   HYPRE_Int       *A_j         = hypre_CSRMatrixJ(A);
+   HYPRE_Int        num_rows    = hypre_CSRMatrixNumRows(A);
+
+   HYPRE_Complex   *x_data      = hypre_VectorData(x);
+   HYPRE_Complex   *b_data      = hypre_VectorData(b);
+   HYPRE_Complex   *y_data      = hypre_VectorData(y);
+   HYPRE_Int        num_vectors = hypre_VectorNumVectors(x);
+   HYPRE_Int        idxstride_x = hypre_VectorIndexStride(x);
+   HYPRE_Int        vecstride_x = hypre_VectorVectorStride(x);
+   HYPRE_Int        idxstride_y = hypre_VectorIndexStride(y);
+   HYPRE_Int        vecstride_y = hypre_VectorVectorStride(y);
+   HYPRE_Int        idxstride_b = hypre_VectorIndexStride(b);
+   HYPRE_Int        vecstride_b = hypre_VectorVectorStride(b);
+
+   HYPRE_Complex    tempx;
+   HYPRE_Int        i, j, jj, k;
+   HYPRE_Int        ierr = 0;
+
+   hypre_assert(x != y);
+   hypre_assert(num_vectors == hypre_VectorNumVectors(y));
+   hypre_assert(num_vectors == hypre_VectorNumVectors(b));
+
+   if (hypre_CSRMatrixNumCols(A) != hypre_VectorSize(x))
+   {
+      ierr = 1;
+   }
+
+   if (num_rows != hypre_VectorSize(y) || num_rows != hypre_VectorSize(b))
+   {
+      ierr = (ierr == 1) ? 3 : 2;
+   }
+
+   if (num_vectors == 1)
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i, jj, tempx) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         tempx = 0.0;
+         for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+         {
+            tempx += A_data[jj] * x_data[A_j[jj]];
+         }
+
+         if (beta == 0.0)
+         {
+            y_data[i] = alpha * tempx;
+         }
+         else
+         {
+            y_data[i] = alpha * tempx + beta * b_data[i];
+         }
+      }
+   }
+   else
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i, j, jj, k, tempx) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         for (k = 0; k < num_vectors; k++)
+         {
+            tempx = 0.0;
+            for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+            {
+               j = A_j[jj];
+               tempx += A_data[jj] * x_data[j * idxstride_x + k * vecstride_x];
+            }
+
+            if (beta == 0.0)
+            {
+               y_data[i * idxstride_y + k * vecstride_y] = alpha * tempx;
+            }
+            else
+            {
+               y_data[i * idxstride_y + k * vecstride_y] =
+                  alpha * tempx + beta * b_data[i * idxstride_b + k * vecstride_b];
+            }
+         }
+      }
+   }
+
+   return ierr;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecTSingleHost
+ *
+ * Performs y <- alpha * A^T * x + beta * y using the single-precision values
+ * of A. x and y must not be aliased and must hold a single vector.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecTSingleHost( HYPRE_Complex    alpha,
+                                  hypre_CSRMatrix *A,
+                                  hypre_Vector    *x,
+                                  HYPRE_Complex    beta,
+                                  hypre_Vector    *y )
+{
+   hypre_float     *A_data      = hypre_CSRMatrixDataSingle(A);
+   HYPRE_Int       *A_i         = hypre_CSRMatrixI(A);
+   HYPRE_Int       *A_j         = hypre_CSRMatrixJ(A);
+   HYPRE_Int        num_rows    = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int        num_cols    = hypre_CSRMatrixNumCols(A);
+
+   HYPRE_Complex   *x_data      = hypre_VectorData(x);
+   HYPRE_Complex   *y_data      = hypre_VectorData(y);
+   HYPRE_Int        y_size      = hypre_VectorSize(y);
+
+   HYPRE_Complex   *y_data_expand;
+   HYPRE_Int        num_threads, my_thread_num, offset;
+   HYPRE_Int        i, j, jj;
+   HYPRE_Int        ierr = 0;
+
+   hypre_assert(x != y);
+   hypre_assert(hypre_VectorNumVectors(x) == 1);
+
+   if (num_rows != hypre_VectorSize(x))
+   {
+      ierr = 1;
+   }
+
+   if (num_cols != y_size)
+   {
+      ierr = (ierr == 1) ? 3 : 2;
+   }
+
+   /* y = beta * y */
+   if (beta != 1.0)
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_cols; i++)
+      {
+         y_data[i] = (beta == 0.0) ? 0.0 : beta * y_data[i];
+      }
+   }
+
+   if (alpha == 0.0)
+   {
+      return ierr;
+   }
+
+   /* y += alpha * A^T * x */
+   num_threads = hypre_NumThreads();
+   if (num_threads > 1)
+   {
+      y_data_expand = hypre_CTAlloc(HYPRE_Complex, num_threads * y_size, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel private(i, jj, j, my_thread_num, offset)
+#endif
+      {
+         my_thread_num = hypre_GetThreadNum();
+         offset        = y_size * my_thread_num;
+
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < num_rows; i++)
+         {
+            for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+            {
+               y_data_expand[offset + A_j[jj]] += A_data[jj] * x_data[i];
+            }
+         }
+
+         /* implied barrier (for threads) */
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < y_size; i++)
+         {
+            for (j = 0; j < num_threads; j++)
+            {
+               y_data[i] += alpha * y_data_expand[j * y_size + i];
+            }
+         }
+      }
+
+      hypre_TFree(y_data_expand, HYPRE_MEMORY_HOST);
+   }
+   else
+   {
+      for (i = 0; i < num_rows; i++)
+      {
+         const HYPRE_Complex ax = alpha * x_data[i];
+
+         for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+         {
+            y_data[A_j[jj]] += A_data[jj] * ax;
+         }
+      }
+   }
+
+   return ierr;
+}
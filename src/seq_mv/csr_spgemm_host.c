@@ -0,0 +1,286 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Host sparse matrix-matrix product C = A * B split into a symbolic phase,
+ * which computes the sparsity pattern of C, and a numeric phase, which only
+ * computes the values of C. The numeric phase can be repeated for as long as
+ * the patterns of A and B do not change.
+ *
+ *****************************************************************************/
+
+#include "seq_mv.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMultiplyHostSymbolic
+ *
+ * Returns a matrix C with the sparsity pattern of A * B. The values of C are
+ * allocated but not set; use hypre_CSRMatrixMultiplyHostNumeric for that.
+ *
+ * If diag_first is set, the diagonal entry of each row i < ncols_B is
+ * stored first (as hypre_CSRMatrixMultiplyHost does for square products).
+ *--------------------------------------------------------------------------*/
+
+hypre_CSRMatrix*
+hypre_CSRMatrixMultiplyHostSymbolic( hypre_CSRMatrix *A,
+                                     hypre_CSRMatrix *B,
+                                     HYPRE_Int        diag_first )
+{
+   HYPRE_Int            *A_i       = hypre_CSRMatrixI(A);
+   HYPRE_Int            *A_j       = hypre_CSRMatrixJ(A);
+   HYPRE_Int             nrows_A   = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int             ncols_A   = hypre_CSRMatrixNumCols(A);
+
+   HYPRE_Int            *B_i       = hypre_CSRMatrixI(B);
+   HYPRE_Int            *B_j       = hypre_CSRMatrixJ(B);
+   HYPRE_Int             nrows_B   = hypre_CSRMatrixNumRows(B);
+   HYPRE_Int             ncols_B   = hypre_CSRMatrixNumCols(B);
+
+   hypre_CSRMatrix      *C;
+   HYPRE_Int            *C_i;
+   HYPRE_Int            *C_j;
+   HYPRE_Int             i;
+
+   if (ncols_A != nrows_B)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Warning! incompatible matrix dimensions!\n");
+      return NULL;
+   }
+
+   C_i = hypre_CTAlloc(HYPRE_Int, nrows_A + 1, HYPRE_MEMORY_HOST);
+
+   /* First pass: compute sizes of C rows */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel
+#endif
+   {
+      HYPRE_Int  *B_marker;
+      HYPRE_Int   ns, ne, ia, ib, ja, jb, ic, cnt;
+
+      hypre_partition1D(nrows_A, hypre_NumActiveThreads(), hypre_GetThreadNum(), &ns, &ne);
+
+      B_marker = hypre_TAlloc(HYPRE_Int, ncols_B, HYPRE_MEMORY_HOST);
+      for (ib = 0; ib < ncols_B; ib++)
+      {
+         B_marker[ib] = -1;
+      }
+
+      for (ic = ns; ic < ne; ic++)
+      {
+         cnt = 0;
+         if (diag_first && ic < ncols_B)
+         {
+            B_marker[ic] = ic;
+            cnt++;
+         }
+
+         for (ia = A_i[ic]; ia < A_i[ic + 1]; ia++)
+         {
+            ja = A_j[ia];
+            for (ib = B_i[ja]; ib < B_i[ja + 1]; ib++)
+            {
+               jb = B_j[ib];
+               if (B_marker[jb] != ic)
+               {
+                  B_marker[jb] = ic;
+                  cnt++;
+               }
+            }
+         }
+         C_i[ic + 1] = cnt;
+      }
+
+      hypre_TFree(B_marker, HYPRE_MEMORY_HOST);
+   }
+
+   for (i = 0; i < nrows_A; i++)
+   {
+      C_i[i + 1] += C_i[i];
+   }
+
+   C = hypre_CSRMatrixCreate(nrows_A, ncols_B, C_i[nrows_A]);
+   hypre_CSRMatrixI(C) = C_i;
+   hypre_CSRMatrixInitialize_v2(C, 0, HYPRE_MEMORY_HOST);
+   C_j = hypre_CSRMatrixJ(C);
+
+   /* Second pass: fill in C_j */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel
+#endif
+   {
+      HYPRE_Int  *B_marker;
+      HYPRE_Int   ns, ne, ia, ib, ja, jb, ic, cnt;
+
+      hypre_partition1D(nrows_A, hypre_NumActiveThreads(), hypre_GetThreadNum(), &ns, &ne);
+
+      B_marker = hypre_TAlloc(HYPRE_Int, ncols_B, HYPRE_MEMORY_HOST);
+      for (ib = 0; ib < ncols_B; ib++)
+      {
+         B_marker[ib] = -1;
+      }
+
+      for (ic = ns; ic < ne; ic++)
+      {
+         cnt = C_i[ic];
+         if (diag_first && ic < ncols_B)
+         {
+            B_marker[ic] = ic;
+            C_j[cnt++] = ic;
+         }
+
+         for (ia = A_i[ic]; ia < A_i[ic + 1]; ia++)
+         {
+            ja = A_j[ia];
+            for (ib = B_i[ja]; ib < B_i[ja + 1]; ib++)
+            {
+               jb = B_j[ib];
+               if (B_marker[jb] != ic)
+               {
+                  B_marker[jb] = ic;
+                  C_j[cnt++] = jb;
+               }
+            }
+         }
+         hypre_assert(cnt == C_i[ic + 1]);
+      }
+
+      hypre_TFree(B_marker, HYPRE_MEMORY_HOST);
+   }
+
+   hypre_CSRMatrixSetRownnz(C);
+
+   return C;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMultiplyHostNumeric
+ *
+ * Computes the values of C = A * B, where C carries the pattern returned by
+ * hypre_CSRMatrixMultiplyHostSymbolic for matrices with the same patterns as
+ * A and B. Each thread accumulates its rows through a small open-addressing
+ * hash table mapping the columns of a row of C to their positions, so the
+ * work space does not grow with the number of columns of B. Products that
+ * fall outside the pattern of C are dropped and reported as an error.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMultiplyHostNumeric( hypre_CSRMatrix *A,
+                                    hypre_CSRMatrix *B,
+                                    hypre_CSRMatrix *C )
+{
+   HYPRE_Complex        *A_data    = hypre_CSRMatrixData(A);
+   HYPRE_Int            *A_i       = hypre_CSRMatrixI(A);
+   HYPRE_Int            *A_j       = hypre_CSRMatrixJ(A);
+   HYPRE_Int             nrows_A   = hypre_CSRMatrixNumRows(A);
+
+   HYPRE_Complex        *B_data    = hypre_CSRMatrixData(B);
+   HYPRE_Int            *B_i       = hypre_CSRMatrixI(B);
+   HYPRE_Int            *B_j       = hypre_CSRMatrixJ(B);
+
+   HYPRE_Complex        *C_data    = hypre_CSRMatrixData(C);
+   HYPRE_Int            *C_i       = hypre_CSRMatrixI(C);
+   HYPRE_Int            *C_j       = hypre_CSRMatrixJ(C);
+   HYPRE_Int             num_missing = 0;
+
+   if (hypre_CSRMatrixNumRows(C) != nrows_A ||
+       hypre_CSRMatrixNumCols(C) != hypre_CSRMatrixNumCols(B))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Warning! incompatible matrix dimensions!\n");
+      return hypre_error_flag;
+   }
+
+   if (hypre_CSRMatrixNumNonzeros(C) == 0)
+   {
+      return hypre_error_flag;
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel reduction(+:num_missing)
+#endif
+   {
+      HYPRE_Int     *ht_row, *ht_key, *ht_pos;
+      HYPRE_Int      ns, ne, ia, ib, ja, jb, ic, k, h;
+      HYPRE_Int      ht_size, ht_mask, max_row;
+      HYPRE_Complex  a_entry;
+
+      hypre_partition1D(nrows_A, hypre_NumActiveThreads(), hypre_GetThreadNum(), &ns, &ne);
+
+      /* Table size: power of two of at least twice the longest row */
+      max_row = 0;
+      for (ic = ns; ic < ne; ic++)
+      {
+         max_row = hypre_max(max_row, C_i[ic + 1] - C_i[ic]);
+      }
+      ht_size = 16;
+      while (ht_size < 2 * max_row)
+      {
+         ht_size *= 2;
+      }
+      ht_mask = ht_size - 1;
+
+      ht_row = hypre_TAlloc(HYPRE_Int, ht_size, HYPRE_MEMORY_HOST);
+      ht_key = hypre_TAlloc(HYPRE_Int, ht_size, HYPRE_MEMORY_HOST);
+      ht_pos = hypre_TAlloc(HYPRE_Int, ht_size, HYPRE_MEMORY_HOST);
+      for (h = 0; h < ht_size; h++)
+      {
+         ht_row[h] = -1;
+      }
+
+      for (ic = ns; ic < ne; ic++)
+      {
+         /* Insert the columns of row ic of C; slots tagged with an older
+            row are free, so the table never needs to be cleared */
+         for (k = C_i[ic]; k < C_i[ic + 1]; k++)
+         {
+            h = C_j[k] & ht_mask;
+            while (ht_row[h] == ic)
+            {
+               h = (h + 1) & ht_mask;
+            }
+            ht_row[h] = ic;
+            ht_key[h] = C_j[k];
+            ht_pos[h] = k;
+            C_data[k] = 0.0;
+         }
+
+         for (ia = A_i[ic]; ia < A_i[ic + 1]; ia++)
+         {
+            ja = A_j[ia];
+            a_entry = A_data[ia];
+            for (ib = B_i[ja]; ib < B_i[ja + 1]; ib++)
+            {
+               jb = B_j[ib];
+               h  = jb & ht_mask;
+               while (ht_row[h] == ic && ht_key[h] != jb)
+               {
+                  h = (h + 1) & ht_mask;
+               }
+
+               /* A free slot ends the probe: jb is not in the pattern of C */
+               if (ht_row[h] != ic)
+               {
+                  num_missing++;
+                  continue;
+               }
+               C_data[ht_pos[h]] += a_entry * B_data[ib];
+            }
+         }
+      }
+
+      hypre_TFree(ht_row, HYPRE_MEMORY_HOST);
+      hypre_TFree(ht_key, HYPRE_MEMORY_HOST);
+      hypre_TFree(ht_pos, HYPRE_MEMORY_HOST);
+   }
+
+   if (num_missing)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Pattern of C does not contain A * B!\n");
+   }
+
+   return hypre_error_flag;
+}
@@ -112,6 +112,7 @@ HYPRE_Int hypre_CSRMatrixILU0(hypre_CSRMatrix *A);
 hypre_CSRMatrix *hypre_CSRMatrixCreate ( HYPRE_Int num_rows, HYPRE_Int num_cols,
                                          HYPRE_Int num_nonzeros );
 HYPRE_Int hypre_CSRMatrixDestroy ( hypre_CSRMatrix *matrix );
+size_t hypre_CSRMatrixMemorySize ( hypre_CSRMatrix *A );
 HYPRE_Int hypre_CSRMatrixInitialize_v2( hypre_CSRMatrix *matrix, HYPRE_Int bigInit,
                                         HYPRE_MemoryLocation memory_location );
 HYPRE_Int hypre_CSRMatrixInitialize ( hypre_CSRMatrix *matrix );
@@ -158,6 +159,27 @@ HYPRE_Int hypre_CSRMatrixMatvec_FF ( HYPRE_Complex alpha, hypre_CSRMatrix *A, hy
                                      HYPRE_Complex beta, hypre_Vector *y, HYPRE_Int *CF_marker_x, HYPRE_Int *CF_marker_y,
                                      HYPRE_Int fpt );
 
+/* csr_matvec_sell.c */
+hypre_CSRSellData *hypre_CSRSellDataCreate ( hypre_CSRMatrix *A, HYPRE_Int sigma );
+HYPRE_Int hypre_CSRSellDataDestroy ( hypre_CSRSellData *sell );
+HYPRE_Int hypre_CSRMatrixSetMatvecFormat ( hypre_CSRMatrix *A, HYPRE_Int format );
+HYPRE_Int hypre_CSRMatrixRefreshMatvecFormat ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixMatvecSellHost ( HYPRE_Complex alpha, hypre_CSRMatrix *A,
+                                          hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *b, hypre_Vector *y );
+
+/* csr_matvec_single.c */
+HYPRE_Int hypre_CSRMatrixSetSinglePrecision ( hypre_CSRMatrix *A, HYPRE_Int single_precision );
+HYPRE_Int hypre_CSRMatrixMatvecSingleHost ( HYPRE_Complex alpha, hypre_CSRMatrix *A,
+                                            hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *b, hypre_Vector *y );
+HYPRE_Int hypre_CSRMatrixMatvecTSingleHost ( HYPRE_Complex alpha, hypre_CSRMatrix *A,
+                                             hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *y );
+
+/* csr_spgemm_host.c */
+hypre_CSRMatrix *hypre_CSRMatrixMultiplyHostSymbolic ( hypre_CSRMatrix *A, hypre_CSRMatrix *B,
+                                                       HYPRE_Int diag_first );
+HYPRE_Int hypre_CSRMatrixMultiplyHostNumeric ( hypre_CSRMatrix *A, hypre_CSRMatrix *B,
+                                               hypre_CSRMatrix *C );
+
 /* csr_matvec_device.c */
 HYPRE_Int hypre_CSRMatrixMatvecDevice(HYPRE_Int trans, HYPRE_Complex alpha, hypre_CSRMatrix *A,
                                       hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *b, hypre_Vector *y, HYPRE_Int offset );
@@ -253,6 +275,7 @@ HYPRE_Int hypre_MultiblockMatrixSetSubmatrix ( hypre_MultiblockMatrix *matrix, H
 hypre_Vector *hypre_SeqVectorCreate ( HYPRE_Int size );
 hypre_Vector *hypre_SeqMultiVectorCreate ( HYPRE_Int size, HYPRE_Int num_vectors );
 HYPRE_Int hypre_SeqVectorDestroy ( hypre_Vector *vector );
+size_t hypre_SeqVectorMemorySize ( hypre_Vector *vector );
 HYPRE_Int hypre_SeqVectorInitialize_v2( hypre_Vector *vector,
                                         HYPRE_MemoryLocation memory_location );
 HYPRE_Int hypre_SeqVectorInitialize ( hypre_Vector *vector );
@@ -46,6 +46,43 @@ struct hypre_GpuMatData;
 typedef struct hypre_GpuMatData hypre_GpuMatData;
 #endif
 
+/*--------------------------------------------------------------------------
+ * SELL-C-sigma (sliced ELLPACK) copy of a CSR matrix
+ *
+ * Rows are sorted by decreasing length inside windows of sigma rows and
+ * grouped into slices of HYPRE_SELL_CHUNK_SIZE rows. Each slice is padded to
+ * the length of its longest row and stored column-major, so that the inner
+ * loop of the matvec runs over HYPRE_SELL_CHUNK_SIZE consecutive entries.
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_SELL_CHUNK_SIZE 8
+#define HYPRE_SELL_SIGMA      256
+
+/* Host matvec kernels available for a hypre_CSRMatrix */
+#define HYPRE_CSR_MATVEC_FORMAT_CSR  0
+#define HYPRE_CSR_MATVEC_FORMAT_SELL 1
+
+typedef struct
+{
+   HYPRE_Int       num_rows;
+   HYPRE_Int       num_slices;
+   HYPRE_Int       sigma;
+   HYPRE_Int      *slice_ptr;  /* offsets of the slices in j/data (num_slices + 1) */
+   HYPRE_Int      *slice_len;  /* padded row length of each slice */
+   HYPRE_Int      *perm;       /* original row index of each slice row, -1 for padding */
+   HYPRE_Int      *j;
+   HYPRE_Complex  *data;
+} hypre_CSRSellData;
+
+#define hypre_CSRSellDataNumRows(sell)    ((sell) -> num_rows)
+#define hypre_CSRSellDataNumSlices(sell)  ((sell) -> num_slices)
+#define hypre_CSRSellDataSigma(sell)      ((sell) -> sigma)
+#define hypre_CSRSellDataSlicePtr(sell)   ((sell) -> slice_ptr)
+#define hypre_CSRSellDataSliceLen(sell)   ((sell) -> slice_len)
+#define hypre_CSRSellDataPerm(sell)       ((sell) -> perm)
+#define hypre_CSRSellDataJ(sell)          ((sell) -> j)
+#define hypre_CSRSellDataData(sell)       ((sell) -> data)
+
 /*--------------------------------------------------------------------------
  * CSR Matrix
  *--------------------------------------------------------------------------*/
@@ -66,6 +103,10 @@ typedef struct
    HYPRE_Int            *rownnz;          /* for compressing rows in matrix multiplication  */
    HYPRE_Int             num_rownnz;
    HYPRE_MemoryLocation  memory_location; /* memory location of arrays i, j, data */
+   HYPRE_Int             matvec_format;   /* host matvec kernel, see HYPRE_CSR_MATVEC_FORMAT_* */
+   hypre_CSRSellData    *sell_data;       /* SELL-C-sigma copy, built on first use */
+   hypre_float          *data_single;     /* single-precision copy of data used by host
+                                             matvecs and smoothers, if requested */
 
 #if defined(HYPRE_USING_CUSPARSE)  ||\
     defined(HYPRE_USING_ROCSPARSE) ||\
@@ -93,6 +134,9 @@ typedef struct
 #define hypre_CSRMatrixOwnsData(matrix)             ((matrix) -> owns_data)
 #define hypre_CSRMatrixPatternOnly(matrix)          ((matrix) -> pattern_only)
 #define hypre_CSRMatrixMemoryLocation(matrix)       ((matrix) -> memory_location)
+#define hypre_CSRMatrixMatvecFormat(matrix)         ((matrix) -> matvec_format)
+#define hypre_CSRMatrixSellData(matrix)             ((matrix) -> sell_data)
+#define hypre_CSRMatrixDataSingle(matrix)           ((matrix) -> data_single)
 
 #if defined(HYPRE_USING_CUSPARSE)  ||\
     defined(HYPRE_USING_ROCSPARSE) ||\
@@ -388,6 +432,7 @@ HYPRE_Int hypre_CSRMatrixILU0(hypre_CSRMatrix *A);
 hypre_CSRMatrix *hypre_CSRMatrixCreate ( HYPRE_Int num_rows, HYPRE_Int num_cols,
                                          HYPRE_Int num_nonzeros );
 HYPRE_Int hypre_CSRMatrixDestroy ( hypre_CSRMatrix *matrix );
+size_t hypre_CSRMatrixMemorySize ( hypre_CSRMatrix *A );
 HYPRE_Int hypre_CSRMatrixInitialize_v2( hypre_CSRMatrix *matrix, HYPRE_Int bigInit,
                                         HYPRE_MemoryLocation memory_location );
 HYPRE_Int hypre_CSRMatrixInitialize ( hypre_CSRMatrix *matrix );
@@ -434,6 +479,27 @@ HYPRE_Int hypre_CSRMatrixMatvec_FF ( HYPRE_Complex alpha, hypre_CSRMatrix *A, hy
                                      HYPRE_Complex beta, hypre_Vector *y, HYPRE_Int *CF_marker_x, HYPRE_Int *CF_marker_y,
                                      HYPRE_Int fpt );
 
+/* csr_matvec_sell.c */
+hypre_CSRSellData *hypre_CSRSellDataCreate ( hypre_CSRMatrix *A, HYPRE_Int sigma );
+HYPRE_Int hypre_CSRSellDataDestroy ( hypre_CSRSellData *sell );
+HYPRE_Int hypre_CSRMatrixSetMatvecFormat ( hypre_CSRMatrix *A, HYPRE_Int format );
+HYPRE_Int hypre_CSRMatrixRefreshMatvecFormat ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixMatvecSellHost ( HYPRE_Complex alpha, hypre_CSRMatrix *A,
+                                          hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *b, hypre_Vector *y );
+
+/* csr_matvec_single.c */
+HYPRE_Int hypre_CSRMatrixSetSinglePrecision ( hypre_CSRMatrix *A, HYPRE_Int single_precision );
+HYPRE_Int hypre_CSRMatrixMatvecSingleHost ( HYPRE_Complex alpha, hypre_CSRMatrix *A,
+                                            hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *b, hypre_Vector *y );
+HYPRE_Int hypre_CSRMatrixMatvecTSingleHost ( HYPRE_Complex alpha, hypre_CSRMatrix *A,
+                                             hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *y );
+
+/* csr_spgemm_host.c */
+hypre_CSRMatrix *hypre_CSRMatrixMultiplyHostSymbolic ( hypre_CSRMatrix *A, hypre_CSRMatrix *B,
+                                                       HYPRE_Int diag_first );
+HYPRE_Int hypre_CSRMatrixMultiplyHostNumeric ( hypre_CSRMatrix *A, hypre_CSRMatrix *B,
+                                               hypre_CSRMatrix *C );
+
 /* csr_matvec_device.c */
 HYPRE_Int hypre_CSRMatrixMatvecDevice(HYPRE_Int trans, HYPRE_Complex alpha, hypre_CSRMatrix *A,
                                       hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *b, hypre_Vector *y, HYPRE_Int offset );
@@ -529,6 +595,7 @@ HYPRE_Int hypre_MultiblockMatrixSetSubmatrix ( hypre_MultiblockMatrix *matrix, H
 hypre_Vector *hypre_SeqVectorCreate ( HYPRE_Int size );
 hypre_Vector *hypre_SeqMultiVectorCreate ( HYPRE_Int size, HYPRE_Int num_vectors );
 HYPRE_Int hypre_SeqVectorDestroy ( hypre_Vector *vector );
+size_t hypre_SeqVectorMemorySize ( hypre_Vector *vector );
 HYPRE_Int hypre_SeqVectorInitialize_v2( hypre_Vector *vector,
                                         HYPRE_MemoryLocation memory_location );
 HYPRE_Int hypre_SeqVectorInitialize ( hypre_Vector *vector );
@@ -73,6 +73,32 @@ hypre_SeqVectorDestroy( hypre_Vector *vector )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_SeqVectorMemorySize
+ *
+ * Returns the number of bytes held by the vector and the data it owns.
+ *--------------------------------------------------------------------------*/
+
+size_t
+hypre_SeqVectorMemorySize( hypre_Vector *vector )
+{
+   size_t bytes;
+
+   if (!vector)
+   {
+      return 0;
+   }
+
+   bytes = sizeof(hypre_Vector);
+   if (hypre_VectorOwnsData(vector) && hypre_VectorData(vector))
+   {
+      bytes += (size_t) hypre_VectorSize(vector) * hypre_VectorNumVectors(vector) *
+               sizeof(HYPRE_Complex);
+   }
+
+   return bytes;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_SeqVectorInitialize_v2
  *
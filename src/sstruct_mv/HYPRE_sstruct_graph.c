@@ -420,6 +420,7 @@ HYPRE_SStructGraphAssemble( HYPRE_SStructGraph graph )
                                hypre_StructGridNDim(sgrid), bbox,
                                hypre_StructGridComm(sgrid),
                                &new_managers[part][var]);
+            hypre_BoxManSetIndexType(new_managers[part][var], hypre_BoxManIndexType(orig_boxman));
             /* create gather box with flipped bounding box extents */
             new_gboxes[part][var] = hypre_BoxCreate(ndim);
             hypre_BoxSetExtents(new_gboxes[part][var],
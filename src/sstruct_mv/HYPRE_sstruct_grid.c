@@ -87,6 +87,8 @@ HYPRE_SStructGridCreate( MPI_Comm           comm,
    }
    hypre_SStructGridSetNumGhost(grid, num_ghost);
 
+   hypre_SStructGridBoxManIndexType(grid) = hypre_BOXMAN_INDEX_TABLE;
+
    *grid_ptr = grid;
 
    return hypre_error_flag;
@@ -886,3 +888,21 @@ HYPRE_SStructGridSetNumGhost( HYPRE_SStructGrid grid,
 
    return hypre_error_flag;
 }
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SStructGridSetBoxManIndexType( HYPRE_SStructGrid grid,
+                                     HYPRE_Int         index_type )
+{
+   if (index_type != hypre_BOXMAN_INDEX_TABLE && index_type != hypre_BOXMAN_INDEX_BVH)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_SStructGridSetBoxManIndexType(grid, index_type);
+
+   return hypre_error_flag;
+}
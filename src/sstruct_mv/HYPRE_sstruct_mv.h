@@ -326,6 +326,20 @@ HYPRE_Int
 HYPRE_SStructGridSetNumGhost(HYPRE_SStructGrid  grid,
                              HYPRE_Int         *num_ghost);
 
+/**
+ * (Optional) Set the spatial index used to find the boxes intersecting a
+ * region, which is used heavily when assembling graphs and matrices.
+ * Choices are 0 for a dense table over the box extents (default), and 1 for a
+ * bounding volume hierarchy. The table is fastest for grids with few boxes,
+ * but its size grows as the product of the number of distinct box extents in
+ * each dimension; the hierarchy needs storage linear in the number of boxes
+ * and is preferable for grids with many small, irregular boxes (e.g., AMR).
+ * Must be called before \Ref{HYPRE_SStructGridAssemble}.
+ **/
+HYPRE_Int
+HYPRE_SStructGridSetBoxManIndexType(HYPRE_SStructGrid  grid,
+                                    HYPRE_Int          index_type);
+
 /**@}*/
 
 /*--------------------------------------------------------------------------
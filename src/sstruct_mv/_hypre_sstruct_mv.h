@@ -181,6 +181,8 @@ typedef struct hypre_SStructGrid_struct
    HYPRE_BigInt            ghstart_rank;  /* GEC0902 start rank including ghosts  */
    HYPRE_Int               num_ghost[2 * HYPRE_MAXDIM]; /* ghost layer size */
 
+   HYPRE_Int               boxman_index_type; /* spatial index of the box managers */
+
 } hypre_SStructGrid;
 
 /*--------------------------------------------------------------------------
@@ -223,6 +225,7 @@ typedef struct hypre_SStructGrid_struct
 #define hypre_SStructGridGhlocalSize(grid)    ((grid) -> ghlocal_size)
 #define hypre_SStructGridGhstartRank(grid)    ((grid) -> ghstart_rank)
 #define hypre_SStructGridNumGhost(grid)       ((grid) -> num_ghost)
+#define hypre_SStructGridBoxManIndexType(grid) ((grid) -> boxman_index_type)
 
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_SStructPGrid
@@ -829,6 +832,7 @@ HYPRE_Int HYPRE_SStructGridAssemble ( HYPRE_SStructGrid grid );
 HYPRE_Int HYPRE_SStructGridSetPeriodic ( HYPRE_SStructGrid grid, HYPRE_Int part,
                                          HYPRE_Int *periodic );
 HYPRE_Int HYPRE_SStructGridSetNumGhost ( HYPRE_SStructGrid grid, HYPRE_Int *num_ghost );
+HYPRE_Int HYPRE_SStructGridSetBoxManIndexType ( HYPRE_SStructGrid grid, HYPRE_Int index_type );
 
 /* HYPRE_sstruct_matrix.c */
 HYPRE_Int HYPRE_SStructMatrixCreate ( MPI_Comm comm, HYPRE_SStructGraph graph,
@@ -980,6 +984,7 @@ HYPRE_Int hypre_SStructNborBoxToBox ( hypre_Box *nbor_box, hypre_Index root, hyp
 HYPRE_Int hypre_SStructVarToNborVar ( hypre_SStructGrid *grid, HYPRE_Int part, HYPRE_Int var,
                                       HYPRE_Int *coord, HYPRE_Int *nbor_var_ptr );
 HYPRE_Int hypre_SStructGridSetNumGhost ( hypre_SStructGrid *grid, HYPRE_Int *num_ghost );
+HYPRE_Int hypre_SStructGridSetBoxManIndexType ( hypre_SStructGrid *grid, HYPRE_Int index_type );
 HYPRE_Int hypre_SStructBoxManEntryGetGlobalRank ( hypre_BoxManEntry *entry, hypre_Index index,
                                                   HYPRE_BigInt *rank_ptr, HYPRE_Int type );
 HYPRE_Int hypre_SStructBoxManEntryGetStrides ( hypre_BoxManEntry *entry, hypre_Index strides,
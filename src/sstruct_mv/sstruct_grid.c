@@ -291,6 +291,7 @@ hypre_SStructPGridAssemble( hypre_SStructPGrid  *pgrid )
       {
          HYPRE_StructGridCreate(comm, ndim, &sgrid);
          hypre_StructGridSetNumGhost(sgrid, hypre_StructGridNumGhost(cell_sgrid));
+         hypre_StructGridSetBoxManIndexType(sgrid, hypre_StructGridBoxManIndexType(cell_sgrid));
          boxes = hypre_BoxArrayCreate(0, ndim);
          hypre_SStructVariableGetOffset((hypre_SStructVariable) t,
                                         ndim, varoffset);
@@ -556,6 +557,7 @@ hypre_SStructGridAssembleBoxManagers( hypre_SStructGrid *grid )
             hypre_BoxManNumMyEntries(hypre_StructGridBoxMan(sgrid)),
             info_size, hypre_StructGridNDim(sgrid), bounding_box,
             hypre_StructGridComm(sgrid), &managers[part][var]);
+         hypre_BoxManSetIndexType(managers[part][var], hypre_SStructGridBoxManIndexType(grid));
 
          /* each sgrid has num_ghost */
 
@@ -838,6 +840,7 @@ hypre_SStructGridAssembleNborBoxManagers( hypre_SStructGrid *grid )
                             hypre_StructGridBoundingBox(sgrid),
                             hypre_StructGridComm(sgrid),
                             &nbor_managers[part][var]);
+         hypre_BoxManSetIndexType(nbor_managers[part][var], hypre_SStructGridBoxManIndexType(grid));
 
          /* Compute entries and add to the neighbor box manager */
          for (b = 0; b < nvneighbors[part][var]; b++)
@@ -1965,6 +1968,38 @@ hypre_SStructGridSetNumGhost( hypre_SStructGrid  *grid, HYPRE_Int *num_ghost )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Sets the spatial index used by the box managers of the grid and of its
+ * sgrids (see hypre_BoxManSetIndexType). Must be called before the assemble.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructGridSetBoxManIndexType( hypre_SStructGrid *grid, HYPRE_Int index_type )
+{
+   HYPRE_Int             nparts = hypre_SStructGridNParts(grid);
+   HYPRE_Int             part, t;
+   hypre_SStructPGrid   *pgrid;
+   hypre_StructGrid     *sgrid;
+
+   hypre_SStructGridBoxManIndexType(grid) = index_type;
+
+   for (part = 0; part < nparts; part++)
+   {
+      pgrid = hypre_SStructGridPGrid(grid, part);
+
+      for (t = 0; t < 8; t++)
+      {
+         sgrid = hypre_SStructPGridVTSGrid(pgrid, t);
+         if (sgrid != NULL)
+         {
+            hypre_StructGridSetBoxManIndexType(sgrid, index_type);
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * GEC1002 a function that will select the right way to calculate the rank
  * depending on the matrix type. It is an extension to the usual GetGlobalRank
@@ -161,6 +161,8 @@ typedef struct hypre_SStructGrid_struct
    HYPRE_BigInt            ghstart_rank;  /* GEC0902 start rank including ghosts  */
    HYPRE_Int               num_ghost[2 * HYPRE_MAXDIM]; /* ghost layer size */
 
+   HYPRE_Int               boxman_index_type; /* spatial index of the box managers */
+
 } hypre_SStructGrid;
 
 /*--------------------------------------------------------------------------
@@ -203,6 +205,7 @@ typedef struct hypre_SStructGrid_struct
 #define hypre_SStructGridGhlocalSize(grid)    ((grid) -> ghlocal_size)
 #define hypre_SStructGridGhstartRank(grid)    ((grid) -> ghstart_rank)
 #define hypre_SStructGridNumGhost(grid)       ((grid) -> num_ghost)
+#define hypre_SStructGridBoxManIndexType(grid) ((grid) -> boxman_index_type)
 
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_SStructPGrid
@@ -253,6 +253,8 @@ hypre_StructCoarsen( hypre_StructGrid  *fgrid,
    max_nentries =  hypre_BoxManMaxNEntries(fboxman);
    hypre_BoxManCreate(max_nentries, info_size, ndim, bounding_box,
                       comm, &cboxman);
+   hypre_BoxManSetIndexType(cboxman, hypre_BoxManIndexType(fboxman));
+   hypre_StructGridSetBoxManIndexType(cgrid, hypre_StructGridBoxManIndexType(fgrid));
 
    hypre_BoxDestroy(bounding_box);
 
@@ -501,6 +501,30 @@ typedef struct hypre_BoxManEntry_struct
 
 } hypre_BoxManEntry;
 
+/*--------------------------------------------------------------------------
+ * Spatial index used by BoxManIntersect. The index table is a dense table over
+ * the distinct box extents in each dimension, so its size is the product of
+ * their numbers. The bounding volume hierarchy (BVH) is a binary tree of
+ * bounding boxes with a few entries per leaf, which needs linear storage and
+ * answers queries in logarithmic time.
+ *--------------------------------------------------------------------------*/
+
+#define hypre_BOXMAN_INDEX_TABLE  0
+#define hypre_BOXMAN_INDEX_BVH    1
+
+/* max number of entries in a BVH leaf */
+#define hypre_BOXMAN_BVH_LEAF_SIZE  4
+
+typedef struct
+{
+   hypre_Index imin;  /* Bounding box of the entries below this node */
+   hypre_Index imax;
+   HYPRE_Int   child; /* First of two consecutive children, -1 for a leaf */
+   HYPRE_Int   start; /* Leaf entries are bvh_order[start, start + count) */
+   HYPRE_Int   count;
+
+} hypre_BoxManBVHNode;
+
 /*---------------------------------------------------------------------------
  * Box Manager: organizes arbitrary information in a spatial way
  *----------------------------------------------------------------------------*/
@@ -570,6 +594,12 @@ typedef struct
    HYPRE_Int           last_index[HYPRE_MAXDIM]; /* Last index used in the
                                                     indexes map */
 
+   HYPRE_Int           index_type; /* hypre_BOXMAN_INDEX_TABLE (default) or
+                                      hypre_BOXMAN_INDEX_BVH */
+   HYPRE_Int           bvh_num_nodes;
+   hypre_BoxManBVHNode *bvh_nodes; /* Nodes of the BVH, the root first */
+   HYPRE_Int          *bvh_order; /* Positions in 'entries' grouped by leaf */
+
    HYPRE_Int           num_my_entries; /* Num entries with proc_id = myid */
    HYPRE_Int          *my_ids; /* Array of ids corresponding to my entries */
    hypre_BoxManEntry **my_entries; /* Points into entries that are mine and
@@ -626,6 +656,11 @@ typedef struct
 #define hypre_BoxManSize(manager)               ((manager) -> size)
 #define hypre_BoxManLastIndex(manager)          ((manager) -> last_index)
 
+#define hypre_BoxManIndexType(manager)          ((manager) -> index_type)
+#define hypre_BoxManBVHNumNodes(manager)        ((manager) -> bvh_num_nodes)
+#define hypre_BoxManBVHNodes(manager)           ((manager) -> bvh_nodes)
+#define hypre_BoxManBVHOrder(manager)           ((manager) -> bvh_order)
+
 #define hypre_BoxManNumMyEntries(manager)       ((manager) -> num_my_entries)
 #define hypre_BoxManMyIds(manager)              ((manager) -> my_ids)
 #define hypre_BoxManMyEntries(manager)          ((manager) -> my_entries)
@@ -707,6 +742,7 @@ typedef struct hypre_StructGrid_struct
    HYPRE_Int            num_ghost[2 * HYPRE_MAXDIM]; /* ghost layer size */
 
    hypre_BoxManager    *boxman;
+   HYPRE_Int            boxman_index_type; /* Spatial index of the box manager */
 } hypre_StructGrid;
 
 /*--------------------------------------------------------------------------
@@ -729,6 +765,7 @@ typedef struct hypre_StructGrid_struct
 #define hypre_StructGridGhlocalSize(grid)   ((grid) -> ghlocal_size)
 #define hypre_StructGridNumGhost(grid)      ((grid) -> num_ghost)
 #define hypre_StructGridBoxMan(grid)        ((grid) -> boxman)
+#define hypre_StructGridBoxManIndexType(grid) ((grid) -> boxman_index_type)
 
 #define hypre_StructGridBox(grid, i)        (hypre_BoxArrayBox(hypre_StructGridBoxes(grid), i))
 #define hypre_StructGridNumBoxes(grid)      (hypre_BoxArraySize(hypre_StructGridBoxes(grid)))
@@ -1424,6 +1461,8 @@ HYPRE_Int hypre_BoxManSetAssumedPartition ( hypre_BoxManager *manager,
                                             hypre_StructAssumedPart *assumed_partition );
 HYPRE_Int hypre_BoxManSetBoundingBox ( hypre_BoxManager *manager, hypre_Box *bounding_box );
 HYPRE_Int hypre_BoxManSetNumGhost ( hypre_BoxManager *manager, HYPRE_Int *num_ghost );
+HYPRE_Int hypre_BoxManSetIndexType ( hypre_BoxManager *manager, HYPRE_Int index_type );
+HYPRE_Int hypre_BoxManGetIndexType ( hypre_BoxManager *manager, HYPRE_Int *index_type );
 HYPRE_Int hypre_BoxManDeleteMultipleEntriesAndInfo ( hypre_BoxManager *manager, HYPRE_Int *indices,
                                                      HYPRE_Int num );
 HYPRE_Int hypre_BoxManCreate ( HYPRE_Int max_nentries, HYPRE_Int info_size, HYPRE_Int dim,
@@ -1628,6 +1667,7 @@ HYPRE_Int hypre_ComputeBoxnums ( hypre_BoxArray *boxes, HYPRE_Int *procs, HYPRE_
 HYPRE_Int hypre_StructGridPrint ( FILE *file, hypre_StructGrid *grid );
 HYPRE_Int hypre_StructGridRead ( MPI_Comm comm, FILE *file, hypre_StructGrid **grid_ptr );
 HYPRE_Int hypre_StructGridSetNumGhost ( hypre_StructGrid *grid, HYPRE_Int *num_ghost );
+HYPRE_Int hypre_StructGridSetBoxManIndexType ( hypre_StructGrid *grid, HYPRE_Int index_type );
 HYPRE_Int hypre_StructGridGetMaxBoxSize ( hypre_StructGrid *grid );
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
 HYPRE_Int hypre_StructGridSetDataLocation( HYPRE_StructGrid grid,
@@ -2361,9 +2401,17 @@ hypre__J = hypre__thread;  i1 = i2 = 0; \
 #endif
 #define OMP0 Pragma(omp parallel for HYPRE_OMP_CLAUSE HYPRE_BOX_REDUCTION HYPRE_SMP_SCHEDULE)
 #define OMP1 Pragma(omp parallel for private(HYPRE_BOX_PRIVATE) HYPRE_OMP_CLAUSE HYPRE_BOX_REDUCTION HYPRE_SMP_SCHEDULE)
+#define OMP1UNIT Pragma(omp parallel for private(ZYPRE_BOX_UNIT_PRIVATE) HYPRE_OMP_CLAUSE HYPRE_BOX_REDUCTION HYPRE_SMP_SCHEDULE)
+#if (_OPENMP >= 201307) && !defined(HYPRE_USING_DEVICE_OPENMP)
+#define OMPSIMD Pragma(omp simd HYPRE_BOX_REDUCTION)
+#else
+#define OMPSIMD
+#endif
 #else /* #if defined(HYPRE_USING_OPENMP) */
 #define OMP0
 #define OMP1
+#define OMP1UNIT
+#define OMPSIMD
 #endif /* #if defined(HYPRE_USING_OPENMP) */
 
 #define zypre_BoxLoop0Begin(ndim, loop_size)                                  \
@@ -2593,6 +2641,208 @@ hypre__J = hypre__thread;  i1 = i2 = 0; \
    }                                                                          \
 }
 
+/*--------------------------------------------------------------------------
+ * Unit-stride BoxLoop macros:
+ * [same arguments as the ones above, for loops where all strides are one in
+ *  dimension 0]
+ *
+ * The index of each operand is computed from the start of its row, so the
+ * innermost loop carries no updates from one iteration to the next and is
+ * vectorized with 'omp simd' (which also gets the HYPRE_BOX_REDUCTION clause).
+ * The body must therefore not depend on earlier iterations of the same row,
+ * and hypre_BoxLoopGetIndex cannot be used.
+ *
+ * Rows are visited in tiles of hypre_HandleBoxTile rows of dimension 1 (see
+ * HYPRE_SetBoxLoopTile), sweeping all of dimension 2 before moving on to the
+ * next tile, so that neighboring planes of a stencil stay in cache.  Without
+ * tiling (the default), the rows are visited in the same order as in the
+ * loops above.
+ *--------------------------------------------------------------------------*/
+
+#define ZYPRE_BOX_UNIT_PRIVATE hypre__IN,hypre__JN,hypre__I,hypre__J
+
+#define zypre_BoxLoopUnitDeclare() \
+HYPRE_Int  hypre__tot, hypre__div, hypre__mod;\
+HYPRE_Int  hypre__block, hypre__num_blocks;\
+HYPRE_Int  hypre__d, hypre__ndim;\
+HYPRE_Int  hypre__I, hypre__J, hypre__IN, hypre__JN;\
+HYPRE_Int  hypre__n[HYPRE_MAXDIM+1];\
+HYPRE_Int  hypre__jn, hypre__kn, hypre__tile
+
+#define zypre_BoxLoopUnitDeclareK(k) \
+HYPRE_Int  hypre__ikstart##k, hypre__sk##k[HYPRE_MAXDIM]
+
+#define zypre_BoxLoopUnitInit() \
+hypre__jn = (hypre__ndim > 1) ? hypre__n[1] : 1;\
+hypre__kn = (hypre__ndim > 2) ? hypre__n[2] : 1;\
+hypre__tile = hypre_HandleBoxTile(hypre_handle());\
+if (hypre__tile <= 0 || hypre__tile > hypre__jn)\
+{\
+   hypre__tile = hypre__jn;\
+}
+
+#define zypre_BoxLoopUnitInitK(k, dboxk, startk, stridek) \
+hypre_assert(stridek[0] == 1);\
+hypre__sk##k[0] = stridek[0];\
+hypre__ikstart##k = hypre_BoxSizeD(dboxk, 0); /* temporarily use ikstart */\
+for (hypre__d = 1; hypre__d < hypre__ndim; hypre__d++)\
+{\
+   hypre__sk##k[hypre__d] = hypre__ikstart##k*stridek[hypre__d];\
+   hypre__ikstart##k *= hypre_BoxSizeD(dboxk, hypre__d);\
+}\
+for (hypre__d = hypre__ndim; hypre__d < HYPRE_MAXDIM; hypre__d++)\
+{\
+   hypre__sk##k[hypre__d] = 0;\
+}\
+hypre__ikstart##k = hypre_BoxIndexRank(dboxk, startk)
+
+/* Finds the row (j,k) of the first iteration of the block, where j lies in the
+ * tile [t0,t1) */
+#define zypre_BoxLoopUnitSet() \
+hypre__IN = hypre__n[0];\
+hypre__JN = hypre__tot;\
+hypre__J = 0;\
+if (hypre__num_blocks > 1)\
+{\
+   hypre__JN = hypre__div + ((hypre__mod > hypre__block) ? 1 : 0);\
+   hypre__J = hypre__block * hypre__div + hypre_min(hypre__mod, hypre__block);\
+}\
+hypre__t0 = (hypre__J / (hypre__tile * hypre__kn)) * hypre__tile;\
+hypre__t1 = hypre_min(hypre__t0 + hypre__tile, hypre__jn);\
+hypre__J -= hypre__t0 * hypre__kn;\
+hypre__k = hypre__J / (hypre__t1 - hypre__t0);\
+hypre__j = hypre__t0 + hypre__J % (hypre__t1 - hypre__t0)
+
+#define zypre_BoxLoopUnitSetK(k) \
+HYPRE_Int hypre__row##k = hypre__ikstart##k +\
+   hypre__j * hypre__sk##k[1] + hypre__k * hypre__sk##k[2]
+
+#define zypre_BoxLoopUnitInc() \
+if (++hypre__j == hypre__t1)\
+{\
+   hypre__j = hypre__t0;\
+   if (++hypre__k == hypre__kn)\
+   {\
+      hypre__k  = 0;\
+      hypre__t0 = hypre__t1;\
+      hypre__t1 = hypre_min(hypre__t0 + hypre__tile, hypre__jn);\
+      hypre__j  = hypre__t0;\
+   }\
+}
+
+#define zypre_BoxLoop1UnitBegin(ndim, loop_size,                              \
+                                dbox1, start1, stride1, i1)                   \
+{                                                                             \
+   zypre_BoxLoopUnitDeclare();                                                \
+   zypre_BoxLoopUnitDeclareK(1);                                              \
+   zypre_BoxLoopInit(ndim, loop_size);                                        \
+   zypre_BoxLoopUnitInitK(1, dbox1, start1, stride1);                         \
+   zypre_BoxLoopUnitInit();                                                   \
+   OMP1UNIT                                                                   \
+   for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
+   {                                                                          \
+      HYPRE_Int hypre__j, hypre__k, hypre__t0, hypre__t1;                     \
+      zypre_BoxLoopUnitSet();                                                 \
+      for (hypre__J = 0; hypre__J < hypre__JN; hypre__J++)                    \
+      {                                                                       \
+         zypre_BoxLoopUnitSetK(1);                                            \
+         OMPSIMD                                                              \
+         for (hypre__I = 0; hypre__I < hypre__IN; hypre__I++)                 \
+         {                                                                    \
+            HYPRE_Int i1 = hypre__row1 + hypre__I;
+
+#define zypre_BoxLoop1UnitEnd(i1)                                             \
+         }                                                                    \
+         zypre_BoxLoopUnitInc();                                              \
+      }                                                                       \
+   }                                                                          \
+}
+
+#define zypre_BoxLoop2UnitBegin(ndim, loop_size,                              \
+                                dbox1, start1, stride1, i1,                   \
+                                dbox2, start2, stride2, i2)                   \
+{                                                                             \
+   zypre_BoxLoopUnitDeclare();                                                \
+   zypre_BoxLoopUnitDeclareK(1);                                              \
+   zypre_BoxLoopUnitDeclareK(2);                                              \
+   zypre_BoxLoopInit(ndim, loop_size);                                        \
+   zypre_BoxLoopUnitInitK(1, dbox1, start1, stride1);                         \
+   zypre_BoxLoopUnitInitK(2, dbox2, start2, stride2);                         \
+   zypre_BoxLoopUnitInit();                                                   \
+   OMP1UNIT                                                                   \
+   for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
+   {                                                                          \
+      HYPRE_Int hypre__j, hypre__k, hypre__t0, hypre__t1;                     \
+      zypre_BoxLoopUnitSet();                                                 \
+      for (hypre__J = 0; hypre__J < hypre__JN; hypre__J++)                    \
+      {                                                                       \
+         zypre_BoxLoopUnitSetK(1);                                            \
+         zypre_BoxLoopUnitSetK(2);                                            \
+         OMPSIMD                                                              \
+         for (hypre__I = 0; hypre__I < hypre__IN; hypre__I++)                 \
+         {                                                                    \
+            HYPRE_Int i1 = hypre__row1 + hypre__I;                            \
+            HYPRE_Int i2 = hypre__row2 + hypre__I;
+
+#define zypre_BoxLoop2UnitEnd(i1, i2)                                         \
+         }                                                                    \
+         zypre_BoxLoopUnitInc();                                              \
+      }                                                                       \
+   }                                                                          \
+}
+
+#define zypre_BoxLoop3UnitBegin(ndim, loop_size,                              \
+                                dbox1, start1, stride1, i1,                   \
+                                dbox2, start2, stride2, i2,                   \
+                                dbox3, start3, stride3, i3)                   \
+{                                                                             \
+   zypre_BoxLoopUnitDeclare();                                                \
+   zypre_BoxLoopUnitDeclareK(1);                                              \
+   zypre_BoxLoopUnitDeclareK(2);                                              \
+   zypre_BoxLoopUnitDeclareK(3);                                              \
+   zypre_BoxLoopInit(ndim, loop_size);                                        \
+   zypre_BoxLoopUnitInitK(1, dbox1, start1, stride1);                         \
+   zypre_BoxLoopUnitInitK(2, dbox2, start2, stride2);                         \
+   zypre_BoxLoopUnitInitK(3, dbox3, start3, stride3);                         \
+   zypre_BoxLoopUnitInit();                                                   \
+   OMP1UNIT                                                                   \
+   for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
+   {                                                                          \
+      HYPRE_Int hypre__j, hypre__k, hypre__t0, hypre__t1;                     \
+      zypre_BoxLoopUnitSet();                                                 \
+      for (hypre__J = 0; hypre__J < hypre__JN; hypre__J++)                    \
+      {                                                                       \
+         zypre_BoxLoopUnitSetK(1);                                            \
+         zypre_BoxLoopUnitSetK(2);                                            \
+         zypre_BoxLoopUnitSetK(3);                                            \
+         OMPSIMD                                                              \
+         for (hypre__I = 0; hypre__I < hypre__IN; hypre__I++)                 \
+         {                                                                    \
+            HYPRE_Int i1 = hypre__row1 + hypre__I;                            \
+            HYPRE_Int i2 = hypre__row2 + hypre__I;                            \
+            HYPRE_Int i3 = hypre__row3 + hypre__I;
+
+#define zypre_BoxLoop3UnitEnd(i1, i2, i3)                                     \
+         }                                                                    \
+         zypre_BoxLoopUnitInc();                                              \
+      }                                                                       \
+   }                                                                          \
+}
+
+/* Reduction unit-stride BoxLoop1 */
+#define zypre_BoxLoop1UnitReductionBegin(ndim, loop_size, dbox1, start1, stride1, i1, reducesum) \
+        zypre_BoxLoop1UnitBegin(ndim, loop_size, dbox1, start1, stride1, i1)
+
+#define zypre_BoxLoop1UnitReductionEnd(i1, reducesum) zypre_BoxLoop1UnitEnd(i1)
+
+/* Reduction unit-stride BoxLoop2 */
+#define zypre_BoxLoop2UnitReductionBegin(ndim, loop_size, dbox1, start1, stride1, i1,            \
+                                                          dbox2, start2, stride2, i2, reducesum) \
+        zypre_BoxLoop2UnitBegin(ndim, loop_size, dbox1, start1, stride1, i1,                     \
+                                                 dbox2, start2, stride2, i2)
+
+#define zypre_BoxLoop2UnitReductionEnd(i1, i2, reducesum) zypre_BoxLoop2UnitEnd(i1, i2)
+
 /*--------------------------------------------------------------------------
  * Serial BoxLoop macros:
  * [same as the ones above (without OMP and with SetOneBlock)]
@@ -2699,6 +2949,16 @@ hypre__J = hypre__thread;  i1 = i2 = 0; \
 #define hypre_BoxLoop1ReductionEndHost     zypre_BoxLoop1ReductionEnd
 #define hypre_BoxLoop2ReductionBeginHost   zypre_BoxLoop2ReductionBegin
 #define hypre_BoxLoop2ReductionEndHost     zypre_BoxLoop2ReductionEnd
+#define hypre_BoxLoop1UnitBeginHost        zypre_BoxLoop1UnitBegin
+#define hypre_BoxLoop1UnitEndHost          zypre_BoxLoop1UnitEnd
+#define hypre_BoxLoop2UnitBeginHost        zypre_BoxLoop2UnitBegin
+#define hypre_BoxLoop2UnitEndHost          zypre_BoxLoop2UnitEnd
+#define hypre_BoxLoop3UnitBeginHost        zypre_BoxLoop3UnitBegin
+#define hypre_BoxLoop3UnitEndHost          zypre_BoxLoop3UnitEnd
+#define hypre_BoxLoop1UnitReductionBeginHost zypre_BoxLoop1UnitReductionBegin
+#define hypre_BoxLoop1UnitReductionEndHost   zypre_BoxLoop1UnitReductionEnd
+#define hypre_BoxLoop2UnitReductionBeginHost zypre_BoxLoop2UnitReductionBegin
+#define hypre_BoxLoop2UnitReductionEndHost   zypre_BoxLoop2UnitReductionEnd
 
 //TODO TEMP FIX
 #if !defined(HYPRE_USING_RAJA) && !defined(HYPRE_USING_KOKKOS) && !defined(HYPRE_USING_CUDA) && !defined(HYPRE_USING_HIP) && !defined(HYPRE_USING_DEVICE_OPENMP) && !defined(HYPRE_USING_SYCL)
@@ -2722,6 +2982,28 @@ hypre__J = hypre__thread;  i1 = i2 = 0; \
 #define hypre_BoxLoop1ReductionEnd     hypre_BoxLoop1ReductionEndHost
 #define hypre_BoxLoop2ReductionBegin   hypre_BoxLoop2ReductionBeginHost
 #define hypre_BoxLoop2ReductionEnd     hypre_BoxLoop2ReductionEndHost
+#define hypre_BoxLoop1UnitBegin        hypre_BoxLoop1UnitBeginHost
+#define hypre_BoxLoop1UnitEnd          hypre_BoxLoop1UnitEndHost
+#define hypre_BoxLoop2UnitBegin        hypre_BoxLoop2UnitBeginHost
+#define hypre_BoxLoop2UnitEnd          hypre_BoxLoop2UnitEndHost
+#define hypre_BoxLoop3UnitBegin        hypre_BoxLoop3UnitBeginHost
+#define hypre_BoxLoop3UnitEnd          hypre_BoxLoop3UnitEndHost
+#define hypre_BoxLoop1UnitReductionBegin hypre_BoxLoop1UnitReductionBeginHost
+#define hypre_BoxLoop1UnitReductionEnd   hypre_BoxLoop1UnitReductionEndHost
+#define hypre_BoxLoop2UnitReductionBegin hypre_BoxLoop2UnitReductionBeginHost
+#define hypre_BoxLoop2UnitReductionEnd   hypre_BoxLoop2UnitReductionEndHost
+#else
+/* The device BoxLoops have no unit-stride variants */
+#define hypre_BoxLoop1UnitBegin        hypre_BoxLoop1Begin
+#define hypre_BoxLoop1UnitEnd          hypre_BoxLoop1End
+#define hypre_BoxLoop2UnitBegin        hypre_BoxLoop2Begin
+#define hypre_BoxLoop2UnitEnd          hypre_BoxLoop2End
+#define hypre_BoxLoop3UnitBegin        hypre_BoxLoop3Begin
+#define hypre_BoxLoop3UnitEnd          hypre_BoxLoop3End
+#define hypre_BoxLoop1UnitReductionBegin hypre_BoxLoop1ReductionBegin
+#define hypre_BoxLoop1UnitReductionEnd   hypre_BoxLoop1ReductionEnd
+#define hypre_BoxLoop2UnitReductionBegin hypre_BoxLoop2ReductionBegin
+#define hypre_BoxLoop2UnitReductionEnd   hypre_BoxLoop2ReductionEnd
 #endif
 
 #endif /* #ifndef HYPRE_BOXLOOP_HOST_HEADER */
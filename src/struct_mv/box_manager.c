@@ -345,6 +345,39 @@ hypre_BoxManSetNumGhost( hypre_BoxManager *manager,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Selects the spatial index built by BoxManAssemble (hypre_BOXMAN_INDEX_TABLE
+ * or hypre_BOXMAN_INDEX_BVH). Must be called before the assemble.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoxManSetIndexType( hypre_BoxManager *manager,
+                          HYPRE_Int         index_type )
+{
+   if (hypre_BoxManIsAssembled(manager) ||
+       (index_type != hypre_BOXMAN_INDEX_TABLE && index_type != hypre_BOXMAN_INDEX_BVH))
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_BoxManIndexType(manager) = index_type;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoxManGetIndexType( hypre_BoxManager *manager,
+                          HYPRE_Int        *index_type )
+{
+   *index_type = hypre_BoxManIndexType(manager);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * Delete multiple entries (and their corresponding info object) from the
  * manager.  The indices correspond to the ordering of the entries.  Assumes
@@ -458,6 +491,11 @@ hypre_BoxManCreate( HYPRE_Int max_nentries,
 
    hypre_BoxManIndexTable(manager) = NULL;
 
+   hypre_BoxManIndexType(manager)   = hypre_BOXMAN_INDEX_TABLE;
+   hypre_BoxManBVHNumNodes(manager) = 0;
+   hypre_BoxManBVHNodes(manager)    = NULL;
+   hypre_BoxManBVHOrder(manager)    = NULL;
+
    hypre_BoxManNumProcsSort(manager)     = 0;
    hypre_BoxManIdsSort(manager)          = hypre_CTAlloc(HYPRE_Int,  max_nentries, HYPRE_MEMORY_HOST);
    hypre_BoxManProcsSort(manager)        = hypre_CTAlloc(HYPRE_Int,  max_nentries, HYPRE_MEMORY_HOST);
@@ -576,6 +614,8 @@ hypre_BoxManDestroy( hypre_BoxManager *manager )
       hypre_TFree(hypre_BoxManInfoObjects(manager), HYPRE_MEMORY_HOST);
 
       hypre_TFree(hypre_BoxManIndexTable(manager), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_BoxManBVHNodes(manager), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_BoxManBVHOrder(manager), HYPRE_MEMORY_HOST);
 
       hypre_TFree(hypre_BoxManIdsSort(manager), HYPRE_MEMORY_HOST);
       hypre_TFree(hypre_BoxManProcsSort(manager), HYPRE_MEMORY_HOST);
@@ -1082,6 +1122,125 @@ hypre_BoxManGatherEntries(hypre_BoxManager *manager,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Builds the bounding volume hierarchy over the entries (the alternative to
+ * the index table, see hypre_BOXMAN_INDEX_BVH). Each node is split at the
+ * median of the box centers along the dimension in which they are most
+ * spread out, until at most hypre_BOXMAN_BVH_LEAF_SIZE entries are left.
+ * This takes O(n log^2 n) time and O(n) storage for n entries.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoxManAssembleBVH( hypre_BoxManager *manager )
+{
+   HYPRE_Int            ndim     = hypre_BoxManNDim(manager);
+   HYPRE_Int            nentries = hypre_BoxManNEntries(manager);
+   hypre_BoxManEntry   *entries  = hypre_BoxManEntries(manager);
+
+   hypre_BoxManBVHNode *nodes, *node;
+   hypre_BoxManEntry   *entry;
+   HYPRE_Int           *order, *keys, *stack;
+   HYPRE_Int            num_nodes, stack_size;
+   HYPRE_Int            cmin[HYPRE_MAXDIM], cmax[HYPRE_MAXDIM];
+   HYPRE_Int            i, k, d, n, axis, half;
+
+   hypre_TFree(hypre_BoxManBVHNodes(manager), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_BoxManBVHOrder(manager), HYPRE_MEMORY_HOST);
+
+   /* a binary tree with at most nentries leaves */
+   nodes = hypre_TAlloc(hypre_BoxManBVHNode, hypre_max(2 * nentries - 1, 1), HYPRE_MEMORY_HOST);
+   order = hypre_TAlloc(HYPRE_Int, nentries, HYPRE_MEMORY_HOST);
+   keys  = hypre_TAlloc(HYPRE_Int, nentries, HYPRE_MEMORY_HOST);
+   stack = hypre_TAlloc(HYPRE_Int, nentries + 1, HYPRE_MEMORY_HOST);
+
+   for (i = 0; i < nentries; i++)
+   {
+      order[i] = i;
+      hypre_BoxManEntryNext(&entries[i]) = NULL;
+   }
+
+   num_nodes = 1;
+   nodes[0].start = 0;
+   nodes[0].count = nentries;
+   stack_size = 0;
+   stack[stack_size++] = 0;
+
+   while (stack_size > 0)
+   {
+      node = &nodes[stack[--stack_size]];
+      n    = node->count;
+
+      /* bounding box of the entries, and of their centers (doubled) */
+      for (d = 0; d < ndim; d++)
+      {
+         hypre_IndexD(node->imin, d) = HYPRE_INT_MAX;
+         hypre_IndexD(node->imax, d) = -HYPRE_INT_MAX;
+         cmin[d] = HYPRE_INT_MAX;
+         cmax[d] = -HYPRE_INT_MAX;
+      }
+      for (k = node->start; k < node->start + n; k++)
+      {
+         entry = &entries[order[k]];
+         for (d = 0; d < ndim; d++)
+         {
+            i = hypre_IndexD(hypre_BoxManEntryIMin(entry), d) +
+                hypre_IndexD(hypre_BoxManEntryIMax(entry), d);
+            hypre_IndexD(node->imin, d) = hypre_min(hypre_IndexD(node->imin, d),
+                                                    hypre_IndexD(hypre_BoxManEntryIMin(entry), d));
+            hypre_IndexD(node->imax, d) = hypre_max(hypre_IndexD(node->imax, d),
+                                                    hypre_IndexD(hypre_BoxManEntryIMax(entry), d));
+            cmin[d] = hypre_min(cmin[d], i);
+            cmax[d] = hypre_max(cmax[d], i);
+         }
+      }
+
+      axis = 0;
+      for (d = 1; d < ndim; d++)
+      {
+         if ((cmax[d] - cmin[d]) > (cmax[axis] - cmin[axis]))
+         {
+            axis = d;
+         }
+      }
+
+      /* leaf: few entries, or all of them centered at the same point */
+      if (n <= hypre_BOXMAN_BVH_LEAF_SIZE || cmax[axis] == cmin[axis])
+      {
+         node->child = -1;
+         continue;
+      }
+
+      /* sort the entries by center along the axis and split in halves */
+      for (k = node->start; k < node->start + n; k++)
+      {
+         entry   = &entries[order[k]];
+         keys[k] = hypre_IndexD(hypre_BoxManEntryIMin(entry), axis) +
+                   hypre_IndexD(hypre_BoxManEntryIMax(entry), axis);
+      }
+      hypre_qsort2i(keys, order, node->start, node->start + n - 1);
+
+      half = n / 2;
+      node->child = num_nodes;
+      nodes[num_nodes].start     = node->start;
+      nodes[num_nodes].count     = half;
+      nodes[num_nodes + 1].start = node->start + half;
+      nodes[num_nodes + 1].count = n - half;
+      stack[stack_size++] = num_nodes;
+      stack[stack_size++] = num_nodes + 1;
+      num_nodes += 2;
+   }
+
+   hypre_TFree(keys, HYPRE_MEMORY_HOST);
+   hypre_TFree(stack, HYPRE_MEMORY_HOST);
+
+   hypre_BoxManBVHNumNodes(manager) = num_nodes;
+   hypre_BoxManBVHNodes(manager)    = hypre_TReAlloc(nodes, hypre_BoxManBVHNode,
+                                                     num_nodes, HYPRE_MEMORY_HOST);
+   hypre_BoxManBVHOrder(manager)    = order;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * In the assemble, we populate the local box manager with global box
  * information to be used by calls to BoxManIntersect().  Global box information
@@ -2211,9 +2370,14 @@ hypre_BoxManAssemble( hypre_BoxManager *manager )
 
    /*------------------------------INDEX TABLE ---------------------------*/
 
-   /* now build the index_table and indexes array */
-   /* Note: for now we are using the same scheme as in BoxMap  */
+   if (hypre_BoxManIndexType(manager) == hypre_BOXMAN_INDEX_BVH)
+   {
+      hypre_BoxManAssembleBVH(manager);
+   }
+   else
    {
+      /* now build the index_table and indexes array */
+      /* Note: for now we are using the same scheme as in BoxMap  */
       HYPRE_Int *indexes[HYPRE_MAXDIM];
       HYPRE_Int  size[HYPRE_MAXDIM];
       HYPRE_Int  iminmax[2];
@@ -2431,6 +2595,135 @@ hypre_BoxManAssemble( hypre_BoxManager *manager )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * BoxManIntersect with the bounding volume hierarchy. The entries found are
+ * returned in the order a point query on the index table would list them:
+ * those of this processor first, then by decreasing position.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoxManIntersectBVH( hypre_BoxManager    *manager,
+                          hypre_Index          ilower,
+                          hypre_Index          iupper,
+                          hypre_BoxManEntry ***entries_ptr,
+                          HYPRE_Int           *nentries_ptr )
+{
+   HYPRE_Int            ndim      = hypre_BoxManNDim(manager);
+   hypre_BoxManBVHNode *nodes     = hypre_BoxManBVHNodes(manager);
+   HYPRE_Int           *order     = hypre_BoxManBVHOrder(manager);
+   hypre_BoxManEntry   *man_entries = hypre_BoxManEntries(manager);
+   HYPRE_Int            num_man_entries = hypre_BoxManNEntries(manager);
+
+   hypre_BoxManBVHNode *node;
+   hypre_BoxManEntry   *entry;
+   hypre_BoxManEntry  **entries;
+   HYPRE_Int           *keys, *found;
+   HYPRE_Int            nentries, max_nentries;
+   HYPRE_Int            local_start, local_end;
+   HYPRE_Int            stack[64], stack_size;
+   HYPRE_Int            k, d, position, overlap;
+
+   /* positions of this processor's entries */
+   local_start = hypre_BoxManFirstLocal(manager);
+   local_end   = -1;
+   if (local_start >= 0)
+   {
+      local_end = hypre_BoxManProcsSortOffsets(manager)[hypre_BoxManLocalProcOffset(manager) + 1];
+   }
+
+   nentries     = 0;
+   max_nentries = 8;
+   found        = hypre_TAlloc(HYPRE_Int, max_nentries, HYPRE_MEMORY_HOST);
+
+   /* depth-first traversal; the tree is balanced, so its depth is at most
+      log2(num_man_entries) + 1 and the stack cannot overflow */
+   stack_size = 0;
+   stack[stack_size++] = 0;
+   while (stack_size > 0)
+   {
+      node = &nodes[stack[--stack_size]];
+
+      overlap = 1;
+      for (d = 0; d < ndim; d++)
+      {
+         if ( hypre_IndexD(node->imin, d) > hypre_IndexD(iupper, d) ||
+              hypre_IndexD(node->imax, d) < hypre_IndexD(ilower, d) )
+         {
+            overlap = 0;
+            break;
+         }
+      }
+      if (!overlap)
+      {
+         continue;
+      }
+
+      if (node->child >= 0)
+      {
+         stack[stack_size++] = node->child;
+         stack[stack_size++] = node->child + 1;
+         continue;
+      }
+
+      for (k = node->start; k < node->start + node->count; k++)
+      {
+         position = order[k];
+         entry    = &man_entries[position];
+
+         overlap = 1;
+         for (d = 0; d < ndim; d++)
+         {
+            if ( hypre_IndexD(hypre_BoxManEntryIMin(entry), d) > hypre_IndexD(iupper, d) ||
+                 hypre_IndexD(hypre_BoxManEntryIMax(entry), d) < hypre_IndexD(ilower, d) )
+            {
+               overlap = 0;
+               break;
+            }
+         }
+
+         if (overlap)
+         {
+            if (nentries == max_nentries)
+            {
+               max_nentries *= 2;
+               found = hypre_TReAlloc(found, HYPRE_Int, max_nentries, HYPRE_MEMORY_HOST);
+            }
+            found[nentries++] = position;
+         }
+      }
+   }
+
+   entries = NULL;
+   if (nentries > 0)
+   {
+      /* sort by decreasing key, local entries having the largest keys */
+      keys = hypre_TAlloc(HYPRE_Int, nentries, HYPRE_MEMORY_HOST);
+      for (k = 0; k < nentries; k++)
+      {
+         position = found[k];
+         keys[k]  = -position;
+         if (position >= local_start && position < local_end)
+         {
+            keys[k] -= num_man_entries;
+         }
+      }
+      hypre_qsort2i(keys, found, 0, nentries - 1);
+
+      entries = hypre_TAlloc(hypre_BoxManEntry *, nentries, HYPRE_MEMORY_HOST);
+      for (k = 0; k < nentries; k++)
+      {
+         entries[k] = &man_entries[found[k]];
+      }
+      hypre_TFree(keys, HYPRE_MEMORY_HOST);
+   }
+   hypre_TFree(found, HYPRE_MEMORY_HOST);
+
+   *entries_ptr  = entries;
+   *nentries_ptr = nentries;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * Given a box (lower and upper indices), return a list of boxes in the global
  * grid that are intersected by this box. The user must insure that a processor
@@ -2488,6 +2781,11 @@ hypre_BoxManIntersect ( hypre_BoxManager *manager,
       return hypre_error_flag;
    }
 
+   if (hypre_BoxManIndexType(manager) == hypre_BOXMAN_INDEX_BVH)
+   {
+      return hypre_BoxManIntersectBVH(manager, ilower, iupper, entries_ptr, nentries_ptr);
+   }
+
    /* Loop through each dimension */
    for (d = 0; d < ndim; d++)
    {
@@ -32,6 +32,30 @@ typedef struct hypre_BoxManEntry_struct
 
 } hypre_BoxManEntry;
 
+/*--------------------------------------------------------------------------
+ * Spatial index used by BoxManIntersect. The index table is a dense table over
+ * the distinct box extents in each dimension, so its size is the product of
+ * their numbers. The bounding volume hierarchy (BVH) is a binary tree of
+ * bounding boxes with a few entries per leaf, which needs linear storage and
+ * answers queries in logarithmic time.
+ *--------------------------------------------------------------------------*/
+
+#define hypre_BOXMAN_INDEX_TABLE  0
+#define hypre_BOXMAN_INDEX_BVH    1
+
+/* max number of entries in a BVH leaf */
+#define hypre_BOXMAN_BVH_LEAF_SIZE  4
+
+typedef struct
+{
+   hypre_Index imin;  /* Bounding box of the entries below this node */
+   hypre_Index imax;
+   HYPRE_Int   child; /* First of two consecutive children, -1 for a leaf */
+   HYPRE_Int   start; /* Leaf entries are bvh_order[start, start + count) */
+   HYPRE_Int   count;
+
+} hypre_BoxManBVHNode;
+
 /*---------------------------------------------------------------------------
  * Box Manager: organizes arbitrary information in a spatial way
  *----------------------------------------------------------------------------*/
@@ -101,6 +125,12 @@ typedef struct
    HYPRE_Int           last_index[HYPRE_MAXDIM]; /* Last index used in the
                                                     indexes map */
 
+   HYPRE_Int           index_type; /* hypre_BOXMAN_INDEX_TABLE (default) or
+                                      hypre_BOXMAN_INDEX_BVH */
+   HYPRE_Int           bvh_num_nodes;
+   hypre_BoxManBVHNode *bvh_nodes; /* Nodes of the BVH, the root first */
+   HYPRE_Int          *bvh_order; /* Positions in 'entries' grouped by leaf */
+
    HYPRE_Int           num_my_entries; /* Num entries with proc_id = myid */
    HYPRE_Int          *my_ids; /* Array of ids corresponding to my entries */
    hypre_BoxManEntry **my_entries; /* Points into entries that are mine and
@@ -157,6 +187,11 @@ typedef struct
 #define hypre_BoxManSize(manager)               ((manager) -> size)
 #define hypre_BoxManLastIndex(manager)          ((manager) -> last_index)
 
+#define hypre_BoxManIndexType(manager)          ((manager) -> index_type)
+#define hypre_BoxManBVHNumNodes(manager)        ((manager) -> bvh_num_nodes)
+#define hypre_BoxManBVHNodes(manager)           ((manager) -> bvh_nodes)
+#define hypre_BoxManBVHOrder(manager)           ((manager) -> bvh_order)
+
 #define hypre_BoxManNumMyEntries(manager)       ((manager) -> num_my_entries)
 #define hypre_BoxManMyIds(manager)              ((manager) -> my_ids)
 #define hypre_BoxManMyEntries(manager)          ((manager) -> my_entries)
@@ -28,9 +28,17 @@
 #endif
 #define OMP0 Pragma(omp parallel for HYPRE_OMP_CLAUSE HYPRE_BOX_REDUCTION HYPRE_SMP_SCHEDULE)
 #define OMP1 Pragma(omp parallel for private(HYPRE_BOX_PRIVATE) HYPRE_OMP_CLAUSE HYPRE_BOX_REDUCTION HYPRE_SMP_SCHEDULE)
+#define OMP1UNIT Pragma(omp parallel for private(ZYPRE_BOX_UNIT_PRIVATE) HYPRE_OMP_CLAUSE HYPRE_BOX_REDUCTION HYPRE_SMP_SCHEDULE)
+#if (_OPENMP >= 201307) && !defined(HYPRE_USING_DEVICE_OPENMP)
+#define OMPSIMD Pragma(omp simd HYPRE_BOX_REDUCTION)
+#else
+#define OMPSIMD
+#endif
 #else /* #if defined(HYPRE_USING_OPENMP) */
 #define OMP0
 #define OMP1
+#define OMP1UNIT
+#define OMPSIMD
 #endif /* #if defined(HYPRE_USING_OPENMP) */
 
 #define zypre_BoxLoop0Begin(ndim, loop_size)                                  \
@@ -260,6 +268,208 @@
    }                                                                          \
 }
 
+/*--------------------------------------------------------------------------
+ * Unit-stride BoxLoop macros:
+ * [same arguments as the ones above, for loops where all strides are one in
+ *  dimension 0]
+ *
+ * The index of each operand is computed from the start of its row, so the
+ * innermost loop carries no updates from one iteration to the next and is
+ * vectorized with 'omp simd' (which also gets the HYPRE_BOX_REDUCTION clause).
+ * The body must therefore not depend on earlier iterations of the same row,
+ * and hypre_BoxLoopGetIndex cannot be used.
+ *
+ * Rows are visited in tiles of hypre_HandleBoxTile rows of dimension 1 (see
+ * HYPRE_SetBoxLoopTile), sweeping all of dimension 2 before moving on to the
+ * next tile, so that neighboring planes of a stencil stay in cache.  Without
+ * tiling (the default), the rows are visited in the same order as in the
+ * loops above.
+ *--------------------------------------------------------------------------*/
+
+#define ZYPRE_BOX_UNIT_PRIVATE hypre__IN,hypre__JN,hypre__I,hypre__J
+
+#define zypre_BoxLoopUnitDeclare() \
+HYPRE_Int  hypre__tot, hypre__div, hypre__mod;\
+HYPRE_Int  hypre__block, hypre__num_blocks;\
+HYPRE_Int  hypre__d, hypre__ndim;\
+HYPRE_Int  hypre__I, hypre__J, hypre__IN, hypre__JN;\
+HYPRE_Int  hypre__n[HYPRE_MAXDIM+1];\
+HYPRE_Int  hypre__jn, hypre__kn, hypre__tile
+
+#define zypre_BoxLoopUnitDeclareK(k) \
+HYPRE_Int  hypre__ikstart##k, hypre__sk##k[HYPRE_MAXDIM]
+
+#define zypre_BoxLoopUnitInit() \
+hypre__jn = (hypre__ndim > 1) ? hypre__n[1] : 1;\
+hypre__kn = (hypre__ndim > 2) ? hypre__n[2] : 1;\
+hypre__tile = hypre_HandleBoxTile(hypre_handle());\
+if (hypre__tile <= 0 || hypre__tile > hypre__jn)\
+{\
+   hypre__tile = hypre__jn;\
+}
+
+#define zypre_BoxLoopUnitInitK(k, dboxk, startk, stridek) \
+hypre_assert(stridek[0] == 1);\
+hypre__sk##k[0] = stridek[0];\
+hypre__ikstart##k = hypre_BoxSizeD(dboxk, 0); /* temporarily use ikstart */\
+for (hypre__d = 1; hypre__d < hypre__ndim; hypre__d++)\
+{\
+   hypre__sk##k[hypre__d] = hypre__ikstart##k*stridek[hypre__d];\
+   hypre__ikstart##k *= hypre_BoxSizeD(dboxk, hypre__d);\
+}\
+for (hypre__d = hypre__ndim; hypre__d < HYPRE_MAXDIM; hypre__d++)\
+{\
+   hypre__sk##k[hypre__d] = 0;\
+}\
+hypre__ikstart##k = hypre_BoxIndexRank(dboxk, startk)
+
+/* Finds the row (j,k) of the first iteration of the block, where j lies in the
+ * tile [t0,t1) */
+#define zypre_BoxLoopUnitSet() \
+hypre__IN = hypre__n[0];\
+hypre__JN = hypre__tot;\
+hypre__J = 0;\
+if (hypre__num_blocks > 1)\
+{\
+   hypre__JN = hypre__div + ((hypre__mod > hypre__block) ? 1 : 0);\
+   hypre__J = hypre__block * hypre__div + hypre_min(hypre__mod, hypre__block);\
+}\
+hypre__t0 = (hypre__J / (hypre__tile * hypre__kn)) * hypre__tile;\
+hypre__t1 = hypre_min(hypre__t0 + hypre__tile, hypre__jn);\
+hypre__J -= hypre__t0 * hypre__kn;\
+hypre__k = hypre__J / (hypre__t1 - hypre__t0);\
+hypre__j = hypre__t0 + hypre__J % (hypre__t1 - hypre__t0)
+
+#define zypre_BoxLoopUnitSetK(k) \
+HYPRE_Int hypre__row##k = hypre__ikstart##k +\
+   hypre__j * hypre__sk##k[1] + hypre__k * hypre__sk##k[2]
+
+#define zypre_BoxLoopUnitInc() \
+if (++hypre__j == hypre__t1)\
+{\
+   hypre__j = hypre__t0;\
+   if (++hypre__k == hypre__kn)\
+   {\
+      hypre__k  = 0;\
+      hypre__t0 = hypre__t1;\
+      hypre__t1 = hypre_min(hypre__t0 + hypre__tile, hypre__jn);\
+      hypre__j  = hypre__t0;\
+   }\
+}
+
+#define zypre_BoxLoop1UnitBegin(ndim, loop_size,                              \
+                                dbox1, start1, stride1, i1)                   \
+{                                                                             \
+   zypre_BoxLoopUnitDeclare();                                                \
+   zypre_BoxLoopUnitDeclareK(1);                                              \
+   zypre_BoxLoopInit(ndim, loop_size);                                        \
+   zypre_BoxLoopUnitInitK(1, dbox1, start1, stride1);                         \
+   zypre_BoxLoopUnitInit();                                                   \
+   OMP1UNIT                                                                   \
+   for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
+   {                                                                          \
+      HYPRE_Int hypre__j, hypre__k, hypre__t0, hypre__t1;                     \
+      zypre_BoxLoopUnitSet();                                                 \
+      for (hypre__J = 0; hypre__J < hypre__JN; hypre__J++)                    \
+      {                                                                       \
+         zypre_BoxLoopUnitSetK(1);                                            \
+         OMPSIMD                                                              \
+         for (hypre__I = 0; hypre__I < hypre__IN; hypre__I++)                 \
+         {                                                                    \
+            HYPRE_Int i1 = hypre__row1 + hypre__I;
+
+#define zypre_BoxLoop1UnitEnd(i1)                                             \
+         }                                                                    \
+         zypre_BoxLoopUnitInc();                                              \
+      }                                                                       \
+   }                                                                          \
+}
+
+#define zypre_BoxLoop2UnitBegin(ndim, loop_size,                              \
+                                dbox1, start1, stride1, i1,                   \
+                                dbox2, start2, stride2, i2)                   \
+{                                                                             \
+   zypre_BoxLoopUnitDeclare();                                                \
+   zypre_BoxLoopUnitDeclareK(1);                                              \
+   zypre_BoxLoopUnitDeclareK(2);                                              \
+   zypre_BoxLoopInit(ndim, loop_size);                                        \
+   zypre_BoxLoopUnitInitK(1, dbox1, start1, stride1);                         \
+   zypre_BoxLoopUnitInitK(2, dbox2, start2, stride2);                         \
+   zypre_BoxLoopUnitInit();                                                   \
+   OMP1UNIT                                                                   \
+   for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
+   {                                                                          \
+      HYPRE_Int hypre__j, hypre__k, hypre__t0, hypre__t1;                     \
+      zypre_BoxLoopUnitSet();                                                 \
+      for (hypre__J = 0; hypre__J < hypre__JN; hypre__J++)                    \
+      {                                                                       \
+         zypre_BoxLoopUnitSetK(1);                                            \
+         zypre_BoxLoopUnitSetK(2);                                            \
+         OMPSIMD                                                              \
+         for (hypre__I = 0; hypre__I < hypre__IN; hypre__I++)                 \
+         {                                                                    \
+            HYPRE_Int i1 = hypre__row1 + hypre__I;                            \
+            HYPRE_Int i2 = hypre__row2 + hypre__I;
+
+#define zypre_BoxLoop2UnitEnd(i1, i2)                                         \
+         }                                                                    \
+         zypre_BoxLoopUnitInc();                                              \
+      }                                                                       \
+   }                                                                          \
+}
+
+#define zypre_BoxLoop3UnitBegin(ndim, loop_size,                              \
+                                dbox1, start1, stride1, i1,                   \
+                                dbox2, start2, stride2, i2,                   \
+                                dbox3, start3, stride3, i3)                   \
+{                                                                             \
+   zypre_BoxLoopUnitDeclare();                                                \
+   zypre_BoxLoopUnitDeclareK(1);                                              \
+   zypre_BoxLoopUnitDeclareK(2);                                              \
+   zypre_BoxLoopUnitDeclareK(3);                                              \
+   zypre_BoxLoopInit(ndim, loop_size);                                        \
+   zypre_BoxLoopUnitInitK(1, dbox1, start1, stride1);                         \
+   zypre_BoxLoopUnitInitK(2, dbox2, start2, stride2);                         \
+   zypre_BoxLoopUnitInitK(3, dbox3, start3, stride3);                         \
+   zypre_BoxLoopUnitInit();                                                   \
+   OMP1UNIT                                                                   \
+   for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
+   {                                                                          \
+      HYPRE_Int hypre__j, hypre__k, hypre__t0, hypre__t1;                     \
+      zypre_BoxLoopUnitSet();                                                 \
+      for (hypre__J = 0; hypre__J < hypre__JN; hypre__J++)                    \
+      {                                                                       \
+         zypre_BoxLoopUnitSetK(1);                                            \
+         zypre_BoxLoopUnitSetK(2);                                            \
+         zypre_BoxLoopUnitSetK(3);                                            \
+         OMPSIMD                                                              \
+         for (hypre__I = 0; hypre__I < hypre__IN; hypre__I++)                 \
+         {                                                                    \
+            HYPRE_Int i1 = hypre__row1 + hypre__I;                            \
+            HYPRE_Int i2 = hypre__row2 + hypre__I;                            \
+            HYPRE_Int i3 = hypre__row3 + hypre__I;
+
+#define zypre_BoxLoop3UnitEnd(i1, i2, i3)                                     \
+         }                                                                    \
+         zypre_BoxLoopUnitInc();                                              \
+      }                                                                       \
+   }                                                                          \
+}
+
+/* Reduction unit-stride BoxLoop1 */
+#define zypre_BoxLoop1UnitReductionBegin(ndim, loop_size, dbox1, start1, stride1, i1, reducesum) \
+        zypre_BoxLoop1UnitBegin(ndim, loop_size, dbox1, start1, stride1, i1)
+
+#define zypre_BoxLoop1UnitReductionEnd(i1, reducesum) zypre_BoxLoop1UnitEnd(i1)
+
+/* Reduction unit-stride BoxLoop2 */
+#define zypre_BoxLoop2UnitReductionBegin(ndim, loop_size, dbox1, start1, stride1, i1,            \
+                                                          dbox2, start2, stride2, i2, reducesum) \
+        zypre_BoxLoop2UnitBegin(ndim, loop_size, dbox1, start1, stride1, i1,                     \
+                                                 dbox2, start2, stride2, i2)
+
+#define zypre_BoxLoop2UnitReductionEnd(i1, i2, reducesum) zypre_BoxLoop2UnitEnd(i1, i2)
+
 /*--------------------------------------------------------------------------
  * Serial BoxLoop macros:
  * [same as the ones above (without OMP and with SetOneBlock)]
@@ -366,6 +576,16 @@
 #define hypre_BoxLoop1ReductionEndHost     zypre_BoxLoop1ReductionEnd
 #define hypre_BoxLoop2ReductionBeginHost   zypre_BoxLoop2ReductionBegin
 #define hypre_BoxLoop2ReductionEndHost     zypre_BoxLoop2ReductionEnd
+#define hypre_BoxLoop1UnitBeginHost        zypre_BoxLoop1UnitBegin
+#define hypre_BoxLoop1UnitEndHost          zypre_BoxLoop1UnitEnd
+#define hypre_BoxLoop2UnitBeginHost        zypre_BoxLoop2UnitBegin
+#define hypre_BoxLoop2UnitEndHost          zypre_BoxLoop2UnitEnd
+#define hypre_BoxLoop3UnitBeginHost        zypre_BoxLoop3UnitBegin
+#define hypre_BoxLoop3UnitEndHost          zypre_BoxLoop3UnitEnd
+#define hypre_BoxLoop1UnitReductionBeginHost zypre_BoxLoop1UnitReductionBegin
+#define hypre_BoxLoop1UnitReductionEndHost   zypre_BoxLoop1UnitReductionEnd
+#define hypre_BoxLoop2UnitReductionBeginHost zypre_BoxLoop2UnitReductionBegin
+#define hypre_BoxLoop2UnitReductionEndHost   zypre_BoxLoop2UnitReductionEnd
 
 //TODO TEMP FIX
 #if !defined(HYPRE_USING_RAJA) && !defined(HYPRE_USING_KOKKOS) && !defined(HYPRE_USING_CUDA) && !defined(HYPRE_USING_HIP) && !defined(HYPRE_USING_DEVICE_OPENMP) && !defined(HYPRE_USING_SYCL)
@@ -389,6 +609,28 @@
 #define hypre_BoxLoop1ReductionEnd     hypre_BoxLoop1ReductionEndHost
 #define hypre_BoxLoop2ReductionBegin   hypre_BoxLoop2ReductionBeginHost
 #define hypre_BoxLoop2ReductionEnd     hypre_BoxLoop2ReductionEndHost
+#define hypre_BoxLoop1UnitBegin        hypre_BoxLoop1UnitBeginHost
+#define hypre_BoxLoop1UnitEnd          hypre_BoxLoop1UnitEndHost
+#define hypre_BoxLoop2UnitBegin        hypre_BoxLoop2UnitBeginHost
+#define hypre_BoxLoop2UnitEnd          hypre_BoxLoop2UnitEndHost
+#define hypre_BoxLoop3UnitBegin        hypre_BoxLoop3UnitBeginHost
+#define hypre_BoxLoop3UnitEnd          hypre_BoxLoop3UnitEndHost
+#define hypre_BoxLoop1UnitReductionBegin hypre_BoxLoop1UnitReductionBeginHost
+#define hypre_BoxLoop1UnitReductionEnd   hypre_BoxLoop1UnitReductionEndHost
+#define hypre_BoxLoop2UnitReductionBegin hypre_BoxLoop2UnitReductionBeginHost
+#define hypre_BoxLoop2UnitReductionEnd   hypre_BoxLoop2UnitReductionEndHost
+#else
+/* The device BoxLoops have no unit-stride variants */
+#define hypre_BoxLoop1UnitBegin        hypre_BoxLoop1Begin
+#define hypre_BoxLoop1UnitEnd          hypre_BoxLoop1End
+#define hypre_BoxLoop2UnitBegin        hypre_BoxLoop2Begin
+#define hypre_BoxLoop2UnitEnd          hypre_BoxLoop2End
+#define hypre_BoxLoop3UnitBegin        hypre_BoxLoop3Begin
+#define hypre_BoxLoop3UnitEnd          hypre_BoxLoop3End
+#define hypre_BoxLoop1UnitReductionBegin hypre_BoxLoop1ReductionBegin
+#define hypre_BoxLoop1UnitReductionEnd   hypre_BoxLoop1ReductionEnd
+#define hypre_BoxLoop2UnitReductionBegin hypre_BoxLoop2ReductionBegin
+#define hypre_BoxLoop2UnitReductionEnd   hypre_BoxLoop2ReductionEnd
 #endif
 
 #endif /* #ifndef HYPRE_BOXLOOP_HOST_HEADER */
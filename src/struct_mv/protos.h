@@ -115,6 +115,8 @@ HYPRE_Int hypre_BoxManSetAssumedPartition ( hypre_BoxManager *manager,
                                             hypre_StructAssumedPart *assumed_partition );
 HYPRE_Int hypre_BoxManSetBoundingBox ( hypre_BoxManager *manager, hypre_Box *bounding_box );
 HYPRE_Int hypre_BoxManSetNumGhost ( hypre_BoxManager *manager, HYPRE_Int *num_ghost );
+HYPRE_Int hypre_BoxManSetIndexType ( hypre_BoxManager *manager, HYPRE_Int index_type );
+HYPRE_Int hypre_BoxManGetIndexType ( hypre_BoxManager *manager, HYPRE_Int *index_type );
 HYPRE_Int hypre_BoxManDeleteMultipleEntriesAndInfo ( hypre_BoxManager *manager, HYPRE_Int *indices,
                                                      HYPRE_Int num );
 HYPRE_Int hypre_BoxManCreate ( HYPRE_Int max_nentries, HYPRE_Int info_size, HYPRE_Int dim,
@@ -319,6 +321,7 @@ HYPRE_Int hypre_ComputeBoxnums ( hypre_BoxArray *boxes, HYPRE_Int *procs, HYPRE_
 HYPRE_Int hypre_StructGridPrint ( FILE *file, hypre_StructGrid *grid );
 HYPRE_Int hypre_StructGridRead ( MPI_Comm comm, FILE *file, hypre_StructGrid **grid_ptr );
 HYPRE_Int hypre_StructGridSetNumGhost ( hypre_StructGrid *grid, HYPRE_Int *num_ghost );
+HYPRE_Int hypre_StructGridSetBoxManIndexType ( hypre_StructGrid *grid, HYPRE_Int index_type );
 HYPRE_Int hypre_StructGridGetMaxBoxSize ( hypre_StructGrid *grid );
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
 HYPRE_Int hypre_StructGridSetDataLocation( HYPRE_StructGrid grid,
@@ -66,13 +66,13 @@ hypre_StructAxpy( HYPRE_Complex       alpha,
 #else
 
 #define DEVICE_VAR is_device_ptr(yp,xp)
-      hypre_BoxLoop2Begin(hypre_StructVectorNDim(x), loop_size,
-                          x_data_box, start, unit_stride, xi,
-                          y_data_box, start, unit_stride, yi);
+      hypre_BoxLoop2UnitBegin(hypre_StructVectorNDim(x), loop_size,
+                              x_data_box, start, unit_stride, xi,
+                              y_data_box, start, unit_stride, yi);
       {
          yp[yi] += alpha * xp[xi];
       }
-      hypre_BoxLoop2End(xi, yi);
+      hypre_BoxLoop2UnitEnd(xi, yi);
 #undef DEVICE_VAR
 
 #endif
@@ -53,13 +53,13 @@ hypre_StructCopy( hypre_StructVector *x,
       hypre_BoxGetSize(box, loop_size);
 
 #define DEVICE_VAR is_device_ptr(yp,xp)
-      hypre_BoxLoop2Begin(hypre_StructVectorNDim(x), loop_size,
-                          x_data_box, start, unit_stride, xi,
-                          y_data_box, start, unit_stride, yi);
+      hypre_BoxLoop2UnitBegin(hypre_StructVectorNDim(x), loop_size,
+                              x_data_box, start, unit_stride, xi,
+                              y_data_box, start, unit_stride, yi);
       {
          yp[yi] = xp[xi];
       }
-      hypre_BoxLoop2End(xi, yi);
+      hypre_BoxLoop2UnitEnd(xi, yi);
 #undef DEVICE_VAR
    }
 
@@ -112,13 +112,13 @@ hypre_StructPartialCopy( hypre_StructVector  *x,
          hypre_BoxGetSize(box, loop_size);
 
 #define DEVICE_VAR is_device_ptr(yp,xp)
-         hypre_BoxLoop2Begin(hypre_StructVectorNDim(x), loop_size,
-                             x_data_box, start, unit_stride, xi,
-                             y_data_box, start, unit_stride, yi);
+         hypre_BoxLoop2UnitBegin(hypre_StructVectorNDim(x), loop_size,
+                                 x_data_box, start, unit_stride, xi,
+                                 y_data_box, start, unit_stride, yi);
          {
             yp[yi] = xp[xi];
          }
-         hypre_BoxLoop2End(xi, yi);
+         hypre_BoxLoop2UnitEnd(xi, yi);
 #undef DEVICE_VAR
       }
    }
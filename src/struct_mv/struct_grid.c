@@ -50,6 +50,7 @@ hypre_StructGridCreate( MPI_Comm           comm,
    hypre_SetIndex(hypre_StructGridPeriodic(grid), 0);
    hypre_StructGridRefCount(grid)     = 1;
    hypre_StructGridBoxMan(grid)       = NULL;
+   hypre_StructGridBoxManIndexType(grid) = hypre_BOXMAN_INDEX_TABLE;
 
    hypre_StructGridNumPeriods(grid)   = 1;
    hypre_StructGridPShifts(grid)     = NULL;
@@ -451,6 +452,7 @@ hypre_StructGridAssemble( hypre_StructGrid *grid )
       info_size = 0; /* we don't need an info object */
       hypre_BoxManCreate(max_nentries, info_size, ndim, bounding_box,
                          comm, &boxman);
+      hypre_BoxManSetIndexType(boxman, hypre_StructGridBoxManIndexType(grid));
 
       /******** populate the box manager with my local boxes and gather neighbor
                 information  ******/
@@ -854,6 +856,21 @@ hypre_StructGridSetNumGhost( hypre_StructGrid *grid, HYPRE_Int  *num_ghost )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_StructGridSetBoxManIndexType
+ *
+ * Spatial index of the box manager created at the assemble, see
+ * hypre_BoxManSetIndexType.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructGridSetBoxManIndexType( hypre_StructGrid *grid, HYPRE_Int index_type )
+{
+   hypre_StructGridBoxManIndexType(grid) = index_type;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_StructGridGetMaxBoxSize
  *--------------------------------------------------------------------------*/
@@ -150,12 +150,12 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
          hypre_BoxGetSize(box, loop_size);
 
 #define DEVICE_VAR is_device_ptr(yp)
-         hypre_BoxLoop1Begin(hypre_StructVectorNDim(x), loop_size,
-                             y_data_box, start, stride, yi);
+         hypre_BoxLoop1UnitBegin(hypre_StructVectorNDim(x), loop_size,
+                                 y_data_box, start, stride, yi);
          {
             yp[yi] *= beta;
          }
-         hypre_BoxLoop1End(yi);
+         hypre_BoxLoop1UnitEnd(yi);
 #undef DEVICE_VAR
       }
 
@@ -212,23 +212,23 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
                   {
                      hypre_BoxGetSize(box, loop_size);
 
-                     hypre_BoxLoop1Begin(hypre_StructVectorNDim(x), loop_size,
-                                         y_data_box, start, stride, yi);
+                     hypre_BoxLoop1UnitBegin(hypre_StructVectorNDim(x), loop_size,
+                                             y_data_box, start, stride, yi);
                      {
                         yp[yi] = 0.0;
                      }
-                     hypre_BoxLoop1End(yi);
+                     hypre_BoxLoop1UnitEnd(yi);
                   }
                   else
                   {
                      hypre_BoxGetSize(box, loop_size);
 
-                     hypre_BoxLoop1Begin(hypre_StructVectorNDim(x), loop_size,
-                                         y_data_box, start, stride, yi);
+                     hypre_BoxLoop1UnitBegin(hypre_StructVectorNDim(x), loop_size,
+                                             y_data_box, start, stride, yi);
                      {
                         yp[yi] *= temp;
                      }
-                     hypre_BoxLoop1End(yi);
+                     hypre_BoxLoop1UnitEnd(yi);
                   }
 #undef DEVICE_VAR
                }
@@ -378,10 +378,10 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
                                                   stencil_shape[si + 6]);
 
 #define DEVICE_VAR is_device_ptr(yp,Ap0,Ap1,Ap2,Ap3,Ap4,Ap5,Ap6,xp)
-                  hypre_BoxLoop3Begin(ndim, loop_size,
-                                      A_data_box, start, stride, Ai,
-                                      x_data_box, start, stride, xi,
-                                      y_data_box, start, stride, yi);
+                  hypre_BoxLoop3UnitBegin(ndim, loop_size,
+                                          A_data_box, start, stride, Ai,
+                                          x_data_box, start, stride, xi,
+                                          y_data_box, start, stride, yi);
                   {
                      yp[yi] +=
                         Ap0[Ai] * xp[xi + xoff0] +
@@ -392,7 +392,7 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
                         Ap5[Ai] * xp[xi + xoff5] +
                         Ap6[Ai] * xp[xi + xoff6];
                   }
-                  hypre_BoxLoop3End(Ai, xi, yi);
+                  hypre_BoxLoop3UnitEnd(Ai, xi, yi);
 #undef DEVICE_VAR
 
                   break;
@@ -419,10 +419,10 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
                                                   stencil_shape[si + 5]);
 
 #define DEVICE_VAR is_device_ptr(yp,Ap0,Ap1,Ap2,Ap3,Ap4,Ap5,xp)
-                  hypre_BoxLoop3Begin(ndim, loop_size,
-                                      A_data_box, start, stride, Ai,
-                                      x_data_box, start, stride, xi,
-                                      y_data_box, start, stride, yi);
+                  hypre_BoxLoop3UnitBegin(ndim, loop_size,
+                                          A_data_box, start, stride, Ai,
+                                          x_data_box, start, stride, xi,
+                                          y_data_box, start, stride, yi);
                   {
                      yp[yi] +=
                         Ap0[Ai] * xp[xi + xoff0] +
@@ -432,7 +432,7 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
                         Ap4[Ai] * xp[xi + xoff4] +
                         Ap5[Ai] * xp[xi + xoff5];
                   }
-                  hypre_BoxLoop3End(Ai, xi, yi);
+                  hypre_BoxLoop3UnitEnd(Ai, xi, yi);
 #undef DEVICE_VAR
 
                   break;
@@ -456,10 +456,10 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
                                                   stencil_shape[si + 4]);
 
 #define DEVICE_VAR is_device_ptr(yp,Ap0,Ap1,Ap2,Ap3,Ap4,xp)
-                  hypre_BoxLoop3Begin(ndim, loop_size,
-                                      A_data_box, start, stride, Ai,
-                                      x_data_box, start, stride, xi,
-                                      y_data_box, start, stride, yi);
+                  hypre_BoxLoop3UnitBegin(ndim, loop_size,
+                                          A_data_box, start, stride, Ai,
+                                          x_data_box, start, stride, xi,
+                                          y_data_box, start, stride, yi);
                   {
                      yp[yi] +=
                         Ap0[Ai] * xp[xi + xoff0] +
@@ -468,7 +468,7 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
                         Ap3[Ai] * xp[xi + xoff3] +
                         Ap4[Ai] * xp[xi + xoff4];
                   }
-                  hypre_BoxLoop3End(Ai, xi, yi);
+                  hypre_BoxLoop3UnitEnd(Ai, xi, yi);
 #undef DEVICE_VAR
 
                   break;
@@ -489,10 +489,10 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
                                                   stencil_shape[si + 3]);
 
 #define DEVICE_VAR is_device_ptr(yp,Ap0,Ap1,Ap2,Ap3,xp)
-                  hypre_BoxLoop3Begin(ndim, loop_size,
-                                      A_data_box, start, stride, Ai,
-                                      x_data_box, start, stride, xi,
-                                      y_data_box, start, stride, yi);
+                  hypre_BoxLoop3UnitBegin(ndim, loop_size,
+                                          A_data_box, start, stride, Ai,
+                                          x_data_box, start, stride, xi,
+                                          y_data_box, start, stride, yi);
                   {
                      yp[yi] +=
                         Ap0[Ai] * xp[xi + xoff0] +
@@ -500,7 +500,7 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
                         Ap2[Ai] * xp[xi + xoff2] +
                         Ap3[Ai] * xp[xi + xoff3];
                   }
-                  hypre_BoxLoop3End(Ai, xi, yi);
+                  hypre_BoxLoop3UnitEnd(Ai, xi, yi);
 #undef DEVICE_VAR
 
                   break;
@@ -518,17 +518,17 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
                                                   stencil_shape[si + 2]);
 
 #define DEVICE_VAR is_device_ptr(yp,Ap0,Ap1,Ap2,xp)
-                  hypre_BoxLoop3Begin(ndim, loop_size,
-                                      A_data_box, start, stride, Ai,
-                                      x_data_box, start, stride, xi,
-                                      y_data_box, start, stride, yi);
+                  hypre_BoxLoop3UnitBegin(ndim, loop_size,
+                                          A_data_box, start, stride, Ai,
+                                          x_data_box, start, stride, xi,
+                                          y_data_box, start, stride, yi);
                   {
                      yp[yi] +=
                         Ap0[Ai] * xp[xi + xoff0] +
                         Ap1[Ai] * xp[xi + xoff1] +
                         Ap2[Ai] * xp[xi + xoff2];
                   }
-                  hypre_BoxLoop3End(Ai, xi, yi);
+                  hypre_BoxLoop3UnitEnd(Ai, xi, yi);
 #undef DEVICE_VAR
 
                   break;
@@ -543,16 +543,16 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
                                                   stencil_shape[si + 1]);
 
 #define DEVICE_VAR is_device_ptr(yp,Ap0,Ap1,xp)
-                  hypre_BoxLoop3Begin(ndim, loop_size,
-                                      A_data_box, start, stride, Ai,
-                                      x_data_box, start, stride, xi,
-                                      y_data_box, start, stride, yi);
+                  hypre_BoxLoop3UnitBegin(ndim, loop_size,
+                                          A_data_box, start, stride, Ai,
+                                          x_data_box, start, stride, xi,
+                                          y_data_box, start, stride, yi);
                   {
                      yp[yi] +=
                         Ap0[Ai] * xp[xi + xoff0] +
                         Ap1[Ai] * xp[xi + xoff1];
                   }
-                  hypre_BoxLoop3End(Ai, xi, yi);
+                  hypre_BoxLoop3UnitEnd(Ai, xi, yi);
 #undef DEVICE_VAR
 
                   break;
@@ -564,15 +564,15 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
                                                   stencil_shape[si + 0]);
 
 #define DEVICE_VAR is_device_ptr(yp,Ap0,xp)
-                  hypre_BoxLoop3Begin(ndim, loop_size,
-                                      A_data_box, start, stride, Ai,
-                                      x_data_box, start, stride, xi,
-                                      y_data_box, start, stride, yi);
+                  hypre_BoxLoop3UnitBegin(ndim, loop_size,
+                                          A_data_box, start, stride, Ai,
+                                          x_data_box, start, stride, xi,
+                                          y_data_box, start, stride, yi);
                   {
                      yp[yi] +=
                         Ap0[Ai] * xp[xi + xoff0];
                   }
-                  hypre_BoxLoop3End(Ai, xi, yi);
+                  hypre_BoxLoop3UnitEnd(Ai, xi, yi);
 #undef DEVICE_VAR
 
                   break;
@@ -582,12 +582,12 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
          if (alpha != 1.0)
          {
 #define DEVICE_VAR is_device_ptr(yp)
-            hypre_BoxLoop1Begin(ndim, loop_size,
-                                y_data_box, start, stride, yi);
+            hypre_BoxLoop1UnitBegin(ndim, loop_size,
+                                    y_data_box, start, stride, yi);
             {
                yp[yi] *= alpha;
             }
-            hypre_BoxLoop1End(yi);
+            hypre_BoxLoop1UnitEnd(yi);
 #undef DEVICE_VAR
          }
       }
@@ -712,9 +712,9 @@ HYPRE_Int hypre_StructMatvecCC1( HYPRE_Complex       alpha,
                                                   stencil_shape[si + 6]);
 
 #define DEVICE_VAR is_device_ptr(yp,xp)
-                  hypre_BoxLoop2Begin(ndim, loop_size,
-                                      x_data_box, start, stride, xi,
-                                      y_data_box, start, stride, yi);
+                  hypre_BoxLoop2UnitBegin(ndim, loop_size,
+                                          x_data_box, start, stride, xi,
+                                          y_data_box, start, stride, yi);
                   {
                      yp[yi] +=
                         AAp0 * xp[xi + xoff0] +
@@ -725,7 +725,7 @@ HYPRE_Int hypre_StructMatvecCC1( HYPRE_Complex       alpha,
                         AAp5 * xp[xi + xoff5] +
                         AAp6 * xp[xi + xoff6];
                   }
-                  hypre_BoxLoop2End(xi, yi);
+                  hypre_BoxLoop2UnitEnd(xi, yi);
 #undef DEVICE_VAR
                   break;
 
@@ -757,9 +757,9 @@ HYPRE_Int hypre_StructMatvecCC1( HYPRE_Complex       alpha,
                                                   stencil_shape[si + 5]);
 
 #define DEVICE_VAR is_device_ptr(yp,xp)
-                  hypre_BoxLoop2Begin(ndim, loop_size,
-                                      x_data_box, start, stride, xi,
-                                      y_data_box, start, stride, yi);
+                  hypre_BoxLoop2UnitBegin(ndim, loop_size,
+                                          x_data_box, start, stride, xi,
+                                          y_data_box, start, stride, yi);
                   {
                      yp[yi] +=
                         AAp0 * xp[xi + xoff0] +
@@ -769,7 +769,7 @@ HYPRE_Int hypre_StructMatvecCC1( HYPRE_Complex       alpha,
                         AAp4 * xp[xi + xoff4] +
                         AAp5 * xp[xi + xoff5];
                   }
-                  hypre_BoxLoop2End(xi, yi);
+                  hypre_BoxLoop2UnitEnd(xi, yi);
 #undef DEVICE_VAR
                   break;
 
@@ -797,9 +797,9 @@ HYPRE_Int hypre_StructMatvecCC1( HYPRE_Complex       alpha,
                                                   stencil_shape[si + 4]);
 
 #define DEVICE_VAR is_device_ptr(yp,xp)
-                  hypre_BoxLoop2Begin(ndim, loop_size,
-                                      x_data_box, start, stride, xi,
-                                      y_data_box, start, stride, yi);
+                  hypre_BoxLoop2UnitBegin(ndim, loop_size,
+                                          x_data_box, start, stride, xi,
+                                          y_data_box, start, stride, yi);
                   {
                      yp[yi] +=
                         AAp0 * xp[xi + xoff0] +
@@ -808,7 +808,7 @@ HYPRE_Int hypre_StructMatvecCC1( HYPRE_Complex       alpha,
                         AAp3 * xp[xi + xoff3] +
                         AAp4 * xp[xi + xoff4];
                   }
-                  hypre_BoxLoop2End(xi, yi);
+                  hypre_BoxLoop2UnitEnd(xi, yi);
 #undef DEVICE_VAR
                   break;
 
@@ -832,9 +832,9 @@ HYPRE_Int hypre_StructMatvecCC1( HYPRE_Complex       alpha,
                                                   stencil_shape[si + 3]);
 
 #define DEVICE_VAR is_device_ptr(yp,xp)
-                  hypre_BoxLoop2Begin(ndim, loop_size,
-                                      x_data_box, start, stride, xi,
-                                      y_data_box, start, stride, yi);
+                  hypre_BoxLoop2UnitBegin(ndim, loop_size,
+                                          x_data_box, start, stride, xi,
+                                          y_data_box, start, stride, yi);
                   {
                      yp[yi] +=
                         AAp0 * xp[xi + xoff0] +
@@ -842,7 +842,7 @@ HYPRE_Int hypre_StructMatvecCC1( HYPRE_Complex       alpha,
                         AAp2 * xp[xi + xoff2] +
                         AAp3 * xp[xi + xoff3];
                   }
-                  hypre_BoxLoop2End(xi, yi);
+                  hypre_BoxLoop2UnitEnd(xi, yi);
 #undef DEVICE_VAR
                   break;
 
@@ -862,16 +862,16 @@ HYPRE_Int hypre_StructMatvecCC1( HYPRE_Complex       alpha,
                                                   stencil_shape[si + 2]);
 
 #define DEVICE_VAR is_device_ptr(yp,xp)
-                  hypre_BoxLoop2Begin(ndim, loop_size,
-                                      x_data_box, start, stride, xi,
-                                      y_data_box, start, stride, yi);
+                  hypre_BoxLoop2UnitBegin(ndim, loop_size,
+                                          x_data_box, start, stride, xi,
+                                          y_data_box, start, stride, yi);
                   {
                      yp[yi] +=
                         AAp0 * xp[xi + xoff0] +
                         AAp1 * xp[xi + xoff1] +
                         AAp2 * xp[xi + xoff2];
                   }
-                  hypre_BoxLoop2End(xi, yi);
+                  hypre_BoxLoop2UnitEnd(xi, yi);
 #undef DEVICE_VAR
                   break;
 
@@ -887,15 +887,15 @@ HYPRE_Int hypre_StructMatvecCC1( HYPRE_Complex       alpha,
                                                   stencil_shape[si + 1]);
 
 #define DEVICE_VAR is_device_ptr(yp,xp)
-                  hypre_BoxLoop2Begin(ndim, loop_size,
-                                      x_data_box, start, stride, xi,
-                                      y_data_box, start, stride, yi);
+                  hypre_BoxLoop2UnitBegin(ndim, loop_size,
+                                          x_data_box, start, stride, xi,
+                                          y_data_box, start, stride, yi);
                   {
                      yp[yi] +=
                         AAp0 * xp[xi + xoff0] +
                         AAp1 * xp[xi + xoff1];
                   }
-                  hypre_BoxLoop2End(xi, yi);
+                  hypre_BoxLoop2UnitEnd(xi, yi);
 #undef DEVICE_VAR
                   break;
 
@@ -907,14 +907,14 @@ HYPRE_Int hypre_StructMatvecCC1( HYPRE_Complex       alpha,
                                                   stencil_shape[si + 0]);
 
 #define DEVICE_VAR is_device_ptr(yp,xp)
-                  hypre_BoxLoop2Begin(ndim, loop_size,
-                                      x_data_box, start, stride, xi,
-                                      y_data_box, start, stride, yi);
+                  hypre_BoxLoop2UnitBegin(ndim, loop_size,
+                                          x_data_box, start, stride, xi,
+                                          y_data_box, start, stride, yi);
                   {
                      yp[yi] +=
                         AAp0 * xp[xi + xoff0];
                   }
-                  hypre_BoxLoop2End(xi, yi);
+                  hypre_BoxLoop2UnitEnd(xi, yi);
 #undef DEVICE_VAR
             }
          }
@@ -1070,9 +1070,9 @@ HYPRE_Int hypre_StructMatvecCC2( HYPRE_Complex       alpha,
                                                   stencil_shape[si + 6]);
 
 #define DEVICE_VAR is_device_ptr(yp,xp)
-                  hypre_BoxLoop2Begin(ndim, loop_size,
-                                      x_data_box, start, stride, xi,
-                                      y_data_box, start, stride, yi);
+                  hypre_BoxLoop2UnitBegin(ndim, loop_size,
+                                          x_data_box, start, stride, xi,
+                                          y_data_box, start, stride, yi);
                   {
                      yp[yi] +=
                         AAp0 * xp[xi + xoff0] +
@@ -1083,7 +1083,7 @@ HYPRE_Int hypre_StructMatvecCC2( HYPRE_Complex       alpha,
                         AAp5 * xp[xi + xoff5] +
                         AAp6 * xp[xi + xoff6];
                   }
-                  hypre_BoxLoop2End(xi, yi);
+                  hypre_BoxLoop2UnitEnd(xi, yi);
 #undef DEVICE_VAR
 
                   break;
@@ -1128,9 +1128,9 @@ HYPRE_Int hypre_StructMatvecCC2( HYPRE_Complex       alpha,
                                                   stencil_shape[si + 5]);
 
 #define DEVICE_VAR is_device_ptr(yp,xp)
-                  hypre_BoxLoop2Begin(ndim, loop_size,
-                                      x_data_box, start, stride, xi,
-                                      y_data_box, start, stride, yi);
+                  hypre_BoxLoop2UnitBegin(ndim, loop_size,
+                                          x_data_box, start, stride, xi,
+                                          y_data_box, start, stride, yi);
                   {
                      yp[yi] +=
                         AAp0 * xp[xi + xoff0] +
@@ -1140,7 +1140,7 @@ HYPRE_Int hypre_StructMatvecCC2( HYPRE_Complex       alpha,
                         AAp4 * xp[xi + xoff4] +
                         AAp5 * xp[xi + xoff5];
                   }
-                  hypre_BoxLoop2End(xi, yi);
+                  hypre_BoxLoop2UnitEnd(xi, yi);
 #undef DEVICE_VAR
                   break;
 
@@ -1179,9 +1179,9 @@ HYPRE_Int hypre_StructMatvecCC2( HYPRE_Complex       alpha,
                                                   stencil_shape[si + 4]);
 
 #define DEVICE_VAR is_device_ptr(yp,xp)
-                  hypre_BoxLoop2Begin(ndim, loop_size,
-                                      x_data_box, start, stride, xi,
-                                      y_data_box, start, stride, yi);
+                  hypre_BoxLoop2UnitBegin(ndim, loop_size,
+                                          x_data_box, start, stride, xi,
+                                          y_data_box, start, stride, yi);
                   {
                      yp[yi] +=
                         AAp0 * xp[xi + xoff0] +
@@ -1190,7 +1190,7 @@ HYPRE_Int hypre_StructMatvecCC2( HYPRE_Complex       alpha,
                         AAp3 * xp[xi + xoff3] +
                         AAp4 * xp[xi + xoff4];
                   }
-                  hypre_BoxLoop2End(xi, yi);
+                  hypre_BoxLoop2UnitEnd(xi, yi);
 #undef DEVICE_VAR
                   break;
 
@@ -1224,9 +1224,9 @@ HYPRE_Int hypre_StructMatvecCC2( HYPRE_Complex       alpha,
                                                   stencil_shape[si + 3]);
 
 #define DEVICE_VAR is_device_ptr(yp,xp)
-                  hypre_BoxLoop2Begin(ndim, loop_size,
-                                      x_data_box, start, stride, xi,
-                                      y_data_box, start, stride, yi);
+                  hypre_BoxLoop2UnitBegin(ndim, loop_size,
+                                          x_data_box, start, stride, xi,
+                                          y_data_box, start, stride, yi);
                   {
                      yp[yi] +=
                         AAp0 * xp[xi + xoff0] +
@@ -1234,7 +1234,7 @@ HYPRE_Int hypre_StructMatvecCC2( HYPRE_Complex       alpha,
                         AAp2 * xp[xi + xoff2] +
                         AAp3 * xp[xi + xoff3];
                   }
-                  hypre_BoxLoop2End(xi, yi);
+                  hypre_BoxLoop2UnitEnd(xi, yi);
 #undef DEVICE_VAR
                   break;
 
@@ -1263,16 +1263,16 @@ HYPRE_Int hypre_StructMatvecCC2( HYPRE_Complex       alpha,
                                                   stencil_shape[si + 2]);
 
 #define DEVICE_VAR is_device_ptr(yp,xp)
-                  hypre_BoxLoop2Begin(ndim, loop_size,
-                                      x_data_box, start, stride, xi,
-                                      y_data_box, start, stride, yi);
+                  hypre_BoxLoop2UnitBegin(ndim, loop_size,
+                                          x_data_box, start, stride, xi,
+                                          y_data_box, start, stride, yi);
                   {
                      yp[yi] +=
                         AAp0 * xp[xi + xoff0] +
                         AAp1 * xp[xi + xoff1] +
                         AAp2 * xp[xi + xoff2];
                   }
-                  hypre_BoxLoop2End(xi, yi);
+                  hypre_BoxLoop2UnitEnd(xi, yi);
 #undef DEVICE_VAR
                   break;
 
@@ -1296,15 +1296,15 @@ HYPRE_Int hypre_StructMatvecCC2( HYPRE_Complex       alpha,
                                                   stencil_shape[si + 1]);
 
 #define DEVICE_VAR is_device_ptr(yp,xp)
-                  hypre_BoxLoop2Begin(ndim, loop_size,
-                                      x_data_box, start, stride, xi,
-                                      y_data_box, start, stride, yi);
+                  hypre_BoxLoop2UnitBegin(ndim, loop_size,
+                                          x_data_box, start, stride, xi,
+                                          y_data_box, start, stride, yi);
                   {
                      yp[yi] +=
                         AAp0 * xp[xi + xoff0] +
                         AAp1 * xp[xi + xoff1];
                   }
-                  hypre_BoxLoop2End(xi, yi);
+                  hypre_BoxLoop2UnitEnd(xi, yi);
 #undef DEVICE_VAR
                   break;
 
@@ -1320,14 +1320,14 @@ HYPRE_Int hypre_StructMatvecCC2( HYPRE_Complex       alpha,
                                                   stencil_shape[si + 0]);
 
 #define DEVICE_VAR is_device_ptr(yp,xp)
-                  hypre_BoxLoop2Begin(ndim, loop_size,
-                                      x_data_box, start, stride, xi,
-                                      y_data_box, start, stride, yi);
+                  hypre_BoxLoop2UnitBegin(ndim, loop_size,
+                                          x_data_box, start, stride, xi,
+                                          y_data_box, start, stride, yi);
                   {
                      yp[yi] +=
                         AAp0 * xp[xi + xoff0];
                   }
-                  hypre_BoxLoop2End(xi, yi);
+                  hypre_BoxLoop2UnitEnd(xi, yi);
 #undef DEVICE_VAR
 
                   break;
@@ -1340,29 +1340,29 @@ HYPRE_Int hypre_StructMatvecCC2( HYPRE_Complex       alpha,
          if (alpha != 1.0 )
          {
 #define DEVICE_VAR is_device_ptr(yp,Ap0,xp)
-            hypre_BoxLoop3Begin(ndim, loop_size,
-                                A_data_box, start, stride, Ai,
-                                x_data_box, start, stride, xi,
-                                y_data_box, start, stride, yi);
+            hypre_BoxLoop3UnitBegin(ndim, loop_size,
+                                    A_data_box, start, stride, Ai,
+                                    x_data_box, start, stride, xi,
+                                    y_data_box, start, stride, yi);
             {
                yp[yi] = alpha * ( yp[yi] +
                                   Ap0[Ai] * xp[xi + xoff0] );
             }
-            hypre_BoxLoop3End(Ai, xi, yi);
+            hypre_BoxLoop3UnitEnd(Ai, xi, yi);
 #undef DEVICE_VAR
          }
          else
          {
 #define DEVICE_VAR is_device_ptr(yp,Ap0,xp)
-            hypre_BoxLoop3Begin(ndim, loop_size,
-                                A_data_box, start, stride, Ai,
-                                x_data_box, start, stride, xi,
-                                y_data_box, start, stride, yi);
+            hypre_BoxLoop3UnitBegin(ndim, loop_size,
+                                    A_data_box, start, stride, Ai,
+                                    x_data_box, start, stride, xi,
+                                    y_data_box, start, stride, yi);
             {
                yp[yi] +=
                   Ap0[Ai] * xp[xi + xoff0];
             }
-            hypre_BoxLoop3End(Ai, xi, yi);
+            hypre_BoxLoop3UnitEnd(Ai, xi, yi);
 #undef DEVICE_VAR
          }
 
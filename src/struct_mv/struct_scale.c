@@ -48,12 +48,12 @@ hypre_StructScale( HYPRE_Complex       alpha,
       hypre_BoxGetSize(box, loop_size);
 
 #define DEVICE_VAR is_device_ptr(yp)
-      hypre_BoxLoop1Begin(hypre_StructVectorNDim(y), loop_size,
-                          y_data_box, start, unit_stride, yi);
+      hypre_BoxLoop1UnitBegin(hypre_StructVectorNDim(y), loop_size,
+                              y_data_box, start, unit_stride, yi);
       {
          yp[yi] *= alpha;
       }
-      hypre_BoxLoop1End(yi);
+      hypre_BoxLoop1UnitEnd(yi);
 #undef DEVICE_VAR
    }
 
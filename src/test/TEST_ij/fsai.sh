@@ -32,6 +32,9 @@ FILES="\
  ${TNAME}.out.16\
  ${TNAME}.out.17\
  ${TNAME}.out.18\
+ ${TNAME}.out.19\
+ ${TNAME}.out.20\
+ ${TNAME}.out.21\
  ${TNAME}.out.100\
  ${TNAME}.out.101\
  ${TNAME}.out.102\
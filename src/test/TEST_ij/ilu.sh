@@ -35,6 +35,8 @@ FILES="\
  ${TNAME}.out.323\
  ${TNAME}.out.324\
  ${TNAME}.out.325\
+ ${TNAME}.out.326\
+ ${TNAME}.out.327\
 "
 
 for i in $FILES
@@ -21,6 +21,8 @@ FILES="\
  ${TNAME}.out.103\
  ${TNAME}.out.150\
  ${TNAME}.out.151\
+ ${TNAME}.out.200\
+ ${TNAME}.out.201\
 "
 
 for i in $FILES
@@ -186,6 +186,18 @@ FILES="\
  ${TNAME}.out.213\
  ${TNAME}.out.404\
  ${TNAME}.out.405\
+ ${TNAME}.out.406\
+ ${TNAME}.out.407\
+ ${TNAME}.out.408\
+ ${TNAME}.out.409\
+ ${TNAME}.out.410\
+ ${TNAME}.out.411\
+ ${TNAME}.out.412\
+ ${TNAME}.out.413\
+ ${TNAME}.out.414\
+ ${TNAME}.out.415\
+ ${TNAME}.out.416\
+ ${TNAME}.out.417\
 "
 
 for i in $FILES
@@ -81,5 +81,30 @@ if [ "$OUTCOUNT" != "$RUNCOUNT" ]; then
    echo "Incorrect number of runs in ${TNAME}.out.B" >&2
 fi
 
+#=============================================================================
+# C. AMG: multi-component vector tests
+#=============================================================================
+
+FILES="\
+ ${TNAME}.out.C0\
+ ${TNAME}.out.C1\
+ ${TNAME}.out.C2\
+ ${TNAME}.out.C3\
+ ${TNAME}.out.C4
+"
+
+for i in $FILES
+do
+  echo "# Output file: $i"
+  tail -3 $i
+done > ${TNAME}.out.C
+
+# Make sure that the output file is reasonable
+RUNCOUNT=`echo $FILES | wc -w`
+OUTCOUNT=`grep "Iterations" ${TNAME}.out.C | wc -l`
+if [ "$OUTCOUNT" != "$RUNCOUNT" ]; then
+   echo "Incorrect number of runs in ${TNAME}.out.C" >&2
+fi
+
 # put all of the output files together
 cat ${TNAME}.out.[A-Z] > ${TNAME}.out
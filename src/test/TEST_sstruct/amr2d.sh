@@ -33,6 +33,8 @@ FILES="\
  ${TNAME}.out.11\
  ${TNAME}.out.12\
  ${TNAME}.out.13\
+ ${TNAME}.out.14\
+ ${TNAME}.out.15\
 "
 
 for i in $FILES
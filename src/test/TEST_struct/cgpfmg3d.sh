@@ -16,6 +16,15 @@ tail -3 ${TNAME}.out.0 > ${TNAME}.testdata
 tail -3 ${TNAME}.out.1 > ${TNAME}.testdata.temp
 diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
 
+#=============================================================================
+# struct: Test tiled host BoxLoops by diffing against the untiled base case
+#=============================================================================
+
+tail -3 ${TNAME}.out.2 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+tail -3 ${TNAME}.out.3 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
 #=============================================================================
 # compare with baseline case
 #=============================================================================
@@ -23,6 +32,8 @@ diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
 FILES="\
  ${TNAME}.out.0\
  ${TNAME}.out.1\
+ ${TNAME}.out.2\
+ ${TNAME}.out.3\
 "
 
 for i in $FILES
@@ -96,6 +96,8 @@ HYPRE_Int SetSysVcoefValues(HYPRE_Int num_fun, HYPRE_BigInt nx, HYPRE_BigInt ny,
 
 HYPRE_Int BuildParCoordinates (HYPRE_Int argc, char *argv [], HYPRE_Int arg_index,
                                HYPRE_Int *coorddim_ptr, float **coord_ptr );
+HYPRE_Int PerturbIJMatrixValues (HYPRE_IJMatrix ij_A, HYPRE_ParCSRMatrix parcsr_A,
+                                 HYPRE_Real eps);
 
 extern HYPRE_Int hypre_FlexGMRESModifyPCAMGExample(void *precond_data, HYPRE_Int iterations,
                                                    HYPRE_Real rel_residual_norm);
@@ -242,6 +244,8 @@ main( hypre_int argc,
    HYPRE_Int      P_max_elmts = 4;
    HYPRE_Int      cycle_type;
    HYPRE_Int      fcycle;
+   HYPRE_Int      adaptive_cycle = 0;
+   HYPRE_Real     adaptive_cycle_tol = 0.9;
    HYPRE_Int      coarsen_type = 10;
    HYPRE_Int      measure_type = 0;
    HYPRE_Int      num_sweeps = 1;
@@ -275,6 +279,17 @@ main( hypre_int argc,
    HYPRE_Int    rap2     = 0;
    HYPRE_Int    mod_rap2 = 0;
    HYPRE_Int    keepTranspose = 0;
+   HYPRE_Int    mv_format = 0;
+   HYPRE_Int    mv_format_nlv = -1;
+   HYPRE_Int    mv_overlap = 0;
+   HYPRE_Int    test_csr = 0;
+   HYPRE_Int    *csr_row_ptr = NULL;
+   HYPRE_BigInt *csr_cols = NULL;
+   HYPRE_Complex *csr_values = NULL;
+   HYPRE_Int    node_comm = 0;
+   HYPRE_Int    host_arena = 0;
+   HYPRE_Int    sp_level = 0;
+   HYPRE_Int    setup_reuse = 0;
 #ifdef HYPRE_USING_DSUPERLU
    HYPRE_Int    dslu_threshold = -1;
 #endif
@@ -294,6 +309,8 @@ main( hypre_int argc,
    HYPRE_Int  cheby_variant = 0;
    HYPRE_Int  cheby_scale = 1;
    HYPRE_Real cheby_fraction = .3;
+   HYPRE_Int  cheby_lanczos = 0;
+   HYPRE_Real cheby_refresh_tol = 0.0;
 
 #if defined(HYPRE_USING_GPU)
 #if defined(HYPRE_USING_CUSPARSE) && CUSPARSE_VERSION >= 11000
@@ -346,6 +363,8 @@ main( hypre_int argc,
    /* parameters for COGMRES */
    HYPRE_Int    cgs = 1;
    HYPRE_Int    unroll = 0;
+   HYPRE_Int    s_step = 0;
+   HYPRE_Int    s_step_basis = 1;
    /* parameters for LGMRES */
    HYPRE_Int    aug_dim;
    /* parameters for GSMG */
@@ -364,8 +383,11 @@ main( hypre_int argc,
 
    HYPRE_Int    print_system = 0;
    HYPRE_Int    print_system_binary = 0;
+   HYPRE_Int    print_system_mpiio = 0;
    HYPRE_Int    rel_change = 0;
    HYPRE_Int    second_time = 0;
+   HYPRE_Real   second_perturb = 0.0;
+   HYPRE_Int    second_setup = 1;
    HYPRE_Int    benchmark = 0;
 
    /* begin lobpcg */
@@ -387,6 +409,8 @@ main( hypre_int argc,
    HYPRE_Int  two_norm = 1;
    HYPRE_Int  skip_break = 0;
    HYPRE_Int  flex = 0;
+   HYPRE_Int  pipelined = 0;
+   HYPRE_Int  recompute_res_p = 0;
    HYPRE_Int  pcgIterations = 0;
    HYPRE_Int  pcgMode = 1;
    HYPRE_Real pcgTol = 1e-2;
@@ -461,6 +485,7 @@ main( hypre_int argc,
    HYPRE_Real fsai_threshold = 1.0e-02;
    HYPRE_Int  fsai_eig_max_iters = 5;
    HYPRE_Real fsai_kap_tolerance = 1.0e-03;
+   HYPRE_Int  fsai_reuse = 0;
    /* end hypre FSAI options */
 
    HYPRE_Real     *nongalerk_tol = NULL;
@@ -686,6 +711,12 @@ main( hypre_int argc,
          build_matrix_type      = -1;
          build_matrix_arg_index = arg_index;
       }
+      else if ( strcmp(argv[arg_index], "-fromMMfile") == 0 )
+      {
+         arg_index++;
+         build_matrix_type      = -3;
+         build_matrix_arg_index = arg_index;
+      }
       else if ( strcmp(argv[arg_index], "-auxfromfile") == 0 )
       {
          arg_index++;
@@ -704,6 +735,12 @@ main( hypre_int argc,
          build_matrix_type      = 1;
          build_matrix_arg_index = arg_index;
       }
+      else if ( strcmp(argv[arg_index], "-frommpiiofile") == 0 )
+      {
+         arg_index++;
+         build_matrix_type      = 9;
+         build_matrix_arg_index = arg_index;
+      }
       else if ( strcmp(argv[arg_index], "-laplacian") == 0 )
       {
          arg_index++;
@@ -832,6 +869,11 @@ main( hypre_int argc,
             solver_id = atoi(argv[arg_index++]);
          }
       }
+      else if ( strcmp(argv[arg_index], "-nthreads") == 0 )
+      {
+         arg_index++;
+         hypre_SetNumThreads(atoi(argv[arg_index++]));
+      }
       else if ( strcmp(argv[arg_index], "-rbm") == 0 )
       {
          arg_index++;
@@ -868,6 +910,12 @@ main( hypre_int argc,
          build_rhs_type      = 7;
          build_rhs_arg_index = arg_index;
       }
+      else if ( strcmp(argv[arg_index], "-rhsmpiiofile") == 0 )
+      {
+         arg_index++;
+         build_rhs_type      = 8;
+         build_rhs_arg_index = arg_index;
+      }
       else if ( strcmp(argv[arg_index], "-rhsisone") == 0 )
       {
          arg_index++;
@@ -1464,6 +1512,11 @@ main( hypre_int argc,
          arg_index++;
          fsai_kap_tolerance = (HYPRE_Real)atof(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-fs_reuse") == 0 )
+      {
+         arg_index++;
+         fsai_reuse = atoi(argv[arg_index++]);
+      }
       /* end FSAI options */
 #if defined(HYPRE_USING_GPU)
       else if ( strcmp(argv[arg_index], "-mm_vendor") == 0 )
@@ -1566,6 +1619,16 @@ main( hypre_int argc,
          arg_index++;
          second_time = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-second_perturb") == 0 )
+      {
+         arg_index++;
+         second_perturb = (HYPRE_Real) atof(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-second_setup") == 0 )
+      {
+         arg_index++;
+         second_setup = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-benchmark") == 0 )
       {
          arg_index++;
@@ -1681,6 +1744,16 @@ main( hypre_int argc,
          arg_index++;
          unroll = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-sstep") == 0 )
+      {
+         arg_index++;
+         s_step = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-sstep_basis") == 0 )
+      {
+         arg_index++;
+         s_step_basis = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-check_residual") == 0 )
       {
          arg_index++;
@@ -1919,6 +1992,16 @@ main( hypre_int argc,
          arg_index++;
          flex  = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-pipelined") == 0 )
+      {
+         arg_index++;
+         pipelined  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-recompute_p") == 0 )
+      {
+         arg_index++;
+         recompute_res_p  = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-var") == 0 )
       {
          arg_index++;
@@ -1957,6 +2040,16 @@ main( hypre_int argc,
          arg_index++;
          fcycle  = 1;
       }
+      else if ( strcmp(argv[arg_index], "-adapt_cycle") == 0 )
+      {
+         arg_index++;
+         adaptive_cycle = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-adapt_cycle_tol") == 0 )
+      {
+         arg_index++;
+         adaptive_cycle_tol = (HYPRE_Real)atof(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-numsamp") == 0 )
       {
          arg_index++;
@@ -2042,6 +2135,16 @@ main( hypre_int argc,
          arg_index++;
          cheby_fraction = (HYPRE_Real)atof(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-cheby_lanczos") == 0 )
+      {
+         arg_index++;
+         cheby_lanczos = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-cheby_refresh_tol") == 0 )
+      {
+         arg_index++;
+         cheby_refresh_tol = (HYPRE_Real)atof(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-additive") == 0 )
       {
          arg_index++;
@@ -2097,6 +2200,46 @@ main( hypre_int argc,
          arg_index++;
          keepTranspose  = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-mv_format") == 0 )
+      {
+         arg_index++;
+         mv_format  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-mv_format_nlv") == 0 )
+      {
+         arg_index++;
+         mv_format_nlv  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-mv_overlap") == 0 )
+      {
+         arg_index++;
+         mv_overlap  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-test_csr") == 0 )
+      {
+         arg_index++;
+         test_csr  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-node_comm") == 0 )
+      {
+         arg_index++;
+         node_comm  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-host_arena") == 0 )
+      {
+         arg_index++;
+         host_arena  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-sp_level") == 0 )
+      {
+         arg_index++;
+         sp_level  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-setup_reuse") == 0 )
+      {
+         arg_index++;
+         setup_reuse = atoi(argv[arg_index++]);
+      }
 #ifdef HYPRE_USING_DSUPERLU
       else if ( strcmp(argv[arg_index], "-dslu_th") == 0 )
       {
@@ -2124,6 +2267,11 @@ main( hypre_int argc,
          arg_index++;
          print_system_binary = 1;
       }
+      else if ( strcmp(argv[arg_index], "-printmpiio") == 0 )
+      {
+         arg_index++;
+         print_system_mpiio = 1;
+      }
       /* BM Oct 23, 2006 */
       else if ( strcmp(argv[arg_index], "-plot_grids") == 0 )
       {
@@ -2251,10 +2399,14 @@ main( hypre_int argc,
          hypre_printf("matrix read from multiple files (IJ format)\n");
          hypre_printf("  -frombinfile <filename>    : ");
          hypre_printf("matrix read from multiple binary files (IJ format)\n");
+         hypre_printf("  -fromMMfile <filename>     : ");
+         hypre_printf("matrix read from a single file (Matrix Market format)\n");
          hypre_printf("  -fromparcsrfile <filename> : ");
          hypre_printf("matrix read from multiple files (ParCSR format)\n");
          hypre_printf("  -fromonecsrfile <filename> : ");
          hypre_printf("matrix read from a single file (CSR format)\n");
+         hypre_printf("  -frommpiiofile <filename>  : ");
+         hypre_printf("matrix read from a single binary file (MPI-IO format)\n");
          hypre_printf("\n");
          hypre_printf("  -laplacian             : build 5pt 2D laplacian problem (default) \n");
          hypre_printf("  -sysL <num functions>  : build SYSTEMS laplacian 7pt operator\n");
@@ -2286,6 +2438,8 @@ main( hypre_int argc,
          hypre_printf("rhs read from a single file (CSR format)\n");
          hypre_printf("  -rhsparcsrfile        :  ");
          hypre_printf("rhs read from multiple files (ParCSR format)\n");
+         hypre_printf("  -rhsmpiiofile          : ");
+         hypre_printf("rhs read from a single binary file (MPI-IO format)\n");
          hypre_printf("  -Ffromonefile          : ");
          hypre_printf("list of F points from a single file\n");
          hypre_printf("  -SFfromonefile          : ");
@@ -2399,6 +2553,7 @@ main( hypre_int argc,
          hypre_printf("       16=Chebyshev  \n");
          hypre_printf("       17=FCF-Jacobi  \n");
          hypre_printf("       18=L1-Jacobi (may be used with -CF) \n");
+         hypre_printf("       31=multicolor Gauss-Seidel  32=reverse color order  33=symmetric  \n");
          hypre_printf("       9=Gauss elimination (use for coarsest grid only)  \n");
          hypre_printf("       99=Gauss elimination with pivoting (use for coarsest grid only)  \n");
          hypre_printf("       20= Nodal Weighted Jacobi (for systems only) \n");
@@ -2410,6 +2565,10 @@ main( hypre_int argc,
          hypre_printf("  -rlx_up      <val>       : set relaxation type for up cycle\n");
          hypre_printf("  -cheby_order  <val> : set order (1-4) for Chebyshev poly. smoother (default is 2)\n");
          hypre_printf("  -cheby_fraction <val> : fraction of the spectrum for Chebyshev poly. smoother (default is .3)\n");
+         hypre_printf("  -cheby_variant <val> : Chebyshev poly. (0 standard, 1 modified, 2 fourth kind)\n");
+         hypre_printf("  -cheby_lanczos <val> : 1 = estimate Chebyshev bounds with Lanczos instead of CG\n");
+         hypre_printf("  -cheby_refresh_tol <val> : reuse Chebyshev bounds across setups unless ||A||_F\n");
+         hypre_printf("                             changes by more than val (default 0 = off)\n");
          hypre_printf("  -nodal  <val>            : nodal system type\n");
          hypre_printf("       0 = Unknown approach \n");
          hypre_printf("       1 = Frobenius norm  \n");
@@ -2430,6 +2589,18 @@ main( hypre_int argc,
          hypre_printf("  -ns_up      <val>       : set no. of sweeps for up cycle\n");
          hypre_printf("\n");
          hypre_printf("  -mu   <val>            : set AMG cycles (1=V, 2=W, etc.)\n");
+         hypre_printf("  -adapt_cycle <val>     : adaptive AMG cycle, probing every <val> cycles\n");
+         hypre_printf("  -adapt_cycle_tol <val> : reduction factor for skipping smoothing/levels\n");
+         hypre_printf("  -mv_format <val>       : host matvec kernel in the AMG solve (0=CSR, 1=SELL-C-sigma)\n");
+         hypre_printf("  -mv_format_nlv <val>   : use the -mv_format kernel on the first <val> levels only\n");
+         hypre_printf("  -mv_overlap <val>      : overlap halo exchange and computation in host matvecs (0/1)\n");
+         hypre_printf("  -test_csr <val>        : rebuild A from its local CSR rows (1=natural row order,\n");
+         hypre_printf("                           2=reversed row order)\n");
+         hypre_printf("  -node_comm <val>       : node-aware halo exchange (0=off, 1=shared-memory nodes,\n");
+         hypre_printf("                           n>1: nodes of n consecutive ranks)\n");
+         hypre_printf("  -host_arena <val>      : host arena for AMG setup scratch arrays (0=off, 1=on)\n");
+         hypre_printf("  -sp_level <val>        : single-precision AMG operators on levels >= val (0=off)\n");
+         hypre_printf("  -setup_reuse <val>     : reuse AMG coarsening on re-setup (0=off, 1=on)\n");
          hypre_printf("  -cutf <val>            : set coarsening cut factor for dense rows\n");
          hypre_printf("  -th   <val>            : set AMG threshold Theta = val \n");
          hypre_printf("  -tr   <val>            : set AMG interpolation truncation factor = val \n");
@@ -2450,12 +2621,16 @@ main( hypre_int argc,
 
          hypre_printf("  -w   <val>             : set Jacobi relax weight = val\n");
          hypre_printf("  -k   <val>             : dimension Krylov space for GMRES\n");
+         hypre_printf("  -sstep <val>           : block size of s-step COGMRES (0/1 = off)\n");
+         hypre_printf("  -sstep_basis <val>     : s-step COGMRES basis, 0=monomial, 1=Newton\n");
          hypre_printf("  -aug   <val>           : number of augmentation vectors for LGMRES (-k indicates total approx space size)\n");
 
          hypre_printf("  -mxl  <val>            : maximum number of levels (AMG, ParaSAILS)\n");
          hypre_printf("  -tol  <val>            : set solver convergence tolerance = val\n");
          hypre_printf("  -atol  <val>           : set solver absolute convergence tolerance = val\n");
          hypre_printf("  -max_iter  <val>       : set max iterations\n");
+         hypre_printf("  -pipelined <val>       : use pipelined PCG (0/1)\n");
+         hypre_printf("  -recompute_p <val>     : recompute the PCG residual every val iterations\n");
          hypre_printf("  -mg_max_iter  <val>    : set max iterations for mg solvers\n");
          hypre_printf("  -agg_nl  <val>         : set number of aggressive coarsening levels (default:0)\n");
          hypre_printf("  -np  <val>             : set number of paths of length 2 for aggr. coarsening\n");
@@ -2482,6 +2657,14 @@ main( hypre_int argc,
          hypre_printf("\n");
          hypre_printf("  -print                 : print out the system\n");
          hypre_printf("\n");
+         hypre_printf("  -nthreads <val>        : number of OpenMP threads\n");
+         hypre_printf("\n");
+         hypre_printf("  -second_perturb <val>  : perturb the off-diagonal values of A by up to\n");
+         hypre_printf("                           a factor 1+val before the second setup of\n");
+         hypre_printf("                           solvers 0 and 1 (needs an IJ matrix)\n");
+         hypre_printf("  -second_setup <val>    : 0=keep the first preconditioner for the second\n");
+         hypre_printf("                           PCG solve (default 1, set up again)\n");
+         hypre_printf("\n");
          /* begin lobpcg */
 
          hypre_printf("LOBPCG options:\n");
@@ -2604,6 +2787,7 @@ main( hypre_int argc,
          hypre_printf("  -fs_threshold <val>              : Filtering threshold (static)\n");
          hypre_printf("  -fs_eig_max_iters <val>          : Max. it. for eig calculation.\n");
          hypre_printf("  -fs_kap_tol <val>                : Kap. theshold (adaptive)\n");
+         hypre_printf("  -fs_reuse <val>                  : Reuse the pattern of G in later setups\n");
          /* end FSAI options */
          /* hypre AMG-DD options */
          hypre_printf("  -amgdd_start_level   <val>       : set AMG-DD start level = val\n");
@@ -2689,6 +2873,12 @@ main( hypre_int argc,
    /* default execution policy */
    HYPRE_SetExecutionPolicy(default_exec_policy);
 
+   /* node-aware halo exchange */
+   HYPRE_SetNodeAwareComm(node_comm);
+
+   /* host arena for setup scratch arrays */
+   HYPRE_SetHostArena(host_arena);
+
 #if defined(HYPRE_USING_GPU)
    ierr = HYPRE_SetSpMVUseVendor(spmv_use_vendor); hypre_assert(ierr == 0);
    /* use vendor implementation for SpGEMM */
@@ -2714,7 +2904,17 @@ main( hypre_int argc,
 
    time_index = hypre_InitializeTiming("Spatial Operator");
    hypre_BeginTiming(time_index);
-   if ( build_matrix_type == -2 )
+   if ( build_matrix_type == -3 )
+   {
+      ierr = HYPRE_IJMatrixReadMM( argv[build_matrix_arg_index], comm,
+                                   HYPRE_PARCSR, &ij_A );
+      if (ierr)
+      {
+         hypre_printf("ERROR: Problem reading in the system matrix in MM format!\n");
+         hypre_MPI_Abort(comm, 1);
+      }
+   }
+   else if ( build_matrix_type == -2 )
    {
       ierr = HYPRE_IJMatrixReadBinary( argv[build_matrix_arg_index], comm,
                                        HYPRE_PARCSR, &ij_A );
@@ -2781,6 +2981,16 @@ main( hypre_int argc,
    {
       BuildParRotate7pt(argc, argv, build_matrix_arg_index, &parcsr_A);
    }
+   else if ( build_matrix_type == 9 )
+   {
+      ierr = HYPRE_ParCSRMatrixReadMPIIO(comm, argv[build_matrix_arg_index],
+                                         NULL, NULL, &parcsr_A);
+      if (ierr)
+      {
+         hypre_printf("ERROR: Problem reading in the system matrix!\n");
+         hypre_MPI_Abort(comm, 1);
+      }
+   }
    else
    {
       hypre_printf("You have asked for an unsupported problem with\n");
@@ -3188,12 +3398,85 @@ main( hypre_int argc,
       /*-----------------------------------------------------------
        * Fetch the resulting underlying matrix out
        *-----------------------------------------------------------*/
-      ierr += HYPRE_ParCSRMatrixDestroy(parcsr_A);
-
       ierr += HYPRE_IJMatrixGetObject( ij_A, &object);
+      if (parcsr_M == parcsr_A)
+      {
+         parcsr_M = (HYPRE_ParCSRMatrix) object;
+      }
+      ierr += HYPRE_ParCSRMatrixDestroy(parcsr_A);
       parcsr_A = (HYPRE_ParCSRMatrix) object;
    }
 
+   /*-----------------------------------------------------------
+    * Rebuild A from its local rows in CSR form. The matrix is created
+    * from doubled values, which are then restored in place and passed
+    * to HYPRE_ParCSRMatrixUpdateValuesFromCSR
+    *-----------------------------------------------------------*/
+
+   if (test_csr && !test_ij && build_matrix_type > -1)
+   {
+      HYPRE_ParCSRMatrix  parcsr_csr;
+      HYPRE_BigInt        csr_row_starts[2], csr_col_starts[2];
+      HYPRE_BigInt       *row_cols;
+      HYPRE_Complex      *row_vals;
+      HYPRE_Int           row_size, pos, k;
+
+      hypre_ParCSRMatrixMigrate(parcsr_A, HYPRE_MEMORY_HOST);
+
+      HYPRE_ParCSRMatrixGetDims(parcsr_A, &M, &N);
+      HYPRE_ParCSRMatrixGetLocalRange(parcsr_A, &first_local_row, &last_local_row,
+                                      &first_local_col, &last_local_col);
+      local_num_rows = (HYPRE_Int)(last_local_row - first_local_row + 1);
+
+      csr_row_ptr = hypre_CTAlloc(HYPRE_Int, local_num_rows + 1, HYPRE_MEMORY_HOST);
+      for (i = 0; i < local_num_rows; i++)
+      {
+         HYPRE_ParCSRMatrixGetRow(parcsr_A, first_local_row + i, &row_size, NULL, NULL);
+         csr_row_ptr[i + 1] = csr_row_ptr[i] + row_size;
+         HYPRE_ParCSRMatrixRestoreRow(parcsr_A, first_local_row + i, &row_size, NULL, NULL);
+      }
+
+      csr_cols   = hypre_TAlloc(HYPRE_BigInt, csr_row_ptr[local_num_rows], HYPRE_MEMORY_HOST);
+      csr_values = hypre_TAlloc(HYPRE_Complex, csr_row_ptr[local_num_rows], HYPRE_MEMORY_HOST);
+      for (i = 0; i < local_num_rows; i++)
+      {
+         HYPRE_ParCSRMatrixGetRow(parcsr_A, first_local_row + i, &row_size, &row_cols, &row_vals);
+         for (k = 0; k < row_size; k++)
+         {
+            pos = (test_csr == 2) ? csr_row_ptr[i + 1] - 1 - k : csr_row_ptr[i] + k;
+            csr_cols[pos]   = row_cols[k];
+            csr_values[pos] = 2.0 * row_vals[k];
+         }
+         HYPRE_ParCSRMatrixRestoreRow(parcsr_A, first_local_row + i, &row_size, &row_cols, &row_vals);
+      }
+
+      csr_row_starts[0] = first_local_row;
+      csr_row_starts[1] = last_local_row + 1;
+      csr_col_starts[0] = first_local_col;
+      csr_col_starts[1] = last_local_col + 1;
+
+      HYPRE_ParCSRMatrixCreateFromCSR(comm, M, N, csr_row_starts, csr_col_starts,
+                                      csr_row_ptr, csr_cols, csr_values, 1, &parcsr_csr);
+
+      for (k = 0; k < csr_row_ptr[local_num_rows]; k++)
+      {
+         csr_values[k] *= 0.5;
+      }
+      HYPRE_ParCSRMatrixUpdateValuesFromCSR(parcsr_csr, csr_values);
+
+      if (parcsr_M == parcsr_A)
+      {
+         parcsr_M = parcsr_csr;
+      }
+      HYPRE_ParCSRMatrixDestroy(parcsr_A);
+      parcsr_A = parcsr_csr;
+   }
+
+   if (mv_overlap)
+   {
+      HYPRE_ParCSRMatrixSetMatvecOverlap(parcsr_A, mv_overlap);
+   }
+
    /*-----------------------------------------------------------
     * Set up the interp vector
     *-----------------------------------------------------------*/
@@ -3525,6 +3808,36 @@ main( hypre_int argc,
       ierr = HYPRE_IJVectorGetObject( ij_x, &object );
       x = (HYPRE_ParVector) object;
    }
+   else if (build_rhs_type == 8)
+   {
+      HYPRE_BigInt partitioning[2];
+
+      if (myid == 0)
+      {
+         hypre_printf("  RHS vector read from file %s\n", argv[build_rhs_arg_index]);
+         hypre_printf("  Initial guess is 0\n");
+      }
+
+      /* the rhs is distributed like the rows of the matrix */
+      ij_b = NULL;
+      partitioning[0] = first_local_row;
+      partitioning[1] = last_local_row + 1;
+      ierr = HYPRE_ParVectorReadMPIIO(comm, argv[build_rhs_arg_index], partitioning, &b);
+      if (ierr)
+      {
+         hypre_printf("ERROR: Problem reading in the right-hand-side!\n");
+         hypre_MPI_Abort(comm, 1);
+      }
+
+      /* initial guess */
+      HYPRE_IJVectorCreate(hypre_MPI_COMM_WORLD, first_local_col, last_local_col, &ij_x);
+      HYPRE_IJVectorSetObjectType(ij_x, HYPRE_PARCSR);
+      HYPRE_IJVectorInitialize(ij_x);
+      HYPRE_IJVectorAssemble(ij_x);
+
+      ierr = HYPRE_IJVectorGetObject( ij_x, &object );
+      x = (HYPRE_ParVector) object;
+   }
    else
    {
       if (build_rhs_type != -1)
@@ -3953,6 +4266,19 @@ main( hypre_int argc,
       }
    }
 
+   if (print_system_mpiio)
+   {
+      HYPRE_ParCSRMatrixPrintMPIIO(parcsr_A, "IJ.out.A.mpiio");
+      if (b)
+      {
+         HYPRE_ParVectorPrintMPIIO(b, "IJ.out.b.mpiio");
+      }
+      if (x)
+      {
+         HYPRE_ParVectorPrintMPIIO(x, "IJ.out.x0.mpiio");
+      }
+   }
+
    /*-----------------------------------------------------------
     * Migrate the system to the wanted memory space
     *-----------------------------------------------------------*/
@@ -4371,6 +4697,8 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetPrintFileName(amg_solver, "driver.out.log");
       HYPRE_BoomerAMGSetCycleType(amg_solver, cycle_type);
       HYPRE_BoomerAMGSetFCycle(amg_solver, fcycle);
+      HYPRE_BoomerAMGSetAdaptiveCycle(amg_solver, adaptive_cycle);
+      HYPRE_BoomerAMGSetAdaptiveCycleTol(amg_solver, adaptive_cycle_tol);
       HYPRE_BoomerAMGSetNumSweeps(amg_solver, num_sweeps);
       HYPRE_BoomerAMGSetISType(amg_solver, IS_type);
       HYPRE_BoomerAMGSetNumCRRelaxSteps(amg_solver, num_CR_relax_steps);
@@ -4397,6 +4725,8 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetChebyEigEst(amg_solver, cheby_eig_est);
       HYPRE_BoomerAMGSetChebyVariant(amg_solver, cheby_variant);
       HYPRE_BoomerAMGSetChebyScale(amg_solver, cheby_scale);
+      HYPRE_BoomerAMGSetChebyLanczos(amg_solver, cheby_lanczos);
+      HYPRE_BoomerAMGSetChebyEigRefreshTol(amg_solver, cheby_refresh_tol);
       HYPRE_BoomerAMGSetRelaxOrder(amg_solver, relax_order);
       HYPRE_BoomerAMGSetRelaxWt(amg_solver, relax_wt);
       HYPRE_BoomerAMGSetOuterWt(amg_solver, outer_wt);
@@ -4474,6 +4804,14 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetRAP2(amg_solver, rap2);
       HYPRE_BoomerAMGSetModuleRAP2(amg_solver, mod_rap2);
       HYPRE_BoomerAMGSetKeepTranspose(amg_solver, keepTranspose);
+      HYPRE_BoomerAMGSetMatvecFormat(amg_solver, mv_format);
+      if (mv_format_nlv > -1)
+      {
+         HYPRE_BoomerAMGSetMatvecFormatNumLevels(amg_solver, mv_format_nlv);
+      }
+      HYPRE_BoomerAMGSetMatvecOverlap(amg_solver, mv_overlap);
+      HYPRE_BoomerAMGSetSinglePrecisionLevel(amg_solver, sp_level);
+      HYPRE_BoomerAMGSetSetupReuse(amg_solver, setup_reuse);
 #ifdef HYPRE_USING_DSUPERLU
       HYPRE_BoomerAMGSetDSLUThreshold(amg_solver, dslu_threshold);
 #endif
@@ -4559,6 +4897,12 @@ main( hypre_int argc,
 #endif
          hypre_ParVectorCopy(x0_save, x);
 
+         /* change the values, but not the pattern, of A */
+         if (second_perturb != 0.0)
+         {
+            PerturbIJMatrixValues(ij_A, parcsr_A, second_perturb);
+         }
+
 #if defined(HYPRE_USING_CUDA)
          cudaProfilerStart();
 #endif
@@ -4710,6 +5054,8 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetChebyEigEst(amg_solver, cheby_eig_est);
       HYPRE_BoomerAMGSetChebyVariant(amg_solver, cheby_variant);
       HYPRE_BoomerAMGSetChebyScale(amg_solver, cheby_scale);
+      HYPRE_BoomerAMGSetChebyLanczos(amg_solver, cheby_lanczos);
+      HYPRE_BoomerAMGSetChebyEigRefreshTol(amg_solver, cheby_refresh_tol);
       HYPRE_BoomerAMGSetRelaxOrder(amg_solver, relax_order);
       HYPRE_BoomerAMGSetRelaxWt(amg_solver, relax_wt);
       HYPRE_BoomerAMGSetOuterWt(amg_solver, outer_wt);
@@ -4768,6 +5114,14 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetRAP2(amg_solver, rap2);
       HYPRE_BoomerAMGSetModuleRAP2(amg_solver, mod_rap2);
       HYPRE_BoomerAMGSetKeepTranspose(amg_solver, keepTranspose);
+      HYPRE_BoomerAMGSetMatvecFormat(amg_solver, mv_format);
+      if (mv_format_nlv > -1)
+      {
+         HYPRE_BoomerAMGSetMatvecFormatNumLevels(amg_solver, mv_format_nlv);
+      }
+      HYPRE_BoomerAMGSetMatvecOverlap(amg_solver, mv_overlap);
+      HYPRE_BoomerAMGSetSinglePrecisionLevel(amg_solver, sp_level);
+      HYPRE_BoomerAMGSetSetupReuse(amg_solver, setup_reuse);
       if (nongalerk_tol)
       {
          HYPRE_BoomerAMGSetNonGalerkinTol(amg_solver, nongalerk_tol[nongalerk_num_tol - 1]);
@@ -4853,6 +5207,8 @@ main( hypre_int argc,
       HYPRE_PCGSetTol(pcg_solver, tol);
       HYPRE_PCGSetTwoNorm(pcg_solver, 1);
       HYPRE_PCGSetFlex(pcg_solver, flex);
+      HYPRE_PCGSetPipelined(pcg_solver, pipelined);
+      HYPRE_PCGSetRecomputeResidualP(pcg_solver, recompute_res_p);
       HYPRE_PCGSetSkipBreak(pcg_solver, skip_break);
       HYPRE_PCGSetRelChange(pcg_solver, rel_change);
       HYPRE_PCGSetPrintLevel(pcg_solver, ioutdat);
@@ -4916,6 +5272,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyLanczos(pcg_precond, cheby_lanczos);
+         HYPRE_BoomerAMGSetChebyEigRefreshTol(pcg_precond, cheby_refresh_tol);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
@@ -4976,6 +5334,14 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMatvecFormat(pcg_precond, mv_format);
+         if (mv_format_nlv > -1)
+         {
+            HYPRE_BoomerAMGSetMatvecFormatNumLevels(pcg_precond, mv_format_nlv);
+         }
+         HYPRE_BoomerAMGSetMatvecOverlap(pcg_precond, mv_overlap);
+         HYPRE_BoomerAMGSetSinglePrecisionLevel(pcg_precond, sp_level);
+         HYPRE_BoomerAMGSetSetupReuse(pcg_precond, setup_reuse);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -5105,6 +5471,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyLanczos(pcg_precond, cheby_lanczos);
+         HYPRE_BoomerAMGSetChebyEigRefreshTol(pcg_precond, cheby_refresh_tol);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
          if (level_w > -1)
@@ -5162,6 +5530,14 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMatvecFormat(pcg_precond, mv_format);
+         if (mv_format_nlv > -1)
+         {
+            HYPRE_BoomerAMGSetMatvecFormatNumLevels(pcg_precond, mv_format_nlv);
+         }
+         HYPRE_BoomerAMGSetMatvecOverlap(pcg_precond, mv_overlap);
+         HYPRE_BoomerAMGSetSinglePrecisionLevel(pcg_precond, sp_level);
+         HYPRE_BoomerAMGSetSetupReuse(pcg_precond, setup_reuse);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -5194,6 +5570,7 @@ main( hypre_int argc,
          HYPRE_FSAISetNumLevels(pcg_precond, fsai_num_levels);
          HYPRE_FSAISetThreshold(pcg_precond, fsai_threshold);
          HYPRE_FSAISetKapTolerance(pcg_precond, fsai_kap_tolerance);
+         HYPRE_FSAISetReuse(pcg_precond, fsai_reuse);
          HYPRE_FSAISetMaxIterations(pcg_precond, 1);
          HYPRE_FSAISetTolerance(pcg_precond, 0.0);
          HYPRE_FSAISetZeroGuess(pcg_precond, 1);
@@ -5382,6 +5759,12 @@ main( hypre_int argc,
 #endif
          hypre_ParVectorCopy(x0_save, x);
 
+         /* change the values, but not the pattern, of A */
+         if (second_perturb != 0.0)
+         {
+            PerturbIJMatrixValues(ij_A, parcsr_A, second_perturb);
+         }
+
 #if defined(HYPRE_USING_CUDA)
          cudaProfilerStart();
 #endif
@@ -5391,8 +5774,11 @@ main( hypre_int argc,
 
          hypre_GpuProfilingPushRange("PCG-Setup-2");
 
-         HYPRE_PCGSetup(pcg_solver, (HYPRE_Matrix) parcsr_M,
-                        (HYPRE_Vector) b, (HYPRE_Vector) x);
+         if (second_setup)
+         {
+            HYPRE_PCGSetup(pcg_solver, (HYPRE_Matrix) parcsr_M,
+                           (HYPRE_Vector) b, (HYPRE_Vector) x);
+         }
 
          hypre_GpuProfilingPopRange();
 
@@ -6585,6 +6971,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMaxIter(amg_precond, precon_cycles);
          HYPRE_BoomerAMGSetCycleType(amg_precond, cycle_type);
          HYPRE_BoomerAMGSetFCycle(amg_precond, fcycle);
+         HYPRE_BoomerAMGSetAdaptiveCycle(amg_precond, adaptive_cycle);
+         HYPRE_BoomerAMGSetAdaptiveCycleTol(amg_precond, adaptive_cycle_tol);
          HYPRE_BoomerAMGSetNumSweeps(amg_precond, num_sweeps);
          HYPRE_BoomerAMGSetISType(amg_precond, IS_type);
          HYPRE_BoomerAMGSetNumCRRelaxSteps(amg_precond, num_CR_relax_steps);
@@ -6611,6 +6999,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(amg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(amg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(amg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyLanczos(amg_precond, cheby_lanczos);
+         HYPRE_BoomerAMGSetChebyEigRefreshTol(amg_precond, cheby_refresh_tol);
          HYPRE_BoomerAMGSetRelaxOrder(amg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(amg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(amg_precond, outer_wt);
@@ -6678,6 +7068,14 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(amg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(amg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(amg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMatvecFormat(amg_precond, mv_format);
+         if (mv_format_nlv > -1)
+         {
+            HYPRE_BoomerAMGSetMatvecFormatNumLevels(amg_precond, mv_format_nlv);
+         }
+         HYPRE_BoomerAMGSetMatvecOverlap(amg_precond, mv_overlap);
+         HYPRE_BoomerAMGSetSinglePrecisionLevel(amg_precond, sp_level);
+         HYPRE_BoomerAMGSetSetupReuse(amg_precond, setup_reuse);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(amg_precond, dslu_threshold);
 #endif
@@ -6811,6 +7209,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyLanczos(pcg_precond, cheby_lanczos);
+         HYPRE_BoomerAMGSetChebyEigRefreshTol(pcg_precond, cheby_refresh_tol);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
@@ -6870,6 +7270,14 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMatvecFormat(pcg_precond, mv_format);
+         if (mv_format_nlv > -1)
+         {
+            HYPRE_BoomerAMGSetMatvecFormatNumLevels(pcg_precond, mv_format_nlv);
+         }
+         HYPRE_BoomerAMGSetMatvecOverlap(pcg_precond, mv_overlap);
+         HYPRE_BoomerAMGSetSinglePrecisionLevel(pcg_precond, sp_level);
+         HYPRE_BoomerAMGSetSetupReuse(pcg_precond, setup_reuse);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -7166,6 +7574,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyLanczos(pcg_precond, cheby_lanczos);
+         HYPRE_BoomerAMGSetChebyEigRefreshTol(pcg_precond, cheby_refresh_tol);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
@@ -7225,6 +7635,14 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMatvecFormat(pcg_precond, mv_format);
+         if (mv_format_nlv > -1)
+         {
+            HYPRE_BoomerAMGSetMatvecFormatNumLevels(pcg_precond, mv_format_nlv);
+         }
+         HYPRE_BoomerAMGSetMatvecOverlap(pcg_precond, mv_overlap);
+         HYPRE_BoomerAMGSetSinglePrecisionLevel(pcg_precond, sp_level);
+         HYPRE_BoomerAMGSetSetupReuse(pcg_precond, setup_reuse);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -7350,6 +7768,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMaxIter(pcg_precond, precon_cycles);
          HYPRE_BoomerAMGSetCycleType(pcg_precond, cycle_type);
          HYPRE_BoomerAMGSetFCycle(pcg_precond, fcycle);
+         HYPRE_BoomerAMGSetAdaptiveCycle(pcg_precond, adaptive_cycle);
+         HYPRE_BoomerAMGSetAdaptiveCycleTol(pcg_precond, adaptive_cycle_tol);
          HYPRE_BoomerAMGSetNumSweeps(pcg_precond, num_sweeps);
          HYPRE_BoomerAMGSetISType(pcg_precond, IS_type);
          HYPRE_BoomerAMGSetNumCRRelaxSteps(pcg_precond, num_CR_relax_steps);
@@ -7376,6 +7796,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyLanczos(pcg_precond, cheby_lanczos);
+         HYPRE_BoomerAMGSetChebyEigRefreshTol(pcg_precond, cheby_refresh_tol);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
@@ -7435,6 +7857,14 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMatvecFormat(pcg_precond, mv_format);
+         if (mv_format_nlv > -1)
+         {
+            HYPRE_BoomerAMGSetMatvecFormatNumLevels(pcg_precond, mv_format_nlv);
+         }
+         HYPRE_BoomerAMGSetMatvecOverlap(pcg_precond, mv_overlap);
+         HYPRE_BoomerAMGSetSinglePrecisionLevel(pcg_precond, sp_level);
+         HYPRE_BoomerAMGSetSetupReuse(pcg_precond, setup_reuse);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -7791,6 +8221,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyLanczos(pcg_precond, cheby_lanczos);
+         HYPRE_BoomerAMGSetChebyEigRefreshTol(pcg_precond, cheby_refresh_tol);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
@@ -7851,6 +8283,14 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMatvecFormat(pcg_precond, mv_format);
+         if (mv_format_nlv > -1)
+         {
+            HYPRE_BoomerAMGSetMatvecFormatNumLevels(pcg_precond, mv_format_nlv);
+         }
+         HYPRE_BoomerAMGSetMatvecOverlap(pcg_precond, mv_overlap);
+         HYPRE_BoomerAMGSetSinglePrecisionLevel(pcg_precond, sp_level);
+         HYPRE_BoomerAMGSetSetupReuse(pcg_precond, setup_reuse);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -8134,6 +8574,8 @@ main( hypre_int argc,
       HYPRE_COGMRESSetKDim(pcg_solver, k_dim);
       HYPRE_COGMRESSetUnroll(pcg_solver, unroll);
       HYPRE_COGMRESSetCGS(pcg_solver, cgs);
+      HYPRE_COGMRESSetSStep(pcg_solver, s_step);
+      HYPRE_COGMRESSetSStepBasis(pcg_solver, s_step_basis);
       HYPRE_COGMRESSetMaxIter(pcg_solver, max_iter);
       HYPRE_COGMRESSetTol(pcg_solver, tol);
       HYPRE_COGMRESSetAbsoluteTol(pcg_solver, atol);
@@ -8196,6 +8638,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyLanczos(pcg_precond, cheby_lanczos);
+         HYPRE_BoomerAMGSetChebyEigRefreshTol(pcg_precond, cheby_refresh_tol);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
@@ -8256,6 +8700,14 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMatvecFormat(pcg_precond, mv_format);
+         if (mv_format_nlv > -1)
+         {
+            HYPRE_BoomerAMGSetMatvecFormatNumLevels(pcg_precond, mv_format_nlv);
+         }
+         HYPRE_BoomerAMGSetMatvecOverlap(pcg_precond, mv_overlap);
+         HYPRE_BoomerAMGSetSinglePrecisionLevel(pcg_precond, sp_level);
+         HYPRE_BoomerAMGSetSetupReuse(pcg_precond, setup_reuse);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -8545,6 +8997,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyLanczos(pcg_precond, cheby_lanczos);
+         HYPRE_BoomerAMGSetChebyEigRefreshTol(pcg_precond, cheby_refresh_tol);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
@@ -8588,6 +9042,14 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMatvecFormat(pcg_precond, mv_format);
+         if (mv_format_nlv > -1)
+         {
+            HYPRE_BoomerAMGSetMatvecFormatNumLevels(pcg_precond, mv_format_nlv);
+         }
+         HYPRE_BoomerAMGSetMatvecOverlap(pcg_precond, mv_overlap);
+         HYPRE_BoomerAMGSetSinglePrecisionLevel(pcg_precond, sp_level);
+         HYPRE_BoomerAMGSetSetupReuse(pcg_precond, setup_reuse);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -8974,6 +9436,11 @@ main( hypre_int argc,
       }
    }
 
+   if (print_system_mpiio && x)
+   {
+      HYPRE_ParVectorPrintMPIIO(x, "IJ.out.x.mpiio");
+   }
+
    /*-----------------------------------------------------------
     * Finalize things
     *-----------------------------------------------------------*/
@@ -8982,7 +9449,7 @@ final:
 
    HYPRE_ParVectorDestroy(x0_save);
 
-   if (test_ij || build_matrix_type == -1 || build_matrix_type == -2)
+   if (test_ij || build_matrix_type == -1 || build_matrix_type == -2 || build_matrix_type == -3)
    {
       if (ij_A)
       {
@@ -8994,13 +9461,18 @@ final:
       HYPRE_ParCSRMatrixDestroy(parcsr_A);
    }
 
+   /* the values of a matrix built with -test_csr may alias csr_values */
+   hypre_TFree(csr_row_ptr, HYPRE_MEMORY_HOST);
+   hypre_TFree(csr_cols, HYPRE_MEMORY_HOST);
+   hypre_TFree(csr_values, HYPRE_MEMORY_HOST);
+
    if (build_matrix_M == 1)
    {
       HYPRE_IJMatrixDestroy(ij_M);
    }
 
-   /* for build_rhs_type = 1, 6 or 7, we did not create ij_b  - just b*/
-   if (build_rhs_type == 1 || build_rhs_type == 6 || build_rhs_type == 7)
+   /* for build_rhs_type = 1, 6, 7 or 8, we did not create ij_b  - just b*/
+   if (build_rhs_type == 1 || build_rhs_type == 6 || build_rhs_type == 7 || build_rhs_type == 8)
    {
       HYPRE_ParVectorDestroy(b);
    }
@@ -11159,6 +11631,77 @@ BuildParCoordinates( HYPRE_Int            argc,
 }
 
 
+/*----------------------------------------------------------------------
+ * Scale the off-diagonal values of an assembled IJ matrix by symmetric
+ * factors in [1, 1 + eps] and add the growth of each row to its diagonal,
+ * so that a symmetric, diagonally dominant matrix stays so. The sparsity
+ * pattern is not changed.
+ *----------------------------------------------------------------------*/
+
+HYPRE_Int
+PerturbIJMatrixValues( HYPRE_IJMatrix      ij_A,
+                       HYPRE_ParCSRMatrix  parcsr_A,
+                       HYPRE_Real          eps )
+{
+   HYPRE_BigInt         first_row, last_row, first_col, last_col;
+   HYPRE_BigInt         row, lo, hi;
+   HYPRE_BigInt        *col_ind, *new_cols;
+   HYPRE_Complex       *values, *new_values;
+   HYPRE_Int            size, k, diag;
+   HYPRE_Real           factor, growth;
+   hypre_ulonglongint   key;
+
+   if (!ij_A)
+   {
+      hypre_printf("Warning: -second_perturb needs an IJ matrix, A is not changed\n");
+      return 0;
+   }
+
+   HYPRE_ParCSRMatrixGetLocalRange(parcsr_A, &first_row, &last_row, &first_col, &last_col);
+
+   for (row = first_row; row <= last_row; row++)
+   {
+      HYPRE_ParCSRMatrixGetRow(parcsr_A, row, &size, &col_ind, &values);
+      new_cols   = hypre_TAlloc(HYPRE_BigInt, size, HYPRE_MEMORY_HOST);
+      new_values = hypre_TAlloc(HYPRE_Complex, size, HYPRE_MEMORY_HOST);
+
+      growth = 0.0;
+      diag   = -1;
+      for (k = 0; k < size; k++)
+      {
+         new_cols[k]   = col_ind[k];
+         new_values[k] = values[k];
+         if (col_ind[k] == row)
+         {
+            diag = k;
+            continue;
+         }
+
+         /* the same factor for (i,j) and (j,i) */
+         lo  = hypre_min(row, col_ind[k]);
+         hi  = hypre_max(row, col_ind[k]);
+         key = ((hypre_ulonglongint) lo * 2654435761ULL) ^ ((hypre_ulonglongint) hi * 40503ULL);
+         factor = 1.0 + eps * (HYPRE_Real) (key % 1024) / 1024.0;
+         new_values[k] *= factor;
+         growth += hypre_cabs(new_values[k]) - hypre_cabs(values[k]);
+      }
+      HYPRE_ParCSRMatrixRestoreRow(parcsr_A, row, &size, &col_ind, &values);
+
+      if (diag >= 0)
+      {
+         new_values[diag] += growth;
+      }
+      HYPRE_IJMatrixSetValues(ij_A, 1, &size, &row, new_cols, new_values);
+
+      hypre_TFree(new_cols, HYPRE_MEMORY_HOST);
+      hypre_TFree(new_values, HYPRE_MEMORY_HOST);
+   }
+
+   HYPRE_IJMatrixAssemble(ij_A);
+
+   return 0;
+}
+
 /* begin lobpcg */
 
 /*----------------------------------------------------------------------
@@ -2245,6 +2245,9 @@ PrintUsage( char *progname,
       hypre_printf("                        248- Struct BiCGSTAB with diagonal scaling\n");
       hypre_printf("                        249- Struct BiCGSTAB\n");
       hypre_printf("  -print             : print out the system\n");
+      hypre_printf("  -boxman_index <ID> : box manager index for the grid\n");
+      hypre_printf("                        0 - table (default)\n");
+      hypre_printf("                        1 - bounding volume hierarchy\n");
       hypre_printf("  -rhsfromcosine     : solution is cosine function (default)\n");
       hypre_printf("  -rhsone            : rhs is vector with unit components\n");
       hypre_printf("  -tol <val>         : convergence tolerance (default 1e-6)\n");
@@ -2339,6 +2342,7 @@ main( hypre_int argc,
    Index                *block;
    HYPRE_Int             solver_id, object_type;
    HYPRE_Int             print_system;
+   HYPRE_Int             boxman_index_type;
    HYPRE_Int             cosine;
    HYPRE_Real            scale;
    HYPRE_Int             read_fromfile_flag = 0;
@@ -2502,6 +2506,7 @@ main( hypre_int argc,
 
    solver_id = 39;
    print_system = 0;
+   boxman_index_type = 0;
    cosine = 1;
    skip = 0;
    n_pre  = 1;
@@ -2693,6 +2698,11 @@ main( hypre_int argc,
          arg_index++;
          print_system = 1;
       }
+      else if ( strcmp(argv[arg_index], "-boxman_index") == 0 )
+      {
+         arg_index++;
+         boxman_index_type = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-rhsfromcosine") == 0 )
       {
          arg_index++;
@@ -3040,6 +3050,7 @@ main( hypre_int argc,
 
          HYPRE_SStructGridSetPeriodic(grid, part, pdata.periodic);
       }
+      HYPRE_SStructGridSetBoxManIndexType(grid, boxman_index_type);
       HYPRE_SStructGridAssemble(grid);
 
       /*-----------------------------------------------------------
@@ -99,6 +99,7 @@ main( hypre_int argc,
    HYPRE_Int           n_pre, n_post;
    HYPRE_Int           nblocks ;
    HYPRE_Int           skip;
+   HYPRE_Int           box_tile;
    HYPRE_Int           sym;
    HYPRE_Int           rap;
    HYPRE_Int           relax;
@@ -223,6 +224,7 @@ main( hypre_int argc,
    dim = 3;
 
    skip  = 0;
+   box_tile = 0;
    sym  = 1;
    rap = 0;
    relax = 1;
@@ -534,6 +536,11 @@ main( hypre_int argc,
          arg_index++;
          default_exec_policy = HYPRE_EXEC_DEVICE;
       }
+      else if ( strcmp(argv[arg_index], "-box_tile") == 0 )
+      {
+         arg_index++;
+         box_tile = atoi(argv[arg_index++]);
+      }
 #if defined(HYPRE_USING_MEMORY_TRACKER)
       else if ( strcmp(argv[arg_index], "-print_mem_tracker") == 0 )
       {
@@ -564,6 +571,9 @@ main( hypre_int argc,
    /* default execution policy */
    HYPRE_SetExecutionPolicy(default_exec_policy);
 
+   /* tile size of the unit-stride host BoxLoops */
+   HYPRE_SetBoxLoopTile(box_tile);
+
    /* begin lobpcg */
 
    if ( solver_id == 0 && lobpcgFlag )
@@ -596,6 +606,7 @@ main( hypre_int argc,
       hypre_printf("  -rhsfromfile <name> : prefix name for rhsfiles\n");
       hypre_printf("  -x0fromfile <name>  : prefix name for firstguessfiles\n");
       hypre_printf("  -repeats <reps>     : number of times to repeat the run, default 1.  For solver 0,1,3\n");
+      hypre_printf("  -box_tile <t>       : rows per tile in the host BoxLoops (0: no tiling, default)\n");
       hypre_printf("  -solver <ID>        : solver ID\n");
       hypre_printf("                        0  - SMG (default)\n");
       hypre_printf("                        1  - PFMG\n");
@@ -49,3 +49,54 @@ HYPRE_SetUseGpuRand( HYPRE_Int use_gpu_rand )
    return hypre_SetUseGpuRand(use_gpu_rand);
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_SetNodeAwareComm
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_SetNodeAwareComm( HYPRE_Int node_size )
+{
+   if (node_size < 0)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_HandleNodeAwareComm(hypre_handle()) = node_size;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetBoxLoopTile
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_SetBoxLoopTile( HYPRE_Int tile )
+{
+   if (tile < 0)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_HandleBoxTile(hypre_handle()) = tile;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetHostArena
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_SetHostArena( HYPRE_Int use_arena )
+{
+   return hypre_SetHostArena(use_arena);
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetHostArenaChunkSize
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_SetHostArenaChunkSize( size_t nbytes )
+{
+   return hypre_SetHostArenaChunkSize(nbytes);
+}
@@ -338,6 +338,45 @@ HYPRE_Int HYPRE_SetSpMVUseVendor( HYPRE_Int use_vendor );
 HYPRE_Int HYPRE_SetSpGemmUseVendor( HYPRE_Int use_vendor );
 HYPRE_Int HYPRE_SetUseGpuRand( HYPRE_Int use_curand );
 
+/**
+ * (Optional) Enables node-aware halo exchanges for the ParCSR communication
+ * packages created afterwards. With 1, ranks sharing memory form a node;
+ * a value n > 1 groups every n consecutive ranks into a node instead. Data
+ * for other nodes is then aggregated through one leader rank per node, and
+ * the matvec sends a value needed by several ranks of a node only once to
+ * that node. The default 0 exchanges all messages directly.
+ **/
+
+HYPRE_Int HYPRE_SetNodeAwareComm( HYPRE_Int node_size );
+
+/**
+ * (Optional) Sets the number of rows of dimension 1 per tile in the
+ * unit-stride host BoxLoops of the Struct interface. The loops then sweep
+ * all of dimension 2 for one tile before moving on to the next, which keeps
+ * neighboring planes of a 3D stencil in cache. The default 0 disables
+ * tiling. Results may differ from untiled loops by rounding in reductions.
+ **/
+
+HYPRE_Int HYPRE_SetBoxLoopTile( HYPRE_Int tile );
+
+/**
+ * (Optional) Enables (use\_arena = 1) or disables (0) the host arena for
+ * the scratch arrays of the AMG setup. Each thread then carves its scratch
+ * arrays out of its own chunks of host memory instead of calling malloc and
+ * free, and the chunks are recycled after each level of the hierarchy. Must
+ * not be changed during a setup. The default is 0.
+ **/
+
+HYPRE_Int HYPRE_SetHostArena( HYPRE_Int use_arena );
+
+/**
+ * (Optional) Sets the size in bytes of the chunks requested by the host
+ * arena. Larger scratch arrays get a chunk of their own. The default is
+ * 4 MB.
+ **/
+
+HYPRE_Int HYPRE_SetHostArenaChunkSize( size_t nbytes );
+
 /*--------------------------------------------------------------------------
  * Base objects
  *--------------------------------------------------------------------------*/
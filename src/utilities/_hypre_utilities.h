@@ -575,6 +575,8 @@ extern "C" {
 #define MPI_Op              hypre_MPI_Op
 #define MPI_Aint            hypre_MPI_Aint
 #define MPI_Info            hypre_MPI_Info
+#define MPI_File            hypre_MPI_File
+#define MPI_Offset          hypre_MPI_Offset
 
 #define MPI_COMM_WORLD       hypre_MPI_COMM_WORLD
 #define MPI_COMM_NULL        hypre_MPI_COMM_NULL
@@ -611,6 +613,10 @@ extern "C" {
 #define MPI_ANY_TAG         hypre_MPI_ANY_TAG
 #define MPI_SOURCE          hypre_MPI_SOURCE
 #define MPI_TAG             hypre_MPI_TAG
+#define MPI_FILE_NULL       hypre_MPI_FILE_NULL
+#define MPI_MODE_RDONLY     hypre_MPI_MODE_RDONLY
+#define MPI_MODE_WRONLY     hypre_MPI_MODE_WRONLY
+#define MPI_MODE_CREATE     hypre_MPI_MODE_CREATE
 
 #define MPI_Init            hypre_MPI_Init
 #define MPI_Finalize        hypre_MPI_Finalize
@@ -655,6 +661,7 @@ extern "C" {
 #define MPI_Waitall         hypre_MPI_Waitall
 #define MPI_Waitany         hypre_MPI_Waitany
 #define MPI_Allreduce       hypre_MPI_Allreduce
+#define MPI_Iallreduce      hypre_MPI_Iallreduce
 #define MPI_Reduce          hypre_MPI_Reduce
 #define MPI_Scan            hypre_MPI_Scan
 #define MPI_Request_free    hypre_MPI_Request_free
@@ -668,6 +675,11 @@ extern "C" {
 #define MPI_Op_create       hypre_MPI_Op_create
 #define MPI_User_function   hypre_MPI_User_function
 #define MPI_Info_create     hypre_MPI_Info_create
+#define MPI_File_open       hypre_MPI_File_open
+#define MPI_File_close      hypre_MPI_File_close
+#define MPI_File_set_size   hypre_MPI_File_set_size
+#define MPI_File_read_at_all  hypre_MPI_File_read_at_all
+#define MPI_File_write_at_all hypre_MPI_File_write_at_all
 
 /*--------------------------------------------------------------------------
  * Types, etc.
@@ -690,6 +702,10 @@ typedef HYPRE_Int  hypre_MPI_Op;
 typedef HYPRE_Int  hypre_MPI_Aint;
 typedef HYPRE_Int  hypre_MPI_Info;
 
+/* MPI-IO files are accessed with stdio */
+typedef FILE          *hypre_MPI_File;
+typedef long long int  hypre_MPI_Offset;
+
 #define  hypre_MPI_COMM_SELF   1
 #define  hypre_MPI_COMM_WORLD  0
 #define  hypre_MPI_COMM_NULL  -1
@@ -723,6 +739,11 @@ typedef HYPRE_Int  hypre_MPI_Info;
 #define  hypre_MPI_ANY_SOURCE    1
 #define  hypre_MPI_ANY_TAG       1
 
+#define  hypre_MPI_FILE_NULL     NULL
+#define  hypre_MPI_MODE_RDONLY   1
+#define  hypre_MPI_MODE_WRONLY   2
+#define  hypre_MPI_MODE_CREATE   4
+
 #else
 
 /******************************************************************************
@@ -738,6 +759,8 @@ typedef MPI_Op       hypre_MPI_Op;
 typedef MPI_Aint     hypre_MPI_Aint;
 typedef MPI_Info     hypre_MPI_Info;
 typedef MPI_User_function    hypre_MPI_User_function;
+typedef MPI_File     hypre_MPI_File;
+typedef MPI_Offset   hypre_MPI_Offset;
 
 #define  hypre_MPI_COMM_WORLD         MPI_COMM_WORLD
 #define  hypre_MPI_COMM_NULL          MPI_COMM_NULL
@@ -774,6 +797,11 @@ typedef MPI_User_function    hypre_MPI_User_function;
 #define  hypre_MPI_TAG             MPI_TAG
 #define  hypre_MPI_LAND            MPI_LAND
 
+#define  hypre_MPI_FILE_NULL       MPI_FILE_NULL
+#define  hypre_MPI_MODE_RDONLY     MPI_MODE_RDONLY
+#define  hypre_MPI_MODE_WRONLY     MPI_MODE_WRONLY
+#define  hypre_MPI_MODE_CREATE     MPI_MODE_CREATE
+
 #endif
 
 /******************************************************************************
@@ -857,6 +885,9 @@ HYPRE_Int hypre_MPI_Waitany( HYPRE_Int count, hypre_MPI_Request *array_of_reques
                              HYPRE_Int *index, hypre_MPI_Status *status );
 HYPRE_Int hypre_MPI_Allreduce( void *sendbuf, void *recvbuf, HYPRE_Int count,
                                hypre_MPI_Datatype datatype, hypre_MPI_Op op, hypre_MPI_Comm comm );
+HYPRE_Int hypre_MPI_Iallreduce( void *sendbuf, void *recvbuf, HYPRE_Int count,
+                                hypre_MPI_Datatype datatype, hypre_MPI_Op op, hypre_MPI_Comm comm,
+                                hypre_MPI_Request *request );
 HYPRE_Int hypre_MPI_Reduce( void *sendbuf, void *recvbuf, HYPRE_Int count,
                             hypre_MPI_Datatype datatype, hypre_MPI_Op op, HYPRE_Int root, hypre_MPI_Comm comm );
 HYPRE_Int hypre_MPI_Scan( void *sendbuf, void *recvbuf, HYPRE_Int count,
@@ -876,9 +907,19 @@ HYPRE_Int hypre_MPI_Type_free( hypre_MPI_Datatype *datatype );
 HYPRE_Int hypre_MPI_Op_free( hypre_MPI_Op *op );
 HYPRE_Int hypre_MPI_Op_create( hypre_MPI_User_function *function, hypre_int commute,
                                hypre_MPI_Op *op );
-#if defined(HYPRE_USING_GPU) || defined(HYPRE_USING_DEVICE_OPENMP)
 HYPRE_Int hypre_MPI_Comm_split_type(hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key,
                                     hypre_MPI_Info info, hypre_MPI_Comm *newcomm);
+HYPRE_Int hypre_MPI_File_open( hypre_MPI_Comm comm, const char *filename, HYPRE_Int amode,
+                               hypre_MPI_Info info, hypre_MPI_File *fh );
+HYPRE_Int hypre_MPI_File_close( hypre_MPI_File *fh );
+HYPRE_Int hypre_MPI_File_set_size( hypre_MPI_File fh, hypre_MPI_Offset size );
+HYPRE_Int hypre_MPI_File_read_at_all( hypre_MPI_File fh, hypre_MPI_Offset offset, void *buf,
+                                      HYPRE_Int count, hypre_MPI_Datatype datatype,
+                                      hypre_MPI_Status *status );
+HYPRE_Int hypre_MPI_File_write_at_all( hypre_MPI_File fh, hypre_MPI_Offset offset, void *buf,
+                                       HYPRE_Int count, hypre_MPI_Datatype datatype,
+                                       hypre_MPI_Status *status );
+#if defined(HYPRE_USING_GPU) || defined(HYPRE_USING_DEVICE_OPENMP)
 HYPRE_Int hypre_MPI_Info_create(hypre_MPI_Info *info);
 HYPRE_Int hypre_MPI_Info_free( hypre_MPI_Info *info );
 #endif
@@ -1301,6 +1342,77 @@ extern hypre_MemoryTracker *_hypre_memory_tracker;
 #endif /* #if defined(HYPRE_USING_MEMORY_TRACKER) */
 #endif /* #ifndef hypre_MEMORY_TRACKER_HEADER */
 
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Host arena for short-lived scratch arrays
+ *
+ * Each thread bump-allocates from its own list of chunks, so scratch arrays
+ * do not go through the system allocator and threads do not contend for it.
+ * Freeing the most recent allocation of a thread gives its space back;
+ * anything else is reclaimed in bulk by hypre_HostArenaReset.
+ *
+ *****************************************************************************/
+
+#ifndef hypre_HOST_ARENA_HEADER
+#define hypre_HOST_ARENA_HEADER
+
+/* default size of the chunks requested from the system */
+#define HYPRE_HOST_ARENA_CHUNK_SIZE  (4 * 1024 * 1024)
+
+/* alignment of the arrays; also the size of the header preceding them */
+#define HYPRE_HOST_ARENA_ALIGN       16
+
+typedef struct hypre_HostArenaChunk_struct
+{
+   struct hypre_HostArenaChunk_struct  *next;
+   size_t                               size;   /* usable bytes after the chunk header */
+   size_t                               used;
+} hypre_HostArenaChunk;
+
+typedef struct
+{
+   hypre_HostArenaChunk  *first;
+   hypre_HostArenaChunk  *current;
+   size_t                 used_bytes;    /* bytes handed out since the last reset */
+   size_t                 peak_bytes;
+   char                   pad[64];       /* keep threads on separate cache lines */
+} hypre_HostArenaThread;
+
+typedef struct
+{
+   HYPRE_Int              num_threads;
+   size_t                 chunk_size;
+   hypre_HostArenaThread *threads;
+} hypre_HostArena;
+
+#define hypre_HostArenaNumThreads(arena)   ((arena) -> num_threads)
+#define hypre_HostArenaChunkSize(arena)    ((arena) -> chunk_size)
+#define hypre_HostArenaThreads(arena)      ((arena) -> threads)
+
+/*--------------------------------------------------------------------------
+ * Scratch arrays: host arrays that are freed by the routine allocating them.
+ * They come from the host arena when it is enabled (HYPRE_SetHostArena),
+ * and from hypre_MAlloc otherwise. They must be freed with
+ * hypre_TFreeScratch and must not be reallocated.
+ *--------------------------------------------------------------------------*/
+
+#define hypre_TAllocScratch(type, count) \
+( (type *) hypre_ScratchAlloc((size_t)(sizeof(type) * (count)), 0) )
+
+#define hypre_CTAllocScratch(type, count) \
+( (type *) hypre_ScratchAlloc((size_t)(sizeof(type) * (count)), 1) )
+
+#define hypre_TFreeScratch(ptr) \
+( hypre_ScratchFree((void *) ptr), ptr = NULL )
+
+#endif /* hypre_HOST_ARENA_HEADER */
 /******************************************************************************
  * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
  * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
@@ -1770,6 +1882,16 @@ typedef struct
    HYPRE_Int              struct_comm_recv_buffer_size;
    HYPRE_Int              struct_comm_send_buffer_size;
 
+   /* node-aware ParCSR halo exchange (0: off, 1: shared-memory nodes, n: n ranks) */
+   HYPRE_Int              node_aware_comm;
+
+   /* rows of dimension 1 per tile in the unit-stride host BoxLoops (0: no tiling) */
+   HYPRE_Int              box_tile;
+
+   /* host arena for scratch arrays (NULL if not used) */
+   hypre_HostArena       *host_arena;
+   size_t                 host_arena_chunk_size;
+
 #if defined(HYPRE_USING_GPU)
    hypre_DeviceData      *device_data;
    HYPRE_Int              device_gs_method; /* device G-S options */
@@ -1809,6 +1931,10 @@ typedef struct
 #define hypre_HandleStructCommSendBuffer(hypre_handle)           ((hypre_handle) -> struct_comm_send_buffer)
 #define hypre_HandleStructCommRecvBufferSize(hypre_handle)       ((hypre_handle) -> struct_comm_recv_buffer_size)
 #define hypre_HandleStructCommSendBufferSize(hypre_handle)       ((hypre_handle) -> struct_comm_send_buffer_size)
+#define hypre_HandleNodeAwareComm(hypre_handle)                  ((hypre_handle) -> node_aware_comm)
+#define hypre_HandleBoxTile(hypre_handle)                        ((hypre_handle) -> box_tile)
+#define hypre_HandleHostArena(hypre_handle)                      ((hypre_handle) -> host_arena)
+#define hypre_HandleHostArenaChunkSize(hypre_handle)             ((hypre_handle) -> host_arena_chunk_size)
 
 #define hypre_HandleDeviceData(hypre_handle)                     ((hypre_handle) -> device_data)
 #define hypre_HandleDeviceGSMethod(hypre_handle)                 ((hypre_handle) -> device_gs_method)
@@ -2363,6 +2489,17 @@ HYPRE_Int hypre_SetGaussSeidelMethod( HYPRE_Int gs_method );
 HYPRE_Int hypre_SetUserDeviceMalloc(GPUMallocFunc func);
 HYPRE_Int hypre_SetUserDeviceMfree(GPUMfreeFunc func);
 
+/* host_arena.c */
+hypre_HostArena *hypre_HostArenaCreate ( HYPRE_Int num_threads, size_t chunk_size );
+HYPRE_Int hypre_HostArenaRelease ( hypre_HostArena *arena );
+HYPRE_Int hypre_HostArenaReset ( hypre_HostArena *arena );
+HYPRE_Int hypre_HostArenaDestroy ( hypre_HostArena *arena );
+size_t hypre_HostArenaPeakBytes ( hypre_HostArena *arena );
+void *hypre_ScratchAlloc ( size_t size, HYPRE_Int zeroinit );
+void hypre_ScratchFree ( void *ptr );
+HYPRE_Int hypre_SetHostArena ( HYPRE_Int use_arena );
+HYPRE_Int hypre_SetHostArenaChunkSize ( size_t nbytes );
+
 /* int_array.c */
 hypre_IntArray* hypre_IntArrayCreate( HYPRE_Int size );
 HYPRE_Int hypre_IntArrayDestroy( hypre_IntArray *array );
@@ -3743,6 +3880,12 @@ HYPRE_Int hypre_mm_is_valid(MM_typecode matcode); /* too complex for a macro */
 HYPRE_Int hypre_mm_read_banner(FILE *f, MM_typecode *matcode);
 HYPRE_Int hypre_mm_read_mtx_crd_size(FILE *f, HYPRE_Int *M, HYPRE_Int *N, HYPRE_Int *nz);
 
+/* memory-mapped access and locale-independent parsing of coordinate entries */
+HYPRE_Int hypre_mm_map_file(const char *filename, char **data_ptr, size_t *size_ptr);
+HYPRE_Int hypre_mm_unmap_file(char *data, size_t size);
+const char *hypre_mm_parse_index(const char *p, const char *end, HYPRE_BigInt *val);
+const char *hypre_mm_parse_real(const char *p, const char *end, HYPRE_Real *val);
+
 /********************* MM_typecode query fucntions ***************************/
 
 #define hypre_mm_is_matrix(typecode)    ((typecode)[0]=='M')
@@ -57,6 +57,8 @@ hypre_HandleDestroy(hypre_Handle *hypre_handle_)
 
    hypre_TFree(hypre_HandleStructCommRecvBuffer(hypre_handle_), HYPRE_MEMORY_DEVICE);
    hypre_TFree(hypre_HandleStructCommSendBuffer(hypre_handle_), HYPRE_MEMORY_DEVICE);
+   hypre_HostArenaDestroy(hypre_HandleHostArena(hypre_handle_));
+   hypre_HandleHostArena(hypre_handle_) = NULL;
 #if defined(HYPRE_USING_GPU)
    hypre_DeviceDataDestroy(hypre_HandleDeviceData(hypre_handle_));
    hypre_HandleDeviceData(hypre_handle_) = NULL;
@@ -29,6 +29,16 @@ typedef struct
    HYPRE_Int              struct_comm_recv_buffer_size;
    HYPRE_Int              struct_comm_send_buffer_size;
 
+   /* node-aware ParCSR halo exchange (0: off, 1: shared-memory nodes, n: n ranks) */
+   HYPRE_Int              node_aware_comm;
+
+   /* rows of dimension 1 per tile in the unit-stride host BoxLoops (0: no tiling) */
+   HYPRE_Int              box_tile;
+
+   /* host arena for scratch arrays (NULL if not used) */
+   hypre_HostArena       *host_arena;
+   size_t                 host_arena_chunk_size;
+
 #if defined(HYPRE_USING_GPU)
    hypre_DeviceData      *device_data;
    HYPRE_Int              device_gs_method; /* device G-S options */
@@ -68,6 +78,10 @@ typedef struct
 #define hypre_HandleStructCommSendBuffer(hypre_handle)           ((hypre_handle) -> struct_comm_send_buffer)
 #define hypre_HandleStructCommRecvBufferSize(hypre_handle)       ((hypre_handle) -> struct_comm_recv_buffer_size)
 #define hypre_HandleStructCommSendBufferSize(hypre_handle)       ((hypre_handle) -> struct_comm_send_buffer_size)
+#define hypre_HandleNodeAwareComm(hypre_handle)                  ((hypre_handle) -> node_aware_comm)
+#define hypre_HandleBoxTile(hypre_handle)                        ((hypre_handle) -> box_tile)
+#define hypre_HandleHostArena(hypre_handle)                      ((hypre_handle) -> host_arena)
+#define hypre_HandleHostArenaChunkSize(hypre_handle)             ((hypre_handle) -> host_arena_chunk_size)
 
 #define hypre_HandleDeviceData(hypre_handle)                     ((hypre_handle) -> device_data)
 #define hypre_HandleDeviceGSMethod(hypre_handle)                 ((hypre_handle) -> device_gs_method)
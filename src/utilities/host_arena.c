@@ -0,0 +1,356 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Host arena for short-lived scratch arrays (see host_arena.h)
+ *
+ *****************************************************************************/
+
+#include "_hypre_utilities.h"
+
+/* defined in general.c; read directly so that scratch allocations do not
+   trigger the initialization checks of hypre_handle() */
+extern hypre_Handle *_hypre_handle;
+
+/* Header preceding each scratch array */
+typedef union
+{
+   struct
+   {
+      size_t     size;     /* bytes taken, header included */
+      HYPRE_Int  thread;   /* owning arena thread, or -1 if from hypre_MAlloc */
+   } info;
+   char          align[HYPRE_HOST_ARENA_ALIGN];
+} hypre_ScratchHeader;
+
+#define hypre_RoundUpArenaAlign(n) \
+   ( (((n) + HYPRE_HOST_ARENA_ALIGN - 1) / HYPRE_HOST_ARENA_ALIGN) * HYPRE_HOST_ARENA_ALIGN )
+
+#define HYPRE_SCRATCH_HEADER_SIZE  hypre_RoundUpArenaAlign(sizeof(hypre_ScratchHeader))
+#define HYPRE_ARENA_CHUNK_OFFSET   hypre_RoundUpArenaAlign(sizeof(hypre_HostArenaChunk))
+
+#define hypre_HostArenaChunkData(chunk)  ((char *) (chunk) + HYPRE_ARENA_CHUNK_OFFSET)
+
+/*--------------------------------------------------------------------------
+ * hypre_HostArenaCreate
+ *--------------------------------------------------------------------------*/
+
+hypre_HostArena *
+hypre_HostArenaCreate( HYPRE_Int num_threads,
+                       size_t    chunk_size )
+{
+   hypre_HostArena *arena;
+
+   arena = hypre_CTAlloc(hypre_HostArena, 1, HYPRE_MEMORY_HOST);
+
+   hypre_HostArenaNumThreads(arena) = hypre_max(num_threads, 1);
+   hypre_HostArenaChunkSize(arena)  = chunk_size > 0 ? chunk_size : HYPRE_HOST_ARENA_CHUNK_SIZE;
+   hypre_HostArenaThreads(arena)    = hypre_CTAlloc(hypre_HostArenaThread,
+                                                    hypre_HostArenaNumThreads(arena),
+                                                    HYPRE_MEMORY_HOST);
+
+   return arena;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_HostArenaRelease
+ *
+ * Returns the chunks of all threads to the system. No scratch array taken
+ * from the arena may be in use.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_HostArenaRelease( hypre_HostArena *arena )
+{
+   hypre_HostArenaThread *thread;
+   hypre_HostArenaChunk  *chunk, *next;
+   HYPRE_Int              t;
+
+   if (!arena)
+   {
+      return hypre_error_flag;
+   }
+
+   for (t = 0; t < hypre_HostArenaNumThreads(arena); t++)
+   {
+      thread = &hypre_HostArenaThreads(arena)[t];
+      for (chunk = thread->first; chunk; chunk = next)
+      {
+         next = chunk->next;
+         hypre_Free(chunk, HYPRE_MEMORY_HOST);
+      }
+      thread->first      = NULL;
+      thread->current    = NULL;
+      thread->used_bytes = 0;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_HostArenaReset
+ *
+ * Makes the whole arena available again while keeping its chunks. Must be
+ * called outside of parallel regions, when no scratch array taken from the
+ * arena is in use.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_HostArenaReset( hypre_HostArena *arena )
+{
+   hypre_HostArenaThread *thread;
+   hypre_HostArenaChunk  *chunk;
+   HYPRE_Int              t;
+
+   if (!arena)
+   {
+      return hypre_error_flag;
+   }
+
+   for (t = 0; t < hypre_HostArenaNumThreads(arena); t++)
+   {
+      thread = &hypre_HostArenaThreads(arena)[t];
+      for (chunk = thread->first; chunk; chunk = chunk->next)
+      {
+         chunk->used = 0;
+      }
+      thread->current    = thread->first;
+      thread->used_bytes = 0;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_HostArenaDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_HostArenaDestroy( hypre_HostArena *arena )
+{
+   if (arena)
+   {
+      hypre_HostArenaRelease(arena);
+      hypre_TFree(hypre_HostArenaThreads(arena), HYPRE_MEMORY_HOST);
+      hypre_TFree(arena, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_HostArenaPeakBytes
+ *
+ * Largest number of bytes handed out by the arena between two resets,
+ * summed over the threads.
+ *--------------------------------------------------------------------------*/
+
+size_t
+hypre_HostArenaPeakBytes( hypre_HostArena *arena )
+{
+   size_t     bytes = 0;
+   HYPRE_Int  t;
+
+   if (arena)
+   {
+      for (t = 0; t < hypre_HostArenaNumThreads(arena); t++)
+      {
+         bytes += hypre_HostArenaThreads(arena)[t].peak_bytes;
+      }
+   }
+
+   return bytes;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_HostArenaNextChunk
+ *
+ * Moves the thread to a chunk with at least nbytes free bytes: the next
+ * chunk kept from before the last reset if it is large enough, or a new
+ * chunk inserted after the current one.
+ *--------------------------------------------------------------------------*/
+
+static hypre_HostArenaChunk *
+hypre_HostArenaNextChunk( hypre_HostArena       *arena,
+                          hypre_HostArenaThread *thread,
+                          size_t                 nbytes )
+{
+   hypre_HostArenaChunk *current = thread->current;
+   hypre_HostArenaChunk *chunk;
+   size_t                size;
+
+   chunk = current ? current->next : thread->first;
+   if (!chunk || chunk->size < nbytes)
+   {
+      size  = hypre_max(hypre_HostArenaChunkSize(arena), nbytes);
+      chunk = (hypre_HostArenaChunk *) hypre_MAlloc(HYPRE_ARENA_CHUNK_OFFSET + size,
+                                                     HYPRE_MEMORY_HOST);
+      chunk->size = size;
+      if (current)
+      {
+         chunk->next   = current->next;
+         current->next = chunk;
+      }
+      else
+      {
+         chunk->next   = thread->first;
+         thread->first = chunk;
+      }
+   }
+   chunk->used     = 0;
+   thread->current = chunk;
+
+   return chunk;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ScratchAlloc
+ *
+ * Allocates a host scratch array from the arena of the calling thread, or
+ * with hypre_MAlloc when the arena is disabled or has no slot for the
+ * thread. Thread-safe since each thread only touches its own arena.
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_ScratchAlloc( size_t    size,
+                    HYPRE_Int zeroinit )
+{
+   hypre_HostArena       *arena;
+   hypre_HostArenaThread *thread;
+   hypre_HostArenaChunk  *chunk;
+   hypre_ScratchHeader   *header;
+   HYPRE_Int              t;
+   size_t                 nbytes;
+   void                  *ptr;
+
+   if (size == 0)
+   {
+      return NULL;
+   }
+
+   arena  = _hypre_handle ? hypre_HandleHostArena(_hypre_handle) : NULL;
+   t      = hypre_GetThreadNum();
+   nbytes = HYPRE_SCRATCH_HEADER_SIZE + hypre_RoundUpArenaAlign(size);
+
+   if (arena && t < hypre_HostArenaNumThreads(arena))
+   {
+      thread = &hypre_HostArenaThreads(arena)[t];
+      chunk  = thread->current;
+      if (!chunk || chunk->used + nbytes > chunk->size)
+      {
+         chunk = hypre_HostArenaNextChunk(arena, thread, nbytes);
+      }
+
+      header = (hypre_ScratchHeader *) (hypre_HostArenaChunkData(chunk) + chunk->used);
+      header->info.thread = t;
+      chunk->used        += nbytes;
+      thread->used_bytes += nbytes;
+      thread->peak_bytes  = hypre_max(thread->peak_bytes, thread->used_bytes);
+   }
+   else
+   {
+      header = (hypre_ScratchHeader *) hypre_MAlloc(nbytes, HYPRE_MEMORY_HOST);
+      header->info.thread = -1;
+   }
+   header->info.size = nbytes;
+
+   ptr = (void *) ((char *) header + HYPRE_SCRATCH_HEADER_SIZE);
+   if (zeroinit)
+   {
+      memset(ptr, 0, size);
+   }
+
+   return ptr;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ScratchFree
+ *
+ * Frees an array from hypre_ScratchAlloc. Arena space is given back right
+ * away only for the last array of the calling thread; the rest is reclaimed
+ * by hypre_HostArenaReset.
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_ScratchFree( void *ptr )
+{
+   hypre_HostArena       *arena;
+   hypre_HostArenaThread *thread;
+   hypre_HostArenaChunk  *chunk;
+   hypre_ScratchHeader   *header;
+   size_t                 nbytes;
+
+   if (!ptr)
+   {
+      return;
+   }
+
+   header = (hypre_ScratchHeader *) ((char *) ptr - HYPRE_SCRATCH_HEADER_SIZE);
+   if (header->info.thread < 0)
+   {
+      hypre_Free(header, HYPRE_MEMORY_HOST);
+      return;
+   }
+
+   arena = _hypre_handle ? hypre_HandleHostArena(_hypre_handle) : NULL;
+   if (!arena || header->info.thread != hypre_GetThreadNum())
+   {
+      return;
+   }
+
+   thread = &hypre_HostArenaThreads(arena)[header->info.thread];
+   chunk  = thread->current;
+   nbytes = header->info.size;
+   if (chunk && (char *) header + nbytes == hypre_HostArenaChunkData(chunk) + chunk->used)
+   {
+      chunk->used        -= nbytes;
+      thread->used_bytes -= nbytes;
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SetHostArena
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SetHostArena( HYPRE_Int use_arena )
+{
+   hypre_Handle *handle = hypre_handle();
+
+   if (use_arena && !hypre_HandleHostArena(handle))
+   {
+      hypre_HandleHostArena(handle) =
+         hypre_HostArenaCreate(hypre_NumThreads(), hypre_HandleHostArenaChunkSize(handle));
+   }
+   else if (!use_arena && hypre_HandleHostArena(handle))
+   {
+      hypre_HostArenaDestroy(hypre_HandleHostArena(handle));
+      hypre_HandleHostArena(handle) = NULL;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SetHostArenaChunkSize
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SetHostArenaChunkSize( size_t nbytes )
+{
+   hypre_Handle *handle = hypre_handle();
+
+   hypre_HandleHostArenaChunkSize(handle) = nbytes;
+   if (hypre_HandleHostArena(handle))
+   {
+      hypre_HostArenaChunkSize(hypre_HandleHostArena(handle)) =
+         nbytes > 0 ? nbytes : HYPRE_HOST_ARENA_CHUNK_SIZE;
+   }
+
+   return hypre_error_flag;
+}
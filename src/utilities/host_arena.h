@@ -0,0 +1,71 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Host arena for short-lived scratch arrays
+ *
+ * Each thread bump-allocates from its own list of chunks, so scratch arrays
+ * do not go through the system allocator and threads do not contend for it.
+ * Freeing the most recent allocation of a thread gives its space back;
+ * anything else is reclaimed in bulk by hypre_HostArenaReset.
+ *
+ *****************************************************************************/
+
+#ifndef hypre_HOST_ARENA_HEADER
+#define hypre_HOST_ARENA_HEADER
+
+/* default size of the chunks requested from the system */
+#define HYPRE_HOST_ARENA_CHUNK_SIZE  (4 * 1024 * 1024)
+
+/* alignment of the arrays; also the size of the header preceding them */
+#define HYPRE_HOST_ARENA_ALIGN       16
+
+typedef struct hypre_HostArenaChunk_struct
+{
+   struct hypre_HostArenaChunk_struct  *next;
+   size_t                               size;   /* usable bytes after the chunk header */
+   size_t                               used;
+} hypre_HostArenaChunk;
+
+typedef struct
+{
+   hypre_HostArenaChunk  *first;
+   hypre_HostArenaChunk  *current;
+   size_t                 used_bytes;    /* bytes handed out since the last reset */
+   size_t                 peak_bytes;
+   char                   pad[64];       /* keep threads on separate cache lines */
+} hypre_HostArenaThread;
+
+typedef struct
+{
+   HYPRE_Int              num_threads;
+   size_t                 chunk_size;
+   hypre_HostArenaThread *threads;
+} hypre_HostArena;
+
+#define hypre_HostArenaNumThreads(arena)   ((arena) -> num_threads)
+#define hypre_HostArenaChunkSize(arena)    ((arena) -> chunk_size)
+#define hypre_HostArenaThreads(arena)      ((arena) -> threads)
+
+/*--------------------------------------------------------------------------
+ * Scratch arrays: host arrays that are freed by the routine allocating them.
+ * They come from the host arena when it is enabled (HYPRE_SetHostArena),
+ * and from hypre_MAlloc otherwise. They must be freed with
+ * hypre_TFreeScratch and must not be reallocated.
+ *--------------------------------------------------------------------------*/
+
+#define hypre_TAllocScratch(type, count) \
+( (type *) hypre_ScratchAlloc((size_t)(sizeof(type) * (count)), 0) )
+
+#define hypre_CTAllocScratch(type, count) \
+( (type *) hypre_ScratchAlloc((size_t)(sizeof(type) * (count)), 1) )
+
+#define hypre_TFreeScratch(ptr) \
+( hypre_ScratchFree((void *) ptr), ptr = NULL )
+
+#endif /* hypre_HOST_ARENA_HEADER */
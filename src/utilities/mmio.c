@@ -18,6 +18,13 @@
 #include <ctype.h>
 #include "_hypre_utilities.h"
 
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 HYPRE_Int hypre_mm_is_valid(MM_typecode matcode)
 {
    if (!hypre_mm_is_matrix(matcode)) { return 0; }
@@ -173,3 +180,262 @@ HYPRE_Int hypre_mm_read_mtx_crd_size(FILE *f, HYPRE_Int *M, HYPRE_Int *N, HYPRE_
    return 0;
 }
 
+
+/*--------------------------------------------------------------------------
+ * hypre_mm_map_file
+ *
+ * Maps a whole file read-only into memory, so that pages are only loaded
+ * when (and where) they are parsed. Falls back to reading the file into a
+ * buffer where mmap is not available.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int hypre_mm_map_file(const char *filename, char **data_ptr, size_t *size_ptr)
+{
+   char   *data = NULL;
+   size_t  size;
+
+#if !defined(_WIN32)
+   struct stat  st;
+   int          fd;
+
+   if ((fd = open(filename, O_RDONLY)) < 0)
+   {
+      return MM_COULD_NOT_READ_FILE;
+   }
+   if (fstat(fd, &st) != 0)
+   {
+      close(fd);
+      return MM_COULD_NOT_READ_FILE;
+   }
+
+   size = (size_t) st.st_size;
+   if (size > 0)
+   {
+      data = (char *) mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (data == (char *) MAP_FAILED)
+      {
+         close(fd);
+         return MM_COULD_NOT_READ_FILE;
+      }
+#if defined(POSIX_MADV_SEQUENTIAL)
+      posix_madvise(data, size, POSIX_MADV_SEQUENTIAL);
+#endif
+   }
+   close(fd);
+#else
+   FILE   *f;
+   long    fsize;
+
+   if ((f = fopen(filename, "rb")) == NULL)
+   {
+      return MM_COULD_NOT_READ_FILE;
+   }
+   fseek(f, 0, SEEK_END);
+   fsize = ftell(f);
+   fseek(f, 0, SEEK_SET);
+
+   size = (fsize > 0) ? (size_t) fsize : 0;
+   if (size > 0)
+   {
+      data = (char *) malloc(size);
+      if (!data || fread(data, 1, size, f) != size)
+      {
+         free(data);
+         fclose(f);
+         return MM_COULD_NOT_READ_FILE;
+      }
+   }
+   fclose(f);
+#endif
+
+   *data_ptr = data;
+   *size_ptr = size;
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_mm_unmap_file
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int hypre_mm_unmap_file(char *data, size_t size)
+{
+   if (data)
+   {
+#if !defined(_WIN32)
+      munmap(data, size);
+#else
+      free(data);
+#endif
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_mm_parse_index
+ *
+ * Parses a nonnegative integer from [p, end), which need not be null
+ * terminated, after skipping blanks. The number must be followed by white
+ * space or by the end of the range. Returns a pointer past the number, or
+ * NULL if there is none.
+ *--------------------------------------------------------------------------*/
+
+const char *hypre_mm_parse_index(const char *p, const char *end, HYPRE_BigInt *val)
+{
+   const char   *start;
+   HYPRE_BigInt  v = 0;
+
+   while (p < end && (*p == ' ' || *p == '\t'))
+   {
+      p++;
+   }
+
+   start = p;
+   while (p < end && *p >= '0' && *p <= '9')
+   {
+      v = 10 * v + (HYPRE_BigInt) (*p - '0');
+      p++;
+   }
+
+   if (p == start || (p < end && !isspace((unsigned char) *p)))
+   {
+      return NULL;
+   }
+
+   *val = v;
+
+   return p;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_mm_parse_real
+ *
+ * Same as hypre_mm_parse_index for a floating point number, which does not
+ * depend on the locale. Numbers with at most 15 significant digits and a
+ * decimal exponent of at most 22 in magnitude are converted with a single
+ * correctly rounded operation; the few others go through strtod.
+ *--------------------------------------------------------------------------*/
+
+const char *hypre_mm_parse_real(const char *p, const char *end, HYPRE_Real *val)
+{
+   static const hypre_double pow10[] =
+   {
+      1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+      1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+   };
+
+   const char    *start;
+   char           token[MM_MAX_TOKEN_LENGTH];
+   hypre_uint64   mantissa = 0;
+   hypre_double   v;
+   HYPRE_Int      negative = 0, num_digits = 0, num_sig = 0;
+   HYPRE_Int      exp10 = 0, exp_value = 0, exp_negative = 0;
+   size_t         len, k;
+
+   while (p < end && (*p == ' ' || *p == '\t'))
+   {
+      p++;
+   }
+
+   start = p;
+   if (p < end && (*p == '+' || *p == '-'))
+   {
+      negative = (*p == '-');
+      p++;
+   }
+
+   /* integer part */
+   for (; p < end && *p >= '0' && *p <= '9'; p++, num_digits++)
+   {
+      if (mantissa || *p != '0')
+      {
+         if (++num_sig <= 19)
+         {
+            mantissa = 10 * mantissa + (hypre_uint64) (*p - '0');
+         }
+         else
+         {
+            exp10++;
+         }
+      }
+   }
+
+   /* fractional part */
+   if (p < end && *p == '.')
+   {
+      for (p++; p < end && *p >= '0' && *p <= '9'; p++, num_digits++)
+      {
+         if (mantissa || *p != '0')
+         {
+            if (++num_sig <= 19)
+            {
+               mantissa = 10 * mantissa + (hypre_uint64) (*p - '0');
+               exp10--;
+            }
+         }
+         else
+         {
+            exp10--;
+         }
+      }
+   }
+
+   if (!num_digits)
+   {
+      return NULL;
+   }
+
+   /* exponent, also accepting the Fortran 'd' */
+   if (p < end && (*p == 'e' || *p == 'E' || *p == 'd' || *p == 'D'))
+   {
+      p++;
+      if (p < end && (*p == '+' || *p == '-'))
+      {
+         exp_negative = (*p == '-');
+         p++;
+      }
+      if (p == end || *p < '0' || *p > '9')
+      {
+         return NULL;
+      }
+      for (; p < end && *p >= '0' && *p <= '9'; p++)
+      {
+         if (exp_value < 100000)
+         {
+            exp_value = 10 * exp_value + (HYPRE_Int) (*p - '0');
+         }
+      }
+      exp10 += exp_negative ? -exp_value : exp_value;
+   }
+
+   if (p < end && !isspace((unsigned char) *p))
+   {
+      return NULL;
+   }
+
+   if (num_sig <= 15 && exp10 >= -22 && exp10 <= 22)
+   {
+      v = (hypre_double) mantissa;
+      v = (exp10 < 0) ? v / pow10[-exp10] : v * pow10[exp10];
+      v = negative ? -v : v;
+   }
+   else
+   {
+      len = (size_t) (p - start);
+      if (len >= MM_MAX_TOKEN_LENGTH)
+      {
+         return NULL;
+      }
+      for (k = 0; k < len; k++)
+      {
+         token[k] = (start[k] == 'd' || start[k] == 'D') ? 'e' : start[k];
+      }
+      token[len] = '\0';
+      v = strtod(token, NULL);
+   }
+
+   *val = (HYPRE_Real) v;
+
+   return p;
+}
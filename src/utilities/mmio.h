@@ -26,6 +26,12 @@ HYPRE_Int hypre_mm_is_valid(MM_typecode matcode); /* too complex for a macro */
 HYPRE_Int hypre_mm_read_banner(FILE *f, MM_typecode *matcode);
 HYPRE_Int hypre_mm_read_mtx_crd_size(FILE *f, HYPRE_Int *M, HYPRE_Int *N, HYPRE_Int *nz);
 
+/* memory-mapped access and locale-independent parsing of coordinate entries */
+HYPRE_Int hypre_mm_map_file(const char *filename, char **data_ptr, size_t *size_ptr);
+HYPRE_Int hypre_mm_unmap_file(char *data, size_t size);
+const char *hypre_mm_parse_index(const char *p, const char *end, HYPRE_BigInt *val);
+const char *hypre_mm_parse_real(const char *p, const char *end, HYPRE_Real *val);
+
 /********************* MM_typecode query fucntions ***************************/
 
 #define hypre_mm_is_matrix(typecode)    ((typecode)[0]=='M')
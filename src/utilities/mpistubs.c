@@ -642,6 +642,19 @@ hypre_MPI_Allreduce( void              *sendbuf,
    return 0;
 }
 
+HYPRE_Int
+hypre_MPI_Iallreduce( void              *sendbuf,
+                      void              *recvbuf,
+                      HYPRE_Int          count,
+                      hypre_MPI_Datatype datatype,
+                      hypre_MPI_Op       op,
+                      hypre_MPI_Comm     comm,
+                      hypre_MPI_Request *request )
+{
+   *request = hypre_MPI_REQUEST_NULL;
+   return hypre_MPI_Allreduce(sendbuf, recvbuf, count, datatype, op, comm);
+}
+
 HYPRE_Int
 hypre_MPI_Reduce( void               *sendbuf,
                   void               *recvbuf,
@@ -735,13 +748,116 @@ hypre_MPI_Op_free( hypre_MPI_Op *op )
    return (0);
 }
 
-#if defined(HYPRE_USING_GPU)
 HYPRE_Int hypre_MPI_Comm_split_type( hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key,
                                      hypre_MPI_Info info, hypre_MPI_Comm *newcomm )
 {
+   *newcomm = comm;
+   return (0);
+}
+
+static size_t
+hypre_MPI_DatatypeSize( hypre_MPI_Datatype datatype )
+{
+   switch (datatype)
+   {
+      case hypre_MPI_INT:
+         return sizeof(HYPRE_Int);
+      case hypre_MPI_LONG_LONG_INT:
+         return sizeof(HYPRE_BigInt);
+      case hypre_MPI_FLOAT:
+         return sizeof(float);
+      case hypre_MPI_DOUBLE:
+         return sizeof(double);
+      case hypre_MPI_LONG_DOUBLE:
+         return sizeof(long double);
+      case hypre_MPI_LONG:
+         return sizeof(hypre_longint);
+      case hypre_MPI_REAL:
+         return sizeof(HYPRE_Real);
+      case hypre_MPI_COMPLEX:
+         return sizeof(HYPRE_Complex);
+      default:
+         return 1;
+   }
+}
+
+HYPRE_Int
+hypre_MPI_File_open( hypre_MPI_Comm   comm,
+                     const char      *filename,
+                     HYPRE_Int        amode,
+                     hypre_MPI_Info   info,
+                     hypre_MPI_File  *fh )
+{
+   *fh = fopen(filename, (amode & hypre_MPI_MODE_RDONLY) ? "rb" : "wb");
+
+   return (*fh == NULL);
+}
+
+HYPRE_Int
+hypre_MPI_File_close( hypre_MPI_File *fh )
+{
+   if (*fh)
+   {
+      fclose(*fh);
+      *fh = NULL;
+   }
+
+   return (0);
+}
+
+HYPRE_Int
+hypre_MPI_File_set_size( hypre_MPI_File    fh,
+                         hypre_MPI_Offset  size )
+{
+   /* files opened for writing are truncated by hypre_MPI_File_open */
    return (0);
 }
 
+HYPRE_Int
+hypre_MPI_File_read_at_all( hypre_MPI_File      fh,
+                            hypre_MPI_Offset    offset,
+                            void               *buf,
+                            HYPRE_Int           count,
+                            hypre_MPI_Datatype  datatype,
+                            hypre_MPI_Status   *status )
+{
+   size_t nbytes = (size_t) count * hypre_MPI_DatatypeSize(datatype);
+
+   if (nbytes == 0)
+   {
+      return (0);
+   }
+   if (fseek(fh, (long) offset, SEEK_SET))
+   {
+      return (1);
+   }
+
+   return (fread(buf, 1, nbytes, fh) != nbytes);
+}
+
+HYPRE_Int
+hypre_MPI_File_write_at_all( hypre_MPI_File      fh,
+                             hypre_MPI_Offset    offset,
+                             void               *buf,
+                             HYPRE_Int           count,
+                             hypre_MPI_Datatype  datatype,
+                             hypre_MPI_Status   *status )
+{
+   size_t nbytes = (size_t) count * hypre_MPI_DatatypeSize(datatype);
+
+   if (nbytes == 0)
+   {
+      return (0);
+   }
+   if (fseek(fh, (long) offset, SEEK_SET))
+   {
+      return (1);
+   }
+
+   return (fwrite(buf, 1, nbytes, fh) != nbytes);
+}
+
+#if defined(HYPRE_USING_GPU)
 HYPRE_Int hypre_MPI_Info_create( hypre_MPI_Info *info )
 {
    return (0);
@@ -1277,6 +1393,26 @@ hypre_MPI_Allreduce( void              *sendbuf,
    return result;
 }
 
+HYPRE_Int
+hypre_MPI_Iallreduce( void              *sendbuf,
+                      void              *recvbuf,
+                      HYPRE_Int          count,
+                      hypre_MPI_Datatype datatype,
+                      hypre_MPI_Op       op,
+                      hypre_MPI_Comm     comm,
+                      hypre_MPI_Request *request )
+{
+#if MPI_VERSION > 2
+   return (HYPRE_Int) MPI_Iallreduce(sendbuf, recvbuf, (hypre_int)count,
+                                     datatype, op, comm, request);
+#else
+   /* no non-blocking collectives before MPI-3: complete the reduction here */
+   *request = MPI_REQUEST_NULL;
+   return (HYPRE_Int) MPI_Allreduce(sendbuf, recvbuf, (hypre_int)count,
+                                    datatype, op, comm);
+#endif
+}
+
 HYPRE_Int
 hypre_MPI_Reduce( void               *sendbuf,
                   void               *recvbuf,
@@ -1399,7 +1535,6 @@ hypre_MPI_Op_create( hypre_MPI_User_function *function, hypre_int commute, hypre
    return (HYPRE_Int) MPI_Op_create(function, commute, op);
 }
 
-#if defined(HYPRE_USING_GPU) || defined(HYPRE_USING_DEVICE_OPENMP)
 HYPRE_Int
 hypre_MPI_Comm_split_type( hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key,
                            hypre_MPI_Info info, hypre_MPI_Comm *newcomm )
@@ -1407,6 +1542,55 @@ hypre_MPI_Comm_split_type( hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int
    return (HYPRE_Int) MPI_Comm_split_type(comm, split_type, key, info, newcomm );
 }
 
+HYPRE_Int
+hypre_MPI_File_open( hypre_MPI_Comm   comm,
+                     const char      *filename,
+                     HYPRE_Int        amode,
+                     hypre_MPI_Info   info,
+                     hypre_MPI_File  *fh )
+{
+   return (HYPRE_Int) MPI_File_open(comm, (char *) filename, (hypre_int) amode, info, fh);
+}
+
+HYPRE_Int
+hypre_MPI_File_close( hypre_MPI_File *fh )
+{
+   return (HYPRE_Int) MPI_File_close(fh);
+}
+
+HYPRE_Int
+hypre_MPI_File_set_size( hypre_MPI_File    fh,
+                         hypre_MPI_Offset  size )
+{
+   return (HYPRE_Int) MPI_File_set_size(fh, size);
+}
+
+/* A NULL status is passed to MPI as MPI_STATUS_IGNORE */
+HYPRE_Int
+hypre_MPI_File_read_at_all( hypre_MPI_File      fh,
+                            hypre_MPI_Offset    offset,
+                            void               *buf,
+                            HYPRE_Int           count,
+                            hypre_MPI_Datatype  datatype,
+                            hypre_MPI_Status   *status )
+{
+   return (HYPRE_Int) MPI_File_read_at_all(fh, offset, buf, (hypre_int) count, datatype,
+                                           status ? status : MPI_STATUS_IGNORE);
+}
+
+HYPRE_Int
+hypre_MPI_File_write_at_all( hypre_MPI_File      fh,
+                             hypre_MPI_Offset    offset,
+                             void               *buf,
+                             HYPRE_Int           count,
+                             hypre_MPI_Datatype  datatype,
+                             hypre_MPI_Status   *status )
+{
+   return (HYPRE_Int) MPI_File_write_at_all(fh, offset, buf, (hypre_int) count, datatype,
+                                            status ? status : MPI_STATUS_IGNORE);
+}
+
+#if defined(HYPRE_USING_GPU) || defined(HYPRE_USING_DEVICE_OPENMP)
 HYPRE_Int
 hypre_MPI_Info_create( hypre_MPI_Info *info )
 {
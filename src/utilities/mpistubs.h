@@ -39,6 +39,8 @@ extern "C" {
 #define MPI_Op              hypre_MPI_Op
 #define MPI_Aint            hypre_MPI_Aint
 #define MPI_Info            hypre_MPI_Info
+#define MPI_File            hypre_MPI_File
+#define MPI_Offset          hypre_MPI_Offset
 
 #define MPI_COMM_WORLD       hypre_MPI_COMM_WORLD
 #define MPI_COMM_NULL        hypre_MPI_COMM_NULL
@@ -75,6 +77,10 @@ extern "C" {
 #define MPI_ANY_TAG         hypre_MPI_ANY_TAG
 #define MPI_SOURCE          hypre_MPI_SOURCE
 #define MPI_TAG             hypre_MPI_TAG
+#define MPI_FILE_NULL       hypre_MPI_FILE_NULL
+#define MPI_MODE_RDONLY     hypre_MPI_MODE_RDONLY
+#define MPI_MODE_WRONLY     hypre_MPI_MODE_WRONLY
+#define MPI_MODE_CREATE     hypre_MPI_MODE_CREATE
 
 #define MPI_Init            hypre_MPI_Init
 #define MPI_Finalize        hypre_MPI_Finalize
@@ -119,6 +125,7 @@ extern "C" {
 #define MPI_Waitall         hypre_MPI_Waitall
 #define MPI_Waitany         hypre_MPI_Waitany
 #define MPI_Allreduce       hypre_MPI_Allreduce
+#define MPI_Iallreduce      hypre_MPI_Iallreduce
 #define MPI_Reduce          hypre_MPI_Reduce
 #define MPI_Scan            hypre_MPI_Scan
 #define MPI_Request_free    hypre_MPI_Request_free
@@ -132,6 +139,11 @@ extern "C" {
 #define MPI_Op_create       hypre_MPI_Op_create
 #define MPI_User_function   hypre_MPI_User_function
 #define MPI_Info_create     hypre_MPI_Info_create
+#define MPI_File_open       hypre_MPI_File_open
+#define MPI_File_close      hypre_MPI_File_close
+#define MPI_File_set_size   hypre_MPI_File_set_size
+#define MPI_File_read_at_all  hypre_MPI_File_read_at_all
+#define MPI_File_write_at_all hypre_MPI_File_write_at_all
 
 /*--------------------------------------------------------------------------
  * Types, etc.
@@ -154,6 +166,10 @@ typedef HYPRE_Int  hypre_MPI_Op;
 typedef HYPRE_Int  hypre_MPI_Aint;
 typedef HYPRE_Int  hypre_MPI_Info;
 
+/* MPI-IO files are accessed with stdio */
+typedef FILE          *hypre_MPI_File;
+typedef long long int  hypre_MPI_Offset;
+
 #define  hypre_MPI_COMM_SELF   1
 #define  hypre_MPI_COMM_WORLD  0
 #define  hypre_MPI_COMM_NULL  -1
@@ -187,6 +203,11 @@ typedef HYPRE_Int  hypre_MPI_Info;
 #define  hypre_MPI_ANY_SOURCE    1
 #define  hypre_MPI_ANY_TAG       1
 
+#define  hypre_MPI_FILE_NULL     NULL
+#define  hypre_MPI_MODE_RDONLY   1
+#define  hypre_MPI_MODE_WRONLY   2
+#define  hypre_MPI_MODE_CREATE   4
+
 #else
 
 /******************************************************************************
@@ -202,6 +223,8 @@ typedef MPI_Op       hypre_MPI_Op;
 typedef MPI_Aint     hypre_MPI_Aint;
 typedef MPI_Info     hypre_MPI_Info;
 typedef MPI_User_function    hypre_MPI_User_function;
+typedef MPI_File     hypre_MPI_File;
+typedef MPI_Offset   hypre_MPI_Offset;
 
 #define  hypre_MPI_COMM_WORLD         MPI_COMM_WORLD
 #define  hypre_MPI_COMM_NULL          MPI_COMM_NULL
@@ -238,6 +261,11 @@ typedef MPI_User_function    hypre_MPI_User_function;
 #define  hypre_MPI_TAG             MPI_TAG
 #define  hypre_MPI_LAND            MPI_LAND
 
+#define  hypre_MPI_FILE_NULL       MPI_FILE_NULL
+#define  hypre_MPI_MODE_RDONLY     MPI_MODE_RDONLY
+#define  hypre_MPI_MODE_WRONLY     MPI_MODE_WRONLY
+#define  hypre_MPI_MODE_CREATE     MPI_MODE_CREATE
+
 #endif
 
 /******************************************************************************
@@ -321,6 +349,9 @@ HYPRE_Int hypre_MPI_Waitany( HYPRE_Int count, hypre_MPI_Request *array_of_reques
                              HYPRE_Int *index, hypre_MPI_Status *status );
 HYPRE_Int hypre_MPI_Allreduce( void *sendbuf, void *recvbuf, HYPRE_Int count,
                                hypre_MPI_Datatype datatype, hypre_MPI_Op op, hypre_MPI_Comm comm );
+HYPRE_Int hypre_MPI_Iallreduce( void *sendbuf, void *recvbuf, HYPRE_Int count,
+                                hypre_MPI_Datatype datatype, hypre_MPI_Op op, hypre_MPI_Comm comm,
+                                hypre_MPI_Request *request );
 HYPRE_Int hypre_MPI_Reduce( void *sendbuf, void *recvbuf, HYPRE_Int count,
                             hypre_MPI_Datatype datatype, hypre_MPI_Op op, HYPRE_Int root, hypre_MPI_Comm comm );
 HYPRE_Int hypre_MPI_Scan( void *sendbuf, void *recvbuf, HYPRE_Int count,
@@ -340,9 +371,19 @@ HYPRE_Int hypre_MPI_Type_free( hypre_MPI_Datatype *datatype );
 HYPRE_Int hypre_MPI_Op_free( hypre_MPI_Op *op );
 HYPRE_Int hypre_MPI_Op_create( hypre_MPI_User_function *function, hypre_int commute,
                                hypre_MPI_Op *op );
-#if defined(HYPRE_USING_GPU) || defined(HYPRE_USING_DEVICE_OPENMP)
 HYPRE_Int hypre_MPI_Comm_split_type(hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key,
                                     hypre_MPI_Info info, hypre_MPI_Comm *newcomm);
+HYPRE_Int hypre_MPI_File_open( hypre_MPI_Comm comm, const char *filename, HYPRE_Int amode,
+                               hypre_MPI_Info info, hypre_MPI_File *fh );
+HYPRE_Int hypre_MPI_File_close( hypre_MPI_File *fh );
+HYPRE_Int hypre_MPI_File_set_size( hypre_MPI_File fh, hypre_MPI_Offset size );
+HYPRE_Int hypre_MPI_File_read_at_all( hypre_MPI_File fh, hypre_MPI_Offset offset, void *buf,
+                                      HYPRE_Int count, hypre_MPI_Datatype datatype,
+                                      hypre_MPI_Status *status );
+HYPRE_Int hypre_MPI_File_write_at_all( hypre_MPI_File fh, hypre_MPI_Offset offset, void *buf,
+                                       HYPRE_Int count, hypre_MPI_Datatype datatype,
+                                       hypre_MPI_Status *status );
+#if defined(HYPRE_USING_GPU) || defined(HYPRE_USING_DEVICE_OPENMP)
 HYPRE_Int hypre_MPI_Info_create(hypre_MPI_Info *info);
 HYPRE_Int hypre_MPI_Info_free( hypre_MPI_Info *info );
 #endif
@@ -389,6 +389,17 @@ HYPRE_Int hypre_SetGaussSeidelMethod( HYPRE_Int gs_method );
 HYPRE_Int hypre_SetUserDeviceMalloc(GPUMallocFunc func);
 HYPRE_Int hypre_SetUserDeviceMfree(GPUMfreeFunc func);
 
+/* host_arena.c */
+hypre_HostArena *hypre_HostArenaCreate ( HYPRE_Int num_threads, size_t chunk_size );
+HYPRE_Int hypre_HostArenaRelease ( hypre_HostArena *arena );
+HYPRE_Int hypre_HostArenaReset ( hypre_HostArena *arena );
+HYPRE_Int hypre_HostArenaDestroy ( hypre_HostArena *arena );
+size_t hypre_HostArenaPeakBytes ( hypre_HostArena *arena );
+void *hypre_ScratchAlloc ( size_t size, HYPRE_Int zeroinit );
+void hypre_ScratchFree ( void *ptr );
+HYPRE_Int hypre_SetHostArena ( HYPRE_Int use_arena );
+HYPRE_Int hypre_SetHostArenaChunkSize ( size_t nbytes );
+
 /* int_array.c */
 hypre_IntArray* hypre_IntArrayCreate( HYPRE_Int size );
 HYPRE_Int hypre_IntArrayDestroy( hypre_IntArray *array );